@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "i2s_multiline_adpcm.h"
+
+/* 解码表项：高位为带符号的量化差值，低12位为下一个步长索引乘16，即下一个采样的表行偏移 */
+#define ADPCM_DIFF_SHIFT        (12U)
+#define ADPCM_NEXT_MASK         ((1UL << ADPCM_DIFF_SHIFT) - 1U)
+
+static const int16_t adpcm_step_table[I2S_MULTILINE_ADPCM_STEP_NUM] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t adpcm_index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/* 每个步长索引16项，按编码值索引 */
+static uint32_t adpcm_decode_table[I2S_MULTILINE_ADPCM_STEP_NUM * 16U];
+static bool adpcm_table_ready;
+
+static inline int32_t adpcm_clamp_sample(int32_t v)
+{
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return v;
+}
+
+static inline uint8_t adpcm_next_index(uint8_t index, uint8_t code)
+{
+    int32_t next = (int32_t)index + adpcm_index_table[code & 7U];
+
+    if (next < 0) {
+        return 0;
+    }
+    if (next >= (int32_t)I2S_MULTILINE_ADPCM_STEP_NUM) {
+        return I2S_MULTILINE_ADPCM_STEP_NUM - 1U;
+    }
+    return (uint8_t)next;
+}
+
+/* 标准IMA算法的量化差值，编码器和解码表共用 */
+static inline int32_t adpcm_diff(uint8_t index, uint8_t code)
+{
+    int32_t step = adpcm_step_table[index];
+    int32_t diff = step >> 3;
+
+    if (code & 4U) {
+        diff += step;
+    }
+    if (code & 2U) {
+        diff += step >> 1;
+    }
+    if (code & 1U) {
+        diff += step >> 2;
+    }
+    return (code & 8U) ? -diff : diff;
+}
+
+static void adpcm_build_table(void)
+{
+    for (uint8_t index = 0; index < I2S_MULTILINE_ADPCM_STEP_NUM; index++) {
+        for (uint8_t code = 0; code < 16U; code++) {
+            adpcm_decode_table[index * 16U + code] = ((uint32_t)adpcm_diff(index, code) << ADPCM_DIFF_SHIFT) |
+                                                     ((uint32_t)adpcm_next_index(index, code) * 16U);
+        }
+    }
+    adpcm_table_ready = true;
+}
+
+static inline uint8_t adpcm_header_index(const uint8_t *header)
+{
+    /* 块头损坏时限制在表内 */
+    return (header[2] < I2S_MULTILINE_ADPCM_STEP_NUM) ? header[2] : (I2S_MULTILINE_ADPCM_STEP_NUM - 1U);
+}
+
+hpm_stat_t i2s_multiline_adpcm_init(i2s_multiline_adpcm_t *adpcm, const i2s_multiline_adpcm_config_t *config)
+{
+    uint8_t line_num = config->line_num;
+    uint8_t cpl = config->channel_per_line;
+
+    if ((line_num == 0U) || (line_num > 4U) || (cpl == 0U) ||
+        ((uint32_t)line_num * cpl > I2S_MULTILINE_ADPCM_MAX_CHANNEL) ||
+        (config->block_frames == 0U) || ((config->block_frames % 8U) != 0U)) {
+        return status_invalid_argument;
+    }
+
+    adpcm->config = *config;
+    adpcm->channel_num = line_num * cpl;
+    adpcm->channel_block_bytes = I2S_MULTILINE_ADPCM_CHANNEL_BLOCK_BYTES(config->block_frames);
+    adpcm->block_bytes = adpcm->channel_block_bytes * adpcm->channel_num;
+    for (uint8_t line = 0; line < line_num; line++) {
+        for (uint8_t slot = 0; slot < cpl; slot++) {
+            adpcm->out_index[line * cpl + slot] = slot * line_num + line;
+        }
+    }
+
+    if (!adpcm_table_ready) {
+        adpcm_build_table();
+    }
+    return status_success;
+}
+
+void i2s_multiline_adpcm_reset_state(const i2s_multiline_adpcm_t *adpcm, i2s_multiline_adpcm_state_t state[])
+{
+    for (uint8_t ch = 0; ch < adpcm->channel_num; ch++) {
+        state[ch].predictor = 0;
+        state[ch].index = 0;
+    }
+}
+
+static uint8_t adpcm_encode_sample(i2s_multiline_adpcm_state_t *state, int16_t sample)
+{
+    int32_t diff = (int32_t)sample - state->predictor;
+    int32_t step = adpcm_step_table[state->index];
+    uint8_t code = 0;
+
+    if (diff < 0) {
+        code = 8U;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        code |= 4U;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 2U;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 1U;
+    }
+
+    /* 预测值按解码器的算法更新，保证编解码两端一致 */
+    state->predictor = (int16_t)adpcm_clamp_sample(state->predictor + adpcm_diff(state->index, code));
+    state->index = adpcm_next_index(state->index, code);
+    return code;
+}
+
+void i2s_multiline_adpcm_encode(const i2s_multiline_adpcm_t *adpcm, uint8_t *dst, const int16_t *const src[],
+                                uint32_t first_frame, uint32_t blocks, i2s_multiline_adpcm_state_t state[])
+{
+    uint32_t block_frames = adpcm->config.block_frames;
+    const int16_t *s;
+    uint8_t lo;
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        for (uint8_t ch = 0; ch < adpcm->channel_num; ch++) {
+            s = src[ch] + first_frame + b * block_frames;
+            dst[0] = (uint8_t)((uint16_t)state[ch].predictor & 0xFFU);
+            dst[1] = (uint8_t)((uint16_t)state[ch].predictor >> 8);
+            dst[2] = state[ch].index;
+            dst[3] = 0;
+            dst += I2S_MULTILINE_ADPCM_HEADER_BYTES;
+            for (uint32_t f = 0; f < block_frames; f += 2U) {
+                lo = adpcm_encode_sample(&state[ch], s[f]);
+                *dst++ = lo | (uint8_t)(adpcm_encode_sample(&state[ch], s[f + 1U]) << 4);
+            }
+        }
+    }
+}
+
+/* 解码一个声道块，预测值和表行偏移保存在寄存器中，每个采样一次查表 */
+static inline void adpcm_decode_channel(uint32_t *dst, uint32_t stride, const uint8_t *src, uint32_t block_frames)
+{
+    const uint32_t *table = adpcm_decode_table;
+    int32_t predictor = (int16_t)((uint16_t)src[0] | ((uint16_t)src[1] << 8));
+    uint32_t row = (uint32_t)adpcm_header_index(src) * 16U;
+    uint32_t e;
+    uint8_t byte;
+
+    src += I2S_MULTILINE_ADPCM_HEADER_BYTES;
+    for (uint32_t f = 0; f < block_frames; f += 2U) {
+        byte = *src++;
+
+        e = table[row + (byte & 0x0FU)];
+        predictor = adpcm_clamp_sample(predictor + ((int32_t)e >> ADPCM_DIFF_SHIFT));
+        row = e & ADPCM_NEXT_MASK;
+        dst[0] = (uint32_t)predictor << 16;
+
+        e = table[row + (byte >> 4)];
+        predictor = adpcm_clamp_sample(predictor + ((int32_t)e >> ADPCM_DIFF_SHIFT));
+        row = e & ADPCM_NEXT_MASK;
+        dst[stride] = (uint32_t)predictor << 16;
+
+        dst += 2U * stride;
+    }
+}
+
+void i2s_multiline_adpcm_decode(const i2s_multiline_adpcm_t *adpcm, uint32_t *dst, const uint8_t *src,
+                                uint32_t blocks)
+{
+    uint32_t block_frames = adpcm->config.block_frames;
+    uint8_t n = adpcm->channel_num;
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        for (uint8_t ch = 0; ch < n; ch++) {
+            adpcm_decode_channel(dst + adpcm->out_index[ch], n, src, block_frames);
+            src += adpcm->channel_block_bytes;
+        }
+        dst += block_frames * n;
+    }
+}
+
+/*
+ * 参考解码：按IMA ADPCM标准的步骤逐个采样计算，不使用解码表和编码器的公共函数，
+ * 用于独立校验解码表的展开
+ */
+void i2s_multiline_adpcm_decode_ref(const i2s_multiline_adpcm_t *adpcm, uint32_t *dst, const uint8_t *src,
+                                    uint32_t blocks)
+{
+    static const int8_t index_adjust[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+    uint32_t block_frames = adpcm->config.block_frames;
+    uint8_t n = adpcm->channel_num;
+    uint8_t line_num = adpcm->config.line_num;
+    uint8_t cpl = adpcm->config.channel_per_line;
+    const uint8_t *p;
+    int32_t predictor;
+    int32_t index;
+    int32_t step;
+    int32_t vpdiff;
+    uint8_t code;
+    uint8_t ch;
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        for (uint8_t line = 0; line < line_num; line++) {
+            for (uint8_t slot = 0; slot < cpl; slot++) {
+                ch = line * cpl + slot;
+                p = src + (b * n + ch) * adpcm->channel_block_bytes;
+                predictor = (int16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8));
+                index = (p[2] > 88U) ? 88 : p[2];
+                p += I2S_MULTILINE_ADPCM_HEADER_BYTES;
+                for (uint32_t f = 0; f < block_frames; f++) {
+                    code = (f & 1U) ? (p[f / 2U] >> 4) : (p[f / 2U] & 0x0FU);
+
+                    /* 1. 由步长和编码值的低3位计算差值 */
+                    step = adpcm_step_table[index];
+                    vpdiff = step >> 3;
+                    if (code & 4U) {
+                        vpdiff += step;
+                    }
+                    if (code & 2U) {
+                        vpdiff += step >> 1;
+                    }
+                    if (code & 1U) {
+                        vpdiff += step >> 2;
+                    }
+
+                    /* 2. 按符号位更新预测值并饱和到16位 */
+                    if (code & 8U) {
+                        predictor -= vpdiff;
+                    } else {
+                        predictor += vpdiff;
+                    }
+                    if (predictor > 32767) {
+                        predictor = 32767;
+                    } else if (predictor < -32768) {
+                        predictor = -32768;
+                    }
+
+                    /* 3. 调整步长索引并限制在0 ~ 88 */
+                    index += index_adjust[code];
+                    if (index < 0) {
+                        index = 0;
+                    } else if (index > 88) {
+                        index = 88;
+                    }
+
+                    /* 输出为burst顺序：第f帧的slot时隙、line数据线 */
+                    dst[(b * block_frames + f) * n + slot * line_num + line] = (uint32_t)predictor << 16;
+                }
+            }
+        }
+    }
+}
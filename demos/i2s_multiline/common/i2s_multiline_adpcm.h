@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_ADPCM_H
+#define I2S_MULTILINE_ADPCM_H
+
+/*
+ * 多声道IMA-ADPCM编解码，用于压缩存放在NOR Flash中的音频
+ *
+ * 16位采样压缩为4位，加上块头后约为32位PCM的1/7.75。数据按块存放，每块包含所有声道的block_frames帧：
+ * 依次为声道0、声道1 ...的声道块，每个声道块为4字节块头(小端int16预测值、uint8步长索引、保留字节)
+ * 和block_frames/2字节的编码数据(每字节低4位在前)。块头为解码该块第一个采样前的状态，不单独输出采样，
+ * 因此每块正好输出block_frames帧，块之间互不依赖，可以从任意块开始播放，Flash读错也只影响一块。
+ *
+ * 解码直接输出I2S发送所需的burst顺序：每帧依次为slot0的line0..lineN-1、slot1的line0..lineN-1 ...，
+ * 每个采样左对齐到32位，声道编号为 line * channel_per_line + slot，与i2s_multiline_pack一致。
+ * 量化差值和下一个步长索引在初始化时按标准IMA算法展开成表，每个采样只需两次查表、一次加法和饱和，
+ * 结果与标准算法逐位一致。i2s_multiline_adpcm_decode_ref为按标准算法逐位计算的参考实现，用于校验。
+ *
+ * 只依赖hpm_common.h中的基本类型和状态码，可以在主机上编译，与编码器组合做逐位一致性测试。
+ */
+
+#include "hpm_common.h"
+
+#define I2S_MULTILINE_ADPCM_MAX_CHANNEL     (64U)   /* 4条数据线，每条16个TDM时隙 */
+#define I2S_MULTILINE_ADPCM_HEADER_BYTES    (4U)
+#define I2S_MULTILINE_ADPCM_STEP_NUM        (89U)
+
+/* 一个声道块的字节数 */
+#define I2S_MULTILINE_ADPCM_CHANNEL_BLOCK_BYTES(block_frames) \
+    (I2S_MULTILINE_ADPCM_HEADER_BYTES + (block_frames) / 2U)
+
+typedef struct {
+    uint8_t line_num;               /* 数据线数 (1 ~ 4) */
+    uint8_t channel_per_line;       /* 每条数据线每帧的通道数 */
+    uint16_t block_frames;          /* 每块的帧数，8的倍数 */
+} i2s_multiline_adpcm_config_t;
+
+/* 单个声道的编解码状态 */
+typedef struct {
+    int16_t predictor;
+    uint8_t index;
+} i2s_multiline_adpcm_state_t;
+
+typedef struct {
+    i2s_multiline_adpcm_config_t config;
+    uint8_t channel_num;            /* 声道总数 */
+    uint32_t channel_block_bytes;   /* 每个声道块的字节数 */
+    uint32_t block_bytes;           /* 每块的字节数 */
+    uint8_t out_index[I2S_MULTILINE_ADPCM_MAX_CHANNEL];    /* 声道在输出帧中的位置 */
+} i2s_multiline_adpcm_t;
+
+hpm_stat_t i2s_multiline_adpcm_init(i2s_multiline_adpcm_t *adpcm, const i2s_multiline_adpcm_config_t *config);
+
+/* 初始化编码状态：预测值为0，步长索引为0 */
+void i2s_multiline_adpcm_reset_state(const i2s_multiline_adpcm_t *adpcm, i2s_multiline_adpcm_state_t state[]);
+
+/*
+ * 编码blocks块：src[ch]为第ch个声道的平面int16_t缓冲区，从其第first_frame帧开始读取，
+ * state[ch]为各声道的编码状态，跨调用连续编码时保留。dst需能容纳 blocks * block_bytes 字节
+ */
+void i2s_multiline_adpcm_encode(const i2s_multiline_adpcm_t *adpcm, uint8_t *dst, const int16_t *const src[],
+                                uint32_t first_frame, uint32_t blocks, i2s_multiline_adpcm_state_t state[]);
+
+/*
+ * 解码blocks块：src为blocks * block_bytes字节的压缩数据，
+ * dst为burst顺序的输出，需能容纳 blocks * block_frames * channel_num 个32位字
+ */
+void i2s_multiline_adpcm_decode(const i2s_multiline_adpcm_t *adpcm, uint32_t *dst, const uint8_t *src,
+                                uint32_t blocks);
+
+/* 参考解码，按标准IMA算法逐步计算，不使用解码表和编码器的函数，参数和输出与i2s_multiline_adpcm_decode相同 */
+void i2s_multiline_adpcm_decode_ref(const i2s_multiline_adpcm_t *adpcm, uint32_t *dst, const uint8_t *src,
+                                    uint32_t blocks);
+
+#endif /* I2S_MULTILINE_ADPCM_H */
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_capture.h"
+
+/* 描述符及缓冲区地址转换为DMA可访问的系统地址 */
+#define CAPTURE_SYS_ADDR(ptr)   core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)(ptr))
+
+/* 位置在环内的帧序号，相对slot_base取模，与发送流相同，计数在2^32处回绕时映射保持连续 */
+static inline uint32_t capture_slot(i2s_multiline_capture_t *capture, uint32_t pos)
+{
+    return (pos - capture->slot_base) % capture->ring_frames;
+}
+
+static inline uint8_t *capture_line_addr(i2s_multiline_capture_t *capture, uint8_t line, uint32_t pos)
+{
+    return (uint8_t *)capture->config.buffer[line] + capture_slot(capture, pos) * capture->frame_bytes;
+}
+
+/*
+ * 写位置领先slot_base超过2^31帧时将其前移整数个环，并保持在写位置之前至少一个环；
+ * 读位置不落后写位置超过一个环，消费者读到前移前后的任一值得到的帧序号相同
+ */
+static void capture_rebase(i2s_multiline_capture_t *capture)
+{
+    uint32_t ahead = capture->write_pos - capture->slot_base;
+
+    if (ahead >= 0x80000000UL) {
+        capture->slot_base += (ahead / capture->ring_frames - 1U) * capture->ring_frames;
+    }
+}
+
+/* 在[from, to)帧填充静音，区间不跨越周期边界，在环内连续 */
+static void capture_fill_silence(i2s_multiline_capture_t *capture, uint32_t from, uint32_t to)
+{
+    for (uint8_t ring = 0; ring < capture->ring_num; ring++) {
+        memset(capture_line_addr(capture, ring, from), 0, (to - from) * capture->frame_bytes);
+    }
+}
+
+static uint8_t capture_burst_size(uint8_t line_num)
+{
+    switch (line_num) {
+    case 1:
+        return DMA_NUM_TRANSFER_PER_BURST_1T;
+    case 2:
+        return DMA_NUM_TRANSFER_PER_BURST_2T;
+    default:
+        return DMA_NUM_TRANSFER_PER_BURST_4T;
+    }
+}
+
+/* 配置通道及循环链表描述符，通道本身承担第start_period个周期 */
+static hpm_stat_t capture_config_line_dma(i2s_multiline_capture_t *capture, uint8_t line, uint8_t start_period)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+    dma_channel_config_t ch_config;
+    uint32_t period_bytes = cfg->period_frames * capture->frame_bytes;
+    uint8_t *buffer = (uint8_t *)cfg->buffer[line];
+    uint8_t data_width;
+    uint8_t data_shift_byte;
+    hpm_stat_t stat;
+
+    /* 有效数据位于RXD的高位，16位数据从RXD的高半字读取 */
+    if (capture->sample_bytes == 2U) {
+        data_width = DMA_TRANSFER_WIDTH_HALF_WORD;
+        data_shift_byte = 2U;
+    } else {
+        data_width = DMA_TRANSFER_WIDTH_WORD;
+        data_shift_byte = 0U;
+    }
+
+    dma_default_channel_config(cfg->dma, &ch_config);
+    ch_config.src_addr = (uint32_t)&cfg->i2s->RXD[line] + data_shift_byte;
+    ch_config.src_width = data_width;
+    ch_config.dst_width = data_width;
+    ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_FIXED;
+    ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+    ch_config.size_in_byte = period_bytes;
+    ch_config.src_mode = DMA_HANDSHAKE_MODE_HANDSHAKE;
+    if (cfg->engine == i2s_multiline_engine_burst_dma) {
+        /* 一个burst依次读取RXD[0..line_num-1]，然后回到RXD[0] */
+        ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+        ch_config.en_src_burst_in_fixed_trans = true;
+        ch_config.src_burst_size = capture_burst_size(cfg->line_num);
+    }
+    /* 各通道同步运行，只由第0个通道产生周期中断，其余通道只报告错误 */
+    if (line == 0U) {
+        ch_config.interrupt_mask = DMA_INTERRUPT_MASK_NONE;
+    } else {
+        ch_config.interrupt_mask = DMA_INTERRUPT_MASK_TERMINAL_COUNT | DMA_INTERRUPT_MASK_HALF_TC;
+    }
+
+    /* 每个周期一个描述符，最后一个指回第一个形成环 */
+    for (uint8_t p = 0; p < cfg->period_num; p++) {
+        ch_config.dst_addr = CAPTURE_SYS_ADDR(buffer + p * period_bytes);
+        ch_config.linked_ptr = CAPTURE_SYS_ADDR(&capture->desc[line][(p + 1U) % cfg->period_num]);
+        stat = dma_config_linked_descriptor(cfg->dma, &capture->desc[line][p], cfg->dma_channel[line], &ch_config);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    ch_config.dst_addr = CAPTURE_SYS_ADDR(buffer + start_period * period_bytes);
+    ch_config.linked_ptr = CAPTURE_SYS_ADDR(&capture->desc[line][(start_period + 1U) % cfg->period_num]);
+    stat = dma_setup_channel(cfg->dma, cfg->dma_channel[line], &ch_config, false);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    dmamux_config(cfg->dmamux, DMA_SOC_CHN_TO_DMAMUX_CHN(cfg->dma, cfg->dma_channel[line]), cfg->dma_req[line], true);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_capture_init(i2s_multiline_capture_t *capture, const i2s_multiline_capture_config_t *config)
+{
+    if ((config->line_num == 0U) || (config->line_num > I2S_MULTILINE_MAX_LINE) ||
+        (config->period_num < 2U) || (config->period_num > I2S_MULTILINE_MAX_PERIOD) ||
+        (config->period_frames == 0U) || ((config->period_frames & 1U) != 0U) ||
+        (config->channel_per_line == 0U)) {
+        return status_invalid_argument;
+    }
+    if (config->engine == i2s_multiline_engine_burst_dma) {
+        /* burst长度只能为1/2/4，4条数据线才能在同一个burst内同步推进 */
+        if ((config->line_num == 3U) ||
+            ((config->audio_depth != 16U) && (config->audio_depth != 24U) && (config->audio_depth != 32U))) {
+            return status_invalid_argument;
+        }
+    } else if ((config->audio_depth != 16U) && (config->audio_depth != 32U)) {
+        return status_invalid_argument;
+    }
+
+    memset(capture, 0, sizeof(*capture));
+    capture->config = *config;
+    if (config->engine == i2s_multiline_engine_burst_dma) {
+        /* 与发送相同，burst内无法按半字访问各RXD的高半字，环中每个采样固定占32位 */
+        capture->sample_bytes = 4U;
+        capture->ring_num = 1;
+        capture->frame_bytes = config->line_num * config->channel_per_line * capture->sample_bytes;
+    } else {
+        capture->sample_bytes = config->audio_depth / 8U;
+        capture->ring_num = config->line_num;
+        capture->frame_bytes = config->channel_per_line * capture->sample_bytes;
+    }
+    capture->ring_frames = config->period_num * config->period_frames;
+
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        if (config->buffer[line] == NULL) {
+            return status_invalid_argument;
+        }
+    }
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_capture_prepare(i2s_multiline_capture_t *capture)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+    hpm_stat_t stat;
+    uint8_t period;
+
+    /* 从写位置所在的周期开始，丢弃尚未读取的数据 */
+    capture->write_pos -= capture_slot(capture, capture->write_pos) % cfg->period_frames;
+    capture->read_pos = capture->write_pos;
+    period = capture_slot(capture, capture->write_pos) / cfg->period_frames;
+    capture->half_period_count = 0;
+    capture->recover_pending = false;
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        stat = capture_config_line_dma(capture, line, period);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    i2s_enable_rx_dma_request(cfg->i2s);
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        dma_enable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    capture->running = true;
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_capture_start(i2s_multiline_capture_t *capture)
+{
+    hpm_stat_t stat = i2s_multiline_capture_prepare(capture);
+
+    if (stat == status_success) {
+        i2s_start(capture->config.i2s);
+    }
+    return stat;
+}
+
+void i2s_multiline_capture_stop(i2s_multiline_capture_t *capture)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        dma_disable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    i2s_stop(cfg->i2s);
+    i2s_disable_rx_dma_request(cfg->i2s);
+    capture->recover_pending = false;
+    capture->running = false;
+}
+
+/*
+ * DMA即将写入[write_pos, write_pos + half)，其中尚未读取的数据将被覆盖，
+ * 读位置前移到覆盖区之后，接收不中断
+ */
+static void capture_drop_until(i2s_multiline_capture_t *capture, uint32_t end)
+{
+    uint32_t oldest = end - capture->ring_frames;
+    uint32_t level;
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if ((int32_t)(oldest - capture->read_pos) > 0) {
+        capture->overrun_count++;
+        capture->dropped_frames += oldest - capture->read_pos;
+        capture->read_pos = oldest;
+    }
+    restore_global_irq(level);
+}
+
+static void capture_advance_half_period(i2s_multiline_capture_t *capture, bool period_end)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+    uint32_t period = capture->half_period_count / 2U;
+
+    capture->write_pos += cfg->period_frames / 2U;
+    capture->half_period_count++;
+
+    if (period_end) {
+        if (cfg->period_cb != NULL) {
+            cfg->period_cb(capture, period, cfg->user_data);
+        }
+    } else {
+        if (cfg->half_period_cb != NULL) {
+            cfg->half_period_cb(capture, period, cfg->user_data);
+        }
+    }
+
+    /* DMA下一个进入的半周期，回调中可能已读取了数据，回调之后再检查 */
+    capture_drop_until(capture, capture->write_pos + cfg->period_frames / 2U);
+    capture_rebase(capture);
+}
+
+/*
+ * DMA错误或I2S接收FIFO溢出后恢复的第一步，在中断中执行：停止DMA和I2S，之后的数据不再写入环。
+ * 清空FIFO、以静音填充未完成的周期和重新配置DMA不在中断中执行，由i2s_multiline_capture_task完成
+ */
+static void capture_recover(i2s_multiline_capture_t *capture)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+
+    capture->recover_start = read_csr(CSR_MCYCLE);
+
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        dma_disable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    i2s_stop(cfg->i2s);
+    capture->recover_pending = true;
+}
+
+/*
+ * 恢复的第二步：清空所有数据线的FIFO，丢弃未完成的周期，从下一个周期边界重新接收，
+ * 各数据线重新在帧边界上对齐
+ */
+void i2s_multiline_capture_task(i2s_multiline_capture_t *capture)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+    uint32_t cycles;
+    uint32_t next;
+    uint8_t period;
+
+    if (!capture->recover_pending) {
+        return;
+    }
+    /* DMA已停止，中断不会再推进写位置，无需关中断 */
+    i2s_reset_rx(cfg->i2s);
+
+    /* 未完成的周期中已写入的部分可能不再对齐，以静音代替，读出的数据在时间上保持连续 */
+    next = capture->write_pos + cfg->period_frames - capture_slot(capture, capture->write_pos) % cfg->period_frames;
+    capture_fill_silence(capture, capture->write_pos, next);
+    capture->write_pos = next;
+    capture->half_period_count = (capture->half_period_count + 2U) & ~1UL;
+    capture_drop_until(capture, capture->write_pos + cfg->period_frames);
+    capture_rebase(capture);
+
+    period = capture_slot(capture, capture->write_pos) / cfg->period_frames;
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        capture_config_line_dma(capture, line, period);
+        dma_enable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    i2s_start(cfg->i2s);
+    capture->recover_pending = false;
+
+    cycles = read_csr(CSR_MCYCLE) - capture->recover_start;
+    capture->recovery_count++;
+    capture->recovery_cycles_last = cycles;
+    if (cycles > capture->recovery_cycles_max) {
+        capture->recovery_cycles_max = cycles;
+    }
+}
+
+void i2s_multiline_capture_irq_handler(i2s_multiline_capture_t *capture)
+{
+    i2s_multiline_capture_config_t *cfg = &capture->config;
+    uint32_t stat;
+    bool recover = false;
+
+    for (uint8_t line = 1; line < capture->ring_num; line++) {
+        stat = dma_check_transfer_status(cfg->dma, cfg->dma_channel[line]);
+        if (stat & DMA_CHANNEL_STATUS_ERROR) {
+            capture->dma_error_count++;
+            recover = true;
+        }
+    }
+
+    stat = dma_check_transfer_status(cfg->dma, cfg->dma_channel[0]);
+    if (stat & DMA_CHANNEL_STATUS_ERROR) {
+        capture->dma_error_count++;
+        recover = true;
+    }
+    /* 中断被延迟时半周期与整周期标志可能同时置位，按顺序处理 */
+    if (((capture->half_period_count & 1U) == 0U) && (stat & DMA_CHANNEL_STATUS_HALF_TC)) {
+        capture_advance_half_period(capture, false);
+    }
+    if (stat & DMA_CHANNEL_STATUS_TC) {
+        if ((capture->half_period_count & 1U) == 0U) {
+            /* 漏掉的半周期 */
+            capture_advance_half_period(capture, false);
+        }
+        capture_advance_half_period(capture, true);
+    }
+
+    /* DMA未能及时读空FIFO时各数据线可能不再对齐 */
+    if ((i2s_get_irq_status(cfg->i2s) & I2S_STA_RX_OV_MASK) != 0U) {
+        i2s_clear_irq_status(cfg->i2s, I2S_STA_RX_OV_MASK);
+        capture->fifo_overflow_count++;
+        recover = true;
+    }
+
+    if (recover && capture->running && !capture->recover_pending) {
+        capture_recover(capture);
+    }
+}
+
+void i2s_multiline_capture_get_stats(i2s_multiline_capture_t *capture, i2s_multiline_capture_stats_t *stats)
+{
+    stats->overrun_count = capture->overrun_count;
+    stats->dropped_frames = capture->dropped_frames;
+    stats->dma_error_count = capture->dma_error_count;
+    stats->fifo_overflow_count = capture->fifo_overflow_count;
+    stats->recovery_count = capture->recovery_count;
+    stats->recovery_cycles_last = capture->recovery_cycles_last;
+    stats->recovery_cycles_max = capture->recovery_cycles_max;
+}
+
+uint32_t i2s_multiline_capture_get_avail_frames(i2s_multiline_capture_t *capture)
+{
+    int32_t avail = (int32_t)(capture->write_pos - capture->read_pos);
+
+    return (avail > 0) ? (uint32_t)avail : 0U;
+}
+
+uint32_t i2s_multiline_capture_get_read_ptr(i2s_multiline_capture_t *capture, const void *line_ptr[])
+{
+    uint32_t avail = i2s_multiline_capture_get_avail_frames(capture);
+    uint32_t contiguous = capture->ring_frames - capture_slot(capture, capture->read_pos);
+
+    capture->pending_pos = capture->read_pos;
+    for (uint8_t line = 0; line < capture->ring_num; line++) {
+        line_ptr[line] = capture_line_addr(capture, line, capture->pending_pos);
+    }
+    return (avail < contiguous) ? avail : contiguous;
+}
+
+void i2s_multiline_capture_release(i2s_multiline_capture_t *capture, uint32_t frames)
+{
+    uint32_t end = capture->pending_pos + frames;
+    uint32_t level;
+
+    /* 数据读取完成后再释放读位置 */
+    fencerw();
+    /* 读取期间中断可能已丢弃旧数据并前移读位置，只释放超出部分 */
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if ((int32_t)(end - capture->read_pos) > 0) {
+        capture->read_pos = end;
+    }
+    restore_global_irq(level);
+}
+
+uint32_t i2s_multiline_capture_read(i2s_multiline_capture_t *capture, void *const line_data[], uint32_t frames)
+{
+    const void *line_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t done = 0;
+    uint32_t chunk;
+
+    while (done < frames) {
+        chunk = i2s_multiline_capture_get_read_ptr(capture, line_ptr);
+        if (chunk == 0U) {
+            break;
+        }
+        if (chunk > frames - done) {
+            chunk = frames - done;
+        }
+        for (uint8_t line = 0; line < capture->ring_num; line++) {
+            memcpy((uint8_t *)line_data[line] + done * capture->frame_bytes, line_ptr[line],
+                   chunk * capture->frame_bytes);
+        }
+        i2s_multiline_capture_release(capture, chunk);
+        done += chunk;
+    }
+    return done;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_CAPTURE_H
+#define I2S_MULTILINE_CAPTURE_H
+
+/*
+ * I2S多数据线流式接收接口，与i2s_multiline_stream发送接口对应
+ *
+ * 环形缓冲区由period_num个周期组成，DMA通道使用循环链表描述符不停地搬运，
+ * 接收不会因重新配置DMA而中断。DMA中断按半周期推进写指针并回调应用，
+ * 消费者通过读指针从环中取出数据。
+ *
+ * 消费者来不及读取时，中断在DMA进入下一个半周期之前丢弃最旧的数据，
+ * DMA错误或I2S接收FIFO溢出时中断只停止DMA和I2S，由i2s_multiline_capture_task在任务中
+ * 从下一个周期边界重新启动，各数据线重新在帧边界对齐，未完成的周期以静音代替，
+ * 相关次数和恢复耗时通过i2s_multiline_capture_get_stats获取。
+ * 环形缓冲区大小与发送相同，见I2S_MULTILINE_STREAM_LINE_BUF_SIZE和I2S_MULTILINE_STREAM_BURST_BUF_SIZE。
+ *
+ * 支持两种DMA引擎：
+ * - per_line：每条数据线一个DMA通道和一个环(需每条line独立DMA请求，如HPM6P00)
+ * - burst：单个DMA通道和一个环，使用DMAv2的burst小循环功能依次读取RXD[0..N-1](如HPM6E00)，
+ *   环内按line0..lineN-1的顺序交织，每个采样占32位并左对齐，由i2s_multiline_unpack拆分为平面声道
+ */
+
+#include "i2s_multiline_stream.h"
+
+typedef struct i2s_multiline_capture i2s_multiline_capture_t;
+
+/* 周期回调，在DMA中断上下文中调用，period为刚接收完(或接收完一半)的周期序号 */
+typedef void (*i2s_multiline_capture_cb_t)(i2s_multiline_capture_t *capture, uint32_t period, void *user_data);
+
+typedef struct {
+    I2S_Type *i2s;
+    DMAV2_Type *dma;
+    DMAMUX_Type *dmamux;
+    i2s_multiline_engine_t engine;                  /* DMA引擎 */
+    uint8_t line_num;                               /* 使用的数据线数，burst引擎下为1、2或4 */
+    uint8_t dma_channel[I2S_MULTILINE_MAX_LINE];    /* 每条数据线的DMA通道，burst引擎只使用[0] */
+    uint8_t dma_req[I2S_MULTILINE_MAX_LINE];        /* 每条数据线的DMA请求源，burst引擎只使用[0] */
+    uint8_t channel_per_line;                       /* 每条数据线每帧的通道数 */
+    uint8_t audio_depth;                            /* 音频位深 (16/32 bits，burst引擎还支持24 bits) */
+    uint8_t period_num;                             /* 周期数 (2 ~ I2S_MULTILINE_MAX_PERIOD) */
+    uint32_t period_frames;                         /* 每个周期的帧数，需为偶数 */
+    void *buffer[I2S_MULTILINE_MAX_LINE];           /* 环形缓冲区，需位于非缓存区；burst引擎只使用[0] */
+    i2s_multiline_capture_cb_t half_period_cb;      /* 半周期回调，可为NULL */
+    i2s_multiline_capture_cb_t period_cb;           /* 整周期回调，可为NULL */
+    void *user_data;
+} i2s_multiline_capture_config_t;
+
+/* 接收实例，包含DMA链表描述符，需放置在非缓存区 */
+struct i2s_multiline_capture {
+    dma_linked_descriptor_t desc[I2S_MULTILINE_MAX_LINE][I2S_MULTILINE_MAX_PERIOD];
+    i2s_multiline_capture_config_t config;
+    uint8_t sample_bytes;                           /* 每个采样在缓冲区中占用的字节数 */
+    uint8_t ring_num;                               /* 环及DMA通道的个数 */
+    uint32_t frame_bytes;                           /* 每个环中每帧占用的字节数 */
+    uint32_t ring_frames;                           /* 环的总帧数 */
+    volatile uint32_t write_pos;                    /* DMA写位置(帧，按半周期推进) */
+    volatile uint32_t read_pos;                     /* 消费者读位置(帧，单调递增) */
+    volatile uint32_t slot_base;                    /* 环内第0帧对应的位置，由中断按整环前移 */
+    uint32_t pending_pos;                           /* get_read_ptr返回区域的起始位置 */
+    volatile uint32_t half_period_count;            /* 已完成的半周期数 */
+    volatile uint32_t overrun_count;                /* 消费者来不及读取的次数 */
+    volatile uint32_t dropped_frames;               /* 因此丢弃的帧数 */
+    volatile uint32_t dma_error_count;              /* DMA错误次数 */
+    volatile uint32_t fifo_overflow_count;          /* I2S接收FIFO溢出次数 */
+    volatile uint32_t recovery_count;               /* 重新启动次数 */
+    uint32_t recovery_cycles_last;                  /* 最近一次恢复耗时(CPU周期，从中断中检测到错误至I2S重新启动) */
+    uint32_t recovery_cycles_max;                   /* 最长恢复耗时(CPU周期) */
+    uint32_t recover_start;                         /* 检测到错误时的CPU周期 */
+    volatile bool recover_pending;                  /* 中断已停止DMA和I2S，等待任务中重新启动 */
+    bool running;
+};
+
+typedef struct {
+    uint32_t overrun_count;
+    uint32_t dropped_frames;
+    uint32_t dma_error_count;
+    uint32_t fifo_overflow_count;
+    uint32_t recovery_count;
+    uint32_t recovery_cycles_last;
+    uint32_t recovery_cycles_max;
+} i2s_multiline_capture_stats_t;
+
+hpm_stat_t i2s_multiline_capture_init(i2s_multiline_capture_t *capture, const i2s_multiline_capture_config_t *config);
+
+/*
+ * 配置并使能DMA但不启动I2S，用于与发送流共用一个I2S时由一次i2s_start同时启动收发；
+ * start相当于prepare后调用i2s_start
+ */
+hpm_stat_t i2s_multiline_capture_prepare(i2s_multiline_capture_t *capture);
+hpm_stat_t i2s_multiline_capture_start(i2s_multiline_capture_t *capture);
+void i2s_multiline_capture_stop(i2s_multiline_capture_t *capture);
+
+/* 在应用的DMA中断处理函数中调用 */
+void i2s_multiline_capture_irq_handler(i2s_multiline_capture_t *capture);
+
+/* 在主循环中调用，完成中断中检测到的错误的恢复 */
+void i2s_multiline_capture_task(i2s_multiline_capture_t *capture);
+
+void i2s_multiline_capture_get_stats(i2s_multiline_capture_t *capture, i2s_multiline_capture_stats_t *stats);
+
+/* 已接收但尚未读取的帧数 */
+uint32_t i2s_multiline_capture_get_avail_frames(i2s_multiline_capture_t *capture);
+
+/*
+ * 拷贝方式读取，返回实际读取的帧数
+ * per_line引擎：line_data[line]接收该数据线frames帧的交织数据(每帧channel_per_line个采样，左对齐)
+ * burst引擎：line_data[0]接收按burst顺序交织的数据
+ */
+uint32_t i2s_multiline_capture_read(i2s_multiline_capture_t *capture, void *const line_data[], uint32_t frames);
+
+/*
+ * 零拷贝方式读取：获取读指针处可连续读取的区域，消费者直接处理(如i2s_multiline_unpack)后调用release释放
+ * 返回可连续读取的帧数，line_ptr[]为各环的读地址(burst引擎只有line_ptr[0])
+ */
+uint32_t i2s_multiline_capture_get_read_ptr(i2s_multiline_capture_t *capture, const void *line_ptr[]);
+void i2s_multiline_capture_release(i2s_multiline_capture_t *capture, uint32_t frames);
+
+#endif /* I2S_MULTILINE_CAPTURE_H */
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_CFG_H
+#define I2S_MULTILINE_CFG_H
+
+/*
+ * I2S多数据线编译期配置
+ *
+ * I2S_MULTILINE_CFG_DEFINE(name, lines, depth, slots, engine, rate)按数据线数、位深、每条数据线的时隙数、
+ * 发送引擎和采样率生成一组以name为前缀的常量和内联函数，同一源文件中可定义多组：
+ * - 常量：时隙掩码、数据线掩码、环中每个采样和每帧的字节数、环和DMA通道的个数、
+ *   FIFO阈值(i2s_multiline_tune的阈值规则及默认响应延迟)和per_line引擎的DMA burst长度，
+ *   均为枚举常量，可用于声明缓冲区
+ * - name##_config_i2s：按上述常量配置I2S主设备；name##_config_i2s_duplex同时使能各数据线的接收；
+ *   name##_config_i2s_at在运行时指定采样率(如USB主机选择的采样率)，此时rate为最高采样率，
+ *   FIFO阈值按最高采样率计算
+ * - name##_init_pins：按数据线数配置I2S0的引脚
+ * - name##_pack：把平面声道打包到DMA环(burst引擎交织环或per_line引擎每条数据线的环)
+ * - name##_fill_fifo：中断引擎每次中断向各数据线写入一批采样
+ * 热循环中的数据线数、时隙数、移位量和批量都是常量，引擎的选择在编译期折叠，运行时没有按配置的分支。
+ *
+ * 无效组合在编译时报错：burst引擎需要DMAv2 burst小循环功能(如HPM6E00)且数据线数为1、2或4，
+ * per_line引擎需要每条line独立的DMA请求(如HPM6P00)且只支持16/32位，
+ * 位深为16/24/32，数据线数不超过I2S_SOC_MAX_LINE_NUM，时隙数为1~16。
+ *
+ * 引脚表与各示例中的init_i2s_multiline_pin相同，需根据实际硬件修改。
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "i2s_multiline_tune.h"
+
+#define I2S_MULTILINE_CFG_ENGINE_IRQ        (0)
+#define I2S_MULTILINE_CFG_ENGINE_PER_LINE   (1)
+#define I2S_MULTILINE_CFG_ENGINE_BURST      (2)
+
+#ifdef HPM_DMA_SRC_I2S0_TX_0
+#define I2S_MULTILINE_CFG_HAS_PER_LINE_DMA  (1)
+#else
+#define I2S_MULTILINE_CFG_HAS_PER_LINE_DMA  (0)
+#endif
+
+#if defined(HPM_IP_FEATURE_DMAV2_BURST_IN_FIXED_TRANS) && HPM_IP_FEATURE_DMAV2_BURST_IN_FIXED_TRANS
+#define I2S_MULTILINE_CFG_HAS_BURST_DMA     (1)
+#else
+#define I2S_MULTILINE_CFG_HAS_BURST_DMA     (0)
+#endif
+
+/* I2S0引脚：MCLK、BCLK、FCLK、TXD0~3 */
+typedef struct {
+    uint16_t pad;
+    uint16_t func;
+} i2s_multiline_cfg_pin_t;
+
+static const i2s_multiline_cfg_pin_t i2s_multiline_cfg_i2s0_pin[] = {
+#if I2S_MULTILINE_CFG_HAS_PER_LINE_DMA
+    {IOC_PAD_PD01, IOC_PD01_FUNC_CTL_I2S0_MCLK},
+    {IOC_PAD_PD02, IOC_PD02_FUNC_CTL_I2S0_BCLK},
+    {IOC_PAD_PD03, IOC_PD03_FUNC_CTL_I2S0_FCLK},
+    {IOC_PAD_PD18, IOC_PD18_FUNC_CTL_I2S0_TXD_0},
+    {IOC_PAD_PD19, IOC_PD19_FUNC_CTL_I2S0_TXD_1},
+    {IOC_PAD_PD20, IOC_PD20_FUNC_CTL_I2S0_TXD_2},
+    {IOC_PAD_PD21, IOC_PD21_FUNC_CTL_I2S0_TXD_3},
+#else
+    {IOC_PAD_PB11, IOC_PB11_FUNC_CTL_I2S0_MCLK},
+    {IOC_PAD_PB01, IOC_PB01_FUNC_CTL_I2S0_BCLK},
+    {IOC_PAD_PB10, IOC_PB10_FUNC_CTL_I2S0_FCLK},
+    {IOC_PAD_PB00, IOC_PB00_FUNC_CTL_I2S0_TXD_0},
+    {IOC_PAD_PB03, IOC_PB03_FUNC_CTL_I2S0_TXD_1},
+    {IOC_PAD_PB05, IOC_PB05_FUNC_CTL_I2S0_TXD_2},
+    {IOC_PAD_PB02, IOC_PB02_FUNC_CTL_I2S0_TXD_3},
+#endif
+};
+
+/* 按默认响应延迟使用i2s_multiline_tune的阈值规则 */
+#define I2S_MULTILINE_CFG_THRESHOLD(engine, rate, slots)                                                 \
+    I2S_MULTILINE_TUNE_THRESHOLD((engine) != I2S_MULTILINE_CFG_ENGINE_IRQ,                               \
+                                 I2S_MULTILINE_TUNE_NEED_SAMPLES((rate) * (slots),                       \
+                                                                 I2S_MULTILINE_TUNE_DEFAULT_LATENCY_NS), \
+                                 I2S_SOC_MAX_TX_FIFO_DEPTH)
+
+/* 不超过FIFO空位数的最大2的幂，最大8 */
+#define I2S_MULTILINE_CFG_BURST(space) \
+    (((space) >= 8U) ? 8U : ((space) >= 4U) ? 4U : ((space) >= 2U) ? 2U : 1U)
+
+#define I2S_MULTILINE_CFG_DEFINE(name, lines, depth, slots, engine, rate)                                            \
+    _Static_assert(((depth) == 16) || ((depth) == 24) || ((depth) == 32), #name ": audio depth must be 16/24/32");  \
+    _Static_assert(((lines) >= 1) && ((lines) <= I2S_SOC_MAX_LINE_NUM), #name ": invalid line count");              \
+    _Static_assert(((slots) >= 1) && ((slots) <= 16), #name ": slots per line must be 1~16");                       \
+    _Static_assert(((engine) != I2S_MULTILINE_CFG_ENGINE_BURST) || I2S_MULTILINE_CFG_HAS_BURST_DMA,                \
+                   #name ": burst engine needs DMAv2 burst in fixed transfer");                                     \
+    _Static_assert(((engine) != I2S_MULTILINE_CFG_ENGINE_BURST) || ((lines) == 1) || ((lines) == 2) ||             \
+                   ((lines) == 4), #name ": burst engine supports 1, 2 or 4 lines");                                \
+    _Static_assert(((engine) != I2S_MULTILINE_CFG_ENGINE_PER_LINE) || I2S_MULTILINE_CFG_HAS_PER_LINE_DMA,          \
+                   #name ": per_line engine needs one DMA request per line");                                       \
+    _Static_assert(((engine) != I2S_MULTILINE_CFG_ENGINE_PER_LINE) || ((depth) != 24),                             \
+                   #name ": per_line engine supports 16/32 bit only");                                              \
+                                                                                                                    \
+    enum {                                                                                                          \
+        name##_line_num = (lines),                                                                                  \
+        name##_audio_depth = (depth),                                                                               \
+        name##_channel_per_line = (slots),                                                                          \
+        name##_sample_rate = (rate),                                                                                \
+        name##_slot_mask = (int)((1UL << (slots)) - 1U),                                                            \
+        name##_line_mask = (int)((1UL << (lines)) - 1U),                                                            \
+        /* 环中每个采样的字节数：burst引擎左对齐为32位，per_line引擎与位深相同 */                           \
+        name##_sample_bytes = ((engine) == I2S_MULTILINE_CFG_ENGINE_PER_LINE) ? ((depth) / 8) : 4,                  \
+        name##_ring_num = ((engine) == I2S_MULTILINE_CFG_ENGINE_PER_LINE) ? (lines) : 1,                            \
+        name##_dma_num = ((engine) == I2S_MULTILINE_CFG_ENGINE_IRQ) ? 0                                             \
+                       : ((engine) == I2S_MULTILINE_CFG_ENGINE_PER_LINE) ? (lines) : 1,                             \
+        /* 每个环中每帧的字节数 */                                                                              \
+        name##_frame_bytes = (((engine) == I2S_MULTILINE_CFG_ENGINE_PER_LINE) ? ((depth) / 8) : 4) * (slots) *      \
+                             (((engine) == I2S_MULTILINE_CFG_ENGINE_BURST) ? (lines) : 1),                          \
+        name##_fifo_threshold = (int)I2S_MULTILINE_CFG_THRESHOLD(engine, rate, slots),                              \
+        /* 中断引擎每次中断每条数据线写入的采样数 */                                                        \
+        name##_batch = I2S_SOC_MAX_TX_FIFO_DEPTH - name##_fifo_threshold,                                           \
+        name##_dma_burst = (int)I2S_MULTILINE_CFG_BURST(I2S_SOC_MAX_TX_FIFO_DEPTH - name##_fifo_threshold),         \
+    };                                                                                                              \
+                                                                                                                    \
+    /* 按采样率sample_rate配置I2S主设备，rx为true时各数据线同时接收，rx_threshold为接收FIFO阈值 */                                            \
+    static inline hpm_stat_t name##_config_i2s_at(I2S_Type *i2s, uint32_t mclk_hz, uint32_t sample_rate,            \
+                                                  uint8_t tx_threshold, bool rx, uint8_t rx_threshold)              \
+    {                                                                                                               \
+        i2s_config_t i2s_config;                                                                                    \
+        i2s_multiline_transfer_config_t transfer;                                                                   \
+                                                                                                                    \
+        i2s_get_default_config(i2s, &i2s_config);                                                                   \
+        i2s_config.tx_fifo_threshold = tx_threshold;                                                                \
+        if (rx) {                                                                                                   \
+            i2s_config.rx_fifo_threshold = rx_threshold;                                                            \
+        }                                                                                                           \
+        i2s_config.enable_mclk_out = true;                                                                          \
+        i2s_init(i2s, &i2s_config);                                                                                 \
+                                                                                                                    \
+        i2s_get_default_multiline_transfer_config(&transfer);                                                       \
+        transfer.sample_rate = sample_rate;                                                                         \
+        transfer.channel_num_per_frame = (slots);                                                                   \
+        transfer.audio_depth = (depth);                                                                             \
+        transfer.channel_length = i2s_channel_length_32_bits;                                                       \
+        transfer.master_mode = true;                                                                                \
+        transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;                                                             \
+        for (uint8_t line = 0; line < (lines); line++) {                                                            \
+            transfer.tx_data_line_en[line] = true;                                                                  \
+            transfer.tx_channel_slot_mask[line] = name##_slot_mask;                                                 \
+            if (rx) {                                                                                               \
+                transfer.rx_data_line_en[line] = true;                                                              \
+                transfer.rx_channel_slot_mask[line] = name##_slot_mask;                                             \
+            }                                                                                                       \
+        }                                                                                                           \
+        return i2s_config_multiline_transfer(i2s, mclk_hz, &transfer);                                              \
+    }                                                                                                               \
+                                                                                                                    \
+    static inline hpm_stat_t name##_config_i2s(I2S_Type *i2s, uint32_t mclk_hz, uint8_t fifo_threshold)             \
+    {                                                                                                               \
+        return name##_config_i2s_at(i2s, mclk_hz, (rate), fifo_threshold, false, 0);                                \
+    }                                                                                                               \
+                                                                                                                    \
+    static inline hpm_stat_t name##_config_i2s_duplex(I2S_Type *i2s, uint32_t mclk_hz, uint8_t tx_threshold,        \
+                                                      uint8_t rx_threshold)                                         \
+    {                                                                                                               \
+        return name##_config_i2s_at(i2s, mclk_hz, (rate), tx_threshold, true, rx_threshold);                        \
+    }                                                                                                               \
+                                                                                                                    \
+    static inline void name##_init_pins(void)                                                                       \
+    {                                                                                                               \
+        for (uint8_t i = 0; i < 3U + (lines); i++) {                                                                \
+            HPM_IOC->PAD[i2s_multiline_cfg_i2s0_pin[i].pad].FUNC_CTL = i2s_multiline_cfg_i2s0_pin[i].func;          \
+        }                                                                                                           \
+    }                                                                                                               \
+                                                                                                                    \
+    /* src[line * slots + slot]为右对齐的平面声道，写入ring[]中frames帧，burst引擎只使用ring[0] */      \
+    static inline void name##_pack(void *const ring[], const int32_t *const src[], uint32_t first, uint32_t frames) \
+    {                                                                                                               \
+        for (uint32_t f = 0; f < frames; f++) {                                                                     \
+            for (uint32_t s = 0; s < (slots); s++) {                                                                \
+                for (uint32_t l = 0; l < (lines); l++) {                                                            \
+                    uint32_t v = (uint32_t)src[l * (slots) + s][first + f];                                         \
+                    if ((engine) == I2S_MULTILINE_CFG_ENGINE_BURST) {                                               \
+                        ((uint32_t *)ring[0])[(f * (slots) + s) * (lines) + l] = v << (32 - (depth));               \
+                    } else if ((depth) == 16) {                                                                     \
+                        ((uint16_t *)ring[l])[f * (slots) + s] = (uint16_t)v;                                       \
+                    } else {                                                                                        \
+                        ((uint32_t *)ring[l])[f * (slots) + s] = v;                                                 \
+                    }                                                                                               \
+                }                                                                                                   \
+            }                                                                                                       \
+        }                                                                                                           \
+    }                                                                                                               \
+                                                                                                                    \
+    /* line_data[line]为各数据线时隙交织的源数据(16位为uint16_t，24/32位为右对齐的uint32_t)，从pos开始写入一批 */ \
+    static inline void name##_fill_fifo(I2S_Type *i2s, const void *const line_data[], uint32_t pos)                 \
+    {                                                                                                               \
+        for (uint32_t i = 0; i < (uint32_t)name##_batch; i++) {                                                     \
+            for (uint32_t l = 0; l < (lines); l++) {                                                                \
+                if ((depth) == 16) {                                                                                \
+                    i2s->TXD[l] = (uint32_t)((const uint16_t *)line_data[l])[pos + i] << 16;                        \
+                } else {                                                                                            \
+                    i2s->TXD[l] = ((const uint32_t *)line_data[l])[pos + i] << (32 - (depth));                      \
+                }                                                                                                   \
+            }                                                                                                       \
+        }                                                                                                           \
+    }
+
+#endif /* I2S_MULTILINE_CFG_H */
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "board.h"
+#include "i2s_multiline_dma_mgr.h"
+
+typedef struct {
+    DMAV2_Type *dma;
+    DMAMUX_Type *dmamux;
+    uint32_t channel_mask;                          /* 允许分配的通道 */
+    uint32_t allocated;                             /* 已分配的通道 */
+    volatile uint32_t dispatch_mask;                /* 参与中断分发的通道 */
+    i2s_multiline_dma_mgr_cb_t callback[DMA_SOC_CHANNEL_NUM];
+    void *user_data[DMA_SOC_CHANNEL_NUM];
+} dma_mgr_controller_t;
+
+static dma_mgr_controller_t dma_mgr_controller[DMA_SOC_MAX_COUNT];
+
+static dma_mgr_controller_t *dma_mgr_find(DMAV2_Type *dma)
+{
+    for (uint8_t i = 0; i < DMA_SOC_MAX_COUNT; i++) {
+        if (dma_mgr_controller[i].dma == dma) {
+            return &dma_mgr_controller[i];
+        }
+    }
+    return NULL;
+}
+
+static void dma_mgr_connect(dma_mgr_controller_t *ctrl, uint8_t channel, uint8_t dma_req)
+{
+    if (dma_req != I2S_MULTILINE_DMA_MGR_NO_REQ) {
+        dmamux_config(ctrl->dmamux, DMA_SOC_CHN_TO_DMAMUX_CHN(ctrl->dma, channel), dma_req, true);
+    }
+}
+
+hpm_stat_t i2s_multiline_dma_mgr_add_controller(DMAV2_Type *dma, DMAMUX_Type *dmamux, uint32_t channel_mask)
+{
+    dma_mgr_controller_t *ctrl;
+
+    if ((dma == NULL) || (dmamux == NULL)) {
+        return status_invalid_argument;
+    }
+    if (dma_mgr_find(dma) != NULL) {
+        return status_success;
+    }
+    ctrl = dma_mgr_find(NULL);
+    if (ctrl == NULL) {
+        return status_fail;
+    }
+#if DMA_SOC_CHANNEL_NUM < 32
+    channel_mask &= (1UL << DMA_SOC_CHANNEL_NUM) - 1U;
+#endif
+    ctrl->dmamux = dmamux;
+    ctrl->channel_mask = channel_mask;
+    ctrl->allocated = 0;
+    ctrl->dispatch_mask = 0;
+    ctrl->dma = dma;
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_dma_mgr_request(DMAV2_Type *dma, uint8_t dma_req, uint8_t *channel)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+    uint32_t level;
+    uint32_t free_mask;
+    uint8_t ch;
+
+    if ((ctrl == NULL) || (channel == NULL)) {
+        return status_invalid_argument;
+    }
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    free_mask = ctrl->channel_mask & ~ctrl->allocated;
+    if (free_mask == 0U) {
+        restore_global_irq(level);
+        return status_fail;
+    }
+    ch = (uint8_t)__builtin_ctz(free_mask);
+    ctrl->allocated |= 1UL << ch;
+    restore_global_irq(level);
+
+    dma_mgr_connect(ctrl, ch, dma_req);
+    *channel = ch;
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_dma_mgr_request_channel(DMAV2_Type *dma, uint8_t channel, uint8_t dma_req)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+    uint32_t level;
+
+    if ((ctrl == NULL) || (channel >= DMA_SOC_CHANNEL_NUM)) {
+        return status_invalid_argument;
+    }
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if (((ctrl->channel_mask & ~ctrl->allocated) & (1UL << channel)) == 0U) {
+        restore_global_irq(level);
+        return status_fail;
+    }
+    ctrl->allocated |= 1UL << channel;
+    restore_global_irq(level);
+
+    dma_mgr_connect(ctrl, channel, dma_req);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_dma_mgr_release(DMAV2_Type *dma, uint8_t channel)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+    uint32_t level;
+
+    if ((ctrl == NULL) || (channel >= DMA_SOC_CHANNEL_NUM) || ((ctrl->allocated & (1UL << channel)) == 0U)) {
+        return status_invalid_argument;
+    }
+    /* 先停止分发，避免中断中调用已释放通道的回调 */
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    ctrl->dispatch_mask &= ~(1UL << channel);
+    restore_global_irq(level);
+
+    dma_disable_channel(dma, channel);
+    dma_clear_transfer_status(dma, channel);
+    dmamux_config(ctrl->dmamux, DMA_SOC_CHN_TO_DMAMUX_CHN(dma, channel), 0, false);
+    ctrl->callback[channel] = NULL;
+    ctrl->user_data[channel] = NULL;
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    ctrl->allocated &= ~(1UL << channel);
+    restore_global_irq(level);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_dma_mgr_set_callback(DMAV2_Type *dma, uint8_t channel,
+                                              i2s_multiline_dma_mgr_cb_t callback, void *user_data)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+    uint32_t level;
+
+    if ((ctrl == NULL) || (channel >= DMA_SOC_CHANNEL_NUM) || ((ctrl->allocated & (1UL << channel)) == 0U)) {
+        return status_invalid_argument;
+    }
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    ctrl->callback[channel] = callback;
+    ctrl->user_data[channel] = user_data;
+    if (callback != NULL) {
+        ctrl->dispatch_mask |= 1UL << channel;
+    } else {
+        ctrl->dispatch_mask &= ~(1UL << channel);
+    }
+    restore_global_irq(level);
+    return status_success;
+}
+
+uint32_t i2s_multiline_dma_mgr_get_allocated(DMAV2_Type *dma)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+
+    return (ctrl == NULL) ? 0U : ctrl->allocated;
+}
+
+void i2s_multiline_dma_mgr_irq_handler(DMAV2_Type *dma)
+{
+    dma_mgr_controller_t *ctrl = dma_mgr_find(dma);
+    uint32_t mask;
+    uint32_t half;
+    uint32_t tc;
+    uint32_t abort;
+    uint32_t err;
+    uint32_t pending;
+    uint32_t bit;
+    uint32_t status;
+    uint8_t ch;
+
+    if (ctrl == NULL) {
+        return;
+    }
+    mask = ctrl->dispatch_mask;
+
+    /* 每个状态寄存器只读一次，只清除读到的位，之后置位的留给下一次中断 */
+    half = dma->INTHALFSTS & mask;
+    tc = dma->INTTCSTS & mask;
+    abort = dma->INTABORTSTS & mask;
+    err = dma->INTERRSTS & mask;
+    if (half != 0U) {
+        dma->INTHALFSTS = half;
+    }
+    if (tc != 0U) {
+        dma->INTTCSTS = tc;
+    }
+    if (abort != 0U) {
+        dma->INTABORTSTS = abort;
+    }
+    if (err != 0U) {
+        dma->INTERRSTS = err;
+    }
+
+    pending = half | tc | abort | err;
+    while (pending != 0U) {
+        ch = (uint8_t)__builtin_ctz(pending);
+        bit = 1UL << ch;
+        pending &= pending - 1U;
+
+        status = 0;
+        if (tc & bit) {
+            status |= DMA_CHANNEL_STATUS_TC;
+        }
+        if (half & bit) {
+            status |= DMA_CHANNEL_STATUS_HALF_TC;
+        }
+        if (err & bit) {
+            status |= DMA_CHANNEL_STATUS_ERROR;
+        }
+        if (abort & bit) {
+            status |= DMA_CHANNEL_STATUS_ABORT;
+        }
+        ctrl->callback[ch](ch, status, ctrl->user_data[ch]);
+    }
+}
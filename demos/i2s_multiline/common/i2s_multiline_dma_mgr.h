@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_DMA_MGR_H
+#define I2S_MULTILINE_DMA_MGR_H
+
+/*
+ * DMA通道资源管理及中断分发
+ *
+ * 多个模块(I2S流、采集、SPI NOR等)共用一个DMA控制器时，各自固定通道号容易冲突。
+ * 管理器在运行时从允许的通道中分配空闲通道，并连接对应的DMAMUX输出，释放时断开。
+ *
+ * 中断分发：每次中断只读取一次半传输、传输完成、中止、错误四个状态寄存器，
+ * 按已分配且注册了回调的通道屏蔽，写1清除读到的位后，按置位的通道依次调用回调。
+ * 轮询方式每个通道都要读取这四个寄存器，寄存器访问次数随通道数线性增长；
+ * 分发方式的寄存器访问次数固定，只有挂起的通道才有回调开销。
+ * 回调收到的status与dma_check_transfer_status的返回值格式相同(DMA_CHANNEL_STATUS_xxx)。
+ */
+
+#include "hpm_common.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+
+/* 不连接DMAMUX的通道(如内存到内存的拷贝) */
+#define I2S_MULTILINE_DMA_MGR_NO_REQ    (0xFFU)
+
+typedef void (*i2s_multiline_dma_mgr_cb_t)(uint8_t channel, uint32_t status, void *user_data);
+
+/*
+ * 登记一个DMA控制器，channel_mask为允许分配的通道(如保留给其他软件的通道不置位)，
+ * 重复登记同一控制器时返回成功且不改变已分配的通道
+ */
+hpm_stat_t i2s_multiline_dma_mgr_add_controller(DMAV2_Type *dma, DMAMUX_Type *dmamux, uint32_t channel_mask);
+
+/* 分配编号最小的空闲通道，并把DMAMUX输出连接到dma_req */
+hpm_stat_t i2s_multiline_dma_mgr_request(DMAV2_Type *dma, uint8_t dma_req, uint8_t *channel);
+
+/* 分配指定的通道，已被占用或不允许分配时返回status_fail */
+hpm_stat_t i2s_multiline_dma_mgr_request_channel(DMAV2_Type *dma, uint8_t channel, uint8_t dma_req);
+
+/* 停止通道、断开DMAMUX并释放 */
+hpm_stat_t i2s_multiline_dma_mgr_release(DMAV2_Type *dma, uint8_t channel);
+
+/* 注册通道的中断回调，callback为NULL时该通道不参与分发 */
+hpm_stat_t i2s_multiline_dma_mgr_set_callback(DMAV2_Type *dma, uint8_t channel,
+                                              i2s_multiline_dma_mgr_cb_t callback, void *user_data);
+
+/* 已分配的通道 */
+uint32_t i2s_multiline_dma_mgr_get_allocated(DMAV2_Type *dma);
+
+/* 在DMA控制器的中断服务函数中调用 */
+void i2s_multiline_dma_mgr_irq_handler(DMAV2_Type *dma);
+
+#endif /* I2S_MULTILINE_DMA_MGR_H */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "board.h"
+#include "i2s_multiline_feedback.h"
+
+/* 速率测量结果的一阶低通系数 1/2^n */
+#define FEEDBACK_RATE_FILTER_SHIFT  (2U)
+
+static void feedback_update_rate(i2s_multiline_feedback_t *fb)
+{
+    fb->rate_q16 = (uint32_t)((fb->usb_cpp_q16 << 16) / fb->i2s_cpf_q16);
+}
+
+static void feedback_filter(uint64_t *rate, uint64_t measured)
+{
+    int64_t diff = (int64_t)(measured - *rate);
+
+    *rate += diff / (1 << FEEDBACK_RATE_FILTER_SHIFT);
+}
+
+void i2s_multiline_feedback_init(i2s_multiline_feedback_t *fb, const i2s_multiline_feedback_config_t *config)
+{
+    uint32_t window_ms = (config->window_ms == 0U) ? I2S_MULTILINE_FEEDBACK_WINDOW_MS : config->window_ms;
+
+    memset(fb, 0, sizeof(*fb));
+    fb->config = *config;
+    fb->window_cycles = (uint64_t)config->cpu_hz * window_ms / 1000U;
+    fb->gain_q16 = (int32_t)((65536ULL * 1000U) / ((uint32_t)config->packet_per_second * I2S_MULTILINE_FEEDBACK_TAU_MS));
+    /* 测量完成前使用标称值 */
+    fb->i2s_cpf_q16 = ((uint64_t)config->cpu_hz << 16) / config->sample_rate;
+    fb->usb_cpp_q16 = ((uint64_t)config->cpu_hz << 16) / config->packet_per_second;
+    feedback_update_rate(fb);
+    fb->feedback = config->high_speed ? fb->rate_q16 : (fb->rate_q16 >> 2);
+    i2s_multiline_feedback_reset(fb);
+}
+
+void i2s_multiline_feedback_reset(i2s_multiline_feedback_t *fb)
+{
+    fb->i2s_started = false;
+    fb->usb_started = false;
+    fb->i2s_last_frames = 0;
+    fb->fill_min = UINT32_MAX;
+    fb->fill_max = 0;
+    fb->fill_sum = 0;
+    fb->fill_count = 0;
+}
+
+void i2s_multiline_feedback_i2s_event(i2s_multiline_feedback_t *fb, uint32_t played, uint64_t now)
+{
+    uint64_t dt;
+
+    if (!fb->i2s_started) {
+        fb->i2s_started = true;
+        fb->i2s_win_ts = now;
+        fb->i2s_win_frames = played;
+    } else {
+        dt = now - fb->i2s_win_ts;
+        if ((dt >= fb->window_cycles) && (played != fb->i2s_win_frames)) {
+            feedback_filter(&fb->i2s_cpf_q16, (dt << 16) / (played - fb->i2s_win_frames));
+            fb->i2s_win_ts = now;
+            fb->i2s_win_frames = played;
+        }
+    }
+    fb->i2s_last_ts = now;
+    fb->i2s_last_frames = played;
+}
+
+uint32_t i2s_multiline_feedback_usb_event(i2s_multiline_feedback_t *fb, uint32_t written, uint64_t now)
+{
+    uint32_t level;
+    uint64_t last_ts;
+    uint32_t played;
+    uint64_t elapsed;
+    uint32_t fill = 0;
+    int32_t corr;
+    int32_t limit;
+    uint64_t dt;
+
+    fb->packets++;
+    if (!fb->usb_started) {
+        fb->usb_started = true;
+        fb->usb_win_ts = now;
+        fb->usb_win_packets = fb->packets;
+        /* 第一个包写入之前环为空，I2S启动前以此为播放位置，位置计数不必从0开始 */
+        if (!fb->i2s_started) {
+            fb->i2s_last_frames = written;
+        }
+    } else {
+        dt = now - fb->usb_win_ts;
+        if (dt >= fb->window_cycles) {
+            feedback_filter(&fb->usb_cpp_q16, (dt << 16) / (fb->packets - fb->usb_win_packets));
+            fb->usb_win_ts = now;
+            fb->usb_win_packets = fb->packets;
+            feedback_update_rate(fb);
+        }
+    }
+
+    if (fb->i2s_started) {
+        /* 半周期回调可能在另一个中断中更新，成对读取 */
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        last_ts = fb->i2s_last_ts;
+        played = fb->i2s_last_frames;
+        restore_global_irq(level);
+
+        /* 从最近一次回调按速率插值，最多半个周期 */
+        elapsed = ((now - last_ts) << 16) / fb->i2s_cpf_q16;
+        if (elapsed > fb->config.period_frames / 2U) {
+            elapsed = fb->config.period_frames / 2U;
+        }
+        played += (uint32_t)elapsed;
+    } else {
+        played = fb->i2s_last_frames;
+    }
+    if ((int32_t)(written - played) > 0) {
+        fill = written - played;
+    }
+
+    /* 比例修正，限制在标称速率的1/256以内 */
+    corr = ((int32_t)fb->config.target_fill - (int32_t)fill) * fb->gain_q16;
+    limit = (int32_t)(fb->rate_q16 >> 8);
+    if (corr > limit) {
+        corr = limit;
+    } else if (corr < -limit) {
+        corr = -limit;
+    }
+    fb->feedback = (uint32_t)((int32_t)fb->rate_q16 + corr);
+    if (!fb->config.high_speed) {
+        fb->feedback >>= 2;
+    }
+
+    if (fb->i2s_started) {
+        if (fill < fb->fill_min) {
+            fb->fill_min = fill;
+        }
+        if (fill > fb->fill_max) {
+            fb->fill_max = fill;
+        }
+        fb->fill_sum += fill;
+        fb->fill_count++;
+    }
+    return fill;
+}
+
+uint32_t i2s_multiline_feedback_get_value(i2s_multiline_feedback_t *fb)
+{
+    return fb->feedback;
+}
+
+void i2s_multiline_feedback_get_stats(i2s_multiline_feedback_t *fb, i2s_multiline_feedback_stats_t *stats)
+{
+    uint32_t rate = fb->config.sample_rate;
+    uint32_t level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    uint32_t count = fb->fill_count;
+
+    stats->feedback = fb->feedback;
+    stats->i2s_rate_mhz = (uint32_t)(((uint64_t)fb->rate_q16 * fb->config.packet_per_second * 1000U) >> 16);
+    stats->packets = fb->packets;
+    if (count == 0U) {
+        stats->fill_min = 0;
+        stats->fill_avg = 0;
+        stats->fill_max = 0;
+    } else {
+        stats->fill_min = fb->fill_min;
+        stats->fill_avg = (uint32_t)(fb->fill_sum / count);
+        stats->fill_max = fb->fill_max;
+    }
+    fb->fill_min = UINT32_MAX;
+    fb->fill_max = 0;
+    fb->fill_sum = 0;
+    fb->fill_count = 0;
+    restore_global_irq(level);
+
+    stats->latency_min_us = (uint32_t)((uint64_t)stats->fill_min * 1000000U / rate);
+    stats->latency_avg_us = (uint32_t)((uint64_t)stats->fill_avg * 1000000U / rate);
+    stats->latency_max_us = (uint32_t)((uint64_t)stats->fill_max * 1000000U / rate);
+}
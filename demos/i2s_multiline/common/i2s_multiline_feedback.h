@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_FEEDBACK_H
+#define I2S_MULTILINE_FEEDBACK_H
+
+/*
+ * USB音频异步反馈值计算及缓冲遥测
+ *
+ * I2S按本地时钟消耗环中的数据，USB主机按SOF时钟发送等时包，两者有频偏。
+ * 两个速率都以CPU周期计数器为参照测量，CPU时钟在比值中抵消：
+ * - I2S：在流的半周期回调中记录已播放的帧数和时间戳，得到每帧的CPU周期数
+ * - USB：每个等时OUT包对应一个(微)帧，在包到达时记录时间戳，得到每个包的CPU周期数
+ * 反馈值 = 每个包的周期数 / 每帧的周期数，即每个(微)帧I2S实际消耗的帧数，
+ * 再按环中数据量与目标值的差做比例修正，使缓冲量稳定在目标值，既不因频偏欠载，也不持续增大延迟。
+ *
+ * 环中数据量在包到达时计算：已写入的帧数减去估计的播放位置，播放位置由最近一次半周期回调
+ * 按测得的速率插值，精度不受半周期粒度限制。同时统计缓冲量和端到端延迟(包到达到其第一个采样
+ * 开始输出)的最小、平均、最大值。
+ *
+ * 反馈值格式：高速为Q16.16(4字节)，全速为Q10.14(3字节)，小端发送。
+ * 两个事件函数可以在不同的中断中调用。
+ */
+
+#include "hpm_common.h"
+
+/* 比例修正的时间常数：缓冲量偏差在约该时间内被修正 */
+#define I2S_MULTILINE_FEEDBACK_TAU_MS       (500U)
+/* 速率测量窗口的默认值 */
+#define I2S_MULTILINE_FEEDBACK_WINDOW_MS    (250U)
+
+typedef struct {
+    uint32_t cpu_hz;                    /* 时间戳(CPU周期计数器)的频率 */
+    uint32_t sample_rate;               /* 标称采样率(Hz) */
+    uint16_t packet_per_second;         /* 每秒等时包数：高速bInterval=1时为8000，全速为1000 */
+    bool high_speed;                    /* 反馈值格式，高速Q16.16，全速Q10.14 */
+    uint32_t period_frames;             /* 流的周期帧数，限制播放位置的插值范围 */
+    uint32_t target_fill;               /* 目标缓冲帧数 */
+    uint32_t window_ms;                 /* 速率测量窗口，0使用默认值 */
+} i2s_multiline_feedback_config_t;
+
+typedef struct {
+    uint32_t feedback;                  /* 最近的反馈值(线上格式) */
+    uint32_t i2s_rate_mhz;              /* 以USB时钟计的I2S采样率(mHz) */
+    uint32_t packets;                   /* 收到的包数 */
+    uint32_t fill_min;                  /* 缓冲帧数，自上次读取统计以来 */
+    uint32_t fill_avg;
+    uint32_t fill_max;
+    uint32_t latency_min_us;            /* 端到端延迟，自上次读取统计以来 */
+    uint32_t latency_avg_us;
+    uint32_t latency_max_us;
+} i2s_multiline_feedback_stats_t;
+
+typedef struct {
+    i2s_multiline_feedback_config_t config;
+    uint64_t window_cycles;
+    int32_t gain_q16;                   /* 每帧缓冲偏差对应的修正量 */
+    /* I2S消耗 */
+    bool i2s_started;
+    uint64_t i2s_win_ts;
+    uint32_t i2s_win_frames;
+    volatile uint64_t i2s_last_ts;
+    volatile uint32_t i2s_last_frames;
+    uint64_t i2s_cpf_q16;               /* 每帧CPU周期数，Q16 */
+    /* USB包 */
+    bool usb_started;
+    uint64_t usb_win_ts;
+    uint32_t usb_win_packets;
+    uint32_t packets;
+    uint64_t usb_cpp_q16;               /* 每包CPU周期数，Q16 */
+    uint32_t rate_q16;                  /* 每包I2S消耗的帧数，Q16.16 */
+    uint32_t feedback;
+    /* 遥测 */
+    uint32_t fill_min;
+    uint32_t fill_max;
+    uint64_t fill_sum;
+    uint32_t fill_count;
+} i2s_multiline_feedback_t;
+
+void i2s_multiline_feedback_init(i2s_multiline_feedback_t *fb, const i2s_multiline_feedback_config_t *config);
+
+/* 重新开始测量(如流重新启动)，保留已测得的速率 */
+void i2s_multiline_feedback_reset(i2s_multiline_feedback_t *fb);
+
+/*
+ * 在流的半周期/周期回调中调用，played为播放位置(帧，如流的read_pos)，now为CPU周期计数。
+ * played和written是同一原点的32位自由运行计数，只使用两者之差，可以在2^32处回绕
+ */
+void i2s_multiline_feedback_i2s_event(i2s_multiline_feedback_t *fb, uint32_t played, uint64_t now);
+
+/*
+ * 在等时OUT包到达时、写入环之前调用，written为写位置(帧，如流的data_pos)，
+ * 返回当前缓冲帧数，并更新反馈值
+ */
+uint32_t i2s_multiline_feedback_usb_event(i2s_multiline_feedback_t *fb, uint32_t written, uint64_t now);
+
+/* 当前反馈值(线上格式) */
+uint32_t i2s_multiline_feedback_get_value(i2s_multiline_feedback_t *fb);
+
+/* 读取统计，并重新开始统计缓冲量和延迟的最小、最大、平均值 */
+void i2s_multiline_feedback_get_stats(i2s_multiline_feedback_t *fb, i2s_multiline_feedback_stats_t *stats);
+
+#endif /* I2S_MULTILINE_FEEDBACK_H */
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <math.h>
+#include "i2s_multiline_float.h"
+
+#define FLOAT_DEFAULT_SEED      (0x9E3779B9UL)
+
+static inline uint32_t float_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/*
+ * 转换一个采样，返回左对齐的32位字
+ * 先转换为Q30(保留1位余量，加抖动和舍入时不会溢出)，再按输出位数舍入并限幅
+ */
+static inline uint32_t float_one(float x, uint8_t bits, bool dither, uint32_t *state)
+{
+    uint8_t shift = 32U - bits;
+    int32_t max = (int32_t)((1UL << (bits - 1U)) - 1U);
+    int32_t q;
+    uint32_t r;
+
+    if (isnan(x)) {
+        x = 0.0f;
+    }
+    x = fminf(fmaxf(x, -1.0f), 1.0f);
+    if (bits == 32U) {
+        return (x >= 1.0f) ? (uint32_t)INT32_MAX : (uint32_t)(int32_t)(x * 2147483648.0f);
+    }
+
+    q = (int32_t)(x * 1073741824.0f);
+    if (dither) {
+        /* 两个16位均匀分布之差，单位为2^-16 LSB，换算到Q30 */
+        r = float_rand(state);
+        q += ((int32_t)(r & 0xFFFFU) - (int32_t)(r >> 16)) >> (17U - shift);
+    }
+    q = (q + (1L << (shift - 2U))) >> (shift - 1U);
+    if (q > max) {
+        q = max;
+    } else if (q < -max - 1) {
+        q = -max - 1;
+    }
+    return (uint32_t)q << shift;
+}
+
+/*
+ * n个声道按s[]的顺序写入dst，bits、dither、half为常量时由编译器展开为专用内核
+ * half为真时每个采样写16位(per_line引擎的16位环)
+ */
+static inline void float_kernel(void *dst, const float *s[], uint8_t n, uint16_t stride, uint32_t first,
+                                uint32_t frames, uint8_t bits, bool dither, bool half, uint32_t *state)
+{
+    uint32_t *d32 = (uint32_t *)dst;
+    uint16_t *d16 = (uint16_t *)dst;
+    uint32_t rand_state = *state;
+    uint32_t off = first * stride;
+
+    for (uint32_t f = 0; f < frames; f++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            if (half) {
+                d16[k] = (uint16_t)(float_one(s[k][off], bits, dither, &rand_state) >> 16);
+            } else {
+                d32[k] = float_one(s[k][off], bits, dither, &rand_state);
+            }
+        }
+        d32 += n;
+        d16 += n;
+        off += stride;
+    }
+    *state = rand_state;
+}
+
+static void float_dispatch(i2s_multiline_float_t *conv, void *dst, const float *s[], uint8_t n,
+                           uint32_t first, uint32_t frames)
+{
+    uint16_t stride = conv->config.src_stride;
+    bool dither = conv->config.dither;
+    bool half = (conv->config.layout == i2s_multiline_float_per_line) && (conv->config.out_bits == 16U);
+    uint32_t *state = &conv->rand_state;
+
+    switch (conv->config.out_bits) {
+    case 16U:
+        if (half) {
+            if (dither) {
+                float_kernel(dst, s, n, stride, first, frames, 16U, true, true, state);
+            } else {
+                float_kernel(dst, s, n, stride, first, frames, 16U, false, true, state);
+            }
+        } else {
+            if (dither) {
+                float_kernel(dst, s, n, stride, first, frames, 16U, true, false, state);
+            } else {
+                float_kernel(dst, s, n, stride, first, frames, 16U, false, false, state);
+            }
+        }
+        break;
+    case 24U:
+        if (dither) {
+            float_kernel(dst, s, n, stride, first, frames, 24U, true, false, state);
+        } else {
+            float_kernel(dst, s, n, stride, first, frames, 24U, false, false, state);
+        }
+        break;
+    default:
+        float_kernel(dst, s, n, stride, first, frames, 32U, false, false, state);
+        break;
+    }
+}
+
+hpm_stat_t i2s_multiline_float_init(i2s_multiline_float_t *conv, const i2s_multiline_float_config_t *config)
+{
+    if ((config->line_num == 0U) || (config->line_num > 4U) || (config->channel_per_line == 0U) ||
+        ((config->line_num * config->channel_per_line) > I2S_MULTILINE_FLOAT_MAX_CHANNEL) ||
+        ((config->out_bits != 16U) && (config->out_bits != 24U) && (config->out_bits != 32U)) ||
+        (config->layout > i2s_multiline_float_per_line)) {
+        return status_invalid_argument;
+    }
+
+    conv->config = *config;
+    if (conv->config.src_stride == 0U) {
+        conv->config.src_stride = 1U;
+    }
+    if (conv->config.out_bits == 32U) {
+        conv->config.dither = false;
+    }
+    conv->channel_num = config->line_num * config->channel_per_line;
+    conv->rand_state = (config->seed == 0U) ? FLOAT_DEFAULT_SEED : config->seed;
+    return status_success;
+}
+
+void i2s_multiline_float_convert(i2s_multiline_float_t *conv, void *const dst[], const float *const src[],
+                                 uint32_t first_frame, uint32_t frames)
+{
+    const float *s[I2S_MULTILINE_FLOAT_MAX_CHANNEL];
+    uint8_t lines = conv->config.line_num;
+    uint8_t cpl = conv->config.channel_per_line;
+
+    if (conv->config.layout == i2s_multiline_float_burst) {
+        /* 按burst顺序排列声道，帧内连续写入 */
+        for (uint8_t slot = 0; slot < cpl; slot++) {
+            for (uint8_t line = 0; line < lines; line++) {
+                s[slot * lines + line] = src[line * cpl + slot];
+            }
+        }
+        float_dispatch(conv, dst[0], s, conv->channel_num, first_frame, frames);
+    } else {
+        for (uint8_t line = 0; line < lines; line++) {
+            for (uint8_t slot = 0; slot < cpl; slot++) {
+                s[slot] = src[line * cpl + slot];
+            }
+            float_dispatch(conv, dst[line], s, cpl, first_frame, frames);
+        }
+    }
+}
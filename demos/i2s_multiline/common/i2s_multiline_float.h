@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_FLOAT_H
+#define I2S_MULTILINE_FLOAT_H
+
+/*
+ * float32转PCM接口，把上游DSP输出的浮点数据直接写入多数据线DMA环
+ *
+ * 输入为[-1.0, 1.0]的浮点采样，超出范围的值限幅，NaN输出为0，四舍五入到16、24或32位，
+ * 并左对齐(MSB对齐)到TXD。16、24位输出可叠加TPDF抖动：每个采样取一个xorshift32随机数，
+ * 高低16位之差为[-1, 1) LSB的三角分布；32位输出的精度已超过float，不加抖动。
+ *
+ * 输出布局与i2s_multiline_stream_get_write_ptr()返回的环一致：
+ * burst引擎为交织顺序，每帧依次为slot0的line0..lineN-1、slot1的line0..lineN-1 ...，每个采样32位；
+ * per_line引擎为每条数据线一个环，每帧channel_per_line个采样，16位输出每个采样16位，否则32位。
+ * 声道编号为 line * channel_per_line + slot，第ch个声道的第i帧位于src[ch][i * src_stride]，
+ * src_stride为1时为平面数据，为声道数且src[ch]指向交织帧的第ch个采样时为交织数据。
+ */
+
+#include "hpm_common.h"
+
+#define I2S_MULTILINE_FLOAT_MAX_CHANNEL (64U)
+
+typedef enum {
+    i2s_multiline_float_burst = 0,              /* burst引擎的交织环 */
+    i2s_multiline_float_per_line,               /* per_line引擎每条数据线一个环 */
+} i2s_multiline_float_layout_t;
+
+typedef struct {
+    i2s_multiline_float_layout_t layout;
+    uint8_t line_num;                           /* 数据线数 (1 ~ 4) */
+    uint8_t channel_per_line;                   /* 每条数据线每帧的通道数 */
+    uint8_t out_bits;                           /* 输出位数：16、24或32 */
+    bool dither;                                /* 使能TPDF抖动，32位输出时忽略 */
+    uint16_t src_stride;                        /* 源数据相邻帧的间隔(float个数)，0表示1 */
+    uint32_t seed;                              /* 随机数种子，0使用默认值 */
+} i2s_multiline_float_config_t;
+
+typedef struct {
+    i2s_multiline_float_config_t config;
+    uint8_t channel_num;                        /* 声道总数 */
+    uint32_t rand_state;                        /* xorshift32状态 */
+} i2s_multiline_float_t;
+
+hpm_stat_t i2s_multiline_float_init(i2s_multiline_float_t *conv, const i2s_multiline_float_config_t *config);
+
+/*
+ * 转换frames帧：src[ch]为第ch个声道，从第first_frame帧开始读取；
+ * dst[line]为各数据线的环写地址，burst布局只使用dst[0]
+ */
+void i2s_multiline_float_convert(i2s_multiline_float_t *conv, void *const dst[], const float *const src[],
+                                 uint32_t first_frame, uint32_t frames);
+
+#endif /* I2S_MULTILINE_FLOAT_H */
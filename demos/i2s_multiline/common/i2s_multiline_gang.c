@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "board.h"
+#include "i2s_multiline_gang.h"
+#include "i2s_multiline_dma_mgr.h"
+
+static void gang_release_plan(i2s_multiline_gang_dma_plan_t *plan)
+{
+    for (uint8_t i = 0; i < plan->channel_num; i++) {
+        i2s_multiline_dma_mgr_release(plan->dma, plan->channel[i]);
+    }
+    plan->channel_num = 0;
+}
+
+/* 从第一个有足够空闲通道的控制器上分配一个实例的全部通道 */
+static hpm_stat_t gang_plan_instance(i2s_multiline_gang_t *gang, uint8_t index)
+{
+    i2s_multiline_gang_config_t *cfg = &gang->config;
+    i2s_multiline_gang_dma_plan_t *plan = &gang->plan[index];
+    uint8_t need = (cfg->engine == i2s_multiline_engine_burst_dma) ? 1U : cfg->line_per_instance;
+
+    for (uint8_t d = 0; d < cfg->dma_num; d++) {
+        plan->dma = cfg->dma[d];
+        plan->channel_num = 0;
+        while (plan->channel_num < need) {
+            if (status_success != i2s_multiline_dma_mgr_request(plan->dma, cfg->instance[index].dma_req[plan->channel_num],
+                                                                &plan->channel[plan->channel_num])) {
+                break;
+            }
+            plan->channel_num++;
+        }
+        if (plan->channel_num == need) {
+            return status_success;
+        }
+        gang_release_plan(plan);
+    }
+    return status_fail;
+}
+
+static hpm_stat_t gang_init_stream(i2s_multiline_gang_t *gang, uint8_t index)
+{
+    i2s_multiline_gang_config_t *cfg = &gang->config;
+    i2s_multiline_gang_dma_plan_t *plan = &gang->plan[index];
+    i2s_multiline_stream_config_t config = {0};
+
+    config.i2s = cfg->instance[index].i2s;
+    config.dma = plan->dma;
+    config.dmamux = cfg->dmamux;
+    config.engine = cfg->engine;
+    config.line_num = cfg->line_per_instance;
+    memcpy(config.dma_channel, plan->channel, sizeof(config.dma_channel));
+    memcpy(config.dma_req, cfg->instance[index].dma_req, sizeof(config.dma_req));
+    memcpy(config.buffer, cfg->instance[index].buffer, sizeof(config.buffer));
+    config.dma_burst = cfg->dma_burst;
+    config.channel_per_line = cfg->channel_per_line;
+    config.audio_depth = cfg->audio_depth;
+    config.period_num = cfg->period_num;
+    config.period_frames = cfg->period_frames;
+    config.repeat_last_frame = cfg->repeat_last_frame;
+    /* 各实例同步推进，只由主设备的流回调应用 */
+    if (index == 0U) {
+        config.period_cb = cfg->period_cb;
+        config.user_data = cfg->user_data;
+    }
+    return i2s_multiline_stream_init(&gang->stream[index], &config);
+}
+
+hpm_stat_t i2s_multiline_gang_init(i2s_multiline_gang_t *gang, const i2s_multiline_gang_config_t *config)
+{
+    hpm_stat_t stat = status_success;
+    uint8_t planned = 0;
+
+    if ((config->instance_num == 0U) || (config->instance_num > I2S_MULTILINE_GANG_MAX_INSTANCE) ||
+        (config->dma_num == 0U) || (config->dma_num > I2S_MULTILINE_GANG_MAX_DMA) ||
+        (config->line_per_instance == 0U) || (config->line_per_instance > I2S_MULTILINE_MAX_LINE)) {
+        return status_invalid_argument;
+    }
+
+    memset(gang, 0, sizeof(*gang));
+    gang->config = *config;
+
+    while ((stat == status_success) && (planned < config->instance_num)) {
+        stat = gang_plan_instance(gang, planned);
+        if (stat == status_success) {
+            planned++;
+        }
+    }
+    for (uint8_t i = 0; (stat == status_success) && (i < config->instance_num); i++) {
+        stat = gang_init_stream(gang, i);
+        for (uint8_t ch = 0; (stat == status_success) && (ch < gang->plan[i].channel_num); ch++) {
+            stat = i2s_multiline_dma_mgr_set_callback(gang->plan[i].dma, gang->plan[i].channel[ch],
+                                                      i2s_multiline_stream_dma_callback, &gang->stream[i]);
+        }
+    }
+    if (stat != status_success) {
+        for (uint8_t i = 0; i < planned; i++) {
+            gang_release_plan(&gang->plan[i]);
+        }
+    }
+    return stat;
+}
+
+void i2s_multiline_gang_deinit(i2s_multiline_gang_t *gang)
+{
+    if (gang->running) {
+        i2s_multiline_gang_stop(gang);
+    }
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        gang_release_plan(&gang->plan[i]);
+    }
+}
+
+hpm_stat_t i2s_multiline_gang_config_i2s(i2s_multiline_gang_t *gang, uint32_t sample_rate, uint32_t mclk_hz,
+                                         uint8_t fifo_threshold)
+{
+    i2s_multiline_gang_config_t *cfg = &gang->config;
+    i2s_config_t i2s_config;
+    i2s_multiline_transfer_config_t transfer;
+    hpm_stat_t stat;
+    bool master;
+
+    for (uint8_t i = 0; i < cfg->instance_num; i++) {
+        master = (i == 0U);
+
+        i2s_get_default_config(cfg->instance[i].i2s, &i2s_config);
+        i2s_config.tx_fifo_threshold = fifo_threshold;
+        i2s_config.enable_mclk_out = master;
+        i2s_init(cfg->instance[i].i2s, &i2s_config);
+
+        i2s_get_default_multiline_transfer_config(&transfer);
+        transfer.sample_rate = sample_rate;
+        transfer.channel_num_per_frame = cfg->channel_per_line;
+        transfer.audio_depth = cfg->audio_depth;
+        transfer.channel_length = i2s_channel_length_32_bits;
+        transfer.master_mode = master;                  /* 从设备使用主设备的BCLK/FCLK */
+        transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;
+        for (uint8_t line = 0; line < cfg->line_per_instance; line++) {
+            transfer.tx_data_line_en[line] = true;
+            transfer.tx_channel_slot_mask[line] = (1UL << cfg->channel_per_line) - 1U;
+        }
+        stat = i2s_config_multiline_transfer(cfg->instance[i].i2s, mclk_hz, &transfer);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+    return status_success;
+}
+
+static uint32_t gang_recovery_sum(i2s_multiline_gang_t *gang)
+{
+    uint32_t sum = 0;
+
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        sum += gang->stream[i].recovery_count;
+    }
+    return sum;
+}
+
+hpm_stat_t i2s_multiline_gang_start(i2s_multiline_gang_t *gang)
+{
+    uint8_t num = gang->config.instance_num;
+    hpm_stat_t stat;
+
+    for (uint8_t i = 0; i < num; i++) {
+        stat = i2s_multiline_stream_prepare(&gang->stream[i]);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+    /* 从设备先使能，等待主设备的第一帧 */
+    for (uint8_t i = 1; i < num; i++) {
+        i2s_start(gang->config.instance[i].i2s);
+    }
+    i2s_start(gang->config.instance[0].i2s);
+
+    gang->recovery_seen = gang_recovery_sum(gang);
+    gang->running = true;
+    return status_success;
+}
+
+void i2s_multiline_gang_stop(i2s_multiline_gang_t *gang)
+{
+    /* 主设备停止后从设备不再有时钟，不会因停止顺序产生下溢 */
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_stop(&gang->stream[i]);
+    }
+    gang->running = false;
+}
+
+bool i2s_multiline_gang_task(i2s_multiline_gang_t *gang)
+{
+    i2s_multiline_stream_config_t config;
+    i2s_multiline_stream_t *stream;
+
+    if (!gang->running) {
+        return false;
+    }
+    /* 先完成各实例在中断中发起的恢复 */
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_task(&gang->stream[i]);
+    }
+    if (gang_recovery_sum(gang) == gang->recovery_seen) {
+        return false;
+    }
+
+    /* 有实例自行恢复，与其他实例错开了若干帧：保存统计后清空所有环并重新共同启动 */
+    i2s_multiline_gang_stop(gang);
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        stream = &gang->stream[i];
+        gang->base.underrun_count += stream->underrun_count;
+        gang->base.dma_error_count += stream->dma_error_count;
+        gang->base.fifo_underflow_count += stream->fifo_underflow_count;
+        gang->base.recovery_count += stream->recovery_count;
+        config = stream->config;
+        i2s_multiline_stream_init(stream, &config);
+    }
+    gang->base.resync_count++;
+    i2s_multiline_gang_start(gang);
+    return true;
+}
+
+hpm_stat_t i2s_multiline_gang_measure_skew(i2s_multiline_gang_t *gang, int32_t skew_samples[])
+{
+    i2s_multiline_gang_config_t *cfg = &gang->config;
+    int32_t line_samples = (int32_t)(cfg->period_frames * cfg->channel_per_line);
+    uint32_t fillings[I2S_MULTILINE_GANG_MAX_INSTANCE];
+    uint32_t played[I2S_MULTILINE_GANG_MAX_INSTANCE];
+    int32_t line_skew[I2S_MULTILINE_MAX_LINE];
+    uint32_t level;
+    uint8_t retry;
+    bool moved = true;
+    int32_t diff;
+    hpm_stat_t stat;
+
+    if (!gang->running) {
+        return status_fail;
+    }
+
+    /* 所有实例的FIFO深度在读取DMA剩余传输数前后都不变，说明读取期间各实例都没有推进 */
+    for (retry = 0; moved && (retry < 16U); retry++) {
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        for (uint8_t i = 0; i < cfg->instance_num; i++) {
+            fillings[i] = cfg->instance[i].i2s->TFIFO_FILLINGS;
+        }
+        for (uint8_t i = 0; i < cfg->instance_num; i++) {
+            played[i] = i2s_multiline_stream_get_line0_played(&gang->stream[i], fillings[i]);
+        }
+        moved = false;
+        for (uint8_t i = 0; i < cfg->instance_num; i++) {
+            if (cfg->instance[i].i2s->TFIFO_FILLINGS != fillings[i]) {
+                moved = true;
+            }
+        }
+        restore_global_irq(level);
+    }
+    if (moved) {
+        return status_timeout;
+    }
+
+    for (uint8_t i = 0; i < cfg->instance_num; i++) {
+        /* 实例之间的偏移折算到(-半周期, 半周期]，再加上实例内各数据线相对数据线0的偏移 */
+        diff = (int32_t)(played[i] - played[0]) % line_samples;
+        if (diff > line_samples / 2) {
+            diff -= line_samples;
+        } else if (diff <= -line_samples / 2) {
+            diff += line_samples;
+        }
+        stat = i2s_multiline_stream_measure_skew(&gang->stream[i], line_skew);
+        if (stat != status_success) {
+            return stat;
+        }
+        for (uint8_t line = 0; line < cfg->line_per_instance; line++) {
+            skew_samples[i * cfg->line_per_instance + line] = diff + line_skew[line];
+        }
+    }
+    return status_success;
+}
+
+void i2s_multiline_gang_get_stats(i2s_multiline_gang_t *gang, i2s_multiline_gang_stats_t *stats)
+{
+    i2s_multiline_stream_stats_t s;
+
+    *stats = gang->base;
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_get_stats(&gang->stream[i], &s);
+        stats->underrun_count += s.underrun_count;
+        stats->dma_error_count += s.dma_error_count;
+        stats->fifo_underflow_count += s.fifo_underflow_count;
+        stats->recovery_count += s.recovery_count;
+    }
+}
+
+uint32_t i2s_multiline_gang_get_free_frames(i2s_multiline_gang_t *gang)
+{
+    uint32_t frames = UINT32_MAX;
+    uint32_t n;
+
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        n = i2s_multiline_stream_get_free_frames(&gang->stream[i]);
+        if (n < frames) {
+            frames = n;
+        }
+    }
+    return frames;
+}
+
+uint32_t i2s_multiline_gang_get_queued_frames(i2s_multiline_gang_t *gang)
+{
+    uint32_t frames = UINT32_MAX;
+    uint32_t n;
+
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        n = i2s_multiline_stream_get_queued_frames(&gang->stream[i]);
+        if (n < frames) {
+            frames = n;
+        }
+    }
+    return frames;
+}
+
+uint32_t i2s_multiline_gang_write(i2s_multiline_gang_t *gang, const void *const line_data[], uint32_t frames)
+{
+    uint32_t free_frames = i2s_multiline_gang_get_free_frames(gang);
+    uint8_t ring_num = gang->stream[0].ring_num;
+
+    if (frames > free_frames) {
+        frames = free_frames;
+    }
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_write(&gang->stream[i], &line_data[i * ring_num], frames);
+    }
+    return frames;
+}
+
+uint32_t i2s_multiline_gang_get_write_ptr(i2s_multiline_gang_t *gang, void *ring_ptr[])
+{
+    uint32_t frames = UINT32_MAX;
+    uint8_t ring_num = gang->stream[0].ring_num;
+    uint32_t n;
+
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        n = i2s_multiline_stream_get_write_ptr(&gang->stream[i], &ring_ptr[i * ring_num]);
+        if (n < frames) {
+            frames = n;
+        }
+    }
+    return frames;
+}
+
+void i2s_multiline_gang_commit(i2s_multiline_gang_t *gang, uint32_t frames)
+{
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_commit(&gang->stream[i], frames);
+    }
+}
+
+void i2s_multiline_gang_drain(i2s_multiline_gang_t *gang)
+{
+    for (uint8_t i = 0; i < gang->config.instance_num; i++) {
+        i2s_multiline_stream_drain(&gang->stream[i]);
+    }
+}
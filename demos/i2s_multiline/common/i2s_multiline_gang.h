@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_GANG_H
+#define I2S_MULTILINE_GANG_H
+
+/*
+ * 多个I2S实例组成一个多数据线逻辑设备
+ *
+ * 一个I2S实例最多4条数据线，多个实例联动时最多可得到16条同步输出的数据线：
+ * - 共用时钟：instance[0]为主设备，输出BCLK/FCLK；其余实例为从设备，BCLK/FCLK输入需在板上连接到主设备的时钟引脚，
+ *   各实例的帧边界因此完全一致
+ * - 共同启动：各实例先配置DMA并预填充FIFO，从设备先使能并等待时钟，最后启动主设备，
+ *   所有实例在主设备输出的第一帧同时开始发送
+ * - 环形缓冲区：每个实例一个流(i2s_multiline_stream)，所有流使用相同的周期配置并同步写入，
+ *   对外为一个环：写入、零拷贝写指针和提交都同时作用于所有实例，全局数据线号为 实例 * 每实例数据线数 + 数据线
+ * - DMA规划：按实例依次从config.dma[]列出的控制器中分配该实例所需的全部通道(per_line引擎每条数据线一个，
+ *   burst引擎一个)，一个控制器的空闲通道不足时使用下一个，中断由i2s_multiline_dma_mgr分发
+ *
+ * 单个实例出错时由流自行恢复，但会与其他实例错开若干帧。i2s_multiline_gang_task检测到任一实例恢复后，
+ * 停止所有实例、清空所有环并重新共同启动，实例之间重新对齐。
+ * i2s_multiline_gang_measure_skew同时读取各实例的DMA剩余传输数和FIFO深度，测量各数据线相对全局数据线0的偏移。
+ */
+
+#include "hpm_common.h"
+#include "i2s_multiline_stream.h"
+
+#define I2S_MULTILINE_GANG_MAX_INSTANCE     (4U)
+#define I2S_MULTILINE_GANG_MAX_LINE         (I2S_MULTILINE_GANG_MAX_INSTANCE * I2S_MULTILINE_MAX_LINE)
+#define I2S_MULTILINE_GANG_MAX_DMA          (2U)
+
+typedef struct {
+    I2S_Type *i2s;
+    uint8_t dma_req[I2S_MULTILINE_MAX_LINE];        /* 每条数据线的DMA请求源，burst引擎只使用[0] */
+    void *buffer[I2S_MULTILINE_MAX_LINE];           /* 环形缓冲区，需位于非缓存区；burst引擎只使用[0] */
+} i2s_multiline_gang_instance_t;
+
+typedef struct {
+    uint8_t instance_num;                           /* 实例数，instance[0]为时钟主设备 */
+    i2s_multiline_gang_instance_t instance[I2S_MULTILINE_GANG_MAX_INSTANCE];
+    uint8_t dma_num;                                /* 可用的DMA控制器数 */
+    DMAV2_Type *dma[I2S_MULTILINE_GANG_MAX_DMA];    /* 按顺序分配的DMA控制器，需已登记到i2s_multiline_dma_mgr */
+    DMAMUX_Type *dmamux;
+    i2s_multiline_engine_t engine;                  /* 所有实例使用相同的DMA引擎 */
+    uint8_t line_per_instance;                      /* 每个实例的数据线数 */
+    uint8_t channel_per_line;
+    uint8_t audio_depth;
+    uint8_t period_num;
+    uint32_t period_frames;
+    uint8_t dma_burst;                              /* per_line引擎每次DMA请求传输的采样数 */
+    bool repeat_last_frame;
+    i2s_multiline_stream_cb_t period_cb;            /* 整周期回调，由instance[0]的流调用，可为NULL */
+    void *user_data;
+} i2s_multiline_gang_config_t;
+
+/* 一个实例的DMA规划 */
+typedef struct {
+    DMAV2_Type *dma;
+    uint8_t channel_num;
+    uint8_t channel[I2S_MULTILINE_MAX_LINE];
+} i2s_multiline_gang_dma_plan_t;
+
+typedef struct {
+    uint32_t underrun_count;                        /* 各实例之和，含重新同步之前的次数 */
+    uint32_t dma_error_count;
+    uint32_t fifo_underflow_count;
+    uint32_t recovery_count;
+    uint32_t resync_count;                          /* 所有实例重新共同启动的次数 */
+} i2s_multiline_gang_stats_t;
+
+/* 多实例设备，包含各实例的流(含DMA链表描述符)，需放置在非缓存区 */
+typedef struct {
+    i2s_multiline_stream_t stream[I2S_MULTILINE_GANG_MAX_INSTANCE];
+    i2s_multiline_gang_config_t config;
+    i2s_multiline_gang_dma_plan_t plan[I2S_MULTILINE_GANG_MAX_INSTANCE];
+    uint32_t recovery_seen;                         /* 上次检查时各实例恢复次数之和 */
+    i2s_multiline_gang_stats_t base;                /* 重新同步之前累计的统计 */
+    volatile bool running;
+} i2s_multiline_gang_t;
+
+/* 规划并分配DMA通道，初始化各实例的流，DMA通道不足时返回status_fail且不占用通道 */
+hpm_stat_t i2s_multiline_gang_init(i2s_multiline_gang_t *gang, const i2s_multiline_gang_config_t *config);
+
+/* 释放DMA通道 */
+void i2s_multiline_gang_deinit(i2s_multiline_gang_t *gang);
+
+/*
+ * 配置所有实例的I2S：instance[0]为主模式并输出MCLK，其余为从模式，
+ * 各实例使能line_per_instance条数据线，mclk_hz为主设备的I2S时钟频率
+ */
+hpm_stat_t i2s_multiline_gang_config_i2s(i2s_multiline_gang_t *gang, uint32_t sample_rate, uint32_t mclk_hz,
+                                         uint8_t fifo_threshold);
+
+/* 共同启动：所有实例预填充FIFO后，先启动从设备，最后启动主设备 */
+hpm_stat_t i2s_multiline_gang_start(i2s_multiline_gang_t *gang);
+
+/* 先停止主设备的时钟，再停止各从设备 */
+void i2s_multiline_gang_stop(i2s_multiline_gang_t *gang);
+
+/* 在主循环中调用，完成各实例在中断中发起的恢复，任一实例恢复后重新共同启动所有实例，返回是否进行了重新同步 */
+bool i2s_multiline_gang_task(i2s_multiline_gang_t *gang);
+
+/* 各数据线相对全局数据线0的偏移(采样数)，skew_samples按全局数据线号排列 */
+hpm_stat_t i2s_multiline_gang_measure_skew(i2s_multiline_gang_t *gang, int32_t skew_samples[]);
+
+void i2s_multiline_gang_get_stats(i2s_multiline_gang_t *gang, i2s_multiline_gang_stats_t *stats);
+
+/* 所有实例中最少的可写入帧数 */
+uint32_t i2s_multiline_gang_get_free_frames(i2s_multiline_gang_t *gang);
+/* 所有实例中最少的已写入但尚未播放的帧数 */
+uint32_t i2s_multiline_gang_get_queued_frames(i2s_multiline_gang_t *gang);
+
+/*
+ * 拷贝方式写入所有实例，返回实际写入的帧数
+ * per_line引擎：line_data[]按全局数据线号排列；burst引擎：line_data[instance]为该实例按burst顺序交织的数据
+ */
+uint32_t i2s_multiline_gang_write(i2s_multiline_gang_t *gang, const void *const line_data[], uint32_t frames);
+
+/*
+ * 零拷贝方式写入：返回所有实例都可连续写入的帧数，
+ * ring_ptr[]与i2s_multiline_gang_write的line_data[]排列相同
+ */
+uint32_t i2s_multiline_gang_get_write_ptr(i2s_multiline_gang_t *gang, void *ring_ptr[]);
+void i2s_multiline_gang_commit(i2s_multiline_gang_t *gang, uint32_t frames);
+
+/* 标记数据已全部写入 */
+void i2s_multiline_gang_drain(i2s_multiline_gang_t *gang);
+
+#endif /* I2S_MULTILINE_GANG_H */
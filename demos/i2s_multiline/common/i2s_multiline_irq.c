@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_irq.h"
+
+static void irq_fill_s32(i2s_multiline_irq_t *engine, uint32_t pos, uint32_t n)
+{
+    I2S_Type *i2s = engine->config.i2s;
+    uint8_t shift = engine->shift;
+
+    for (uint8_t line = 0; line < engine->config.line_num; line++) {
+        const uint32_t *src = (const uint32_t *)engine->config.line_data[line] + pos;
+        for (uint32_t i = 0; i < n; i++) {
+            i2s->TXD[line] = src[i] << shift;
+        }
+    }
+}
+
+static void irq_fill_s16(i2s_multiline_irq_t *engine, uint32_t pos, uint32_t n)
+{
+    I2S_Type *i2s = engine->config.i2s;
+
+    for (uint8_t line = 0; line < engine->config.line_num; line++) {
+        const uint16_t *src = (const uint16_t *)engine->config.line_data[line] + pos;
+        for (uint32_t i = 0; i < n; i++) {
+            i2s->TXD[line] = (uint32_t)src[i] << 16;
+        }
+    }
+}
+
+/* 4条数据线时展开，每个采样位置依次写入4个TXD */
+static void irq_fill_s32_4line(i2s_multiline_irq_t *engine, uint32_t pos, uint32_t n)
+{
+    I2S_Type *i2s = engine->config.i2s;
+    uint8_t shift = engine->shift;
+    const uint32_t *src0 = (const uint32_t *)engine->config.line_data[0] + pos;
+    const uint32_t *src1 = (const uint32_t *)engine->config.line_data[1] + pos;
+    const uint32_t *src2 = (const uint32_t *)engine->config.line_data[2] + pos;
+    const uint32_t *src3 = (const uint32_t *)engine->config.line_data[3] + pos;
+
+    for (uint32_t i = 0; i < n; i++) {
+        i2s->TXD[0] = src0[i] << shift;
+        i2s->TXD[1] = src1[i] << shift;
+        i2s->TXD[2] = src2[i] << shift;
+        i2s->TXD[3] = src3[i] << shift;
+    }
+}
+
+static void irq_fill_s16_4line(i2s_multiline_irq_t *engine, uint32_t pos, uint32_t n)
+{
+    I2S_Type *i2s = engine->config.i2s;
+    const uint16_t *src0 = (const uint16_t *)engine->config.line_data[0] + pos;
+    const uint16_t *src1 = (const uint16_t *)engine->config.line_data[1] + pos;
+    const uint16_t *src2 = (const uint16_t *)engine->config.line_data[2] + pos;
+    const uint16_t *src3 = (const uint16_t *)engine->config.line_data[3] + pos;
+
+    for (uint32_t i = 0; i < n; i++) {
+        i2s->TXD[0] = (uint32_t)src0[i] << 16;
+        i2s->TXD[1] = (uint32_t)src1[i] << 16;
+        i2s->TXD[2] = (uint32_t)src2[i] << 16;
+        i2s->TXD[3] = (uint32_t)src3[i] << 16;
+    }
+}
+
+hpm_stat_t i2s_multiline_irq_init(i2s_multiline_irq_t *engine, const i2s_multiline_irq_config_t *config)
+{
+    if ((config->line_num == 0U) || (config->line_num > I2S_MULTILINE_IRQ_MAX_LINE) ||
+        (config->channel_per_line == 0U) || (config->frames == 0U) ||
+        (config->fifo_threshold >= I2S_SOC_MAX_TX_FIFO_DEPTH) ||
+        ((config->audio_depth != 16U) && (config->audio_depth != 24U) && (config->audio_depth != 32U))) {
+        return status_invalid_argument;
+    }
+    for (uint8_t line = 0; line < config->line_num; line++) {
+        if (config->line_data[line] == NULL) {
+            return status_invalid_argument;
+        }
+    }
+
+    memset(engine, 0, sizeof(*engine));
+    engine->config = *config;
+    engine->samples = config->frames * config->channel_per_line;
+    engine->batch = I2S_SOC_MAX_TX_FIFO_DEPTH - config->fifo_threshold;
+    engine->min_cycles = UINT32_MAX;
+    if (config->audio_depth == 16U) {
+        engine->fill = (config->line_num == 4U) ? irq_fill_s16_4line : irq_fill_s16;
+    } else {
+        engine->shift = 32U - config->audio_depth;
+        engine->fill = (config->line_num == 4U) ? irq_fill_s32_4line : irq_fill_s32;
+    }
+    return status_success;
+}
+
+void i2s_multiline_irq_start(i2s_multiline_irq_t *engine)
+{
+    engine->pos = 0;
+    engine->loops = 0;
+    engine->complete = false;
+    i2s_enable_irq(engine->config.i2s, i2s_tx_fifo_threshold_irq_mask);
+    i2s_start(engine->config.i2s);
+}
+
+void i2s_multiline_irq_stop(i2s_multiline_irq_t *engine)
+{
+    i2s_disable_irq(engine->config.i2s, i2s_tx_fifo_threshold_irq_mask);
+    i2s_stop(engine->config.i2s);
+}
+
+/* 填充一批采样，源数据末尾处最多拆分为两段 */
+static void irq_fill_batch(i2s_multiline_irq_t *engine)
+{
+    uint32_t n = engine->batch;
+    uint32_t chunk;
+
+    while (n > 0U) {
+        chunk = engine->samples - engine->pos;
+        if (chunk > n) {
+            chunk = n;
+        }
+        engine->fill(engine, engine->pos, chunk);
+        engine->pos += chunk;
+        n -= chunk;
+
+        if (engine->pos == engine->samples) {
+            engine->pos = 0;
+            engine->loops++;
+            if ((engine->config.loop_count != 0U) && (engine->loops >= engine->config.loop_count)) {
+                engine->complete = true;
+                i2s_disable_irq(engine->config.i2s, i2s_tx_fifo_threshold_irq_mask);
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * 下溢恢复：清空所有数据线的FIFO，使各数据线重新从同一帧边界开始，
+ * 以静音或最后一帧预填充FIFO后重新启动I2S
+ */
+static void irq_recover(i2s_multiline_irq_t *engine)
+{
+    I2S_Type *i2s = engine->config.i2s;
+    uint8_t cpl = engine->config.channel_per_line;
+    uint32_t start = read_csr(CSR_MCYCLE);
+    uint32_t last_frame;
+    uint32_t fill_frames;
+    uint32_t cycles;
+
+    i2s_stop(i2s);
+    i2s_reset_tx(i2s);
+
+    /* 批量填充可能在帧中间结束，从下一帧边界继续 */
+    engine->pos = (engine->pos + cpl - 1U) / cpl * cpl;
+    if (engine->pos >= engine->samples) {
+        engine->pos = 0;
+    }
+    last_frame = ((engine->pos == 0U) ? engine->samples : engine->pos) - cpl;
+
+    fill_frames = engine->batch / cpl;
+    if (fill_frames == 0U) {
+        fill_frames = 1U;
+    }
+    for (uint32_t f = 0; f < fill_frames; f++) {
+        if (engine->config.repeat_last_frame) {
+            engine->fill(engine, last_frame, cpl);
+        } else {
+            for (uint8_t line = 0; line < engine->config.line_num; line++) {
+                for (uint8_t slot = 0; slot < cpl; slot++) {
+                    i2s->TXD[line] = 0;
+                }
+            }
+        }
+    }
+    i2s_start(i2s);
+
+    cycles = read_csr(CSR_MCYCLE) - start;
+    engine->underflow_count++;
+    engine->recovery_cycles_last = cycles;
+    if (cycles > engine->recovery_cycles_max) {
+        engine->recovery_cycles_max = cycles;
+    }
+}
+
+void i2s_multiline_irq_handler(i2s_multiline_irq_t *engine)
+{
+    uint32_t start = read_csr(CSR_MCYCLE);
+    uint32_t stat = i2s_get_irq_status(engine->config.i2s);
+    uint32_t cycles;
+
+    /* 各数据线同步运行，只需判断第0条数据线的阈值标志 */
+    if (((stat & I2S_STA_TX_UD_MASK) != 0U) && !engine->complete) {
+        i2s_clear_irq_status(engine->config.i2s, stat);
+        irq_recover(engine);
+    } else {
+        if ((stat & (1UL << I2S_STA_TX_DN_SHIFT)) != 0U) {
+            irq_fill_batch(engine);
+        }
+        i2s_clear_irq_status(engine->config.i2s, stat);
+    }
+
+    cycles = read_csr(CSR_MCYCLE) - start;
+    if (cycles < engine->min_cycles) {
+        engine->min_cycles = cycles;
+    }
+    if (cycles > engine->max_cycles) {
+        engine->max_cycles = cycles;
+    }
+    engine->total_cycles += cycles;
+    engine->irq_count++;
+}
+
+void i2s_multiline_irq_get_stats(i2s_multiline_irq_t *engine, i2s_multiline_irq_stats_t *stats)
+{
+    stats->irq_count = engine->irq_count;
+    stats->total_cycles = engine->total_cycles;
+    stats->max_cycles = engine->max_cycles;
+    stats->underflow_count = engine->underflow_count;
+    stats->recovery_cycles_last = engine->recovery_cycles_last;
+    stats->recovery_cycles_max = engine->recovery_cycles_max;
+    if (engine->irq_count == 0U) {
+        stats->min_cycles = 0;
+        stats->avg_cycles = 0;
+    } else {
+        stats->min_cycles = engine->min_cycles;
+        stats->avg_cycles = (uint32_t)(engine->total_cycles / engine->irq_count);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_IRQ_H
+#define I2S_MULTILINE_IRQ_H
+
+/*
+ * I2S多数据线中断发送引擎，用于没有DMAv2 burst功能或每条line独立DMA请求的芯片
+ *
+ * 每条数据线有独立的源数据指针，源数据按帧交织(每帧channel_per_line个采样)并循环播放。
+ * 左对齐移位量和采样步长在初始化时计算，中断中按批填充FIFO，内循环没有逐采样的分支。
+ * 中断耗时使用mcycle统计最小/平均/最大值。
+ *
+ * 发送FIFO下溢时不终止播放：清空所有数据线的FIFO，从下一帧边界继续，
+ * 先以静音或最后一帧预填充FIFO再重新启动，下溢次数和恢复耗时计入统计。
+ */
+
+#include "hpm_common.h"
+#include "hpm_i2s_drv.h"
+
+#define I2S_MULTILINE_IRQ_MAX_LINE  (4U)
+
+typedef struct {
+    I2S_Type *i2s;
+    uint8_t line_num;                                   /* 使用的数据线数 */
+    uint8_t channel_per_line;                           /* 每条数据线每帧的通道数 */
+    uint8_t audio_depth;                                /* 音频位深 (16/24/32 bits) */
+    uint8_t fifo_threshold;                             /* 与I2S配置一致的发送FIFO阈值 */
+    const void *line_data[I2S_MULTILINE_IRQ_MAX_LINE];  /* 每条数据线的源数据，16位为int16_t，24/32位为右对齐的int32_t */
+    uint32_t frames;                                    /* 源数据帧数 */
+    uint32_t loop_count;                                /* 循环播放次数，0表示一直播放 */
+    bool repeat_last_frame;                             /* 下溢恢复时重复最后一帧，否则填充静音 */
+} i2s_multiline_irq_config_t;
+
+typedef struct {
+    uint32_t irq_count;
+    uint32_t min_cycles;
+    uint32_t avg_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint32_t underflow_count;
+    uint32_t recovery_cycles_last;
+    uint32_t recovery_cycles_max;
+} i2s_multiline_irq_stats_t;
+
+typedef struct i2s_multiline_irq i2s_multiline_irq_t;
+
+/* 从第pos个采样开始向各数据线写入n个采样 */
+typedef void (*i2s_multiline_irq_fill_t)(i2s_multiline_irq_t *engine, uint32_t pos, uint32_t n);
+
+struct i2s_multiline_irq {
+    i2s_multiline_irq_config_t config;
+    i2s_multiline_irq_fill_t fill;                      /* 按位深和数据线数选择的填充函数 */
+    uint8_t shift;                                      /* 左对齐移位量 */
+    uint8_t batch;                                      /* 每次中断每条数据线填充的采样数 */
+    uint32_t samples;                                   /* 每条数据线源数据的采样数 */
+    uint32_t pos;                                       /* 当前采样位置 */
+    volatile uint32_t loops;                            /* 已播放的循环次数 */
+    volatile bool complete;
+    volatile uint32_t underflow_count;
+    uint32_t recovery_cycles_last;
+    uint32_t recovery_cycles_max;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    volatile uint32_t irq_count;
+};
+
+hpm_stat_t i2s_multiline_irq_init(i2s_multiline_irq_t *engine, const i2s_multiline_irq_config_t *config);
+/* 使能阈值中断并启动I2S，FIFO由随后的中断填充 */
+void i2s_multiline_irq_start(i2s_multiline_irq_t *engine);
+void i2s_multiline_irq_stop(i2s_multiline_irq_t *engine);
+
+/* 在应用的I2S中断处理函数中调用 */
+void i2s_multiline_irq_handler(i2s_multiline_irq_t *engine);
+
+void i2s_multiline_irq_get_stats(i2s_multiline_irq_t *engine, i2s_multiline_irq_stats_t *stats);
+
+#endif /* I2S_MULTILINE_IRQ_H */
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "i2s_multiline_mix.h"
+
+#if defined(__riscv_dsp)
+#include <nds_intrinsic.h>
+#endif
+
+static inline int32_t mix_saturate_q31(int64_t v)
+{
+    if (v > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (v < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)v;
+}
+
+static inline int16_t mix_saturate_q15(int64_t v)
+{
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+/* 由当前增益重新生成非零增益列表，并判断是否为单位阵 */
+static void mix_update_taps(i2s_multiline_mix_t *mix)
+{
+    bool identity = (mix->config.in_num == mix->config.out_num) && (mix->ramp_left == 0U);
+    int32_t g;
+    uint8_t k;
+
+    for (uint8_t n = 0; n < mix->config.out_num; n++) {
+        k = 0;
+        for (uint8_t m = 0; m < mix->config.in_num; m++) {
+            g = mix->gain[n][m];
+            if (g != ((m == n) ? I2S_MULTILINE_MIX_UNITY : 0)) {
+                identity = false;
+            }
+            if (g == 0) {
+                continue;
+            }
+            if (mix->config.format == i2s_multiline_mix_q15) {
+                /* Q31转Q15，四舍五入，1.0饱和为0x7FFF */
+                g = mix_saturate_q15(((int64_t)g + 0x8000) >> 16);
+            }
+            mix->tap_in[n][k] = m;
+            mix->tap_gain[n][k] = g;
+            k++;
+        }
+        mix->tap_num[n] = k;
+    }
+    mix->identity = identity;
+}
+
+/* 开始向target过渡，ramp_frames为0时立即生效 */
+static void mix_start_ramp(i2s_multiline_mix_t *mix)
+{
+    uint32_t segments = (mix->config.ramp_frames + I2S_MULTILINE_MIX_RAMP_BLOCK - 1U) / I2S_MULTILINE_MIX_RAMP_BLOCK;
+
+    if (segments == 0U) {
+        memcpy(mix->gain, mix->target, sizeof(mix->gain));
+        mix->ramp_left = 0;
+    } else {
+        for (uint8_t n = 0; n < mix->config.out_num; n++) {
+            for (uint8_t m = 0; m < mix->config.in_num; m++) {
+                mix->step[n][m] = (int32_t)(((int64_t)mix->target[n][m] - mix->gain[n][m]) / (int32_t)segments);
+            }
+        }
+        mix->ramp_left = segments;
+    }
+    mix->ramp_pos = 0;
+    mix_update_taps(mix);
+}
+
+/* 当前段结束，增益前进一段，最后一段直接取目标值以消除步进的舍入误差 */
+static void mix_ramp_advance(i2s_multiline_mix_t *mix)
+{
+    mix->ramp_left--;
+    mix->ramp_pos = 0;
+    if (mix->ramp_left == 0U) {
+        memcpy(mix->gain, mix->target, sizeof(mix->gain));
+    } else {
+        for (uint8_t n = 0; n < mix->config.out_num; n++) {
+            for (uint8_t m = 0; m < mix->config.in_num; m++) {
+                mix->gain[n][m] += mix->step[n][m];
+            }
+        }
+    }
+    mix_update_taps(mix);
+}
+
+static void mix_q31(const i2s_multiline_mix_t *mix, const void *const in[], void *const out[],
+                    uint32_t first, uint32_t frames)
+{
+    const int32_t *x[I2S_MULTILINE_MIX_MAX_CHANNEL];
+    const int32_t *g;
+    int32_t *y;
+    uint8_t taps;
+    int64_t acc_h;
+    int64_t acc_l;
+
+    for (uint8_t n = 0; n < mix->config.out_num; n++) {
+        y = (int32_t *)out[n] + first;
+        taps = mix->tap_num[n];
+        g = mix->tap_gain[n];
+        if (taps == 0U) {
+            memset(y, 0, frames * sizeof(int32_t));
+            continue;
+        }
+        for (uint8_t k = 0; k < taps; k++) {
+            x[k] = (const int32_t *)in[mix->tap_in[n][k]] + first;
+        }
+        /*
+         * 16个满幅乘积之和可达2^66，超出64位累加器。增益拆为高16位(有符号)和低16位(无符号)分别累加，
+         * 每项不超过2^47，结果与完整精度的 (sum(x * g) + 2^30) >> 31 相同
+         */
+        for (uint32_t i = 0; i < frames; i++) {
+            acc_h = 0;
+            acc_l = 1LL << 30;
+            for (uint8_t k = 0; k < taps; k++) {
+#if defined(__riscv_dsp)
+                acc_h = __nds__smar64(acc_h, x[k][i], g[k] >> 16);
+                acc_l = __nds__smar64(acc_l, x[k][i], g[k] & 0xFFFF);
+#else
+                acc_h += (int64_t)x[k][i] * (g[k] >> 16);
+                acc_l += (int64_t)x[k][i] * (g[k] & 0xFFFF);
+#endif
+            }
+            y[i] = mix_saturate_q31((acc_h + (acc_l >> 16)) >> 15);
+        }
+    }
+}
+
+static inline int16_t mix_q15_frame(const int16_t *const x[], const int32_t *g, uint8_t taps, uint32_t i)
+{
+    int64_t acc = 1LL << 14;
+
+    for (uint8_t k = 0; k < taps; k++) {
+        acc += (int32_t)x[k][i] * g[k];
+    }
+    return mix_saturate_q15(acc >> 15);
+}
+
+static void mix_q15(const i2s_multiline_mix_t *mix, const void *const in[], void *const out[],
+                    uint32_t first, uint32_t frames)
+{
+    const int16_t *x[I2S_MULTILINE_MIX_MAX_CHANNEL];
+    const int32_t *g;
+    int16_t *y;
+    uint8_t taps;
+    uint32_t i;
+
+    for (uint8_t n = 0; n < mix->config.out_num; n++) {
+        y = (int16_t *)out[n] + first;
+        taps = mix->tap_num[n];
+        g = mix->tap_gain[n];
+        if (taps == 0U) {
+            memset(y, 0, frames * sizeof(int16_t));
+            continue;
+        }
+        for (uint8_t k = 0; k < taps; k++) {
+            x[k] = (const int16_t *)in[mix->tap_in[n][k]] + first;
+        }
+        i = 0;
+#if defined(__riscv_dsp)
+        /*
+         * 打包SIMD：一个32位字为相邻两帧，低半字为前一帧。
+         * 两帧分别以32位饱和累加Q30乘积，要求输出和所有输入按字对齐
+         */
+        {
+            uint32_t gp[I2S_MULTILINE_MIX_MAX_CHANNEL];
+            bool aligned;
+            long lo;
+            long hi;
+            uint32_t xv;
+
+            if (((uint32_t)y & 2U) && (frames > 0U)) {
+                y[0] = mix_q15_frame(x, g, taps, 0);
+                i = 1;
+            }
+            aligned = true;
+            for (uint8_t k = 0; k < taps; k++) {
+                gp[k] = ((uint32_t)g[k] << 16) | ((uint32_t)g[k] & 0xFFFFU);
+                if (((uint32_t)&x[k][i] & 3U) != 0U) {
+                    aligned = false;
+                }
+            }
+            if (aligned) {
+                for (; i + 1U < frames; i += 2U) {
+                    lo = 1L << 14;
+                    hi = 1L << 14;
+                    for (uint8_t k = 0; k < taps; k++) {
+                        xv = *(const uint32_t *)&x[k][i];
+                        lo = __nds__kmabb(lo, xv, gp[k]);
+                        hi = __nds__kmatt(hi, xv, gp[k]);
+                    }
+                    *(uint32_t *)&y[i] = __nds__pkbb16(__nds__sclip32(hi >> 15, 15), __nds__sclip32(lo >> 15, 15));
+                }
+            }
+        }
+#endif
+        for (; i < frames; i++) {
+            y[i] = mix_q15_frame(x, g, taps, i);
+        }
+    }
+}
+
+hpm_stat_t i2s_multiline_mix_init(i2s_multiline_mix_t *mix, const i2s_multiline_mix_config_t *config)
+{
+    if ((config->in_num == 0U) || (config->in_num > I2S_MULTILINE_MIX_MAX_CHANNEL) ||
+        (config->out_num == 0U) || (config->out_num > I2S_MULTILINE_MIX_MAX_CHANNEL) ||
+        (config->format > i2s_multiline_mix_q31)) {
+        return status_invalid_argument;
+    }
+
+    memset(mix, 0, sizeof(*mix));
+    mix->config = *config;
+    if (config->in_num == config->out_num) {
+        for (uint8_t n = 0; n < config->out_num; n++) {
+            mix->target[n][n] = I2S_MULTILINE_MIX_UNITY;
+        }
+    }
+    memcpy(mix->gain, mix->target, sizeof(mix->gain));
+    mix_update_taps(mix);
+    return status_success;
+}
+
+void i2s_multiline_mix_set_matrix(i2s_multiline_mix_t *mix, const int32_t *matrix)
+{
+    for (uint8_t n = 0; n < mix->config.out_num; n++) {
+        for (uint8_t m = 0; m < mix->config.in_num; m++) {
+            mix->target[n][m] = matrix[n * mix->config.in_num + m];
+        }
+    }
+    mix_start_ramp(mix);
+}
+
+void i2s_multiline_mix_set_gain(i2s_multiline_mix_t *mix, uint8_t out, uint8_t in, int32_t gain)
+{
+    if ((out >= mix->config.out_num) || (in >= mix->config.in_num)) {
+        return;
+    }
+    mix->target[out][in] = gain;
+    mix_start_ramp(mix);
+}
+
+const void *const *i2s_multiline_mix_process(i2s_multiline_mix_t *mix, const void *const in[],
+                                             void *const out[], uint32_t frames)
+{
+    uint32_t first = 0;
+    uint32_t n;
+
+    if (mix->identity) {
+        return in;
+    }
+
+    while (first < frames) {
+        n = frames - first;
+        if ((mix->ramp_left > 0U) && (n > I2S_MULTILINE_MIX_RAMP_BLOCK - mix->ramp_pos)) {
+            n = I2S_MULTILINE_MIX_RAMP_BLOCK - mix->ramp_pos;
+        }
+        if (mix->config.format == i2s_multiline_mix_q15) {
+            mix_q15(mix, in, out, first, n);
+        } else {
+            mix_q31(mix, in, out, first, n);
+        }
+        first += n;
+        if (mix->ramp_left > 0U) {
+            mix->ramp_pos += n;
+            if (mix->ramp_pos == I2S_MULTILINE_MIX_RAMP_BLOCK) {
+                mix_ramp_advance(mix);
+            }
+        }
+    }
+    return (const void *const *)out;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_MIX_H
+#define I2S_MULTILINE_MIX_H
+
+/*
+ * 增益/混音矩阵，位于生产者和多数据线DMA环之间，例如把立体声分配到8个扬声器声道并微调各声道增益
+ *
+ * out[n] = sum(gain[n][m] * in[m])，输入M声道、输出N声道，数据为平面Q15(int16_t)或Q31(int32_t)，
+ * 增益统一以Q31给出，I2S_MULTILINE_MIX_UNITY为1.0。结果饱和到数据格式的范围。
+ * 每个输出只对非零增益的输入累加，路由类的稀疏矩阵只计算实际用到的输入。
+ * 修改增益时在ramp_frames帧内按I2S_MULTILINE_MIX_RAMP_BLOCK帧一段线性过渡，避免爆音。
+ * 矩阵为单位阵且不在过渡中时直接返回输入指针，不拷贝数据。
+ * 内核支持Andes DSP扩展(__riscv_dsp)时，Q15每次处理两帧的打包数据，Q31使用64位乘累加指令。
+ */
+
+#include "hpm_common.h"
+
+#define I2S_MULTILINE_MIX_MAX_CHANNEL   (16U)
+#define I2S_MULTILINE_MIX_UNITY         (INT32_MAX)     /* 增益1.0，Q31 */
+#define I2S_MULTILINE_MIX_RAMP_BLOCK    (16U)           /* 过渡期间增益每段的帧数 */
+
+typedef enum {
+    i2s_multiline_mix_q15 = 0,                  /* int16_t */
+    i2s_multiline_mix_q31,                      /* int32_t */
+} i2s_multiline_mix_format_t;
+
+typedef struct {
+    i2s_multiline_mix_format_t format;
+    uint8_t in_num;                             /* 输入声道数 */
+    uint8_t out_num;                            /* 输出声道数 */
+    uint32_t ramp_frames;                       /* 增益过渡的帧数，0表示立即生效 */
+} i2s_multiline_mix_config_t;
+
+typedef struct {
+    i2s_multiline_mix_config_t config;
+    int32_t gain[I2S_MULTILINE_MIX_MAX_CHANNEL][I2S_MULTILINE_MIX_MAX_CHANNEL];     /* 当前增益 */
+    int32_t target[I2S_MULTILINE_MIX_MAX_CHANNEL][I2S_MULTILINE_MIX_MAX_CHANNEL];   /* 目标增益 */
+    int32_t step[I2S_MULTILINE_MIX_MAX_CHANNEL][I2S_MULTILINE_MIX_MAX_CHANNEL];     /* 每段的增益变化 */
+    uint32_t ramp_left;                         /* 剩余的过渡段数 */
+    uint32_t ramp_pos;                          /* 当前段已处理的帧数 */
+    bool identity;                              /* 当前为单位阵 */
+    /* 每个输出的非零增益列表，由当前增益生成 */
+    uint8_t tap_num[I2S_MULTILINE_MIX_MAX_CHANNEL];
+    uint8_t tap_in[I2S_MULTILINE_MIX_MAX_CHANNEL][I2S_MULTILINE_MIX_MAX_CHANNEL];
+    int32_t tap_gain[I2S_MULTILINE_MIX_MAX_CHANNEL][I2S_MULTILINE_MIX_MAX_CHANNEL]; /* Q15格式时为Q15 */
+} i2s_multiline_mix_t;
+
+/* 初始化，输入输出声道数相同时为单位阵，否则全部为0 */
+hpm_stat_t i2s_multiline_mix_init(i2s_multiline_mix_t *mix, const i2s_multiline_mix_config_t *config);
+
+/* 设置整个矩阵，matrix为out_num行in_num列的Q31增益，按行存放 */
+void i2s_multiline_mix_set_matrix(i2s_multiline_mix_t *mix, const int32_t *matrix);
+
+/* 设置单个增益 */
+void i2s_multiline_mix_set_gain(i2s_multiline_mix_t *mix, uint8_t out, uint8_t in, int32_t gain);
+
+/*
+ * 处理frames帧：in[m]为输入声道，out[n]为输出缓冲区。
+ * 返回应交给打包接口的声道指针数组，单位阵时为in，否则为out。
+ * 与set_matrix/set_gain在同一上下文中调用
+ */
+const void *const *i2s_multiline_mix_process(i2s_multiline_mix_t *mix, const void *const in[],
+                                             void *const out[], uint32_t frames);
+
+#endif /* I2S_MULTILINE_MIX_H */
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "i2s_multiline_pack.h"
+
+/* 常用配置(4条数据线，每条2个通道)下展开的声道数 */
+#define PACK_UNROLL_CHANNEL     (8U)
+
+static inline uint32_t pack_one(const i2s_multiline_pack_t *pack, const uint8_t *p)
+{
+    /* 按字节读取，源地址可不对齐 */
+    switch (pack->config.format) {
+    case i2s_multiline_pack_s16:
+        return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 24);
+    case i2s_multiline_pack_s24:
+        return ((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24);
+    default:
+        return (((uint32_t)p[0]) | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24)) << pack->shift;
+    }
+}
+
+/* 逐个采样打包，用于不对齐的头部及不足一组的尾部 */
+static void pack_scalar(const i2s_multiline_pack_t *pack, uint32_t *dst, const uint8_t *s[],
+                        uint32_t first, uint32_t frames)
+{
+    uint8_t n = pack->channel_num;
+    uint8_t bytes = pack->sample_bytes;
+
+    for (uint32_t f = first; f < first + frames; f++) {
+        for (uint8_t k = 0; k < n; k++) {
+            *dst++ = pack_one(pack, s[k] + f * bytes);
+        }
+    }
+}
+
+static bool pack_word_aligned(const uint8_t *s[], uint8_t n, uint32_t offset)
+{
+    for (uint8_t k = 0; k < n; k++) {
+        if (((uint32_t)(s[k] + offset) & 3U) != 0U) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 32位：每帧每声道一次加载一次写入 */
+static inline void pack_s32_frames(uint32_t *dst, const uint8_t *s[], uint8_t n, uint8_t shift,
+                                   uint32_t first, uint32_t frames)
+{
+    for (uint32_t f = first; f < first + frames; f++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            dst[k] = ((const uint32_t *)s[k])[f] << shift;
+        }
+        dst += n;
+    }
+}
+
+/* 16位：一次加载32位得到2帧的采样，低半字为前一帧 */
+static inline void pack_s16_pairs(uint32_t *dst, const uint8_t *s[], uint8_t n, uint32_t first_pair, uint32_t pairs)
+{
+    uint32_t w;
+
+    for (uint32_t i = first_pair; i < first_pair + pairs; i++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            w = ((const uint32_t *)s[k])[i];
+            dst[k] = w << 16;
+            dst[n + k] = w & 0xFFFF0000UL;
+        }
+        dst += 2U * n;
+    }
+}
+
+/* 24位：一次加载3个字得到4帧的采样 */
+static inline void pack_s24_quads(uint32_t *dst, const uint8_t *s[], uint8_t n, uint32_t first_quad, uint32_t quads)
+{
+    const uint32_t *p;
+    uint32_t w0, w1, w2;
+
+    for (uint32_t i = first_quad; i < first_quad + quads; i++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            p = (const uint32_t *)s[k] + 3U * i;
+            w0 = p[0];
+            w1 = p[1];
+            w2 = p[2];
+            dst[k] = w0 << 8;
+            dst[n + k] = ((w0 >> 24) << 8) | (w1 << 16);
+            dst[2U * n + k] = ((w1 >> 16) << 8) | (w2 << 24);
+            dst[3U * n + k] = w2 & 0xFFFFFF00UL;
+        }
+        dst += 4U * n;
+    }
+}
+
+hpm_stat_t i2s_multiline_pack_init(i2s_multiline_pack_t *pack, const i2s_multiline_pack_config_t *config)
+{
+    uint8_t valid_bits;
+
+    if ((config->line_num == 0U) || (config->line_num > 4U) || (config->channel_per_line == 0U) ||
+        ((config->line_num * config->channel_per_line) > I2S_MULTILINE_PACK_MAX_CHANNEL) ||
+        (config->valid_bits > 32U)) {
+        return status_invalid_argument;
+    }
+
+    pack->config = *config;
+    pack->channel_num = config->line_num * config->channel_per_line;
+    switch (config->format) {
+    case i2s_multiline_pack_s16:
+        pack->sample_bytes = 2U;
+        valid_bits = 16U;
+        break;
+    case i2s_multiline_pack_s24:
+        pack->sample_bytes = 3U;
+        valid_bits = 24U;
+        break;
+    case i2s_multiline_pack_s32:
+        pack->sample_bytes = 4U;
+        valid_bits = (config->valid_bits == 0U) ? 32U : config->valid_bits;
+        break;
+    default:
+        return status_invalid_argument;
+    }
+    pack->shift = 32U - valid_bits;
+    return status_success;
+}
+
+void i2s_multiline_pack(const i2s_multiline_pack_t *pack, uint32_t *dst, const void *const src[],
+                        uint32_t first_frame, uint32_t frames)
+{
+    const uint8_t *s[I2S_MULTILINE_PACK_MAX_CHANNEL];
+    uint8_t n = pack->channel_num;
+    uint8_t lines = pack->config.line_num;
+    uint8_t cpl = pack->config.channel_per_line;
+    uint32_t head;
+    uint32_t groups;
+
+    /* 按输出顺序(slot优先，line其次)排列源指针，广播模式下同一slot的各数据线共用一个源 */
+    for (uint8_t k = 0; k < n; k++) {
+        s[k] = (const uint8_t *)src[pack->config.broadcast ? (k / lines) : ((k % lines) * cpl + k / lines)];
+    }
+
+    switch (pack->config.format) {
+    case i2s_multiline_pack_s16:
+        head = first_frame & 1U;
+        if (head > frames) {
+            head = frames;
+        }
+        pack_scalar(pack, dst, s, first_frame, head);
+        dst += head * n;
+        first_frame += head;
+        frames -= head;
+        if (!pack_word_aligned(s, n, first_frame * 2U)) {
+            break;
+        }
+        groups = frames / 2U;
+        if (n == PACK_UNROLL_CHANNEL) {
+            pack_s16_pairs(dst, s, PACK_UNROLL_CHANNEL, first_frame / 2U, groups);
+        } else {
+            pack_s16_pairs(dst, s, n, first_frame / 2U, groups);
+        }
+        dst += groups * 2U * n;
+        first_frame += groups * 2U;
+        frames -= groups * 2U;
+        break;
+    case i2s_multiline_pack_s24:
+        head = (4U - (first_frame & 3U)) & 3U;
+        if (head > frames) {
+            head = frames;
+        }
+        pack_scalar(pack, dst, s, first_frame, head);
+        dst += head * n;
+        first_frame += head;
+        frames -= head;
+        if (!pack_word_aligned(s, n, first_frame * 3U)) {
+            break;
+        }
+        groups = frames / 4U;
+        if (n == PACK_UNROLL_CHANNEL) {
+            pack_s24_quads(dst, s, PACK_UNROLL_CHANNEL, first_frame / 4U, groups);
+        } else {
+            pack_s24_quads(dst, s, n, first_frame / 4U, groups);
+        }
+        dst += groups * 4U * n;
+        first_frame += groups * 4U;
+        frames -= groups * 4U;
+        break;
+    default:
+        if (!pack_word_aligned(s, n, first_frame * 4U)) {
+            break;
+        }
+        if (n == PACK_UNROLL_CHANNEL) {
+            pack_s32_frames(dst, s, PACK_UNROLL_CHANNEL, pack->shift, first_frame, frames);
+        } else {
+            pack_s32_frames(dst, s, n, pack->shift, first_frame, frames);
+        }
+        frames = 0;
+        break;
+    }
+
+    /* 源缓冲区未按字对齐或剩余不足一组 */
+    pack_scalar(pack, dst, s, first_frame, frames);
+}
+
+static inline void unpack_one(const i2s_multiline_pack_t *pack, uint8_t *p, uint32_t w)
+{
+    /* 按字节写入，目标地址可不对齐 */
+    switch (pack->config.format) {
+    case i2s_multiline_pack_s16:
+        p[0] = (uint8_t)(w >> 16);
+        p[1] = (uint8_t)(w >> 24);
+        break;
+    case i2s_multiline_pack_s24:
+        p[0] = (uint8_t)(w >> 8);
+        p[1] = (uint8_t)(w >> 16);
+        p[2] = (uint8_t)(w >> 24);
+        break;
+    default:
+        w = (uint32_t)((int32_t)w >> pack->shift);
+        p[0] = (uint8_t)w;
+        p[1] = (uint8_t)(w >> 8);
+        p[2] = (uint8_t)(w >> 16);
+        p[3] = (uint8_t)(w >> 24);
+        break;
+    }
+}
+
+static void unpack_scalar(const i2s_multiline_pack_t *pack, uint8_t *d[], uint32_t first,
+                          const uint32_t *src, uint32_t frames)
+{
+    uint8_t n = pack->channel_num;
+    uint8_t bytes = pack->sample_bytes;
+
+    for (uint32_t f = first; f < first + frames; f++) {
+        for (uint8_t k = 0; k < n; k++) {
+            unpack_one(pack, d[k] + f * bytes, *src++);
+        }
+    }
+}
+
+static inline void unpack_s32_frames(uint8_t *d[], const uint32_t *src, uint8_t n, uint8_t shift,
+                                     uint32_t first, uint32_t frames)
+{
+    for (uint32_t f = first; f < first + frames; f++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            ((int32_t *)d[k])[f] = (int32_t)src[k] >> shift;
+        }
+        src += n;
+    }
+}
+
+/* 16位：2帧的采样合并为一个字写入 */
+static inline void unpack_s16_pairs(uint8_t *d[], const uint32_t *src, uint8_t n, uint32_t first_pair, uint32_t pairs)
+{
+    for (uint32_t i = first_pair; i < first_pair + pairs; i++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            ((uint32_t *)d[k])[i] = (src[k] >> 16) | (src[n + k] & 0xFFFF0000UL);
+        }
+        src += 2U * n;
+    }
+}
+
+/* 24位：4帧的采样合并为3个字写入 */
+static inline void unpack_s24_quads(uint8_t *d[], const uint32_t *src, uint8_t n, uint32_t first_quad, uint32_t quads)
+{
+    uint32_t *p;
+    uint32_t a, b, c, e;
+
+    for (uint32_t i = first_quad; i < first_quad + quads; i++) {
+#pragma GCC unroll 8
+        for (uint8_t k = 0; k < n; k++) {
+            p = (uint32_t *)d[k] + 3U * i;
+            /* 接收的字低8位不属于采样，左移前须清除，否则会覆盖前一个采样的高字节 */
+            a = src[k];
+            b = src[n + k] & 0xFFFFFF00UL;
+            c = src[2U * n + k] & 0xFFFFFF00UL;
+            e = src[3U * n + k];
+            p[0] = (a >> 8) | (b << 16);
+            p[1] = (b >> 16) | (c << 8);
+            p[2] = (c >> 24) | (e & 0xFFFFFF00UL);
+        }
+        src += 4U * n;
+    }
+}
+
+void i2s_multiline_unpack(const i2s_multiline_pack_t *pack, void *const dst[], uint32_t first_frame,
+                          const uint32_t *src, uint32_t frames)
+{
+    uint8_t *d[I2S_MULTILINE_PACK_MAX_CHANNEL];
+    uint8_t n = pack->channel_num;
+    uint8_t lines = pack->config.line_num;
+    uint8_t cpl = pack->config.channel_per_line;
+    uint32_t head;
+    uint32_t groups;
+
+    for (uint8_t k = 0; k < n; k++) {
+        d[k] = (uint8_t *)dst[(k % lines) * cpl + k / lines];
+    }
+
+    switch (pack->config.format) {
+    case i2s_multiline_pack_s16:
+        head = first_frame & 1U;
+        if (head > frames) {
+            head = frames;
+        }
+        unpack_scalar(pack, d, first_frame, src, head);
+        src += head * n;
+        first_frame += head;
+        frames -= head;
+        if (!pack_word_aligned((const uint8_t **)d, n, first_frame * 2U)) {
+            break;
+        }
+        groups = frames / 2U;
+        if (n == PACK_UNROLL_CHANNEL) {
+            unpack_s16_pairs(d, src, PACK_UNROLL_CHANNEL, first_frame / 2U, groups);
+        } else {
+            unpack_s16_pairs(d, src, n, first_frame / 2U, groups);
+        }
+        src += groups * 2U * n;
+        first_frame += groups * 2U;
+        frames -= groups * 2U;
+        break;
+    case i2s_multiline_pack_s24:
+        head = (4U - (first_frame & 3U)) & 3U;
+        if (head > frames) {
+            head = frames;
+        }
+        unpack_scalar(pack, d, first_frame, src, head);
+        src += head * n;
+        first_frame += head;
+        frames -= head;
+        if (!pack_word_aligned((const uint8_t **)d, n, first_frame * 3U)) {
+            break;
+        }
+        groups = frames / 4U;
+        if (n == PACK_UNROLL_CHANNEL) {
+            unpack_s24_quads(d, src, PACK_UNROLL_CHANNEL, first_frame / 4U, groups);
+        } else {
+            unpack_s24_quads(d, src, n, first_frame / 4U, groups);
+        }
+        src += groups * 4U * n;
+        first_frame += groups * 4U;
+        frames -= groups * 4U;
+        break;
+    default:
+        if (!pack_word_aligned((const uint8_t **)d, n, first_frame * 4U)) {
+            break;
+        }
+        if (n == PACK_UNROLL_CHANNEL) {
+            unpack_s32_frames(d, src, PACK_UNROLL_CHANNEL, pack->shift, first_frame, frames);
+        } else {
+            unpack_s32_frames(d, src, n, pack->shift, first_frame, frames);
+        }
+        frames = 0;
+        break;
+    }
+
+    unpack_scalar(pack, d, first_frame, src, frames);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_PACK_H
+#define I2S_MULTILINE_PACK_H
+
+/*
+ * 平面(planar)音频数据打包接口
+ *
+ * 将line_num * channel_per_line个独立的平面声道缓冲区打包为burst引擎所需的顺序：
+ * 每帧依次为slot0的line0..lineN-1、slot1的line0..lineN-1 ...，每个采样占32位并左对齐
+ * (MSB对齐)到TXD。声道编号为 line * channel_per_line + slot。
+ * 广播模式下只有channel_per_line个源声道，每个slot的数据复制到所有数据线，源数据只需存放一份。
+ *
+ * 输出可以是独立的缓冲区，也可以直接是i2s_multiline_stream_get_write_ptr()返回的环形缓冲区写地址。
+ *
+ * 解包为打包的逆过程，将接收到的burst顺序数据拆分为平面声道，采样右移还原为源格式。
+ */
+
+#include "hpm_common.h"
+
+#define I2S_MULTILINE_PACK_MAX_CHANNEL  (64U)   /* 4条数据线，每条16个TDM时隙 */
+
+typedef enum {
+    i2s_multiline_pack_s16 = 0,     /* int16_t */
+    i2s_multiline_pack_s24,         /* 紧凑24位，每个采样3字节，小端 */
+    i2s_multiline_pack_s32,         /* int32_t，有效位数由valid_bits指定并右对齐 */
+} i2s_multiline_pack_format_t;
+
+typedef struct {
+    i2s_multiline_pack_format_t format;
+    uint8_t line_num;               /* 数据线数 (1 ~ 4) */
+    uint8_t channel_per_line;       /* 每条数据线每帧的通道数 */
+    uint8_t valid_bits;             /* s32格式的有效位数(如24表示右对齐的24位)，0表示32 */
+    bool broadcast;                 /* 广播模式，只用于打包 */
+} i2s_multiline_pack_config_t;
+
+typedef struct {
+    i2s_multiline_pack_config_t config;
+    uint8_t channel_num;            /* 输出声道总数 */
+    uint8_t shift;                  /* 左对齐到32位需左移的位数 */
+    uint8_t sample_bytes;           /* 源采样字节数 */
+} i2s_multiline_pack_t;
+
+hpm_stat_t i2s_multiline_pack_init(i2s_multiline_pack_t *pack, const i2s_multiline_pack_config_t *config);
+
+/*
+ * 打包frames帧：src[ch]为第ch个声道的平面缓冲区(广播模式下ch为slot)，从其第first_frame帧开始读取，
+ * dst需能容纳 frames * channel_num 个32位字
+ */
+void i2s_multiline_pack(const i2s_multiline_pack_t *pack, uint32_t *dst, const void *const src[],
+                        uint32_t first_frame, uint32_t frames);
+
+/*
+ * 解包frames帧：src为burst顺序的数据(frames * channel_num个32位字)，
+ * dst[ch]为第ch个声道的平面缓冲区，从其第first_frame帧开始写入
+ */
+void i2s_multiline_unpack(const i2s_multiline_pack_t *pack, void *const dst[], uint32_t first_frame,
+                          const uint32_t *src, uint32_t frames);
+
+#endif /* I2S_MULTILINE_PACK_H */
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "i2s_multiline_sched.h"
+
+#define SCHED_PPB   (1000000000LL)
+
+static inline uint32_t sched_samples_per_second(i2s_multiline_sched_t *sched)
+{
+    return sched->config.sample_rate * sched->stream->config.channel_per_line;
+}
+
+/*
+ * 根据基准和最新的对应点更新漂移。流自行恢复后播放中断过一段时间，以当前点重新建立基准，
+ * 漂移由采样时钟决定，保留之前的值
+ */
+static void sched_update(i2s_multiline_sched_t *sched, const i2s_multiline_sched_point_t *point)
+{
+    uint64_t span_ticks;
+    uint64_t span_samples;
+    int64_t expected;
+    int64_t ppb;
+
+    if (sched->stream->recovery_count != sched->recovery_seen) {
+        sched->recovery_seen = sched->stream->recovery_count;
+        sched->anchor = *point;
+    }
+    sched->last = *point;
+
+    span_ticks = point->tick - sched->anchor.tick;
+    span_samples = point->samples - sched->anchor.samples;
+    if ((span_samples == 0U) ||
+        (span_ticks < (uint64_t)sched->config.mchtmr_hz / 1000U * I2S_MULTILINE_SCHED_MIN_FIT_MS)) {
+        return;
+    }
+    expected = (int64_t)(span_samples * sched->config.mchtmr_hz / sched_samples_per_second(sched));
+    ppb = ((int64_t)span_ticks - expected) * SCHED_PPB / expected;
+    if (ppb > I2S_MULTILINE_SCHED_MAX_DRIFT_PPB) {
+        ppb = I2S_MULTILINE_SCHED_MAX_DRIFT_PPB;
+    } else if (ppb < -I2S_MULTILINE_SCHED_MAX_DRIFT_PPB) {
+        ppb = -I2S_MULTILINE_SCHED_MAX_DRIFT_PPB;
+    }
+    sched->tick_ppb = (int32_t)ppb;
+}
+
+/*
+ * 关中断读取mchtmr、FIFO深度和DMA剩余传输数，读取前后FIFO深度不变时有效。
+ * 数据线0在当前周期内已输出的采样数只确定了模一个周期的位置，
+ * 关中断时DMA位于已完成的半周期之后的半个周期内(中断未及时处理时略超出)，
+ * 取与其 + 1/4周期最接近的同余位置。已完成的帧数由半周期计数得出，
+ * 与呈现时间戳的帧序号一致，不受32位读位置回绕的影响
+ */
+static hpm_stat_t sched_measure(i2s_multiline_sched_t *sched, i2s_multiline_sched_point_t *point)
+{
+    i2s_multiline_stream_config_t *cfg = &sched->stream->config;
+    int64_t line_samples = (int64_t)cfg->period_frames * cfg->channel_per_line;
+    uint32_t fillings;
+    uint32_t played;
+    uint32_t half_periods;
+    uint32_t level;
+    uint64_t ref;
+    int64_t in_period;
+    int64_t m;
+    bool moved;
+
+    for (uint8_t retry = 0; retry < 16U; retry++) {
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        fillings = cfg->i2s->TFIFO_FILLINGS;
+        point->tick = mchtmr_get_count(sched->config.mchtmr);
+        played = i2s_multiline_stream_get_line0_played(sched->stream, fillings);
+        half_periods = sched->stream->half_period_count;
+        moved = (cfg->i2s->TFIFO_FILLINGS != fillings);
+        if (!moved) {
+            in_period = (int64_t)(int32_t)played % line_samples;
+            if (in_period < 0) {
+                in_period += line_samples;
+            }
+            ref = ((uint64_t)half_periods * (cfg->period_frames / 2U) + cfg->period_frames / 4U) * cfg->channel_per_line;
+            m = (int64_t)(ref % (uint64_t)line_samples) - in_period;
+            if (m < 0) {
+                m += line_samples;
+            }
+            point->samples = ref - (uint64_t)m;
+            if (m > line_samples / 2) {
+                point->samples += (uint64_t)line_samples;
+            }
+            sched_update(sched, point);
+            restore_global_irq(level);
+            return status_success;
+        }
+        restore_global_irq(level);
+    }
+    sched->measure_fail_count++;
+    return status_timeout;
+}
+
+/* 整周期回调：测量对应点并给出刚播放完的周期的呈现时间戳 */
+static void sched_period_cb(i2s_multiline_stream_t *stream, uint32_t period, void *user_data)
+{
+    i2s_multiline_sched_t *sched = (i2s_multiline_sched_t *)user_data;
+    i2s_multiline_sched_point_t point;
+    uint64_t pts;
+
+    sched_measure(sched, &point);
+    pts = i2s_multiline_sched_frame_to_tick(sched, period * stream->config.period_frames);
+    sched->last_pts = pts;
+    sched->period_count++;
+
+    if (sched->config.pts_cb != NULL) {
+        sched->config.pts_cb(sched, period, pts, sched->config.user_data);
+    }
+    if (sched->period_cb != NULL) {
+        sched->period_cb(stream, period, sched->period_user_data);
+    }
+}
+
+hpm_stat_t i2s_multiline_sched_init(i2s_multiline_sched_t *sched, i2s_multiline_stream_t *stream,
+                                    const i2s_multiline_sched_config_t *config)
+{
+    if ((config->mchtmr == NULL) || (config->mchtmr_hz == 0U) || (config->sample_rate == 0U) ||
+        (stream->config.period_cb == sched_period_cb)) {
+        return status_invalid_argument;
+    }
+
+    memset(sched, 0, sizeof(*sched));
+    sched->stream = stream;
+    sched->config = *config;
+    sched->period_cb = stream->config.period_cb;
+    sched->period_user_data = stream->config.user_data;
+    stream->config.period_cb = sched_period_cb;
+    stream->config.user_data = sched;
+    return status_success;
+}
+
+uint64_t i2s_multiline_sched_now(i2s_multiline_sched_t *sched)
+{
+    return mchtmr_get_count(sched->config.mchtmr);
+}
+
+uint64_t i2s_multiline_sched_us_to_tick(i2s_multiline_sched_t *sched, uint64_t us)
+{
+    return us * sched->config.mchtmr_hz / 1000000U;
+}
+
+hpm_stat_t i2s_multiline_sched_start_at(i2s_multiline_sched_t *sched, uint64_t start_tick)
+{
+    uint64_t lead = i2s_multiline_sched_us_to_tick(sched, I2S_MULTILINE_SCHED_LEAD_US);
+    uint64_t spin = i2s_multiline_sched_us_to_tick(sched, I2S_MULTILINE_SCHED_SPIN_US);
+    uint64_t now = i2s_multiline_sched_now(sched);
+    uint32_t level;
+    hpm_stat_t stat;
+
+    if ((start_tick <= now) || (start_tick - now < lead)) {
+        return status_invalid_argument;
+    }
+
+    /* 提前配置DMA并预填充FIFO，I2S启动前DMA不会产生中断 */
+    while (i2s_multiline_sched_now(sched) < start_tick - lead) {
+    }
+    stat = i2s_multiline_stream_prepare(sched->stream);
+    if (stat != status_success) {
+        return stat;
+    }
+    while (i2s_multiline_sched_now(sched) < start_tick - spin) {
+    }
+
+    /* 最后一段关中断忙等，到达时刻后立即启动 */
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    now = i2s_multiline_sched_now(sched);
+    if (now >= start_tick) {
+        restore_global_irq(level);
+        i2s_multiline_stream_stop(sched->stream);
+        return status_timeout;
+    }
+    while (now < start_tick) {
+        now = i2s_multiline_sched_now(sched);
+    }
+    i2s_start(sched->stream->config.i2s);
+
+    sched->start_tick = start_tick;
+    sched->start_error = (int32_t)(now - start_tick);
+    sched->anchor.tick = now;
+    sched->anchor.samples = 0;
+    sched->last = sched->anchor;
+    sched->recovery_seen = sched->stream->recovery_count;
+    sched->period_count = 0;
+    restore_global_irq(level);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_sched_correlate(i2s_multiline_sched_t *sched, i2s_multiline_sched_point_t *point)
+{
+    if (!sched->stream->running || sched->stream->recover_pending) {
+        return status_fail;
+    }
+    return sched_measure(sched, point);
+}
+
+int32_t i2s_multiline_sched_get_drift_ppb(i2s_multiline_sched_t *sched)
+{
+    int64_t tick_ppb = sched->tick_ppb;
+
+    /* 每个采样的计数偏差为d时，采样率偏差为 -d / (1 + d) */
+    return (int32_t)(-tick_ppb * SCHED_PPB / (SCHED_PPB + tick_ppb));
+}
+
+uint64_t i2s_multiline_sched_frame_to_tick(i2s_multiline_sched_t *sched, uint32_t frame)
+{
+    i2s_multiline_sched_point_t anchor;
+    int64_t tick_ppb;
+    int64_t ds;
+    int64_t nominal;
+    uint32_t level;
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    anchor = sched->anchor;
+    tick_ppb = sched->tick_ppb;
+    restore_global_irq(level);
+
+    ds = (int64_t)((uint64_t)frame * sched->stream->config.channel_per_line - anchor.samples);
+    nominal = ds * (int64_t)sched->config.mchtmr_hz / (int64_t)sched_samples_per_second(sched);
+    return anchor.tick + (uint64_t)(nominal + nominal * tick_ppb / SCHED_PPB);
+}
+
+uint32_t i2s_multiline_sched_tick_to_frame(i2s_multiline_sched_t *sched, uint64_t tick)
+{
+    i2s_multiline_sched_point_t anchor;
+    uint8_t cpl = sched->stream->config.channel_per_line;
+    int64_t tick_ppb;
+    uint64_t ds;
+    uint64_t nominal;
+    uint32_t level;
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    anchor = sched->anchor;
+    tick_ppb = sched->tick_ppb;
+    restore_global_irq(level);
+
+    if (tick <= anchor.tick) {
+        return (uint32_t)(anchor.samples / cpl);
+    }
+    /* 实际计数 = 标称计数 * (1 + d)，反推标称计数 */
+    ds = tick - anchor.tick;
+    nominal = (uint64_t)((int64_t)ds - (int64_t)ds * tick_ppb / (SCHED_PPB + tick_ppb));
+    return (uint32_t)((anchor.samples + nominal * sched->config.sample_rate / sched->config.mchtmr_hz * cpl) / cpl);
+}
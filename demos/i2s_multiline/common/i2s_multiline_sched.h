@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_SCHED_H
+#define I2S_MULTILINE_SCHED_H
+
+/*
+ * 基于机器定时器(mchtmr)的流式发送定时调度
+ *
+ * - 定时启动：i2s_multiline_sched_start_at在指定的mchtmr计数启动流，第一帧从该时刻开始输出。
+ *   提前I2S_MULTILINE_SCHED_LEAD_US配置DMA并预填充FIFO，最后一段关中断忙等，
+ *   到达时刻后立即启动I2S，实际启动时刻与请求时刻的差记录在start_error中。
+ *   多块板的mchtmr同步(如由PTP校准)后，在同一时刻启动即可同时开始播放
+ * - 对应关系：在关中断的情况下同时读取mchtmr、发送FIFO深度和DMA剩余传输数，
+ *   得到数据线0已输出的采样数与mchtmr计数的一组对应点。每个整周期中断中自动测量一次，
+ *   也可由应用调用i2s_multiline_sched_correlate。以启动时刻(或最近一次恢复后的第一个点)为基准，
+ *   由最新的点计算I2S采样时钟相对mchtmr的漂移，用于帧序号与mchtmr计数的相互换算
+ * - 呈现时间戳：每个整周期中断回调pts_cb，给出刚播放完的周期第一帧开始输出的mchtmr计数
+ *
+ * 流出错自行恢复时播放中断了一段时间，恢复后重新建立基准。
+ * 换算只使用整数运算，可在中断上下文中调用。
+ */
+
+#include "hpm_common.h"
+#include "hpm_mchtmr_drv.h"
+#include "i2s_multiline_stream.h"
+
+/* 启动前提前配置DMA和预填充FIFO的时间，需大于I2S_MULTILINE_STREAM_PREFILL_TIMEOUT_US */
+#define I2S_MULTILINE_SCHED_LEAD_US         (1000U)
+/* 最后关中断忙等的时间 */
+#define I2S_MULTILINE_SCHED_SPIN_US         (20U)
+/* 基准与最新对应点间隔不足该时长时按标称采样率换算 */
+#define I2S_MULTILINE_SCHED_MIN_FIT_MS      (100U)
+/* 漂移的限幅(ppb) */
+#define I2S_MULTILINE_SCHED_MAX_DRIFT_PPB   (1000000)
+
+typedef struct i2s_multiline_sched i2s_multiline_sched_t;
+
+/* 呈现时间戳回调，在DMA中断上下文中调用，period为刚播放完的周期序号，pts为其第一帧开始输出的mchtmr计数 */
+typedef void (*i2s_multiline_sched_pts_cb_t)(i2s_multiline_sched_t *sched, uint32_t period, uint64_t pts,
+                                             void *user_data);
+
+typedef struct {
+    MCHTMR_Type *mchtmr;
+    uint32_t mchtmr_hz;                             /* mchtmr计数频率 */
+    uint32_t sample_rate;                           /* 标称采样率(Hz) */
+    i2s_multiline_sched_pts_cb_t pts_cb;            /* 可为NULL */
+    void *user_data;
+} i2s_multiline_sched_config_t;
+
+/* I2S输出与mchtmr的对应点 */
+typedef struct {
+    uint64_t tick;                                  /* mchtmr计数 */
+    uint64_t samples;                               /* 启动后数据线0已输出的采样数，除以每帧时隙数为帧序号 */
+} i2s_multiline_sched_point_t;
+
+struct i2s_multiline_sched {
+    i2s_multiline_stream_t *stream;
+    i2s_multiline_sched_config_t config;
+    i2s_multiline_stream_cb_t period_cb;            /* 流原有的整周期回调 */
+    void *period_user_data;
+    uint64_t start_tick;                            /* 请求的启动时刻 */
+    int32_t start_error;                            /* 实际启动时刻减请求时刻(mchtmr计数) */
+    i2s_multiline_sched_point_t anchor;             /* 换算基准 */
+    i2s_multiline_sched_point_t last;               /* 最新的对应点 */
+    int32_t tick_ppb;                               /* 每个采样实际占用的mchtmr计数相对标称值的偏差(ppb) */
+    uint32_t recovery_seen;                         /* 建立基准时流的恢复次数 */
+    uint32_t measure_fail_count;                    /* 对应点测量失败次数 */
+    volatile uint32_t period_count;                 /* 已回调的周期数 */
+    volatile uint64_t last_pts;                     /* 最近一次回调的呈现时间戳 */
+};
+
+/* 绑定已初始化的流，接管流的整周期回调(原回调仍会被调用) */
+hpm_stat_t i2s_multiline_sched_init(i2s_multiline_sched_t *sched, i2s_multiline_stream_t *stream,
+                                    const i2s_multiline_sched_config_t *config);
+
+/* 当前mchtmr计数 */
+uint64_t i2s_multiline_sched_now(i2s_multiline_sched_t *sched);
+
+/* 微秒换算为mchtmr计数 */
+uint64_t i2s_multiline_sched_us_to_tick(i2s_multiline_sched_t *sched, uint64_t us);
+
+/*
+ * 在start_tick启动流，环中需已写入数据。
+ * 距离启动时刻不足I2S_MULTILINE_SCHED_LEAD_US时返回status_invalid_argument，
+ * 预填充超出了提前量时返回status_timeout且不启动
+ */
+hpm_stat_t i2s_multiline_sched_start_at(i2s_multiline_sched_t *sched, uint64_t start_tick);
+
+/* 测量一组对应点并更新漂移 */
+hpm_stat_t i2s_multiline_sched_correlate(i2s_multiline_sched_t *sched, i2s_multiline_sched_point_t *point);
+
+/* I2S采样时钟相对mchtmr的漂移(ppb)，正值表示采样时钟偏快 */
+int32_t i2s_multiline_sched_get_drift_ppb(i2s_multiline_sched_t *sched);
+
+/* 帧序号(自启动)开始输出的mchtmr计数 */
+uint64_t i2s_multiline_sched_frame_to_tick(i2s_multiline_sched_t *sched, uint32_t frame);
+
+/* 在tick时刻正在输出的帧序号，tick早于基准时返回基准的帧序号 */
+uint32_t i2s_multiline_sched_tick_to_frame(i2s_multiline_sched_t *sched, uint64_t tick);
+
+#endif /* I2S_MULTILINE_SCHED_H */
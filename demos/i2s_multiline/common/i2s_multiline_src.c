@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "i2s_multiline_src.h"
+#include "i2s_multiline_src_coef.h"
+
+#define SRC_HISTORY_SIZE    (I2S_MULTILINE_SRC_MAX_TAPS + I2S_MULTILINE_SRC_BLOCK)
+
+static inline int32_t src_saturate(int64_t v)
+{
+    if (v > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (v < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)v;
+}
+
+/* 根据当前位置的小数部分在相邻两个相位之间插值，得到本输出帧的系数 */
+static void src_interpolate_coef(i2s_multiline_src_t *src)
+{
+    uint32_t taps = src->taps;
+    uint32_t phase = src->pos_frac >> (32U - src->phase_bits);
+    /* 相位内的位置，Q31 */
+    int32_t mu = (int32_t)((src->pos_frac << src->phase_bits) >> 1);
+    const int32_t *h0 = src->coef + phase * taps;
+    const int32_t *h1 = h0 + taps;
+
+    for (uint32_t j = 0; j < taps; j++) {
+        src->frame_coef[j] = h0[j] + (int32_t)(((int64_t)(h1[j] - h0[j]) * mu) >> 31);
+    }
+}
+
+static inline int32_t src_dot(const int32_t *x, const int32_t *c, uint32_t taps)
+{
+    int64_t acc = 1LL << 30;
+
+    /* taps为4的倍数 */
+    for (uint32_t j = 0; j < taps; j += 4U) {
+        acc += (int64_t)x[j] * c[j];
+        acc += (int64_t)x[j + 1U] * c[j + 1U];
+        acc += (int64_t)x[j + 2U] * c[j + 2U];
+        acc += (int64_t)x[j + 3U] * c[j + 3U];
+    }
+    return src_saturate(acc >> 31);
+}
+
+hpm_stat_t i2s_multiline_src_init(i2s_multiline_src_t *src, const i2s_multiline_src_config_t *config)
+{
+    uint64_t step;
+
+    if ((config->in_rate == 0U) || (config->out_rate < config->in_rate) ||
+        (config->channel_num == 0U) || (config->channel_num > I2S_MULTILINE_SRC_MAX_CHANNEL)) {
+        return status_invalid_argument;
+    }
+
+    memset(src, 0, sizeof(*src));
+    src->config = *config;
+    switch (config->quality) {
+    case i2s_multiline_src_quality_low:
+        src->coef = i2s_multiline_src_coef_low;
+        src->taps = I2S_MULTILINE_SRC_LOW_TAPS;
+        src->phase_bits = I2S_MULTILINE_SRC_LOW_PHASE_BITS;
+        break;
+    case i2s_multiline_src_quality_medium:
+        src->coef = i2s_multiline_src_coef_medium;
+        src->taps = I2S_MULTILINE_SRC_MEDIUM_TAPS;
+        src->phase_bits = I2S_MULTILINE_SRC_MEDIUM_PHASE_BITS;
+        break;
+    case i2s_multiline_src_quality_high:
+        src->coef = i2s_multiline_src_coef_high;
+        src->taps = I2S_MULTILINE_SRC_HIGH_TAPS;
+        src->phase_bits = I2S_MULTILINE_SRC_HIGH_PHASE_BITS;
+        break;
+    default:
+        return status_invalid_argument;
+    }
+    src->bypass = (config->in_rate == config->out_rate);
+
+    step = ((uint64_t)config->in_rate << 32) / config->out_rate;
+    src->step_int = (uint32_t)(step >> 32);
+    src->step_frac = (uint32_t)step;
+    i2s_multiline_src_reset(src);
+    return status_success;
+}
+
+void i2s_multiline_src_reset(i2s_multiline_src_t *src)
+{
+    /* 预置半个窗口的静音，第一个输出帧对齐第一个输入帧 */
+    memset(src->history, 0, sizeof(src->history));
+    src->fill = src->taps / 2U - 1U;
+    src->pos_int = 0;
+    src->pos_frac = 0;
+}
+
+uint32_t i2s_multiline_src_get_delay(i2s_multiline_src_t *src)
+{
+    return src->bypass ? 0U : src->taps / 2U;
+}
+
+uint32_t i2s_multiline_src_process(i2s_multiline_src_t *src, const int32_t *const in[], uint32_t *in_frames,
+                                   int32_t *const out[], uint32_t out_frames)
+{
+    uint8_t channels = src->config.channel_num;
+    uint32_t taps = src->taps;
+    uint32_t avail = *in_frames;
+    uint32_t consumed = 0;
+    uint32_t produced = 0;
+    uint32_t n;
+    uint32_t carry;
+
+    if (src->bypass) {
+        n = (avail < out_frames) ? avail : out_frames;
+        for (uint8_t ch = 0; ch < channels; ch++) {
+            memcpy(out[ch], in[ch], n * sizeof(int32_t));
+        }
+        *in_frames = n;
+        return n;
+    }
+
+    while (produced < out_frames) {
+        if (src->pos_int + taps > src->fill) {
+            if (consumed == avail) {
+                break;
+            }
+            /* 丢弃窗口之前的数据，再从输入补充 */
+            if (src->pos_int > 0U) {
+                for (uint8_t ch = 0; ch < channels; ch++) {
+                    memmove(src->history[ch], &src->history[ch][src->pos_int],
+                            (src->fill - src->pos_int) * sizeof(int32_t));
+                }
+                src->fill -= src->pos_int;
+                src->pos_int = 0;
+            }
+            n = avail - consumed;
+            if (n > SRC_HISTORY_SIZE - src->fill) {
+                n = SRC_HISTORY_SIZE - src->fill;
+            }
+            for (uint8_t ch = 0; ch < channels; ch++) {
+                memcpy(&src->history[ch][src->fill], in[ch] + consumed, n * sizeof(int32_t));
+            }
+            src->fill += n;
+            consumed += n;
+            continue;
+        }
+
+        /* 所有声道共用本帧的系数 */
+        src_interpolate_coef(src);
+        for (uint8_t ch = 0; ch < channels; ch++) {
+            out[ch][produced] = src_dot(&src->history[ch][src->pos_int], src->frame_coef, taps);
+        }
+        produced++;
+
+        carry = (src->pos_frac + src->step_frac < src->pos_frac) ? 1U : 0U;
+        src->pos_frac += src->step_frac;
+        src->pos_int += src->step_int + carry;
+    }
+
+    *in_frames = consumed;
+    return produced;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_SRC_H
+#define I2S_MULTILINE_SRC_H
+
+/*
+ * Q31多相采样率转换，位于多数据线I2S发送之前，将44.1k、16k、32k等源转换为I2S的采样率
+ *
+ * 原型滤波器为Kaiser窗sinc低通，各质量档位的多相系数表由i2s_multiline_src_coef.py
+ * 预先生成(i2s_multiline_src_coef.h)，运行时不计算系数。输出位置以32.32定点数推进，
+ * 相位取位置小数部分的高位，相邻相位之间线性插值，因此任意升采样比例都使用同一张表。
+ *
+ * 按块处理所有声道：每个输出帧只插值一次系数，再对所有声道做点积，
+ * 插值开销分摊到各声道。输入输出均为平面Q31数据，输出可直接交给i2s_multiline_pack打包。
+ * 只支持升采样及相同采样率(直通)。
+ */
+
+#include "hpm_common.h"
+
+#define I2S_MULTILINE_SRC_MAX_CHANNEL   (16U)
+#define I2S_MULTILINE_SRC_MAX_TAPS      (64U)
+#define I2S_MULTILINE_SRC_BLOCK         (64U)   /* 每次从输入拷贝到历史缓冲区的最大帧数 */
+
+typedef enum {
+    i2s_multiline_src_quality_low = 0,          /* 16抽头 */
+    i2s_multiline_src_quality_medium,           /* 32抽头 */
+    i2s_multiline_src_quality_high,             /* 64抽头 */
+} i2s_multiline_src_quality_t;
+
+typedef struct {
+    uint32_t in_rate;                           /* 输入采样率(Hz) */
+    uint32_t out_rate;                          /* 输出采样率(Hz)，不小于输入采样率 */
+    uint8_t channel_num;                        /* 声道数 */
+    i2s_multiline_src_quality_t quality;
+} i2s_multiline_src_config_t;
+
+typedef struct {
+    i2s_multiline_src_config_t config;
+    const int32_t *coef;                        /* (phases + 1) * taps 个系数 */
+    uint16_t taps;
+    uint8_t phase_bits;                         /* log2(相位数) */
+    bool bypass;                                /* 输入输出采样率相同 */
+    uint32_t step_int;                          /* 每个输出帧输入位置的整数步进 */
+    uint32_t step_frac;                         /* 每个输出帧输入位置的小数步进(2^-32) */
+    uint32_t pos_int;                           /* 当前窗口在历史缓冲区中的起点 */
+    uint32_t pos_frac;                          /* 当前输出位置的小数部分 */
+    uint32_t fill;                              /* 历史缓冲区中的帧数 */
+    int32_t frame_coef[I2S_MULTILINE_SRC_MAX_TAPS];
+    int32_t history[I2S_MULTILINE_SRC_MAX_CHANNEL][I2S_MULTILINE_SRC_MAX_TAPS + I2S_MULTILINE_SRC_BLOCK];
+} i2s_multiline_src_t;
+
+hpm_stat_t i2s_multiline_src_init(i2s_multiline_src_t *src, const i2s_multiline_src_config_t *config);
+
+/* 清空历史数据，重新开始 */
+void i2s_multiline_src_reset(i2s_multiline_src_t *src);
+
+/*
+ * 转换：in[ch]为输入声道，*in_frames输入为可用帧数，返回时为实际消耗的帧数；
+ * out[ch]为输出声道，最多写入out_frames帧，返回实际输出的帧数。
+ * 输入用尽或输出写满时返回，未消耗的输入在下次调用时继续传入
+ */
+uint32_t i2s_multiline_src_process(i2s_multiline_src_t *src, const int32_t *const in[], uint32_t *in_frames,
+                                   int32_t *const out[], uint32_t out_frames);
+
+/* 滤波器引入的延迟(输入帧) */
+uint32_t i2s_multiline_src_get_delay(i2s_multiline_src_t *src);
+
+#endif /* I2S_MULTILINE_SRC_H */
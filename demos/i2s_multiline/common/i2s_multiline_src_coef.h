@@ -0,0 +1,1645 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* 由i2s_multiline_src_coef.py生成，请勿手工修改 */
+
+#ifndef I2S_MULTILINE_SRC_COEF_H
+#define I2S_MULTILINE_SRC_COEF_H
+
+/* low: 16 taps, 32 phases, cutoff 0.80, kaiser beta 6.0 */
+#define I2S_MULTILINE_SRC_LOW_TAPS        (16U)
+#define I2S_MULTILINE_SRC_LOW_PHASE_BITS  (5U)
+static const int32_t i2s_multiline_src_coef_low[(32 + 1) * 16] = {
+    -6251266, 10969663, 0, -48572268, 145747078, -273610004, 385391514, 1720134215,
+    385391514, -273610004, 145747078, -48572268, 0, 10969663, -6251266, 0,
+    -5838582, 9474154, 3207898, -52574443, 146123085, -260100287, 331100456, 1717277156,
+    440463061, -285567882, 144212639, -44020303, -3358012, 12457450, -6636477, 1263738,
+    -5414133, 8000734, 6250069, -56103753, 145628423, -245647839, 278431359, 1711715234,
+    496810143, -296321772, 141745994, -39014906, -6848731, 13945389, -7000192, 1307629,
+    -4979019, 6553166, 9112913, -59128932, 144219471, -230230905, 227324223, 1702503591,
+    554034071, -305591654, 138242634, -33543889, -10453215, 15415595, -7333894, 1339493,
+    -4537660, 5140688, 11784677, -61649601, 141939122, -213982222, 177926299, 1689680872,
+    611946560, -313255085, 133686055, -27626207, -14150876, 16855897, -7632535, 1357664,
+    -4094249, 3771800, 14255467, -63668785, 138834266, -197034187, 130374492, 1673300199,
+    670353483, -319193826, 128065979, -21284605, -17919570, 18253739, -7891057, 1360502,
+    -3652732, 2454232, 16517237, -65192760, 134955355, -179518156, 84794882, 1653428872,
+    729055716, -323294567, 121378627, -14545599, -21735690, 19596253, -8104437, 1346416,
+    -3216783, 1194922, 18563771, -66230893, 130355955, -161563759, 41302305, 1630148008,
+    787850020, -325449643, 113626961, -7439432, -25574283, 20870354, -8267734, 1313880,
+    -2789788, 0, 20390653, -66795457, 125092297, -143298248, 0, 1603552107,
+    846529937, -325557724, 104820897, 0, -29409174, 22062825, -8376136, 1261459,
+    -2374833, -1125221, 21995217, -66901441, 119222827, -124845877, -39020669, 1573748562,
+    904886721, -323524489, 94977475, 7735245, -33213107, 23160422, -8425011, 1187825,
+    -1974690, -2176242, 23376496, -66566345, 112807753, -106327309, -75680437, 1540857112,
+    962710271, -319263279, 84121000, 15725422, -36957898, 24149967, -8409957, 1091784,
+    -1591816, -3149378, 24535154, -65809961, 105908598, -87859069, -109912289, 1505009227,
+    1019790091, -312695716, 72283135, 23926373, -40614604, 25018462, -8326855, 972295,
+    -1228346, -4041743, 25473411, -64654157, 98587767, -69553026, -141661543, 1466347456,
+    1075916251, -303752293, 59502962, 32290843, -44153697, 25753192, -8171919, 828489,
+    -886091, -4851233, 26194962, -63122645, 90908107, -51515921, -170885882, 1425024718,
+    1130880347, -292372928, 45826992, 40768686, -47545252, 26341840, -7941747, 659695,
+    -566546, -5576503, 26704881, -61240751, 82932501, -33848940, -197555302, 1381203548,
+    1184476469, -278507482, 31309141, 49307100, -50759150, 26772598, -7633373, 465456,
+    -270891, -6216940, 27009532, -59035177, 74723453, -16647318, -221652016, 1335055306,
+    1236502155, -262116230, 16010657, 57850881, -53765283, 27034286, -7244316, 245548,
+    0, -6772628, 27116460, -56533769, 66342709, 0, -243170293, 1286759345,
+    1286759345, -243170293, 0, 66342709, -56533769, 27116460, -6772628, 0,
+    245548, -7244316, 27034286, -53765283, 57850881, 16010657, -262116230, 1236502155,
+    1335055306, -221652016, -16647318, 74723453, -59035177, 27009532, -6216940, -270891,
+    465456, -7633373, 26772598, -50759150, 49307100, 31309141, -278507482, 1184476469,
+    1381203548, -197555302, -33848940, 82932501, -61240751, 26704881, -5576503, -566546,
+    659695, -7941747, 26341840, -47545252, 40768686, 45826992, -292372928, 1130880347,
+    1425024718, -170885882, -51515921, 90908107, -63122645, 26194962, -4851233, -886091,
+    828489, -8171919, 25753192, -44153697, 32290843, 59502962, -303752293, 1075916251,
+    1466347456, -141661543, -69553026, 98587767, -64654157, 25473411, -4041743, -1228346,
+    972295, -8326855, 25018462, -40614604, 23926373, 72283135, -312695716, 1019790091,
+    1505009227, -109912289, -87859069, 105908598, -65809961, 24535154, -3149378, -1591816,
+    1091784, -8409957, 24149967, -36957898, 15725422, 84121000, -319263279, 962710271,
+    1540857112, -75680437, -106327309, 112807753, -66566345, 23376496, -2176242, -1974690,
+    1187825, -8425011, 23160422, -33213107, 7735245, 94977475, -323524489, 904886721,
+    1573748562, -39020669, -124845877, 119222827, -66901441, 21995217, -1125221, -2374833,
+    1261459, -8376136, 22062825, -29409174, 0, 104820897, -325557724, 846529937,
+    1603552107, 0, -143298248, 125092297, -66795457, 20390653, 0, -2789788,
+    1313880, -8267734, 20870354, -25574283, -7439432, 113626961, -325449643, 787850020,
+    1630148008, 41302305, -161563759, 130355955, -66230893, 18563771, 1194922, -3216783,
+    1346416, -8104437, 19596253, -21735690, -14545599, 121378627, -323294567, 729055716,
+    1653428872, 84794882, -179518156, 134955355, -65192760, 16517237, 2454232, -3652732,
+    1360502, -7891057, 18253739, -17919570, -21284605, 128065979, -319193826, 670353483,
+    1673300199, 130374492, -197034187, 138834266, -63668785, 14255467, 3771800, -4094249,
+    1357664, -7632535, 16855897, -14150876, -27626207, 133686055, -313255085, 611946560,
+    1689680872, 177926299, -213982222, 141939122, -61649601, 11784677, 5140688, -4537660,
+    1339493, -7333894, 15415595, -10453215, -33543889, 138242634, -305591654, 554034071,
+    1702503591, 227324223, -230230905, 144219471, -59128932, 9112913, 6553166, -4979019,
+    1307629, -7000192, 13945389, -6848731, -39014906, 141745994, -296321772, 496810143,
+    1711715234, 278431359, -245647839, 145628423, -56103753, 6250069, 8000734, -5414133,
+    1263738, -6636477, 12457450, -3358012, -44020303, 144212639, -285567882, 440463061,
+    1717277156, 331100456, -260100287, 146123085, -52574443, 3207898, 9474154, -5838582,
+    0, -6251266, 10969663, 0, -48572268, 145747078, -273610004, 385391514,
+    1720134215, 385391514, -273610004, 145747078, -48572268, 0, 10969663, -6251266,
+};
+
+/* medium: 32 taps, 128 phases, cutoff 0.88, kaiser beta 9.0 */
+#define I2S_MULTILINE_SRC_MEDIUM_TAPS        (32U)
+#define I2S_MULTILINE_SRC_MEDIUM_PHASE_BITS  (7U)
+static const int32_t i2s_multiline_src_coef_medium[(128 + 1) * 32] = {
+    -133109, 581281, -1604815, 3295646, -5269831, 6342961, -4385029, -3454693,
+    20064777, -47334352, 85072071, -130311738, 177385137, -218909957, 247500590, 1889805768,
+    247500590, -218909957, 177385137, -130311738, 85072071, -47334352, 20064777, -3454693,
+    -4385029, 6342961, -5269831, 3295646, -1604815, 581281, -133109, 0,
+    -135638, 584695, -1601231, 3264279, -5172816, 6128099, -4000517, -4030961,
+    20783336, -48025955, 85399040, -129711442, 174945937, -212880152, 232067464, 1889648916,
+    263064849, -224887553, 179755191, -130852608, 84701943, -46615624, 19331939, -2872865,
+    -4770196, 6556416, -5365084, 3325658, -1607601, 577496, -130445, 9077,
+    -138036, 587748, -1596883, 3231629, -5074171, 5912026, -3616900, -4601473,
+    21487620, -48690877, 85684048, -129054047, 172441481, -206804103, 216771996, 1889202961,
+    278760092, -230812660, 182056844, -131335137, 84289691, -45870570, 18585348, -2285767,
+    -5155892, 6768429, -5458580, 3354329, -1609601, 573344, -127647, 8403,
+    -140302, 590442, -1591773, 3197711, -4973935, 5694832, -3234337, -5165976,
+    22177290, -49328745, 85926822, -128339616, 169872570, -200683937, 201616326, 1888459482,
+    294581771, -236681155, 184287749, -131758153, 83834877, -45099177, 17825187, -1693632,
+    -5541913, 6978854, -5550232, 3381616, -1610796, 568820, -124715, 7692,
+    -142438, 592781, -1585915, 3162556, -4872173, 5476631, -2853007, -5724238,
+    22852106, -49939416, 86127491, -127568828, 167240827, -194522765, 186603659, 1887418694,
+    310526404, -242489902, 186446384, -132121095, 83337470, -44301658, 17051737, -1096714,
+    -5928073, 7187576, -5639978, 3407489, -1611176, 563920, -121647, 6945,
+    -144444, 594767, -1579320, 3126193, -4768949, 5257538, -2473086, -6276032,
+    23511837, -50522758, 86286205, -126742382, 164547890, -188323688, 171737139, 1886080896,
+    326590455, -248235763, 188531253, -132423427, 82797456, -43478240, 16265289, -495272,
+    -6314182, 7394477, -5727755, 3431922, -1610731, 558641, -118442, 6160,
+    -146323, 596405, -1572001, 3088654, -4664328, 5037669, -2094748, -6821134,
+    24156261, -51078656, 86403133, -125861001, 161795418, -182089797, 157019851, 1884446476,
+    342770336, -253915603, 190540879, -132664639, 82214844, -42629163, 15466141, 110433,
+    -6700053, 7599440, -5813502, 3454888, -1609451, 552982, -115101, 5339,
+    -148074, 597700, -1563969, 3049970, -4558374, 4817136, -1718166, -7359326,
+    24785163, -51607008, 86478461, -124925427, 158985084, -175824175, 142454820, 1882515904,
+    359062410, -259526285, 192473812, -132844248, 81589662, -41754682, 14654599, 720137,
+    -7085494, 7802349, -5897158, 3476358, -1607327, 546940, -111623, 4480,
+    -149700, 598655, -1555238, 3010171, -4451152, 4596055, -1343510, -7890394,
+    25398338, -52107723, 86512396, -123936425, 156118576, -169529890, 128045008, 1880289738,
+    375462987, -265064673, 194328627, -132961794, 80921959, -40855066, 13830978, 1333568,
+    -7470314, 8003086, -5978661, 3496308, -1604350, 540512, -108007, 3583,
+    -151202, 599276, -1545820, 2969291, -4342727, 4374537, -970949, -8414130,
+    25995591, -52580727, 86505162, -122894778, 153197597, -163209999, 113793318, 1877768619,
+    391968333, -270527638, 196103924, -133016845, 80211805, -39930597, 12995598, 1950456,
+    -7854321, 8201536, -6057953, 3514712, -1600512, 533697, -104254, 2648,
+    -152581, 599565, -1535729, 2927360, -4233163, 4152695, -600647, -8930331,
+    26576734, -53025959, 86457002, -121801291, 150223864, -156867544, 99702587, 1874953274,
+    408574660, -275912052, 197798330, -133008996, 79459289, -38981569, 12148790, 2570523,
+    -8237320, 8397582, -6134972, 3531543, -1595804, 526494, -100362, 1675,
+    -153838, 599529, -1524978, 2884411, -4122525, 3930640, -232769, -9438797,
+    27141589, -53443370, 86368175, -120656788, 147199106, -150505551, 85775592, 1871844515,
+    425278140, -281214795, 199410500, -132937867, 78664521, -38008292, 11290891, 3193490,
+    -8619117, 8591108, -6209662, 3546778, -1590219, 518899, -96332, 663,
+    -154976, 599172, -1513581, 2840476, -4010879, 3708484, 132525, -9939334,
+    27689986, -53832927, 86238960, -119462111, 144125064, -144127031, 72015041, 1868443237,
+    442074895, -286432752, 200939118, -132803108, 77827633, -37011088, 10422245, 3819073,
+    -8999517, 8781998, -6281962, 3560393, -1583749, 510913, -92164, -386,
+    -155996, 598499, -1501552, 2795587, -3898288, 3486335, 495075, -10431755,
+    28221765, -54194608, 86069653, -118218121, 141003489, -137734977, 58423583, 1864750421,
+    458961004, -291562818, 202382894, -132604395, 76948776, -35990294, 9543205, 4446988,
+    -9378324, 8970137, -6351816, 3572365, -1576386, 502534, -87858, -1474,
+    -156899, 597515, -1488904, 2749778, -3784817, 3264304, 854725, -10915876,
+    28736774, -54528407, 85860567, -116925697, 137836145, -131332365, 45003795, 1860767129,
+    475932505, -296601896, 203740571, -132341432, 76028124, -34946258, 8654129, 5076945,
+    -9755340, 9155410, -6419168, 3582669, -1568125, 493760, -83414, -2600,
+    -157687, 596225, -1475651, 2703080, -3670532, 3042499, 1211322, -11391519,
+    29234871, -54834328, 85612031, -115585736, 134624803, -124922149, 31758194, 1856494510,
+    492985392, -301546901, 205010920, -132013952, 75065870, -33879342, 7755383, 5708651,
+    -10130370, 9337704, -6483960, 3591285, -1558959, 484592, -78832, -3765,
+    -158361, 594635, -1461809, 2655528, -3555496, 2821025, 1564714, -11858511,
+    29715922, -55112393, 85324393, -114199151, 131371243, -118507265, 18689224, 1851933792,
+    510115618, -306394756, 206192746, -131621715, 74062228, -32789923, 6847341, 6341813,
+    -10503215, 9516903, -6546137, 3598191, -1548882, 475029, -74113, -4969,
+    -158925, 592748, -1447391, 2607153, -3439773, 2599991, 1914753, -12316684,
+    30179804, -55362632, 84998015, -112766871, 128077253, -112090626, 5799267, 1847086288,
+    527319099, -311142403, 207284883, -131164512, 73017433, -31678389, 5930382, 6976133,
+    -10873677, 9692896, -6605647, 3603366, -1537889, 465070, -69256, -6210,
+    -159379, 590573, -1432412, 2557990, -3323427, 2379499, 2261293, -12765878,
+    30626400, -55585093, 84633277, -111289841, 124744628, -105675122, -6909368, 1841953393,
+    544591712, -315786793, 208286200, -130642162, 71931742, -30545140, 5004893, 7611310,
+    -11241559, 9865569, -6662434, 3606790, -1525975, 454715, -64264, -7490,
+    -159725, 588112, -1416886, 2508071, -3206522, 2159656, 2604192, -13205934,
+    31055605, -55779833, 84230575, -109769024, 121375167, -99263622, -19434436, 1836536582,
+    561929295, -320324895, 209195598, -130054512, 70805432, -29390592, 4071267, 8247044,
+    -11606661, 10034812, -6716446, 3608443, -1513135, 443965, -59135, -8808,
+    -159965, 585373, -1400829, 2457430, -3089121, 1940562, 2943309, -13636703,
+    31467321, -55946924, 83790319, -108205394, 117970677, -92858968, -31773765, 1830837413,
+    579327654, -324753695, 210012013, -129401442, 69638801, -28215171, 3129903, 8883028,
+    -11968786, 10200513, -6767632, 3608307, -1499365, 432820, -53872, -10165,
+    -160101, 582361, -1384255, 2406099, -2971287, 1722321, 3278507, -14058038,
+    31861461, -56086450, 83312937, -106599941, 114532968, -86463977, -43925250, 1824857523,
+    596782558, -329070195, 210734415, -128682859, 68432168, -27019315, 2181207, 9518958,
+    -12327735, 10362563, -6815942, 3606363, -1484662, 421280, -48474, -11558,
+    -160135, 579081, -1367180, 2354113, -2853084, 1505031, 3609651, -14469800,
+    32237945, -56198509, 82798870, -104953668, 111063852, -80081442, -55886858, 1818598629,
+    614289745, -333271418, 211361810, -127898700, 67185873, -25803477, 1225590, 10154523,
+    -12683310, 10520853, -6861324, 3602596, -1469022, 409346, -42943, -12990,
+    -160070, 575540, -1349618, 2301504, -2734572, 1288793, 3936611, -14871854,
+    32596702, -56283210, 82248575, -103267593, 107565147, -73714125, -67656624, 1812062528,
+    631844920, -337354405, 211893239, -127048934, 65900275, -24568121, 263470, 10789414,
+    -13035313, 10675275, -6903732, 3596987, -1452442, 397020, -37280, -14459,
+    -159906, 571744, -1331585, 2248306, -2615815, 1073704, 4259258, -15264072,
+    32937672, -56340676, 81662523, -101542745, 104038669, -67364763, -79232657, 1805251096,
+    649443758, -341316222, 212327782, -126133558, 64575757, -23313722, -704731, 11423319,
+    -13383548, 10825723, -6943117, 3589523, -1434921, 384302, -31485, -15965,
+    -159646, 567698, -1313097, 2194552, -2496873, 859861, 4577466, -15646329,
+    33260803, -56371040, 81041198, -99780165, 100486238, -61036061, -90613135, 1798166286,
+    667081907, -345153956, 212664555, -125152603, 63212720, -22040769, -1678583, 12055923,
+    -13727816, 10972090, -6979434, 3580187, -1416456, 371195, -25560, -17507,
+    -159293, 563408, -1294167, 2140276, -2377808, 647358, 4891114, -16018510,
+    33566051, -56374449, 80385101, -97980906, 96909672, -54730697, -101796309, 1790810129,
+    684754986, -348864716, 212902711, -124106128, 61811586, -20749760, -2657652, 12686912,
+    -14067921, 11114273, -7012636, 3568965, -1397047, 357700, -19507, -19086,
+    -158848, 558881, -1274813, 2085509, -2258680, 436288, 5200082, -16380501,
+    33853382, -56351061, 79694744, -96146032, 93310790, -48451317, -112780500, 1783184732,
+    702458586, -352445640, 213041443, -122994224, 60372799, -19441208, -3641500, 13315970,
+    -14403667, 11252169, -7042680, 3555846, -1376692, 343818, -13327, -20700,
+    -158313, 554122, -1255049, 2030287, -2139549, 226745, 5504254, -16732198,
+    34122770, -56301048, 78970653, -94276618, 89691409, -42200533, -123564105, 1775292279,
+    720188277, -355893889, 213079983, -121817013, 58896822, -18115635, -4629682, 13942778,
+    -14734860, 11385675, -7069523, 3540816, -1355392, 329553, -7021, -22350,
+    -157691, 549139, -1234890, 1974640, -2020475, 18819, 5803519, -17073499,
+    34374199, -56224591, 78213368, -92373747, 86053342, -35980928, -134145589, 1767135029,
+    737939604, -359206655, 213017604, -120574647, 57384139, -16773573, -5621750, 14567019,
+    -15061305, 11514691, -7093124, 3523864, -1333145, 314907, -591, -24035,
+    -156984, 543936, -1214353, 1918603, -1901516, -187401, 6097765, -17404310,
+    34607660, -56121884, 77423439, -90438513, 82398403, -29795049, -144523494, 1758715314,
+    755708089, -362381155, 212853617, -119267311, 55835253, -15415569, -6617249, 15188373,
+    -15382808, 11639119, -7113443, 3504980, -1309954, 299883, 5962, -25755,
+    -156194, 538521, -1193453, 1862208, -1782731, -391829, 6386888, -17724542,
+    34823155, -55993132, 76601432, -88472018, 78728397, -23645411, -154696432, 1750035541,
+    773489236, -365414639, 212587376, -117895221, 54250690, -14042179, -7615721, 15806520,
+    -15699179, 11758861, -7130440, 3484153, -1285820, 284483, 12635, -27508,
+    -155322, 532899, -1172205, 1805487, -1664178, -594377, 6670784, -18034112,
+    35020692, -55838552, 75747921, -86475372, 75045128, -17534492, -164663090, 1741098190,
+    791278528, -368304387, 212218275, -116458625, 52630992, -12653967, -8616705, 16421140,
+    -16010225, 11873822, -7144077, 3461376, -1260743, 268712, 19426, -29294,
+    -154373, 527078, -1150625, 1748474, -1545913, -794962, 6949354, -18332942,
+    35200291, -55658371, 74863495, -84449694, 71350394, -11464736, -174422227, 1731905811,
+    809071430, -371047711, 211745751, -114957800, 50976723, -11251511, -9619735, 17031913,
+    -16315757, 11983906, -7154319, 3436640, -1234727, 252572, 26333, -31113,
+    -153346, 521062, -1128729, 1691199, -1427993, -993501, 7222501, -18620962,
+    35361977, -55452828, 73948752, -82396108, 67645986, -5438549, -183972677, 1722461027,
+    826863395, -373641957, 211169284, -113393057, 49288468, -9835398, -10624339, 17638516,
+    -16615587, 12089022, -7161131, 3409938, -1207774, 236067, 33355, -32963,
+    -152246, 514860, -1106531, 1633695, -1310474, -1189913, 7490132, -18898104,
+    35505786, -55222171, 73004302, -80315746, 63933688, 541699, -193313347, 1712766530,
+    844649856, -376084506, 210488395, -111764740, 47566829, -8406224, -11630045, 18240629,
+    -16909528, 12189080, -7164480, 3381265, -1179888, 219201, 40489, -34845,
+    -151074, 508476, -1084048, 1575994, -1193411, -1384118, 7752159, -19164309,
+    35631760, -54966661, 72030765, -78209745, 60215277, 6473677, -202443217, 1702825081,
+    862426235, -378372774, 209702652, -110073220, 45812427, -6964597, -12636374, 18837931,
+    -17197395, 12283989, -7164333, 3350616, -1151072, 201979, 47732, -36758,
+    -149832, 501918, -1061296, 1518128, -1076857, -1576041, 8008495, -19419522,
+    35739953, -54686567, 71028772, -76079248, 56492521, 12355091, -211361341, 1692639510,
+    880187945, -380504214, 208811663, -108318904, 44025906, -5511131, -13642848, 19430101,
+    -17479003, 12373664, -7160660, 3317986, -1121331, 184406, 55083, -38699,
+    -148523, 495191, -1038288, 1460127, -960867, -1765604, 8259057, -19663696,
+    35830423, -54382170, 69998964, -73925401, 52767178, 18183688, -220066849, 1682212714,
+    897930385, -382476318, 207815084, -106502229, 42207925, -4046454, -14648982, 20016819,
+    -17754172, 12458019, -7153433, 3283374, -1090670, 166486, 62538, -40670,
+    -147149, 488303, -1015041, 1402024, -845493, -1952734, 8503767, -19896785,
+    35903240, -54053759, 68941989, -71749358, 49040998, 23957253, -228558941, 1671547656,
+    915648947, -384286616, 206712613, -104623664, 40359162, -2571198, -15654291, 20597766,
+    -18022721, 12536972, -7142623, 3246776, -1059094, 148223, 70094, -42668,
+    -145712, 481260, -991571, 1343847, -730788, -2137358, 8742548, -20118755,
+    35958479, -53701635, 67858508, -69552273, 45315720, 29673615, -236836894, 1660647363,
+    933339016, -385932680, 205503996, -102683710, 38480316, -1086007, -16658286, 21172622,
+    -18284473, 12610440, -7128206, 3208192, -1026610, 129625, 77750, -44693,
+    -144215, 474068, -967892, 1285629, -616801, -2319408, 8975329, -20329571,
+    35996226, -53326108, 66749188, -67335304, 41593069, 35330639, -244900058, 1649514928,
+    950995971, -387412121, 204189023, -100682898, 36572103, 408467, -17660475, 21741070,
+    -18539251, 12678346, -7110156, 3167621, -993224, 110695, 85501, -46744,
+    -142659, 466733, -944019, 1227399, -503584, -2498813, 9202040, -20529210,
+    36016571, -52927495, 65614705, -65099613, 37874760, 40926236, -252747854, 1638153507,
+    968615187, -388722594, 202767531, -98621792, 34635256, 1911564, -18660367, 22302792,
+    -18786883, 12740613, -7088453, 3125066, -958943, 91441, 93345, -48820,
+    -141048, 459262, -919968, 1169188, -391187, -2675508, 9422617, -20717650,
+    36019616, -52506126, 64455743, -62846363, 34162497, 46458359, -260379781, 1626566317,
+    986192036, -389861797, 201239403, -96500989, 32670527, 3422618, -19657465, 22857472,
+    -19027197, 12797165, -7063073, 3080527, -923775, 71868, 101279, -50920,
+    -139383, 451662, -895754, 1111024, -279656, -2849428, 9636997, -20894876,
+    36005467, -52062337, 63272995, -60576718, 30457966, 51925001, -267795408, 1614756636,
+    1003721889, -390827474, 199604569, -94321113, 30678686, 4940951, -20651273, 23404797,
+    -19260023, 12847932, -7034000, 3034009, -887728, 51982, 109300, -53042,
+    -137666, 443938, -871391, 1052937, -169042, -3020511, 9845123, -21060879,
+    35974242, -51596475, 62067159, -58291844, 26762843, 57324200, -274994379, 1602727802,
+    1021200119, -391617414, 197863005, -92082824, 28660519, 6465881, -21641293, 23944454,
+    -19485196, 12892843, -7001214, 2985516, -850811, 31790, 117404, -55186,
+    -135901, 436097, -846895, 994956, -59389, -3188695, 10046939, -21215656,
+    35926062, -51108892, 60838942, -55992905, 23078786, 62654040, -281976409, 1590483212,
+    1038622097, -392229451, 196014738, -89786811, 26616830, 7996718, -22627027, 24476131,
+    -19702553, 12931830, -6964701, 2935051, -813034, 11300, 125588, -57350,
+    -134088, 428146, -822279, 937109, 49256, -3353922, 10242395, -21359209,
+    35861057, -50599953, 59589056, -53681068, 19407440, 67912647, -288741289, 1578026319,
+    1055983203, -392661469, 194059839, -87433793, 24548439, 9532764, -23607973, 24999519,
+    -19911931, 12964828, -6924446, 2882623, -774407, -9482, 133847, -59534,
+    -132231, 420090, -797560, 879426, 156848, -3516135, 10431443, -21491544,
+    35779367, -50070027, 58318221, -51357497, 15750433, 73098191, -295288880, 1565360633,
+    1073278817, -392911400, 191998430, -85024521, 22456184, 11073318, -24583631, 25514312,
+    -20113172, 12991776, -6880437, 2828239, -734939, -30548, 142180, -61736,
+    -130332, 411936, -772751, 821932, 263343, -3675278, 10614038, -21612674,
+    35681135, -49519493, 57027160, -49023355, 12109375, 78208891, -301619117, 1552489721,
+    1090504329, -392977225, 189830679, -82559779, 20340916, 12617668, -25553499, 26020204,
+    -20306122, 13012612, -6832664, 2771906, -694642, -51891, 150580, -63954,
+    -128392, 403690, -747866, 764657, 368699, -3831300, 10790140, -21722618,
+    35566514, -48948738, 55716605, -46679805, 8485860, 83243008, -307732005, 1539417200,
+    1107655135, -392856977, 187556803, -80040377, 18203506, 14165098, -26517077, 26516893,
+    -20490628, 13027279, -6781118, 2713635, -653529, -73503, 159046, -66187,
+    -126415, 395358, -722920, 707626, 472872, -3984149, 10959712, -21821398,
+    35435662, -48358154, 54387289, -44328005, 4881464, 88198851, -313627623, 1526146743,
+    1124726641, -392548740, 185177070, -77467160, 16044837, 15714888, -27473862, 27004078,
+    -20666541, 13035723, -6725792, 2653436, -611610, -95375, 167573, -68435,
+    -124402, 386946, -697927, 650867, 575823, -4133776, 11122719, -21909044,
+    35288745, -47748142, 53039954, -41969112, 1297744, 93074777, -319306120, 1512682072,
+    1141714266, -392050651, 182691795, -74840999, 13865810, 17266311, -28423353, 27481464,
+    -20833714, 13037891, -6666682, 2591321, -568899, -117499, 176156, -70695,
+    -122355, 378462, -672901, 594405, 677510, -4280135, 11279133, -21985589,
+    35125936, -47119111, 51675343, -39604279, -2263763, 97869187, -324767717, 1499026960,
+    1158613438, -391360900, 180101343, -72162797, 11667337, 18818635, -29365048, 27948754,
+    -20992004, 13033734, -6603783, 2527303, -525409, -139867, 184792, -72966,
+    -120277, 369909, -647856, 538267, 777895, -4423180, 11428925, -22051072,
+    34947415, -46471474, 50294203, -37234654, -5801538, 102580531, -330012705, 1485185228,
+    1175419603, -390477732, 177406128, -69433489, 9450350, 20371124, -30298449, 28405658,
+    -21141274, 13023206, -6537096, 2461396, -481155, -162468, 193477, -75247,
+    -118169, 361296, -622804, 482477, 876941, -4562868, 11572073, -22105538,
+    34753365, -45805652, 48897287, -34861383, -9314085, 107207306, -335041445, 1471160746,
+    1192128219, -389399448, 174606614, -66654034, 7215790, 21923036, -31223056, 28851887,
+    -21281385, 13006261, -6466621, 2393615, -436150, -185295, 202205, -77536,
+    -116035, 352626, -597760, 427061, 974609, -4699160, 11708557, -22149036,
+    34543980, -45122072, 47485350, -32485604, -12799926, 111748058, -339854369, 1456957428,
+    1208734766, -388124405, 171703314, -63825426, 4964615, 23473628, -32138371, 29287157,
+    -21412207, 12982860, -6392360, 2323975, -390410, -208338, 210973, -79831,
+    -113875, 343908, -572737, 372043, 1070864, -4832015, 11838361, -22181619,
+    34319457, -44421167, 46059148, -30108453, -16257606, 116201380, -344451977, 1442579235,
+    1225234738, -386651015, 168696791, -60948683, 2697794, 25022150, -33043898, 29711186,
+    -21533610, 12952964, -6314318, 2252496, -343949, -231587, 219775, -82131,
+    -111693, 335145, -547748, 317446, 1165671, -4961397, 11961471, -22203348,
+    34080001, -43703376, 44619441, -27731057, -19685691, 120565914, -348834838, 1428030170,
+    1241623652, -384977751, 165587658, -58024856, 416312, 26567851, -33939141, 30123696,
+    -21645469, 12916538, -6232502, 2179194, -296786, -255032, 228608, -84435,
+    -109489, 326344, -522806, 263294, 1258997, -5087272, 12077878, -22214287,
+    33825821, -42969142, 43166992, -25354539, -23082772, 124840351, -353003590, 1413314277,
+    1257897045, -383103144, 162376580, -55055021, -1878835, 28109976, -34823609, 30524414,
+    -21747663, 12873550, -6146921, 2104089, -248935, -278663, 237466, -86740,
+    -107267, 317511, -497923, 209611, 1350808, -5209606, 12187575, -22214504,
+    33557134, -42218915, 41702564, -22980012, -26447461, 129023431, -356958939, 1398435642,
+    1274050480, -381025784, 159064267, -52040283, -4186639, 29647767, -35696810, 30913070,
+    -21840076, 12823971, -6057583, 2027203, -200415, -302470, 246345, -89045,
+    -105028, 308652, -473113, 156418, 1441073, -5328370, 12290561, -22204073,
+    33274161, -41453150, 40226921, -20608585, -29778392, 133113942, -360701658, 1383398391,
+    1290079541, -378744321, 155651485, -48981775, -6506081, 31180464, -36558257, 31289398,
+    -21922593, 12767774, -5964503, 1948556, -151242, -326441, 255240, -91348,
+    -102774, 299771, -448387, 103738, 1529761, -5443534, 12386834, -22183073,
+    32977129, -40672305, 38740830, -18241357, -33074227, 137110723, -364232585, 1368206687,
+    1305979842, -376257469, 152139045, -45880657, -8836127, 32707306, -37407465, 31653137,
+    -21995105, 12704937, -5867694, 1868173, -101437, -350567, 264146, -93648,
+    -100507, 290875, -423757, 51591, 1616843, -5555072, 12476400, -22151586,
+    32666270, -39876845, 37245056, -15879420, -36333649, 141012662, -367552626, 1352864729,
+    1321747023, -373564001, 148527810, -42738117, -11175737, 34227528, -38243951, 32004029,
+    -22057508, 12635440, -5767174, 1786075, -51016, -374836, 273057, -95942,
+    -98229, 281968, -399236, 0, 1702290, -5662959, 12559265, -22109700,
+    32341823, -39067236, 35740367, -13523855, -39555368, 144818695, -370662753, 1337376752,
+    1337376752, -370662753, 144818695, -39555368, -13523855, 35740367, -39067236, 32341823,
+    -22109700, 12559265, -5662959, 1702290, 0, -399236, 281968, -98229,
+    -95942, 273057, -374836, -51016, 1786075, -5767174, 12635440, -22057508,
+    32004029, -38243951, 34227528, -11175737, -42738117, 148527810, -373564001, 1321747023,
+    1352864729, -367552626, 141012662, -36333649, -15879420, 37245056, -39876845, 32666270,
+    -22151586, 12476400, -5555072, 1616843, 51591, -423757, 290875, -100507,
+    -93648, 264146, -350567, -101437, 1868173, -5867694, 12704937, -21995105,
+    31653137, -37407465, 32707306, -8836127, -45880657, 152139045, -376257469, 1305979842,
+    1368206687, -364232585, 137110723, -33074227, -18241357, 38740830, -40672305, 32977129,
+    -22183073, 12386834, -5443534, 1529761, 103738, -448387, 299771, -102774,
+    -91348, 255240, -326441, -151242, 1948556, -5964503, 12767774, -21922593,
+    31289398, -36558257, 31180464, -6506081, -48981775, 155651485, -378744321, 1290079541,
+    1383398391, -360701658, 133113942, -29778392, -20608585, 40226921, -41453150, 33274161,
+    -22204073, 12290561, -5328370, 1441073, 156418, -473113, 308652, -105028,
+    -89045, 246345, -302470, -200415, 2027203, -6057583, 12823971, -21840076,
+    30913070, -35696810, 29647767, -4186639, -52040283, 159064267, -381025784, 1274050480,
+    1398435642, -356958939, 129023431, -26447461, -22980012, 41702564, -42218915, 33557134,
+    -22214504, 12187575, -5209606, 1350808, 209611, -497923, 317511, -107267,
+    -86740, 237466, -278663, -248935, 2104089, -6146921, 12873550, -21747663,
+    30524414, -34823609, 28109976, -1878835, -55055021, 162376580, -383103144, 1257897045,
+    1413314277, -353003590, 124840351, -23082772, -25354539, 43166992, -42969142, 33825821,
+    -22214287, 12077878, -5087272, 1258997, 263294, -522806, 326344, -109489,
+    -84435, 228608, -255032, -296786, 2179194, -6232502, 12916538, -21645469,
+    30123696, -33939141, 26567851, 416312, -58024856, 165587658, -384977751, 1241623652,
+    1428030170, -348834838, 120565914, -19685691, -27731057, 44619441, -43703376, 34080001,
+    -22203348, 11961471, -4961397, 1165671, 317446, -547748, 335145, -111693,
+    -82131, 219775, -231587, -343949, 2252496, -6314318, 12952964, -21533610,
+    29711186, -33043898, 25022150, 2697794, -60948683, 168696791, -386651015, 1225234738,
+    1442579235, -344451977, 116201380, -16257606, -30108453, 46059148, -44421167, 34319457,
+    -22181619, 11838361, -4832015, 1070864, 372043, -572737, 343908, -113875,
+    -79831, 210973, -208338, -390410, 2323975, -6392360, 12982860, -21412207,
+    29287157, -32138371, 23473628, 4964615, -63825426, 171703314, -388124405, 1208734766,
+    1456957428, -339854369, 111748058, -12799926, -32485604, 47485350, -45122072, 34543980,
+    -22149036, 11708557, -4699160, 974609, 427061, -597760, 352626, -116035,
+    -77536, 202205, -185295, -436150, 2393615, -6466621, 13006261, -21281385,
+    28851887, -31223056, 21923036, 7215790, -66654034, 174606614, -389399448, 1192128219,
+    1471160746, -335041445, 107207306, -9314085, -34861383, 48897287, -45805652, 34753365,
+    -22105538, 11572073, -4562868, 876941, 482477, -622804, 361296, -118169,
+    -75247, 193477, -162468, -481155, 2461396, -6537096, 13023206, -21141274,
+    28405658, -30298449, 20371124, 9450350, -69433489, 177406128, -390477732, 1175419603,
+    1485185228, -330012705, 102580531, -5801538, -37234654, 50294203, -46471474, 34947415,
+    -22051072, 11428925, -4423180, 777895, 538267, -647856, 369909, -120277,
+    -72966, 184792, -139867, -525409, 2527303, -6603783, 13033734, -20992004,
+    27948754, -29365048, 18818635, 11667337, -72162797, 180101343, -391360900, 1158613438,
+    1499026960, -324767717, 97869187, -2263763, -39604279, 51675343, -47119111, 35125936,
+    -21985589, 11279133, -4280135, 677510, 594405, -672901, 378462, -122355,
+    -70695, 176156, -117499, -568899, 2591321, -6666682, 13037891, -20833714,
+    27481464, -28423353, 17266311, 13865810, -74840999, 182691795, -392050651, 1141714266,
+    1512682072, -319306120, 93074777, 1297744, -41969112, 53039954, -47748142, 35288745,
+    -21909044, 11122719, -4133776, 575823, 650867, -697927, 386946, -124402,
+    -68435, 167573, -95375, -611610, 2653436, -6725792, 13035723, -20666541,
+    27004078, -27473862, 15714888, 16044837, -77467160, 185177070, -392548740, 1124726641,
+    1526146743, -313627623, 88198851, 4881464, -44328005, 54387289, -48358154, 35435662,
+    -21821398, 10959712, -3984149, 472872, 707626, -722920, 395358, -126415,
+    -66187, 159046, -73503, -653529, 2713635, -6781118, 13027279, -20490628,
+    26516893, -26517077, 14165098, 18203506, -80040377, 187556803, -392856977, 1107655135,
+    1539417200, -307732005, 83243008, 8485860, -46679805, 55716605, -48948738, 35566514,
+    -21722618, 10790140, -3831300, 368699, 764657, -747866, 403690, -128392,
+    -63954, 150580, -51891, -694642, 2771906, -6832664, 13012612, -20306122,
+    26020204, -25553499, 12617668, 20340916, -82559779, 189830679, -392977225, 1090504329,
+    1552489721, -301619117, 78208891, 12109375, -49023355, 57027160, -49519493, 35681135,
+    -21612674, 10614038, -3675278, 263343, 821932, -772751, 411936, -130332,
+    -61736, 142180, -30548, -734939, 2828239, -6880437, 12991776, -20113172,
+    25514312, -24583631, 11073318, 22456184, -85024521, 191998430, -392911400, 1073278817,
+    1565360633, -295288880, 73098191, 15750433, -51357497, 58318221, -50070027, 35779367,
+    -21491544, 10431443, -3516135, 156848, 879426, -797560, 420090, -132231,
+    -59534, 133847, -9482, -774407, 2882623, -6924446, 12964828, -19911931,
+    24999519, -23607973, 9532764, 24548439, -87433793, 194059839, -392661469, 1055983203,
+    1578026319, -288741289, 67912647, 19407440, -53681068, 59589056, -50599953, 35861057,
+    -21359209, 10242395, -3353922, 49256, 937109, -822279, 428146, -134088,
+    -57350, 125588, 11300, -813034, 2935051, -6964701, 12931830, -19702553,
+    24476131, -22627027, 7996718, 26616830, -89786811, 196014738, -392229451, 1038622097,
+    1590483212, -281976409, 62654040, 23078786, -55992905, 60838942, -51108892, 35926062,
+    -21215656, 10046939, -3188695, -59389, 994956, -846895, 436097, -135901,
+    -55186, 117404, 31790, -850811, 2985516, -7001214, 12892843, -19485196,
+    23944454, -21641293, 6465881, 28660519, -92082824, 197863005, -391617414, 1021200119,
+    1602727802, -274994379, 57324200, 26762843, -58291844, 62067159, -51596475, 35974242,
+    -21060879, 9845123, -3020511, -169042, 1052937, -871391, 443938, -137666,
+    -53042, 109300, 51982, -887728, 3034009, -7034000, 12847932, -19260023,
+    23404797, -20651273, 4940951, 30678686, -94321113, 199604569, -390827474, 1003721889,
+    1614756636, -267795408, 51925001, 30457966, -60576718, 63272995, -52062337, 36005467,
+    -20894876, 9636997, -2849428, -279656, 1111024, -895754, 451662, -139383,
+    -50920, 101279, 71868, -923775, 3080527, -7063073, 12797165, -19027197,
+    22857472, -19657465, 3422618, 32670527, -96500989, 201239403, -389861797, 986192036,
+    1626566317, -260379781, 46458359, 34162497, -62846363, 64455743, -52506126, 36019616,
+    -20717650, 9422617, -2675508, -391187, 1169188, -919968, 459262, -141048,
+    -48820, 93345, 91441, -958943, 3125066, -7088453, 12740613, -18786883,
+    22302792, -18660367, 1911564, 34635256, -98621792, 202767531, -388722594, 968615187,
+    1638153507, -252747854, 40926236, 37874760, -65099613, 65614705, -52927495, 36016571,
+    -20529210, 9202040, -2498813, -503584, 1227399, -944019, 466733, -142659,
+    -46744, 85501, 110695, -993224, 3167621, -7110156, 12678346, -18539251,
+    21741070, -17660475, 408467, 36572103, -100682898, 204189023, -387412121, 950995971,
+    1649514928, -244900058, 35330639, 41593069, -67335304, 66749188, -53326108, 35996226,
+    -20329571, 8975329, -2319408, -616801, 1285629, -967892, 474068, -144215,
+    -44693, 77750, 129625, -1026610, 3208192, -7128206, 12610440, -18284473,
+    21172622, -16658286, -1086007, 38480316, -102683710, 205503996, -385932680, 933339016,
+    1660647363, -236836894, 29673615, 45315720, -69552273, 67858508, -53701635, 35958479,
+    -20118755, 8742548, -2137358, -730788, 1343847, -991571, 481260, -145712,
+    -42668, 70094, 148223, -1059094, 3246776, -7142623, 12536972, -18022721,
+    20597766, -15654291, -2571198, 40359162, -104623664, 206712613, -384286616, 915648947,
+    1671547656, -228558941, 23957253, 49040998, -71749358, 68941989, -54053759, 35903240,
+    -19896785, 8503767, -1952734, -845493, 1402024, -1015041, 488303, -147149,
+    -40670, 62538, 166486, -1090670, 3283374, -7153433, 12458019, -17754172,
+    20016819, -14648982, -4046454, 42207925, -106502229, 207815084, -382476318, 897930385,
+    1682212714, -220066849, 18183688, 52767178, -73925401, 69998964, -54382170, 35830423,
+    -19663696, 8259057, -1765604, -960867, 1460127, -1038288, 495191, -148523,
+    -38699, 55083, 184406, -1121331, 3317986, -7160660, 12373664, -17479003,
+    19430101, -13642848, -5511131, 44025906, -108318904, 208811663, -380504214, 880187945,
+    1692639510, -211361341, 12355091, 56492521, -76079248, 71028772, -54686567, 35739953,
+    -19419522, 8008495, -1576041, -1076857, 1518128, -1061296, 501918, -149832,
+    -36758, 47732, 201979, -1151072, 3350616, -7164333, 12283989, -17197395,
+    18837931, -12636374, -6964597, 45812427, -110073220, 209702652, -378372774, 862426235,
+    1702825081, -202443217, 6473677, 60215277, -78209745, 72030765, -54966661, 35631760,
+    -19164309, 7752159, -1384118, -1193411, 1575994, -1084048, 508476, -151074,
+    -34845, 40489, 219201, -1179888, 3381265, -7164480, 12189080, -16909528,
+    18240629, -11630045, -8406224, 47566829, -111764740, 210488395, -376084506, 844649856,
+    1712766530, -193313347, 541699, 63933688, -80315746, 73004302, -55222171, 35505786,
+    -18898104, 7490132, -1189913, -1310474, 1633695, -1106531, 514860, -152246,
+    -32963, 33355, 236067, -1207774, 3409938, -7161131, 12089022, -16615587,
+    17638516, -10624339, -9835398, 49288468, -113393057, 211169284, -373641957, 826863395,
+    1722461027, -183972677, -5438549, 67645986, -82396108, 73948752, -55452828, 35361977,
+    -18620962, 7222501, -993501, -1427993, 1691199, -1128729, 521062, -153346,
+    -31113, 26333, 252572, -1234727, 3436640, -7154319, 11983906, -16315757,
+    17031913, -9619735, -11251511, 50976723, -114957800, 211745751, -371047711, 809071430,
+    1731905811, -174422227, -11464736, 71350394, -84449694, 74863495, -55658371, 35200291,
+    -18332942, 6949354, -794962, -1545913, 1748474, -1150625, 527078, -154373,
+    -29294, 19426, 268712, -1260743, 3461376, -7144077, 11873822, -16010225,
+    16421140, -8616705, -12653967, 52630992, -116458625, 212218275, -368304387, 791278528,
+    1741098190, -164663090, -17534492, 75045128, -86475372, 75747921, -55838552, 35020692,
+    -18034112, 6670784, -594377, -1664178, 1805487, -1172205, 532899, -155322,
+    -27508, 12635, 284483, -1285820, 3484153, -7130440, 11758861, -15699179,
+    15806520, -7615721, -14042179, 54250690, -117895221, 212587376, -365414639, 773489236,
+    1750035541, -154696432, -23645411, 78728397, -88472018, 76601432, -55993132, 34823155,
+    -17724542, 6386888, -391829, -1782731, 1862208, -1193453, 538521, -156194,
+    -25755, 5962, 299883, -1309954, 3504980, -7113443, 11639119, -15382808,
+    15188373, -6617249, -15415569, 55835253, -119267311, 212853617, -362381155, 755708089,
+    1758715314, -144523494, -29795049, 82398403, -90438513, 77423439, -56121884, 34607660,
+    -17404310, 6097765, -187401, -1901516, 1918603, -1214353, 543936, -156984,
+    -24035, -591, 314907, -1333145, 3523864, -7093124, 11514691, -15061305,
+    14567019, -5621750, -16773573, 57384139, -120574647, 213017604, -359206655, 737939604,
+    1767135029, -134145589, -35980928, 86053342, -92373747, 78213368, -56224591, 34374199,
+    -17073499, 5803519, 18819, -2020475, 1974640, -1234890, 549139, -157691,
+    -22350, -7021, 329553, -1355392, 3540816, -7069523, 11385675, -14734860,
+    13942778, -4629682, -18115635, 58896822, -121817013, 213079983, -355893889, 720188277,
+    1775292279, -123564105, -42200533, 89691409, -94276618, 78970653, -56301048, 34122770,
+    -16732198, 5504254, 226745, -2139549, 2030287, -1255049, 554122, -158313,
+    -20700, -13327, 343818, -1376692, 3555846, -7042680, 11252169, -14403667,
+    13315970, -3641500, -19441208, 60372799, -122994224, 213041443, -352445640, 702458586,
+    1783184732, -112780500, -48451317, 93310790, -96146032, 79694744, -56351061, 33853382,
+    -16380501, 5200082, 436288, -2258680, 2085509, -1274813, 558881, -158848,
+    -19086, -19507, 357700, -1397047, 3568965, -7012636, 11114273, -14067921,
+    12686912, -2657652, -20749760, 61811586, -124106128, 212902711, -348864716, 684754986,
+    1790810129, -101796309, -54730697, 96909672, -97980906, 80385101, -56374449, 33566051,
+    -16018510, 4891114, 647358, -2377808, 2140276, -1294167, 563408, -159293,
+    -17507, -25560, 371195, -1416456, 3580187, -6979434, 10972090, -13727816,
+    12055923, -1678583, -22040769, 63212720, -125152603, 212664555, -345153956, 667081907,
+    1798166286, -90613135, -61036061, 100486238, -99780165, 81041198, -56371040, 33260803,
+    -15646329, 4577466, 859861, -2496873, 2194552, -1313097, 567698, -159646,
+    -15965, -31485, 384302, -1434921, 3589523, -6943117, 10825723, -13383548,
+    11423319, -704731, -23313722, 64575757, -126133558, 212327782, -341316222, 649443758,
+    1805251096, -79232657, -67364763, 104038669, -101542745, 81662523, -56340676, 32937672,
+    -15264072, 4259258, 1073704, -2615815, 2248306, -1331585, 571744, -159906,
+    -14459, -37280, 397020, -1452442, 3596987, -6903732, 10675275, -13035313,
+    10789414, 263470, -24568121, 65900275, -127048934, 211893239, -337354405, 631844920,
+    1812062528, -67656624, -73714125, 107565147, -103267593, 82248575, -56283210, 32596702,
+    -14871854, 3936611, 1288793, -2734572, 2301504, -1349618, 575540, -160070,
+    -12990, -42943, 409346, -1469022, 3602596, -6861324, 10520853, -12683310,
+    10154523, 1225590, -25803477, 67185873, -127898700, 211361810, -333271418, 614289745,
+    1818598629, -55886858, -80081442, 111063852, -104953668, 82798870, -56198509, 32237945,
+    -14469800, 3609651, 1505031, -2853084, 2354113, -1367180, 579081, -160135,
+    -11558, -48474, 421280, -1484662, 3606363, -6815942, 10362563, -12327735,
+    9518958, 2181207, -27019315, 68432168, -128682859, 210734415, -329070195, 596782558,
+    1824857523, -43925250, -86463977, 114532968, -106599941, 83312937, -56086450, 31861461,
+    -14058038, 3278507, 1722321, -2971287, 2406099, -1384255, 582361, -160101,
+    -10165, -53872, 432820, -1499365, 3608307, -6767632, 10200513, -11968786,
+    8883028, 3129903, -28215171, 69638801, -129401442, 210012013, -324753695, 579327654,
+    1830837413, -31773765, -92858968, 117970677, -108205394, 83790319, -55946924, 31467321,
+    -13636703, 2943309, 1940562, -3089121, 2457430, -1400829, 585373, -159965,
+    -8808, -59135, 443965, -1513135, 3608443, -6716446, 10034812, -11606661,
+    8247044, 4071267, -29390592, 70805432, -130054512, 209195598, -320324895, 561929295,
+    1836536582, -19434436, -99263622, 121375167, -109769024, 84230575, -55779833, 31055605,
+    -13205934, 2604192, 2159656, -3206522, 2508071, -1416886, 588112, -159725,
+    -7490, -64264, 454715, -1525975, 3606790, -6662434, 9865569, -11241559,
+    7611310, 5004893, -30545140, 71931742, -130642162, 208286200, -315786793, 544591712,
+    1841953393, -6909368, -105675122, 124744628, -111289841, 84633277, -55585093, 30626400,
+    -12765878, 2261293, 2379499, -3323427, 2557990, -1432412, 590573, -159379,
+    -6210, -69256, 465070, -1537889, 3603366, -6605647, 9692896, -10873677,
+    6976133, 5930382, -31678389, 73017433, -131164512, 207284883, -311142403, 527319099,
+    1847086288, 5799267, -112090626, 128077253, -112766871, 84998015, -55362632, 30179804,
+    -12316684, 1914753, 2599991, -3439773, 2607153, -1447391, 592748, -158925,
+    -4969, -74113, 475029, -1548882, 3598191, -6546137, 9516903, -10503215,
+    6341813, 6847341, -32789923, 74062228, -131621715, 206192746, -306394756, 510115618,
+    1851933792, 18689224, -118507265, 131371243, -114199151, 85324393, -55112393, 29715922,
+    -11858511, 1564714, 2821025, -3555496, 2655528, -1461809, 594635, -158361,
+    -3765, -78832, 484592, -1558959, 3591285, -6483960, 9337704, -10130370,
+    5708651, 7755383, -33879342, 75065870, -132013952, 205010920, -301546901, 492985392,
+    1856494510, 31758194, -124922149, 134624803, -115585736, 85612031, -54834328, 29234871,
+    -11391519, 1211322, 3042499, -3670532, 2703080, -1475651, 596225, -157687,
+    -2600, -83414, 493760, -1568125, 3582669, -6419168, 9155410, -9755340,
+    5076945, 8654129, -34946258, 76028124, -132341432, 203740571, -296601896, 475932505,
+    1860767129, 45003795, -131332365, 137836145, -116925697, 85860567, -54528407, 28736774,
+    -10915876, 854725, 3264304, -3784817, 2749778, -1488904, 597515, -156899,
+    -1474, -87858, 502534, -1576386, 3572365, -6351816, 8970137, -9378324,
+    4446988, 9543205, -35990294, 76948776, -132604395, 202382894, -291562818, 458961004,
+    1864750421, 58423583, -137734977, 141003489, -118218121, 86069653, -54194608, 28221765,
+    -10431755, 495075, 3486335, -3898288, 2795587, -1501552, 598499, -155996,
+    -386, -92164, 510913, -1583749, 3560393, -6281962, 8781998, -8999517,
+    3819073, 10422245, -37011088, 77827633, -132803108, 200939118, -286432752, 442074895,
+    1868443237, 72015041, -144127031, 144125064, -119462111, 86238960, -53832927, 27689986,
+    -9939334, 132525, 3708484, -4010879, 2840476, -1513581, 599172, -154976,
+    663, -96332, 518899, -1590219, 3546778, -6209662, 8591108, -8619117,
+    3193490, 11290891, -38008292, 78664521, -132937867, 199410500, -281214795, 425278140,
+    1871844515, 85775592, -150505551, 147199106, -120656788, 86368175, -53443370, 27141589,
+    -9438797, -232769, 3930640, -4122525, 2884411, -1524978, 599529, -153838,
+    1675, -100362, 526494, -1595804, 3531543, -6134972, 8397582, -8237320,
+    2570523, 12148790, -38981569, 79459289, -133008996, 197798330, -275912052, 408574660,
+    1874953274, 99702587, -156867544, 150223864, -121801291, 86457002, -53025959, 26576734,
+    -8930331, -600647, 4152695, -4233163, 2927360, -1535729, 599565, -152581,
+    2648, -104254, 533697, -1600512, 3514712, -6057953, 8201536, -7854321,
+    1950456, 12995598, -39930597, 80211805, -133016845, 196103924, -270527638, 391968333,
+    1877768619, 113793318, -163209999, 153197597, -122894778, 86505162, -52580727, 25995591,
+    -8414130, -970949, 4374537, -4342727, 2969291, -1545820, 599276, -151202,
+    3583, -108007, 540512, -1604350, 3496308, -5978661, 8003086, -7470314,
+    1333568, 13830978, -40855066, 80921959, -132961794, 194328627, -265064673, 375462987,
+    1880289738, 128045008, -169529890, 156118576, -123936425, 86512396, -52107723, 25398338,
+    -7890394, -1343510, 4596055, -4451152, 3010171, -1555238, 598655, -149700,
+    4480, -111623, 546940, -1607327, 3476358, -5897158, 7802349, -7085494,
+    720137, 14654599, -41754682, 81589662, -132844248, 192473812, -259526285, 359062410,
+    1882515904, 142454820, -175824175, 158985084, -124925427, 86478461, -51607008, 24785163,
+    -7359326, -1718166, 4817136, -4558374, 3049970, -1563969, 597700, -148074,
+    5339, -115101, 552982, -1609451, 3454888, -5813502, 7599440, -6700053,
+    110433, 15466141, -42629163, 82214844, -132664639, 190540879, -253915603, 342770336,
+    1884446476, 157019851, -182089797, 161795418, -125861001, 86403133, -51078656, 24156261,
+    -6821134, -2094748, 5037669, -4664328, 3088654, -1572001, 596405, -146323,
+    6160, -118442, 558641, -1610731, 3431922, -5727755, 7394477, -6314182,
+    -495272, 16265289, -43478240, 82797456, -132423427, 188531253, -248235763, 326590455,
+    1886080896, 171737139, -188323688, 164547890, -126742382, 86286205, -50522758, 23511837,
+    -6276032, -2473086, 5257538, -4768949, 3126193, -1579320, 594767, -144444,
+    6945, -121647, 563920, -1611176, 3407489, -5639978, 7187576, -5928073,
+    -1096714, 17051737, -44301658, 83337470, -132121095, 186446384, -242489902, 310526404,
+    1887418694, 186603659, -194522765, 167240827, -127568828, 86127491, -49939416, 22852106,
+    -5724238, -2853007, 5476631, -4872173, 3162556, -1585915, 592781, -142438,
+    7692, -124715, 568820, -1610796, 3381616, -5550232, 6978854, -5541913,
+    -1693632, 17825187, -45099177, 83834877, -131758153, 184287749, -236681155, 294581771,
+    1888459482, 201616326, -200683937, 169872570, -128339616, 85926822, -49328745, 22177290,
+    -5165976, -3234337, 5694832, -4973935, 3197711, -1591773, 590442, -140302,
+    8403, -127647, 573344, -1609601, 3354329, -5458580, 6768429, -5155892,
+    -2285767, 18585348, -45870570, 84289691, -131335137, 182056844, -230812660, 278760092,
+    1889202961, 216771996, -206804103, 172441481, -129054047, 85684048, -48690877, 21487620,
+    -4601473, -3616900, 5912026, -5074171, 3231629, -1596883, 587748, -138036,
+    9077, -130445, 577496, -1607601, 3325658, -5365084, 6556416, -4770196,
+    -2872865, 19331939, -46615624, 84701943, -130852608, 179755191, -224887553, 263064849,
+    1889648916, 232067464, -212880152, 174945937, -129711442, 85399040, -48025955, 20783336,
+    -4030961, -4000517, 6128099, -5172816, 3264279, -1601231, 584695, -135638,
+    0, -133109, 581281, -1604815, 3295646, -5269831, 6342961, -4385029,
+    -3454693, 20064777, -47334352, 85072071, -130311738, 177385137, -218909957, 247500590,
+    1889805768, 247500590, -218909957, 177385137, -130311738, 85072071, -47334352, 20064777,
+    -3454693, -4385029, 6342961, -5269831, 3295646, -1604815, 581281, -133109,
+};
+
+/* high: 64 taps, 128 phases, cutoff 0.92, kaiser beta 12.0 */
+#define I2S_MULTILINE_SRC_HIGH_TAPS        (64U)
+#define I2S_MULTILINE_SRC_HIGH_PHASE_BITS  (7U)
+static const int32_t i2s_multiline_src_coef_high[(128 + 1) * 64] = {
+    5562, -15053, 30537, -49850, 64795, -57933, 0, 150718,
+    -445563, 937878, -1669808, 2653801, -3850431, 5145706, -6332262, 7099617,
+    -7038497, 5662997, -2452020, -3091707, 11370330, -22615812, 36821996, -53695436,
+    72635454, -92750709, 112914765, -131857359, 148282277, -160998005, 169044420, 1975682832,
+    169044420, -160998005, 148282277, -131857359, 112914765, -92750709, 72635454, -53695436,
+    36821996, -22615812, 11370330, -3091707, -2452020, 5662997, -7038497, 7099617,
+    -6332262, 5145706, -3850431, 2653801, -1669808, 937878, -445563, 150718,
+    0, -57933, 64795, -49850, 30537, -15053, 5562, 0,
+    5500, -14832, 29915, -48391, 61838, -52609, -8628, 163372,
+    -462276, 957346, -1688616, 2665633, -3845456, 5110342, -6249583, 6950614,
+    -6804350, 5328397, -2009451, -3637001, 11995027, -23273235, 37437137, -54160138,
+    72802749, -92425460, 111833222, -129635350, 144265398, -153717282, 152927900, 1975515304,
+    185330569, -168255820, 152246284, -134022106, 113942831, -93029654, 72430369, -53201642,
+    36185902, -21944552, 10737631, -2542879, -2894963, 5995969, -7269962, 7245589,
+    -6412041, 5178578, -3853439, 2640531, -1650029, 917805, -428511, 137898,
+    8693, -63270, 67746, -51296, 31150, -15268, 5621, -1122,
+    5436, -14607, 29284, -46922, 58873, -47300, -17188, 175853,
+    -478642, 976202, -1706445, 2676026, -3838520, 5072507, -6164049, 6798658,
+    -6567639, 4992341, -1567479, -4178490, 12611410, -23916495, 38031023, -54595523,
+    72932186, -92054097, 110698788, -127357259, 140197721, -146417089, 136984369, 1975009688,
+    201782386, -175486770, 156154897, -136128022, 114916503, -93261837, 72187354, -52678824,
+    35529053, -21259717, 10097208, -1990783, -3338050, 6327127, -7498603, 7388432,
+    -6488856, 5208921, -3854463, 2625819, -1629280, 897134, -411125, 124917,
+    17446, -68617, 70686, -52730, 31752, -15477, 5678, -1136,
+    5369, -14376, 28644, -45442, 55905, -42009, -25675, 188158,
+    -494655, 994440, -1723292, 2684983, -3829639, 5032236, -6075721, 6643844,
+    -6328502, 4655009, -1126329, -4715910, 13219198, -24545322, 38603441, -55001497,
+    73023870, -91637028, 109512309, -125024560, 136081638, -139101178, 121217465, 1974167159,
+    218396189, -182687213, 160005912, -138173835, 115835125, -93447015, 71906437, -52127180,
+    34851734, -20561625, 9449371, -1435693, -3781054, 6656297, -7724293, 7528061,
+    -6562656, 5236709, -3853494, 2609668, -1607567, 875872, -393414, 111782,
+    26256, -73972, 73615, -54149, 32344, -15680, 5733, -1150,
+    5301, -14140, 27995, -43952, 52933, -36740, -34086, 200280,
+    -510309, 1012055, -1739154, 2692506, -3818826, 4989559, -5984656, 6486264,
+    -6087070, 4316579, -686226, -5249001, 13818108, -25159443, 39154170, -55377951,
+    73077884, -91174631, 108274595, -122638681, 131919478, -131773198, 105630664, 1972987976,
+    235168139, -189853412, 163797067, -140158230, 116698007, -93584920, 71587631, -51546895,
+    34154226, -19850589, 8794427, -877885, -4223746, 6983301, -7946905, 7664390,
+    -6633392, 5261918, -3850524, 2592077, -1584898, 854027, -375384, 98497,
+    35117, -79331, 76531, -55553, 32925, -15877, 5785, -1162,
+    5230, -13900, 27339, -42454, 49960, -31494, -42416, 212214,
+    -525598, 1029040, -1754028, 2698599, -3806096, 4944511, -5890913, 6326011,
+    -5843478, 3977230, -247392, -5777503, 14407865, -25758594, 39683000, -55724793,
+    73094331, -90667307, 106986478, -120201071, 127713578, -124436777, 90227366, 1971472505,
+    252094327, -196981613, 167526117, -142079916, 117504484, -93675308, 71230966, -50938169,
+    33436818, -19126931, 8132689, -317636, -4665896, 7307961, -8166310, 7797336,
+    -6701012, 5284521, -3845543, 2573048, -1561278, 831607, -357042, 85070,
+    44026, -84691, 79433, -56942, 33495, -16068, 5834, -1175,
+    5158, -13655, 26676, -40948, 46987, -26274, -50662, 223956,
+    -540517, 1045391, -1767911, 2703266, -3791467, 4897125, -5794552, 6163178,
+    -5597859, 3637140, 189953, -6301162, 14988198, -26342518, 40189736, -56041946,
+    73073335, -90115480, 105648815, -117713195, 123466282, -117095516, 75010893, 1969621212,
+    269170775, -204068052, 171190833, -143937627, 118253919, -93717956, 70836493, -50301217,
+    32699811, -18390980, 7464473, 244773, -5107275, 7630101, -8382384, 7926815,
+    -6765467, 5304495, -3838545, 2552585, -1536715, 808620, -338397, 71506,
+    52978, -90051, 82318, -58313, 34053, -16252, 5881, -1186,
+    5084, -13405, 26006, -39436, 44016, -21083, -58820, 235500,
+    -555060, 1061102, -1780802, 2706512, -3774953, 4847437, -5695635, 5997860,
+    -5350348, 3296486, 625588, -6819726, 15558841, -26910968, 40674192, -56329349,
+    73015035, -89519593, 104262481, -115176541, 119179943, -109752995, 59984490, 1967434670,
+    286393441, -211108955, 174789004, -145730123, 118945698, -93712668, 70404280, -49636271,
+    31943517, -17643072, 6790102, 809062, -5547652, 7949545, -8595000, 8052746,
+    -6826711, 5321817, -3829524, 2530689, -1511215, 785075, -319457, 57811,
+    61969, -95406, 85185, -59667, 34598, -16430, 5925, -1197,
+    5008, -13152, 25330, -37918, 41049, -15923, -66886, 246842,
+    -569221, 1076170, -1792701, 2708344, -3756574, 4795484, -5594224, 5830152,
+    -5101081, 2955447, 1059298, -7332947, 16119535, -27463704, 41136195, -56586956,
+    72919591, -88880111, 102828373, -112592609, 114856920, -102412764, 45151325, 1964913553,
+    303758213, -218100536, 178318441, -147456193, 119579237, -93659268, 69934419, -48943575,
+    31168260, -16883552, 6109901, 1374945, -5986796, 8266118, -8804035, 8175049,
+    -6884697, 5336466, -3818474, 2507365, -1484788, 760980, -300228, 43991,
+    70994, -100754, 88033, -61002, 35131, -16600, 5966, -1207,
+    4930, -12895, 24647, -36395, 38087, -10797, -74857, 257978,
+    -582996, 1090590, -1803605, 2708766, -3736348, 4741302, -5490382, 5660152,
+    -4850191, 2614198, 1490865, -7840581, 16670028, -28000498, 41575585, -56814735,
+    72787181, -88197519, 101347411, -109962922, 110499576, -95078348, 30514483, 1962058639,
+    321260919, -225039004, 181776974, -149114650, 120153977, -93557606, 69427017, -48223391,
+    30374374, -16112770, 5424199, 1942137, -6424477, 8579645, -9009366, 8293645,
+    -6939382, 5348422, -3805390, 2482619, -1457442, 736347, -280721, 30054,
+    80048, -106092, 90858, -62318, 35651, -16764, 6004, -1216,
+    4851, -12634, 23960, -34868, 35131, -5707, -82729, 268902,
+    -596379, 1104358, -1813515, 2707788, -3714295, 4684930, -5384174, 5487956,
+    -4597816, 2272916, 1920076, -8342386, 17210072, -28521128, 41992212, -57012671,
+    72618001, -87472322, 99820533, -107289014, 106110279, -87753242, 16076970, 1958870809,
+    338897321, -231920560, 185162456, -150704339, 120669386, -93407557, 68882202, -47475995,
+    29562203, -15331084, 4733331, 2510351, -6860463, 8889953, -9210874, 8408457,
+    -6990722, 5357666, -3790271, 2456454, -1429186, 711183, -260942, 16006,
+    89128, -111417, 93661, -63613, 36156, -16920, 6039, -1224,
+    4770, -12370, 23267, -33338, 32183, -656, -90499, 279610,
+    -609368, 1117472, -1822431, 2705415, -3690434, 4626408, -5275665, 5313663,
+    -4344091, 1931778, 2346718, -8838127, 17739426, -29025383, 42385940, -57180765,
+    72412264, -86705044, 98248695, -104572437, 101691397, -80440911, 1841712, 1955351046,
+    356663121, -238741402, 188472765, -152224132, 121124962, -93209017, 68300124, -46701677,
+    28732103, -14538859, 4037634, 3079296, -7294523, 9196869, -9408438, 8519411,
+    -7038675, 5364182, -3773113, 2428878, -1400030, 685499, -240902, 1853,
+    98228, -116726, 96439, -64887, 36648, -17069, 6070, -1232,
+    4688, -12102, 22569, -31805, 29245, 4354, -98164, 290099,
+    -621956, 1129929, -1830355, 2701657, -3664787, 4565775, -5164920, 5137370,
+    -4089151, 1590957, 2770583, -9327570, 18257857, -29513059, 42756645, -57319031,
+    72170203, -85896230, 96632875, -101814756, 97245301, -73144789, -12188449, 1951500436,
+    374553958, -245497724, 191705800, -153672930, 121520231, -92961909, 67680949, -45900742,
+    27884439, -13736467, 3337450, 3648684, -7726426, 9500222, -9601940, 8626432,
+    -7083203, 5367952, -3753916, 2399898, -1369984, 659306, -220609, -12397,
+    107343, -122016, 99189, -66138, 37125, -17209, 6099, -1238,
+    4604, -11831, 21868, -30271, 26319, 9321, -105719, 300364,
+    -634140, 1141725, -1837287, 2696524, -3637377, 4503074, -5052008, 4959178,
+    -3833134, 1250628, 3191463, -9810485, 18765135, -29983963, 43104214, -57427499,
+    71892067, -85046443, 94974067, -99017550, 92774364, -65868277, -26010753, 1947320166,
+    392565414, -252185717, 194859489, -155049668, 121854745, -92666179, 67024865, -45073511,
+    27019588, -12924285, 2633123, 4218221, -8155942, 9799842, -9791264, 8729449,
+    -7124267, 5368963, -3732680, 2369521, -1339060, 632615, -200071, -26739,
+    116470, -127285, 101912, -67367, 37587, -17342, 6124, -1244,
+    4520, -11558, 21163, -28737, 23405, 14242, -113163, 310401,
+    -645917, 1152858, -1843229, 2690023, -3608225, 4438344, -4936995, 4779186,
+    -3576175, 910964, 3609152, -10286650, 19261039, -30437911, 43428548, -57506216,
+    71578123, -84156266, 93273285, -96182411, 88280956, -58614741, -39622525, 1942811526,
+    410693014, -258801575, 197931783, -156353307, 122128087, -92321798, 66332078, -44220318,
+    26137935, -12102698, 1925002, 4787616, -8582840, 10095560, -9976297, 8828392,
+    -7161831, 5367200, -3709405, 2337757, -1307267, 605435, -179299, -41164,
+    125603, -132528, 104604, -68571, 38034, -17467, 6146, -1249,
+    4434, -11282, 20454, -27202, 20505, 19115, -120491, 320208,
+    -657282, 1163327, -1848184, 2682168, -3577357, 4371631, -4819952, 4597495,
+    -3318410, 572137, 4023448, -10755842, 19745355, -30874728, 43729558, -57555241,
+    71228656, -83226299, 91531557, -93310942, 83767445, -51387513, -53021171, 1937975904,
+    428932226, -265341491, 200920665, -157582844, 122339871, -91928762, 65602814, -43341513,
+    25239876, -11272095, 1213437, 5356574, -9006890, 10387207, -10156924, 8923193,
+    -7195859, 5362653, -3684095, 2304613, -1274619, 577780, -158301, -55666,
+    134737, -137744, 107265, -69750, 38465, -17584, 6164, -1253,
+    4346, -11003, 19743, -25669, 17620, 23938, -127701, 329779,
+    -668233, 1173130, -1852155, 2672968, -3544795, 4302977, -4700946, 4414204,
+    -3059976, 234319, 4434149, -11217847, 20217874, -31294248, 44007169, -57574650,
+    70843967, -82257160, 89749932, -90404757, 79236197, -44189888, -66204186, 1932814791,
+    447278462, -271801662, 203824144, -158737307, 122489736, -91487092, 64837319, -42437459,
+    24325818, -10432874, 498783, 5924801, -9427864, 10674619, -10333035, 9013785,
+    -7226319, 5355310, -3656751, 2270102, -1241128, 549660, -137088, -70238,
+    143868, -142928, 109891, -70903, 38879, -17692, 6179, -1255,
+    4258, -10722, 19029, -24138, 14752, 28709, -134790, 339112,
+    -678766, 1182266, -1855145, 2662434, -3510566, 4232427, -4580048, 4229417,
+    -2801008, -102321, 4841059, -11672452, 20678394, -31696315, 44261319, -57564534,
+    70424374, -81249487, 87929470, -87465481, 74689574, -37025125, -79169147, 1927329775,
+    465727083, -278178289, 206640259, -159815756, 122577355, -90996832, 64035858, -41508533,
+    23396175, -9585436, -218602, 6492001, -9845533, 10957631, -10504522, 9100103,
+    -7253180, 5345163, -3627379, 2234233, -1206806, 521088, -115669, -84872,
+    152990, -148079, 112483, -72029, 39277, -17791, 6191, -1257,
+    4169, -10439, 18314, -22610, 11903, 33425, -141755, 348203,
+    -688878, 1190734, -1857158, 2650581, -3474695, 4160027, -4457329, 4043233,
+    -2541642, -437614, 5243982, -12119451, 21126722, -32080782, 44491955, -57524997,
+    69970214, -80203932, 86071250, -84494748, 70129931, -29896441, -91913720, 1921522547,
+    484273396, -284467580, 209367082, -160817284, 122602428, -90458053, 63198715, -40555127,
+    22451372, -8730190, -938360, 7057878, -10259670, 11236079, -10671277, 9182086,
+    -7276411, 5332204, -3595984, 2197018, -1171667, 492075, -94054, -99562,
+    162099, -153193, 115037, -73127, 39658, -17882, 6198, -1258,
+    4079, -10154, 17597, -21085, 9074, 38085, -148594, 357050,
+    -698567, 1198534, -1858199, 2637421, -3437210, 4085822, -4332860, 3855755,
+    -2282012, -771393, 5642726, -12558640, 21562668, -32447512, 44699038, -57456159,
+    69481836, -79121165, 84176365, -81494199, 65559619, -22807016, -104435656, 1915394894,
+    502912661, -290665751, 212002714, -161741022, 122564688, -89870850, 62326194, -39577647,
+    21491844, -7867548, -1660128, 7622137, -10670047, 11509803, -10833194, 9259673,
+    -7295984, 5316426, -3562573, 2158470, -1135724, 462635, -72253, -114299,
+    171189, -158267, 117552, -74197, 40021, -17964, 6203, -1258,
+    3988, -9868, 16879, -19565, 6265, 42686, -155303, 365649,
+    -707830, 1205665, -1858271, 2622966, -3398136, 4009859, -4206713, 3667086,
+    -2022254, -1103491, 6037101, -12989824, 21986054, -32796378, 44882544, -57358154,
+    68959610, -78001874, 82245922, -78465486, 60980979, -15759988, -116732793, 1908948701,
+    521640087, -296769026, 214545293, -162586131, 122463898, -89235342, 61418616, -38576512,
+    20518032, -6997928, -2383542, 8184481, -11076440, 11778643, -10990172, 9332805,
+    -7311874, 5297825, -3527152, 2118601, -1098992, 432780, -50277, -129076,
+    180257, -163297, 120027, -75237, 40366, -18036, 6203, -1256,
+    3897, -9580, 16160, -18049, 3479, 47227, -161880, 373998,
+    -716666, 1212128, -1857382, 2607233, -3357503, 3932185, -4078961, 3477327,
+    -1762502, -1433746, 6426921, -13412807, 22396704, -33127261, 45042455, -57231132,
+    68403919, -76846761, 80281041, -75410263, 56396346, -8758454, -128803059, 1902185951,
+    540450835, -302773640, 216992989, -163351811, 122299851, -88551676, 60476324, -37552155,
+    19530390, -6121754, -3108234, 8744614, -11478625, 12042441, -11142110, 9401426,
+    -7324056, 5276397, -3489731, 2077427, -1061487, 402524, -28136, -143886,
+    189296, -168282, 122460, -76247, 40693, -18099, 6199, -1254,
+    3804, -9291, 15441, -16540, 717, 51705, -168323, 382093,
+    -725072, 1217923, -1855535, 2590235, -3315339, 3852850, -3949677, 3286580,
+    -1502889, -1761992, 6812002, -13827404, 22794454, -33440053, 45178772, -57075256,
+    67815162, -75656546, 78282856, -72330195, 51808043, -1805465, -140644467, 1895108723,
+    559340024, -308675843, 219344007, -164037295, 122072371, -87820022, 59499678, -36505021,
+    18529377, -5239455, -3833837, 9302238, -11876378, 12301044, -11288908, 9465482,
+    -7332508, 5252141, -3450318, 2034961, -1023223, 371881, -5840, -158721,
+    198302, -173217, 124849, -77226, 41002, -18153, 6192, -1250,
+    3712, -9001, 14722, -15038, -2021, 56120, -174629, 389933,
+    -733047, 1223052, -1852739, 2571988, -3271674, 3771901, -3818934, 3094949,
+    -1243549, -2088071, 7192163, -14233430, 23179142, -33734656, 45291502, -56890703,
+    67193755, -74431961, 76252513, -69226947, 47218385, 5095968, -152255120, 1887719192,
+    578302726, -314471895, 221596590, -164641855, 121781315, -87040573, 58489058, -35435571,
+    17515462, -4351462, -4559980, 9857059, -12269478, 12554296, -11430470, 9524920,
+    -7337209, 5225056, -3408926, 1991219, -984215, 340863, 16599, -173574,
+    207270, -178100, 127192, -78172, 41291, -18197, 6180, -1245,
+    3618, -8710, 14004, -13543, -4732, 60467, -180795, 397514,
+    -740589, 1227516, -1848999, 2552508, -3226537, 3689388, -3686807, 2902536,
+    -984614, -2411821, 7567229, -14630709, 23550618, -34010979, 45380668, -56677663,
+    66540127, -73173755, 74191170, -66102193, 42629672, 11942884, -163633211, 1880019628,
+    597333973, -320158075, 223749017, -165164799, 121426570, -86213552, 57444861, -34344276,
+    16489122, -3458213, -5286292, 10408780, -12657706, 12802048, -11566704, 9579691,
+    -7338140, 5195143, -3365566, 1946217, -944482, 309485, 39171, -188436,
+    216194, -182928, 129488, -79086, 41560, -18232, 6165, -1239,
+    3524, -8418, 13286, -12056, -7416, 64747, -186821, 404836,
+    -747697, 1231315, -1844323, 2531812, -3179960, 3605361, -3553369, 2709443,
+    -726217, -2733086, 7937024, -15019067, 23908737, -34268945, 45446304, -56436344,
+    65854725, -71882692, 72099996, -62957607, 38044194, 18732363, -174777021, 1872012394,
+    616428755, -325730679, 225799605, -165605472, 121008056, -85339202, 56367504, -33231621,
+    15450843, -2560149, -6012399, 10957105, -13040844, 13044150, -11697516, 9629747,
+    -7335284, 5162405, -3320251, 1899973, -904038, 277761, 61864, -203301,
+    225070, -187698, 131736, -79966, 41810, -18256, 6145, -1232,
+    3430, -8126, 12570, -10578, -10071, 68958, -192702, 411895,
+    -754370, 1234453, -1838718, 2509916, -3131973, 3519870, -3418695, 2515773,
+    -468487, -3051710, 8301379, -15398336, 24253361, -34508483, 45488455, -56166962,
+    65138007, -70559548, 69980170, -59794866, 33464227, 25461537, -185684920, 1863699949,
+    635582023, -331186018, 227746713, -165963256, 120525722, -84417795, 55257422, -32098105,
+    14401116, -1657716, -6737927, 11501742, -13418674, 13280455, -11822818, 9675042,
+    -7328626, 5126846, -3272995, 1852503, -862902, 245707, 84668, -218159,
+    233892, -192406, 133932, -80811, 42040, -18270, 6122, -1223,
+    3336, -7833, 11856, -9110, -12697, 73097, -198439, 418690,
+    -760607, 1236932, -1832193, 2486839, -3082609, 3432967, -3282861, 2321627,
+    -211555, -3367539, 8660125, -15768355, 24584361, -34729532, 45507180, -55869752,
+    64390448, -69205113, 67832881, -56615651, 28892030, 32127582, -196355368, 1855084842,
+    654788693, -336520429, 229588738, -166237575, 119979554, -83449625, 54115069, -30944238,
+    13340443, -751362, -7462500, 12042395, -13790984, 13510821, -11942523, 9715533,
+    -7318153, 5088470, -3223813, 1803827, -821091, 213336, 107570, -233003,
+    242656, -197050, 136077, -81621, 42248, -18274, 6094, -1214,
+    3241, -7540, 11144, -7652, -15291, 77163, -204027, 425219,
+    -766409, 1238754, -1824755, 2462599, -3031899, 3344703, -3145942, 2127109,
+    44450, -3680421, 9013100, -16128966, 24901614, -34932044, 45502546, -55544960,
+    63612536, -67820191, 65659329, -53421640, 24329848, 38727727, -206786918, 1846169713,
+    674043643, -341730266, 231324119, -166427887, 119369565, -82435013, 52940915, -29770540,
+    12269331, 158459, -8185743, 12578773, -14157561, 13735105, -12056548, 9751179,
+    -7303854, 5047286, -3172722, 1753963, -778624, 180665, 130561, -247826,
+    251356, -201627, 138167, -82395, 42436, -18268, 6061, -1202,
+    3147, -7247, 10434, -6205, -17853, 81155, -209466, 431480,
+    -771774, 1239922, -1816415, 2437213, -2979878, 3255130, -3008013, 1932320,
+    299400, -3990207, 9360144, -16480019, 25205005, -35115976, 45474636, -55192844,
+    62804773, -66405599, 63460719, -50214515, 19779910, 45259247, -216978209, 1836957295,
+    693341719, -346811909, 232951337, -166533694, 118695804, -81374303, 51735450, -28577548,
+    11188294, 1071292, -8907279, 13110584, -14518194, 13953168, -12164811, 9781942,
+    -7285719, 5003301, -3119738, 1702932, -735518, 147707, 153628, -262618,
+    259988, -206133, 140202, -83132, 42603, -18251, 6025, -1190,
+    3052, -6955, 9727, -4770, -20382, 85070, -214755, 437473,
+    -776704, 1240440, -1807181, 2410703, -2926577, 3164301, -2869150, 1737362,
+    553168, -4296750, 9701099, -16821366, 25494426, -35281299, 45423541, -54813677,
+    61967675, -64962163, 61238267, -46995955, 15244425, 51719471, -226927972, 1827450407,
+    712677734, -351761763, 234468917, -166554535, 117958351, -80267865, 50499181, -27365807,
+    10097855, 1986679, -9626731, 13637538, -14872677, 14164874, -12267232, 9807786,
+    -7263741, 4956526, -3064880, 1650754, -691794, 114480, 176759, -277373,
+    268545, -210566, 142180, -83831, 42748, -18223, 5984, -1176,
+    2957, -6662, 9023, -3348, -22877, 88908, -219890, 443195,
+    -781197, 1240310, -1797063, 2383086, -2872031, 3072268, -2729428, 1542336,
+    805628, -4599903, 10035814, -17152868, 25769778, -35427990, 45349368, -54407745,
+    61101771, -63490724, 58993196, -43767638, 10725585, 58105778, -236635031, 1817651959,
+    732046472, -356576260, 235875427, -166489990, 117157318, -79116094, 49232632, -26135873,
+    8998541, 2904156, -10343720, 14159345, -15220803, 14370091, -12363737, 9828676,
+    -7237916, 4906972, -3008167, 1597450, -647470, 80999, 199942, -292082,
+    277024, -214923, 144100, -84492, 42871, -18185, 5939, -1161,
+    2862, -6371, 8324, -1938, -25337, 92668, -224871, 448646,
+    -785254, 1239538, -1786072, 2354384, -2816275, 2979085, -2588925, 1347342,
+    1056654, -4899524, 10364139, -17474389, 26030969, -35556039, 45252230, -53975345,
+    60207602, -61992133, 56726735, -40531238, 6225561, 64415599, -246098296, 1807564947,
+    751442688, -361251858, 237169482, -166339678, 116292851, -77919407, 47936344, -24888316,
+    7890887, 3823260, -11057870, 14675721, -15562371, 14568686, -12454251, 9844582,
+    -7208238, 4854652, -2949621, 1543042, -602566, 47279, 223167, -306738,
+    285419, -219200, 145959, -85113, 42972, -18136, 5889, -1145,
+    2767, -6080, 7627, -542, -27761, 96347, -229696, 453824,
+    -788876, 1238127, -1774218, 2324616, -2759343, 2884805, -2447715, 1152481,
+    1306125, -5195474, 10685929, -17785801, 26277913, -35665442, 45132256, -53516789,
+    59285722, -60467252, 54440119, -37288427, 1746504, 70646421, -255316772, 1797192455,
+    770861109, -365785047, 238349742, -166103262, 115365127, -76678249, 46610878, -23623716,
+    6775433, 4743524, -11768804, 15186378, -15897180, 14760533, -12538704, 9855474,
+    -7174708, 4799580, -2889262, 1487554, -557103, 13338, 246420, -321331,
+    293724, -223396, 147757, -85695, 43050, -18075, 5835, -1127,
+    2673, -5789, 6936, 839, -30147, 99944, -234364, 458729,
+    -792065, 1236082, -1761512, 2293805, -2701272, 2789482, -2305875, 957854,
+    1553916, -5487612, 11001044, -18086978, 26510534, -35756207, 44989583, -53032399,
+    58336698, -58916953, 52134588, -34040875, -2709456, 76795782, -264289552, 1786537649,
+    790296439, -370172348, 239414913, -165780445, 114374356, -75393086, 45256808, -22342661,
+    5652726, 5664478, -12476144, 15691034, -16225033, 14945507, -12617029, 9861326,
+    -7137326, 4741773, -2827114, 1431008, -511102, -20808, 269690, -335853,
+    301936, -227506, 149491, -86236, 43106, -18004, 5777, -1108,
+    2578, -5500, 6249, 2206, -32495, 103458, -238874, 463360,
+    -794820, 1233408, -1747965, 2261971, -2642095, 2693170, -2163480, 763559,
+    1799908, -5775805, 11309345, -18377804, 26728762, -35828352, 44824362, -52522509,
+    57361108, -57342117, 49811387, -30790243, -7140212, 82861276, -273015821, 1775603781,
+    809743359, -374410314, 240363750, -165370969, 113320783, -74064411, 43874726, -21045754,
+    4523318, 6585652, -13179515, 16189408, -16545735, 15123487, -12689160, 9862115,
+    -7096093, 4681248, -2763199, 1373428, -464583, -55143, 292965, -350298,
+    310048, -231529, 151161, -86735, 43138, -17921, 5713, -1087,
+    2485, -5212, 5567, 3556, -34803, 106889, -243224, 467717,
+    -797144, 1230110, -1733590, 2229136, -2581851, 2595925, -2020608, 569695,
+    2043982, -6059919, 11610701, -18658167, 26932535, -35881903, 44636752, -51987468,
+    56359542, -55743635, 47471767, -27538188, -11543681, 88840552, -281494855, 1764394186,
+    829196528, -378495532, 241195057, -164874622, 112204682, -72692738, 42465242, -19733605,
+    3387765, 7506573, -13878540, 16681220, -16859095, 15294354, -12755037, 9857818,
+    -7051016, 4618023, -2697543, 1314839, -417568, -89650, 316232, -364656,
+    318056, -235461, 152765, -87193, 43147, -17828, 5646, -1065,
+    2391, -4926, 4890, 4891, -37072, 110235, -247413, 471799,
+    -799038, 1226193, -1718398, 2195324, -2520574, 2497799, -1877333, 376361,
+    2286018, -6339823, 11904981, -18927958, 27121800, -35916895, 44426926, -51427634,
+    55332601, -54122409, 45116980, -24286362, -15917804, 94731317, -289726018, 1752912280,
+    848650585, -382424627, 241907685, -164291233, 111026363, -71278608, 41028980, -18406835,
+    2246631, 8426766, -14572845, 17166195, -17164924, 15457992, -12814600, 9848417,
+    -7002100, 4552120, -2630171, 1255267, -370079, -124312, 339480, -378919,
+    325954, -239299, 154301, -87608, 43132, -17722, 5573, -1041,
+    2298, -4641, 4219, 6209, -39300, 113494, -251440, 475605,
+    -800503, 1221663, -1702402, 2160555, -2458303, 2398849, -1733732, 183653,
+    2525901, -6615390, 12192061, -19187079, 27296508, -35933375, 44195066, -50843376,
+    54280896, -52479345, 42748281, -21036409, -20260546, 100531334, -297708767, 1741161558,
+    868100152, -386194259, 242500539, -163620671, 109786166, -69822582, 39566582, -17066074,
+    1100482, 9345756, -15262057, 17644058, -17463038, 15614291, -12867793, 9833896,
+    -6949355, 4483561, -2561110, 1194738, -322137, -159110, 362695, -393079,
+    333739, -243041, 155768, -87979, 43094, -17605, 5496, -1016,
+    2205, -4357, 3553, 7510, -41487, 116666, -255304, 479137,
+    -801543, 1216526, -1685614, 2124855, -2395073, 2299130, -1589880, -8331,
+    2763516, -6886494, 12471819, -19435434, 27456622, -35931396, 43941364, -50235077,
+    53205051, -50815359, 40366929, -17789962, -24569899, 106238421, -305442649, 1729145596,
+    887539838, -389801129, 242972571, -162862851, 108484465, -68325248, 38078702, -15711961,
+    -50110, 10263067, -15945803, 18114538, -17753254, 15763141, -12914565, 9814241,
+    -6892790, 4412368, -2490388, 1133277, -273767, -194029, 385865, -407129,
+    341404, -246683, 157165, -88307, 43031, -17477, 5414, -990,
+    2113, -4075, 2894, 8793, -43630, 119749, -259005, 482393,
+    -802158, 1210789, -1668048, 2088245, -2330924, 2198696, -1445852, -199495,
+    2998750, -7153014, 12744140, -19672934, 27602110, -35911023, 43666025, -49603128,
+    52105697, -49131377, 37974182, -14548650, -28843882, 111850458, -312927300, 1716868047,
+    906964233, -393241976, 243322788, -162017730, 107121668, -66787214, 36566014, -14345146,
+    -1204570, 11178222, -16623713, 18577366, -18035395, 15904438, -12954864, 9789442,
+    -6832419, 4338567, -2418033, 1070913, -224990, -229050, 408979, -421059,
+    348945, -250224, 158489, -88590, 42943, -17337, 5328, -961,
+    2021, -3796, 2242, 10058, -45731, 122744, -262542, 485375,
+    -802352, 1204458, -1649718, 2050750, -2265892, 2097603, -1301725, -389745,
+    3231490, -7414831, 13008911, -19899496, 27732949, -35872329, 43369262, -48947932,
+    50983478, -47428326, 35571302, -11314089, -33080540, 117365382, -320162447, 1704332638,
+    926367921, -396513584, 243550248, -161085307, 105698212, -65209114, 35029202, -12966286,
+    -2362318, 12090742, -17295417, 19032278, -18309284, 16038080, -12988646, 9759488,
+    -6768257, 4262183, -2344076, 1007674, -175830, -264155, 432022, -434861,
+    356357, -253660, 159741, -88828, 42831, -17185, 5237, -932,
+    1930, -3518, 1596, 11304, -47787, 125649, -265914, 488082,
+    -802127, 1197540, -1630637, 2012394, -2200016, 1995906, -1157571, -578986,
+    3461628, -7671826, 13266023, -20115044, 27849122, -35815396, 43051299, -48269904,
+    49839045, -45707145, 33159549, -8087885, -37277950, 122781188, -327147906, 1691543175,
+    945745470, -399612778, 243654062, -160065626, 104214570, -63591602, 33468970, -11576046,
+    -3522771, 13000150, -17960549, 19479011, -18574752, 16163969, -13015867, 9724376,
+    -6700319, 4183246, -2268546, 943587, -126311, -299327, 454984, -448528,
+    363635, -256989, 160918, -89020, 42694, -17021, 5141, -901,
+    1840, -3243, 957, 12530, -49799, 128463, -269120, 490514,
+    -801485, 1190043, -1610820, 1973202, -2133334, 1893661, -1013467, -767125,
+    3689055, -7923888, 13515374, -20319505, 27950621, -35740315, 42712372, -47569467,
+    48673058, -43968776, 30740183, -4871634, -41434214, 128095933, -333883582, 1678503535,
+    965091445, -402536429, 243633397, -158958775, 102671245, -61935357, 31886033, -10175101,
+    -4685341, 13905968, -18618744, 19917306, -18831629, 16282011, -13036486, 9684101,
+    -6628626, 4101784, -2191476, 878682, -76456, -334547, 477850, -462052,
+    370774, -260209, 162020, -89166, 42532, -16846, 5040, -868,
+    1750, -2969, 326, 13737, -51766, 131185, -272161, 492674,
+    -800430, 1181973, -1590280, 1933198, -2065885, 1790924, -869487, -954069,
+    3913665, -8170905, 13756864, -20512815, 28037445, -35647188, 42352723, -46847054,
+    47486189, -42214166, 28314464, -1666920, -45547466, 133307732, -340369470, 1665217667,
+    984400403, -405281453, 243487473, -157764883, 101068773, -60241077, 30281121, -8764132,
+    -5849440, 14807719, -19269640, 20346907, -19079753, 16392115, -13050468, 9638664,
+    -6553198, 4017828, -2112899, 812989, -26289, -369798, 500610, -475424,
+    377769, -263315, 163044, -89265, 42345, -16659, 4935, -834,
+    1661, -2699, -297, 14923, -53686, 133815, -275035, 494560,
+    -798966, 1173338, -1569033, 1892407, -1997707, 1687749, -725703, -1139728,
+    4135354, -8412770, 13990398, -20694915, 28109600, -35536122, 41972607, -46103111,
+    46279115, -40444269, 25883648, 1524686, -49615872, 138414764, -346605653, 1651689592,
+    1003666894, -407844815, 243215566, -156484127, 99407722, -58509486, 28654977, -7343829,
+    -7014475, 15704924, -19912876, 20767563, -19318964, 16494194, -13057778, 9588066,
+    -6474058, 3931410, -2032848, 746537, 24164, -405061, 523249, -488636,
+    384616, -266307, 163990, -89316, 42133, -16459, 4824, -798,
+    1573, -2431, -913, 16089, -55560, 136352, -277743, 496175,
+    -797095, 1164146, -1547094, 1850855, -1928840, 1584192, -582190, -1324010,
+    4354019, -8649379, 14215885, -20865751, 28167102, -35407238, 41572288, -45338089,
+    45052521, -38660041, 23448992, 4701628, -53637627, 143415266, -352592303, 1637923399,
+    1022885470, -410223530, 242817008, -155116724, 97688692, -56741326, 27008359, -5914887,
+    -8179850, 16597107, -20548094, 21179025, -19549106, 16588166, -13058388, 9532312,
+    -6391230, 3842563, -1951357, 679358, 74879, -440317, 545755, -501679,
+    391310, -269181, 164857, -89320, 41894, -16248, 4709, -761,
+    1486, -2165, -1520, 17234, -57387, 138796, -280284, 497520,
+    -794821, 1154406, -1524478, 1808567, -1859322, 1480308, -439020, -1506827,
+    4569560, -8880629, 14433240, -21025276, 28209970, -35260660, 41152039, -44552452,
+    43807102, -36862444, 21011747, 7862360, -57610959, 148307538, -358329677, 1623923246,
+    1042050680, -412414660, 242291186, -153662939, 95912314, -54937363, 25342037, -4478010,
+    -9344969, 17483793, -21174942, 21581050, -19770028, 16673951, -13052269, 9471410,
+    -6304742, 3751324, -1868461, 611483, 125831, -475549, 568117, -514548,
+    397847, -271935, 165643, -89276, 41630, -16024, 4589, -722,
+    1400, -1903, -2119, 18357, -59165, 141146, -282659, 498594,
+    -792148, 1144125, -1501200, 1765569, -1789193, 1376154, -296267, -1688090,
+    4781879, -9106423, 14642381, -21173449, 28238235, -35096525, 40712142, -43746671,
+    42543558, -35052441, 18573163, 11005356, -61534130, 153089942, -363818124, 1609693356,
+    1061157074, -414415324, 241637548, -152123077, 94079253, -53098383, 23656795, -3033907,
+    -10509233, 18364508, -21793066, 21973396, -19981581, 16751474, -13039399, 9405371,
+    -6214623, 3657728, -1784198, 542943, 176995, -510737, 590320, -527232,
+    404221, -274567, 166348, -89183, 41341, -15789, 4465, -682,
+    1315, -1643, -2710, 19458, -60896, 143401, -284867, 499401,
+    -789080, 1133313, -1477277, 1721888, -1718492, 1271783, -154001, -1867713,
+    4990880, -9326666, 14843231, -21310234, 28251933, -34914978, 40252889, -42921225,
+    41262598, -33231001, 16134485, 14129100, -65405434, 157760901, -369058075, 1595238017,
+    1080199208, -416222689, 240855596, -150497491, 92190202, -51225191, 21953427, -1583295,
+    -11672041, 19238778, -22402120, 22355827, -20183623, 16820664, -13019758, 9334207,
+    -6120904, 3561813, -1698605, 473771, 228345, -545863, 612352, -539724,
+    410428, -277074, 166970, -89041, 41025, -15541, 4335, -640,
+    1231, -1387, -3291, 20537, -62578, 145561, -286908, 499940,
+    -785621, 1121978, -1452725, 1677549, -1647259, 1167251, -12294, -2045611,
+    5196467, -9541266, 15035719, -21435602, 28251108, -34716169, 39774580, -42076605,
+    39964935, -31399092, 13696953, 17232095, -69223201, 162318904, -374050051, 1580561580,
+    1099171639, -417833982, 239944894, -148786577, 90245887, -49318617, 20232742, -126893,
+    -12832791, 20106132, -23001759, 22728112, -20376014, 16881453, -12993329, 9257933,
+    -6023617, 3463618, -1611719, 404000, 279855, -580908, 634201, -552017,
+    416464, -279453, 167508, -88849, 40683, -15282, 4201, -596,
+    1148, -1134, -3863, 21594, -64210, 147626, -288783, 500215,
+    -781775, 1110129, -1427559, 1632579, -1575533, 1062613, 128784, -2221697,
+    5398549, -9750134, 15219775, -21549530, 28235810, -34500261, 39277524, -41213305,
+    38651289, -29557686, 11261802, 20312862, -72985794, 166762499, -378794658, 1565668459,
+    1118068936, -419246482, 238905061, -146990774, 88247065, -47379506, 18495558, 1334570,
+    -13990881, 20966102, -23591641, 23090023, -20558622, 16933779, -12960099, 9176569,
+    -5922798, 3363184, -1523580, 333663, 331499, -615853, 655854, -564102,
+    422323, -281704, 167961, -88607, 40315, -15010, 4062, -551,
+    1066, -884, -4426, 22627, -65793, 149596, -290492, 500226,
+    -777548, 1097776, -1401797, 1587005, -1503354, 957924, 269161, -2395891,
+    5597037, -9953186, 15395337, -21652000, 28206099, -34267422, 38762040, -40331832,
+    37322386, -27707756, 8830260, 23369938, -76691613, 171090299, -383292585, 1550563125,
+    1136885673, -420457527, 237735779, -145110568, 86194523, -45408726, 16742707, 2800362,
+    -15145706, 21818219, -24171430, 23441337, -20731315, 16977582, -12920059, 9090136,
+    -5818484, 3260553, -1434227, 262794, 383251, -650679, 677299, -575972,
+    428003, -283823, 168328, -88315, 39921, -14726, 3918, -504,
+    985, -637, -4980, 23637, -67326, 151470, -292035, 499976,
+    -772943, 1084928, -1375456, 1540853, -1430761, 853237, 408770, -2568109,
+    5791842, -10150338, 15562347, -21743002, 28162039, -34017830, 38228453, -39432696,
+    35978958, -25850275, 6403550, 26401876, -80339092, 175300982, -387544609, 1535250111,
+    1155616437, -421464514, 236436788, -143146487, 84089079, -43407163, 14975030, 4269748,
+    -16296663, 22662020, -24740793, 23781837, -20893970, 17012809, -12873202, 8998657,
+    -5710713, 3155768, -1343701, 191427, 435084, -685368, 698522, -587619,
+    433498, -285808, 168609, -87973, 39500, -14430, 3769, -456,
+    905, -394, -5524, 24623, -68808, 153248, -293412, 499466,
+    -767966, 1071594, -1348552, 1494152, -1357795, 748607, 547541, -2738271,
+    5982879, -10341514, 15720750, -21822529, 28103704, -33751670, 37677098, -38516419,
+    34621741, -23986218, 3982888, 29407252, -83926703, 179393286, -391551588, 1519734004,
+    1174255828, -422264900, 235007890, -141099104, 81931580, -41375722, 13193378, 5741986,
+    -17443148, 23497043, -25299401, 24111307, -21046465, 17039408, -12819527, 8902159,
+    -5599527, 3048874, -1252043, 119597, 486972, -719900, 719512, -599035,
+    438805, -287657, 168802, -87580, 39053, -14123, 3616, -406,
+    826, -154, -6058, 25586, -70240, 154930, -294625, 498698,
+    -762621, 1057786, -1321102, 1446927, -1284495, 644088, 685406, -2906299,
+    6170066, -10526637, 15870497, -21890582, 28031173, -33469134, 37108317, -37583526,
+    33251474, -22116558, 1569481, 32384659, -87452957, 183366017, -395314464, 1504019445,
+    1192798460, -422856201, 233448945, -138969037, 79722904, -39315328, 11398615, 7216331,
+    -18584557, 24322829, -25846930, 24429541, -21188685, 17057333, -12759033, 8800671,
+    -5484968, 2939917, -1159296, 47339, 538889, -754257, 740256, -610213,
+    443918, -289368, 168906, -87135, 38580, -13803, 3458, -354,
+    749, 82, -6581, 26524, -71621, 156515, -295674, 497675,
+    -756914, 1043512, -1293124, 1399206, -1210900, 539733, 822298, -3072115,
+    6353320, -10705636, 16011543, -21947168, 27944533, -33170424, 36522460, -36634550,
+    31868904, -20242269, -835472, 35332709, -90916399, 187218042, -398834263, 1488111132,
+    1211238965, -423235998, 231759878, -136756947, 77463958, -37226923, 9591613, 8692034,
+    -19720287, 25138921, -26383059, 24736334, -21320519, 17066542, -12691726, 8694226,
+    -5367082, 2828943, -1065503, -25312, 590806, -788419, 760741, -621146,
+    448834, -290940, 168921, -86639, 38080, -13471, 3295, -301,
+    673, 314, -7095, 27438, -72950, 158004, -296559, 496399,
+    -750850, 1028784, -1264636, 1351017, -1137051, 435596, 958151, -3235642,
+    6532565, -10878442, 16143849, -21992298, 27843878, -32855748, 35919885, -35670032,
+    30474779, -18364323, -3230780, 38250037, -94315615, 190948294, -402112090, 1472013813,
+    1229571992, -423401936, 229940673, -134463539, 75155678, -35111466, 7773252, 10168344,
+    -20849737, 25944869, -26907474, 25031488, -21441862, 17066998, -12617614, 8582857,
+    -5245914, 2716001, -970707, -98320, 642697, -822367, 780955, -631825,
+    453549, -292369, 168846, -86092, 37553, -13127, 3127, -247,
+    598, 542, -7598, 28327, -74228, 159397, -297282, 494873,
+    -744435, 1013610, -1235654, 1302388, -1062986, 331729, 1092900, -3396806,
+    6707723, -11044991, 16267379, -22025991, 27729309, -32525321, 35300956, -34690517,
+    29069850, -16483690, -5615262, 41135298, -97649229, 194555769, -405149135, 1455732283,
+    1247792212, -423351723, 227991377, -132089563, 72799029, -32969934, 5944423, 11644505,
+    -21972304, 26740222, -27419865, 25314811, -21552613, 17058667, -12536707, 8466603,
+    -5121514, 2601142, -874953, -171649, 694535, -856083, 800886, -642244,
+    458060, -293655, 168680, -85493, 37001, -12771, 2955, -191,
+    525, 766, -8090, 29191, -75454, 160694, -297842, 493098,
+    -737674, 998004, -1206198, 1253345, -988746, 228185, 1226479, -3555535,
+    6878721, -11205222, 16382102, -22048270, 27600932, -32179368, 34666047, -33696556,
+    27654872, -14601340, -7987747, 43987169, -100915904, 198039527, -407946664, 1439271389,
+    1265894319, -423083135, 225912099, -129635811, 70395004, -30803323, 4106024, 13119760,
+    -23087389, 27524537, -27919927, 25586114, -21652677, 17041521, -12449022, 8345504,
+    -4993932, 2484415, -778286, -245261, 746292, -889547, 820521, -652395,
+    462361, -294795, 168423, -84841, 36421, -12403, 2778, -133,
+    452, 987, -8572, 30030, -76628, 161895, -298242, 491079,
+    -730573, 981974, -1176286, 1203916, -914370, 125016, 1358825, -3711756,
+    7045489, -11359076, 16487992, -22059166, 27458863, -31818118, 34015535, -32688707,
+    26230602, -12718237, -10347075, 46804348, -104114343, 201398695, -410506025, 1422636023,
+    1283873028, -422594013, 223703011, -127103121, 67944625, -28612643, 2258963, 14593351,
+    -24194396, 28297374, -28407360, 25845216, -21741963, 17015535, -12354576, 8219601,
+    -4863221, 2365873, -680752, -319121, 797940, -922741, 839849, -662272,
+    466450, -295788, 168073, -84138, 35816, -12023, 2597, -74,
+    382, 1203, -9043, 30844, -77750, 163000, -298482, 488816,
+    -723139, 965532, -1145934, 1154130, -839896, 22274, 1489875, -3865399,
+    7207957, -11506499, 16585028, -22058714, 27303222, -31441809, 33349807, -31667533,
+    24797800, -10835346, -12692095, 49585560, -107243289, 204632461, -412828644, 1405831122,
+    1301723084, -421882269, 221364348, -124492371, 65448941, -26398920, 404155, 16064515,
+    -25292727, 29058295, -28881870, 26091940, -21820386, 16980690, -12253393, 8088942,
+    -4729434, 2245569, -582397, -393191, 849454, -955645, 858857, -671867,
+    470322, -296632, 167631, -83383, 35184, -11632, 2411, -13,
+    312, 1415, -9503, 31632, -78819, 164009, -298563, 486315,
+    -715376, 948689, -1115162, 1104013, -765364, -79991, 1619567, -4016397,
+    7366059, -11647441, 16673193, -22046954, 27134136, -31050686, 32669255, -30633601,
+    23357227, -8953625, -15021670, 52329547, -110301525, 207740080, -414916024, 1388861664,
+    1319439258, -420945883, 218896410, -121804484, 62909029, -24163196, -1457481, 17532490,
+    -26381790, 29806870, -29343168, 26326117, -21887867, 16936970, -12145498, 7953573,
+    -4592628, 2123558, -483269, -467433, 900803, -988240, 877534, -681173,
+    473974, -297325, 167095, -82575, 34525, -11229, 2220, 49,
+    244, 1623, -9951, 32394, -79837, 164923, -298487, 483576,
+    -707292, 931456, -1083988, 1053595, -690813, -181728, 1747841, -4164683,
+    7519731, -11781853, 16752475, -22023935, 26951739, -30644999, 31974278, -29587482,
+    21909646, -7074029, -17334674, 55035082, -113287876, 210720870, -416769744, 1371732671,
+    1337016353, -419782906, 216299556, -119040427, 60325990, -21906531, -3325014, 18996514,
+    -27460994, 30542673, -29790973, 26547580, -21944330, 16884364, -12030920, 7813545,
+    -4452861, 1999895, -383416, -541809, 951962, -1020509, 895867, -690184,
+    477403, -297867, 166465, -81714, 33841, -10815, 2026, 112,
+    178, 1826, -10389, 33130, -80802, 165741, -298254, 480605,
+    -698892, 913845, -1052431, 1002901, -616282, -282886, 1874637, -4310192,
+    7668913, -11909693, 16822867, -21989707, 26756172, -30225007, 31265281, -28529753,
+    20455820, -5197510, -19629995, 57700956, -116201207, 213574213, -418391462, 1354449201,
+    1354449201, -418391462, 213574213, -116201207, 57700956, -19629995, -5197510, 20455820,
+    -28529753, 31265281, -30225007, 26756172, -21989707, 16822867, -11909693, 7668913,
+    -4310192, 1874637, -282886, -616282, 1002901, -1052431, 913845, -698892,
+    480605, -298254, 165741, -80802, 33130, -10389, 1826, 178,
+    112, 2026, -10815, 33841, -81714, 166465, -297867, 477403,
+    -690184, 895867, -1020509, 951962, -541809, -383416, 1999895, -4452861,
+    7813545, -12030920, 16884364, -21944330, 26547580, -29790973, 30542673, -27460994,
+    18996514, -3325014, -21906531, 60325990, -119040427, 216299556, -419782906, 1337016353,
+    1371732671, -416769744, 210720870, -113287876, 55035082, -17334674, -7074029, 21909646,
+    -29587482, 31974278, -30644999, 26951739, -22023935, 16752475, -11781853, 7519731,
+    -4164683, 1747841, -181728, -690813, 1053595, -1083988, 931456, -707292,
+    483576, -298487, 164923, -79837, 32394, -9951, 1623, 244,
+    49, 2220, -11229, 34525, -82575, 167095, -297325, 473974,
+    -681173, 877534, -988240, 900803, -467433, -483269, 2123558, -4592628,
+    7953573, -12145498, 16936970, -21887867, 26326117, -29343168, 29806870, -26381790,
+    17532490, -1457481, -24163196, 62909029, -121804484, 218896410, -420945883, 1319439258,
+    1388861664, -414916024, 207740080, -110301525, 52329547, -15021670, -8953625, 23357227,
+    -30633601, 32669255, -31050686, 27134136, -22046954, 16673193, -11647441, 7366059,
+    -4016397, 1619567, -79991, -765364, 1104013, -1115162, 948689, -715376,
+    486315, -298563, 164009, -78819, 31632, -9503, 1415, 312,
+    -13, 2411, -11632, 35184, -83383, 167631, -296632, 470322,
+    -671867, 858857, -955645, 849454, -393191, -582397, 2245569, -4729434,
+    8088942, -12253393, 16980690, -21820386, 26091940, -28881870, 29058295, -25292727,
+    16064515, 404155, -26398920, 65448941, -124492371, 221364348, -421882269, 1301723084,
+    1405831122, -412828644, 204632461, -107243289, 49585560, -12692095, -10835346, 24797800,
+    -31667533, 33349807, -31441809, 27303222, -22058714, 16585028, -11506499, 7207957,
+    -3865399, 1489875, 22274, -839896, 1154130, -1145934, 965532, -723139,
+    488816, -298482, 163000, -77750, 30844, -9043, 1203, 382,
+    -74, 2597, -12023, 35816, -84138, 168073, -295788, 466450,
+    -662272, 839849, -922741, 797940, -319121, -680752, 2365873, -4863221,
+    8219601, -12354576, 17015535, -21741963, 25845216, -28407360, 28297374, -24194396,
+    14593351, 2258963, -28612643, 67944625, -127103121, 223703011, -422594013, 1283873028,
+    1422636023, -410506025, 201398695, -104114343, 46804348, -10347075, -12718237, 26230602,
+    -32688707, 34015535, -31818118, 27458863, -22059166, 16487992, -11359076, 7045489,
+    -3711756, 1358825, 125016, -914370, 1203916, -1176286, 981974, -730573,
+    491079, -298242, 161895, -76628, 30030, -8572, 987, 452,
+    -133, 2778, -12403, 36421, -84841, 168423, -294795, 462361,
+    -652395, 820521, -889547, 746292, -245261, -778286, 2484415, -4993932,
+    8345504, -12449022, 17041521, -21652677, 25586114, -27919927, 27524537, -23087389,
+    13119760, 4106024, -30803323, 70395004, -129635811, 225912099, -423083135, 1265894319,
+    1439271389, -407946664, 198039527, -100915904, 43987169, -7987747, -14601340, 27654872,
+    -33696556, 34666047, -32179368, 27600932, -22048270, 16382102, -11205222, 6878721,
+    -3555535, 1226479, 228185, -988746, 1253345, -1206198, 998004, -737674,
+    493098, -297842, 160694, -75454, 29191, -8090, 766, 525,
+    -191, 2955, -12771, 37001, -85493, 168680, -293655, 458060,
+    -642244, 800886, -856083, 694535, -171649, -874953, 2601142, -5121514,
+    8466603, -12536707, 17058667, -21552613, 25314811, -27419865, 26740222, -21972304,
+    11644505, 5944423, -32969934, 72799029, -132089563, 227991377, -423351723, 1247792212,
+    1455732283, -405149135, 194555769, -97649229, 41135298, -5615262, -16483690, 29069850,
+    -34690517, 35300956, -32525321, 27729309, -22025991, 16267379, -11044991, 6707723,
+    -3396806, 1092900, 331729, -1062986, 1302388, -1235654, 1013610, -744435,
+    494873, -297282, 159397, -74228, 28327, -7598, 542, 598,
+    -247, 3127, -13127, 37553, -86092, 168846, -292369, 453549,
+    -631825, 780955, -822367, 642697, -98320, -970707, 2716001, -5245914,
+    8582857, -12617614, 17066998, -21441862, 25031488, -26907474, 25944869, -20849737,
+    10168344, 7773252, -35111466, 75155678, -134463539, 229940673, -423401936, 1229571992,
+    1472013813, -402112090, 190948294, -94315615, 38250037, -3230780, -18364323, 30474779,
+    -35670032, 35919885, -32855748, 27843878, -21992298, 16143849, -10878442, 6532565,
+    -3235642, 958151, 435596, -1137051, 1351017, -1264636, 1028784, -750850,
+    496399, -296559, 158004, -72950, 27438, -7095, 314, 673,
+    -301, 3295, -13471, 38080, -86639, 168921, -290940, 448834,
+    -621146, 760741, -788419, 590806, -25312, -1065503, 2828943, -5367082,
+    8694226, -12691726, 17066542, -21320519, 24736334, -26383059, 25138921, -19720287,
+    8692034, 9591613, -37226923, 77463958, -136756947, 231759878, -423235998, 1211238965,
+    1488111132, -398834263, 187218042, -90916399, 35332709, -835472, -20242269, 31868904,
+    -36634550, 36522460, -33170424, 27944533, -21947168, 16011543, -10705636, 6353320,
+    -3072115, 822298, 539733, -1210900, 1399206, -1293124, 1043512, -756914,
+    497675, -295674, 156515, -71621, 26524, -6581, 82, 749,
+    -354, 3458, -13803, 38580, -87135, 168906, -289368, 443918,
+    -610213, 740256, -754257, 538889, 47339, -1159296, 2939917, -5484968,
+    8800671, -12759033, 17057333, -21188685, 24429541, -25846930, 24322829, -18584557,
+    7216331, 11398615, -39315328, 79722904, -138969037, 233448945, -422856201, 1192798460,
+    1504019445, -395314464, 183366017, -87452957, 32384659, 1569481, -22116558, 33251474,
+    -37583526, 37108317, -33469134, 28031173, -21890582, 15870497, -10526637, 6170066,
+    -2906299, 685406, 644088, -1284495, 1446927, -1321102, 1057786, -762621,
+    498698, -294625, 154930, -70240, 25586, -6058, -154, 826,
+    -406, 3616, -14123, 39053, -87580, 168802, -287657, 438805,
+    -599035, 719512, -719900, 486972, 119597, -1252043, 3048874, -5599527,
+    8902159, -12819527, 17039408, -21046465, 24111307, -25299401, 23497043, -17443148,
+    5741986, 13193378, -41375722, 81931580, -141099104, 235007890, -422264900, 1174255828,
+    1519734004, -391551588, 179393286, -83926703, 29407252, 3982888, -23986218, 34621741,
+    -38516419, 37677098, -33751670, 28103704, -21822529, 15720750, -10341514, 5982879,
+    -2738271, 547541, 748607, -1357795, 1494152, -1348552, 1071594, -767966,
+    499466, -293412, 153248, -68808, 24623, -5524, -394, 905,
+    -456, 3769, -14430, 39500, -87973, 168609, -285808, 433498,
+    -587619, 698522, -685368, 435084, 191427, -1343701, 3155768, -5710713,
+    8998657, -12873202, 17012809, -20893970, 23781837, -24740793, 22662020, -16296663,
+    4269748, 14975030, -43407163, 84089079, -143146487, 236436788, -421464514, 1155616437,
+    1535250111, -387544609, 175300982, -80339092, 26401876, 6403550, -25850275, 35978958,
+    -39432696, 38228453, -34017830, 28162039, -21743002, 15562347, -10150338, 5791842,
+    -2568109, 408770, 853237, -1430761, 1540853, -1375456, 1084928, -772943,
+    499976, -292035, 151470, -67326, 23637, -4980, -637, 985,
+    -504, 3918, -14726, 39921, -88315, 168328, -283823, 428003,
+    -575972, 677299, -650679, 383251, 262794, -1434227, 3260553, -5818484,
+    9090136, -12920059, 16977582, -20731315, 23441337, -24171430, 21818219, -15145706,
+    2800362, 16742707, -45408726, 86194523, -145110568, 237735779, -420457527, 1136885673,
+    1550563125, -383292585, 171090299, -76691613, 23369938, 8830260, -27707756, 37322386,
+    -40331832, 38762040, -34267422, 28206099, -21652000, 15395337, -9953186, 5597037,
+    -2395891, 269161, 957924, -1503354, 1587005, -1401797, 1097776, -777548,
+    500226, -290492, 149596, -65793, 22627, -4426, -884, 1066,
+    -551, 4062, -15010, 40315, -88607, 167961, -281704, 422323,
+    -564102, 655854, -615853, 331499, 333663, -1523580, 3363184, -5922798,
+    9176569, -12960099, 16933779, -20558622, 23090023, -23591641, 20966102, -13990881,
+    1334570, 18495558, -47379506, 88247065, -146990774, 238905061, -419246482, 1118068936,
+    1565668459, -378794658, 166762499, -72985794, 20312862, 11261802, -29557686, 38651289,
+    -41213305, 39277524, -34500261, 28235810, -21549530, 15219775, -9750134, 5398549,
+    -2221697, 128784, 1062613, -1575533, 1632579, -1427559, 1110129, -781775,
+    500215, -288783, 147626, -64210, 21594, -3863, -1134, 1148,
+    -596, 4201, -15282, 40683, -88849, 167508, -279453, 416464,
+    -552017, 634201, -580908, 279855, 404000, -1611719, 3463618, -6023617,
+    9257933, -12993329, 16881453, -20376014, 22728112, -23001759, 20106132, -12832791,
+    -126893, 20232742, -49318617, 90245887, -148786577, 239944894, -417833982, 1099171639,
+    1580561580, -374050051, 162318904, -69223201, 17232095, 13696953, -31399092, 39964935,
+    -42076605, 39774580, -34716169, 28251108, -21435602, 15035719, -9541266, 5196467,
+    -2045611, -12294, 1167251, -1647259, 1677549, -1452725, 1121978, -785621,
+    499940, -286908, 145561, -62578, 20537, -3291, -1387, 1231,
+    -640, 4335, -15541, 41025, -89041, 166970, -277074, 410428,
+    -539724, 612352, -545863, 228345, 473771, -1698605, 3561813, -6120904,
+    9334207, -13019758, 16820664, -20183623, 22355827, -22402120, 19238778, -11672041,
+    -1583295, 21953427, -51225191, 92190202, -150497491, 240855596, -416222689, 1080199208,
+    1595238017, -369058075, 157760901, -65405434, 14129100, 16134485, -33231001, 41262598,
+    -42921225, 40252889, -34914978, 28251933, -21310234, 14843231, -9326666, 4990880,
+    -1867713, -154001, 1271783, -1718492, 1721888, -1477277, 1133313, -789080,
+    499401, -284867, 143401, -60896, 19458, -2710, -1643, 1315,
+    -682, 4465, -15789, 41341, -89183, 166348, -274567, 404221,
+    -527232, 590320, -510737, 176995, 542943, -1784198, 3657728, -6214623,
+    9405371, -13039399, 16751474, -19981581, 21973396, -21793066, 18364508, -10509233,
+    -3033907, 23656795, -53098383, 94079253, -152123077, 241637548, -414415324, 1061157074,
+    1609693356, -363818124, 153089942, -61534130, 11005356, 18573163, -35052441, 42543558,
+    -43746671, 40712142, -35096525, 28238235, -21173449, 14642381, -9106423, 4781879,
+    -1688090, -296267, 1376154, -1789193, 1765569, -1501200, 1144125, -792148,
+    498594, -282659, 141146, -59165, 18357, -2119, -1903, 1400,
+    -722, 4589, -16024, 41630, -89276, 165643, -271935, 397847,
+    -514548, 568117, -475549, 125831, 611483, -1868461, 3751324, -6304742,
+    9471410, -13052269, 16673951, -19770028, 21581050, -21174942, 17483793, -9344969,
+    -4478010, 25342037, -54937363, 95912314, -153662939, 242291186, -412414660, 1042050680,
+    1623923246, -358329677, 148307538, -57610959, 7862360, 21011747, -36862444, 43807102,
+    -44552452, 41152039, -35260660, 28209970, -21025276, 14433240, -8880629, 4569560,
+    -1506827, -439020, 1480308, -1859322, 1808567, -1524478, 1154406, -794821,
+    497520, -280284, 138796, -57387, 17234, -1520, -2165, 1486,
+    -761, 4709, -16248, 41894, -89320, 164857, -269181, 391310,
+    -501679, 545755, -440317, 74879, 679358, -1951357, 3842563, -6391230,
+    9532312, -13058388, 16588166, -19549106, 21179025, -20548094, 16597107, -8179850,
+    -5914887, 27008359, -56741326, 97688692, -155116724, 242817008, -410223530, 1022885470,
+    1637923399, -352592303, 143415266, -53637627, 4701628, 23448992, -38660041, 45052521,
+    -45338089, 41572288, -35407238, 28167102, -20865751, 14215885, -8649379, 4354019,
+    -1324010, -582190, 1584192, -1928840, 1850855, -1547094, 1164146, -797095,
+    496175, -277743, 136352, -55560, 16089, -913, -2431, 1573,
+    -798, 4824, -16459, 42133, -89316, 163990, -266307, 384616,
+    -488636, 523249, -405061, 24164, 746537, -2032848, 3931410, -6474058,
+    9588066, -13057778, 16494194, -19318964, 20767563, -19912876, 15704924, -7014475,
+    -7343829, 28654977, -58509486, 99407722, -156484127, 243215566, -407844815, 1003666894,
+    1651689592, -346605653, 138414764, -49615872, 1524686, 25883648, -40444269, 46279115,
+    -46103111, 41972607, -35536122, 28109600, -20694915, 13990398, -8412770, 4135354,
+    -1139728, -725703, 1687749, -1997707, 1892407, -1569033, 1173338, -798966,
+    494560, -275035, 133815, -53686, 14923, -297, -2699, 1661,
+    -834, 4935, -16659, 42345, -89265, 163044, -263315, 377769,
+    -475424, 500610, -369798, -26289, 812989, -2112899, 4017828, -6553198,
+    9638664, -13050468, 16392115, -19079753, 20346907, -19269640, 14807719, -5849440,
+    -8764132, 30281121, -60241077, 101068773, -157764883, 243487473, -405281453, 984400403,
+    1665217667, -340369470, 133307732, -45547466, -1666920, 28314464, -42214166, 47486189,
+    -46847054, 42352723, -35647188, 28037445, -20512815, 13756864, -8170905, 3913665,
+    -954069, -869487, 1790924, -2065885, 1933198, -1590280, 1181973, -800430,
+    492674, -272161, 131185, -51766, 13737, 326, -2969, 1750,
+    -868, 5040, -16846, 42532, -89166, 162020, -260209, 370774,
+    -462052, 477850, -334547, -76456, 878682, -2191476, 4101784, -6628626,
+    9684101, -13036486, 16282011, -18831629, 19917306, -18618744, 13905968, -4685341,
+    -10175101, 31886033, -61935357, 102671245, -158958775, 243633397, -402536429, 965091445,
+    1678503535, -333883582, 128095933, -41434214, -4871634, 30740183, -43968776, 48673058,
+    -47569467, 42712372, -35740315, 27950621, -20319505, 13515374, -7923888, 3689055,
+    -767125, -1013467, 1893661, -2133334, 1973202, -1610820, 1190043, -801485,
+    490514, -269120, 128463, -49799, 12530, 957, -3243, 1840,
+    -901, 5141, -17021, 42694, -89020, 160918, -256989, 363635,
+    -448528, 454984, -299327, -126311, 943587, -2268546, 4183246, -6700319,
+    9724376, -13015867, 16163969, -18574752, 19479011, -17960549, 13000150, -3522771,
+    -11576046, 33468970, -63591602, 104214570, -160065626, 243654062, -399612778, 945745470,
+    1691543175, -327147906, 122781188, -37277950, -8087885, 33159549, -45707145, 49839045,
+    -48269904, 43051299, -35815396, 27849122, -20115044, 13266023, -7671826, 3461628,
+    -578986, -1157571, 1995906, -2200016, 2012394, -1630637, 1197540, -802127,
+    488082, -265914, 125649, -47787, 11304, 1596, -3518, 1930,
+    -932, 5237, -17185, 42831, -88828, 159741, -253660, 356357,
+    -434861, 432022, -264155, -175830, 1007674, -2344076, 4262183, -6768257,
+    9759488, -12988646, 16038080, -18309284, 19032278, -17295417, 12090742, -2362318,
+    -12966286, 35029202, -65209114, 105698212, -161085307, 243550248, -396513584, 926367921,
+    1704332638, -320162447, 117365382, -33080540, -11314089, 35571302, -47428326, 50983478,
+    -48947932, 43369262, -35872329, 27732949, -19899496, 13008911, -7414831, 3231490,
+    -389745, -1301725, 2097603, -2265892, 2050750, -1649718, 1204458, -802352,
+    485375, -262542, 122744, -45731, 10058, 2242, -3796, 2021,
+    -961, 5328, -17337, 42943, -88590, 158489, -250224, 348945,
+    -421059, 408979, -229050, -224990, 1070913, -2418033, 4338567, -6832419,
+    9789442, -12954864, 15904438, -18035395, 18577366, -16623713, 11178222, -1204570,
+    -14345146, 36566014, -66787214, 107121668, -162017730, 243322788, -393241976, 906964233,
+    1716868047, -312927300, 111850458, -28843882, -14548650, 37974182, -49131377, 52105697,
+    -49603128, 43666025, -35911023, 27602110, -19672934, 12744140, -7153014, 2998750,
+    -199495, -1445852, 2198696, -2330924, 2088245, -1668048, 1210789, -802158,
+    482393, -259005, 119749, -43630, 8793, 2894, -4075, 2113,
+    -990, 5414, -17477, 43031, -88307, 157165, -246683, 341404,
+    -407129, 385865, -194029, -273767, 1133277, -2490388, 4412368, -6892790,
+    9814241, -12914565, 15763141, -17753254, 18114538, -15945803, 10263067, -50110,
+    -15711961, 38078702, -68325248, 108484465, -162862851, 242972571, -389801129, 887539838,
+    1729145596, -305442649, 106238421, -24569899, -17789962, 40366929, -50815359, 53205051,
+    -50235077, 43941364, -35931396, 27456622, -19435434, 12471819, -6886494, 2763516,
+    -8331, -1589880, 2299130, -2395073, 2124855, -1685614, 1216526, -801543,
+    479137, -255304, 116666, -41487, 7510, 3553, -4357, 2205,
+    -1016, 5496, -17605, 43094, -87979, 155768, -243041, 333739,
+    -393079, 362695, -159110, -322137, 1194738, -2561110, 4483561, -6949355,
+    9833896, -12867793, 15614291, -17463038, 17644058, -15262057, 9345756, 1100482,
+    -17066074, 39566582, -69822582, 109786166, -163620671, 242500539, -386194259, 868100152,
+    1741161558, -297708767, 100531334, -20260546, -21036409, 42748281, -52479345, 54280896,
+    -50843376, 44195066, -35933375, 27296508, -19187079, 12192061, -6615390, 2525901,
+    183653, -1733732, 2398849, -2458303, 2160555, -1702402, 1221663, -800503,
+    475605, -251440, 113494, -39300, 6209, 4219, -4641, 2298,
+    -1041, 5573, -17722, 43132, -87608, 154301, -239299, 325954,
+    -378919, 339480, -124312, -370079, 1255267, -2630171, 4552120, -7002100,
+    9848417, -12814600, 15457992, -17164924, 17166195, -14572845, 8426766, 2246631,
+    -18406835, 41028980, -71278608, 111026363, -164291233, 241907685, -382424627, 848650585,
+    1752912280, -289726018, 94731317, -15917804, -24286362, 45116980, -54122409, 55332601,
+    -51427634, 44426926, -35916895, 27121800, -18927958, 11904981, -6339823, 2286018,
+    376361, -1877333, 2497799, -2520574, 2195324, -1718398, 1226193, -799038,
+    471799, -247413, 110235, -37072, 4891, 4890, -4926, 2391,
+    -1065, 5646, -17828, 43147, -87193, 152765, -235461, 318056,
+    -364656, 316232, -89650, -417568, 1314839, -2697543, 4618023, -7051016,
+    9857818, -12755037, 15294354, -16859095, 16681220, -13878540, 7506573, 3387765,
+    -19733605, 42465242, -72692738, 112204682, -164874622, 241195057, -378495532, 829196528,
+    1764394186, -281494855, 88840552, -11543681, -27538188, 47471767, -55743635, 56359542,
+    -51987468, 44636752, -35881903, 26932535, -18658167, 11610701, -6059919, 2043982,
+    569695, -2020608, 2595925, -2581851, 2229136, -1733590, 1230110, -797144,
+    467717, -243224, 106889, -34803, 3556, 5567, -5212, 2485,
+    -1087, 5713, -17921, 43138, -86735, 151161, -231529, 310048,
+    -350298, 292965, -55143, -464583, 1373428, -2763199, 4681248, -7096093,
+    9862115, -12689160, 15123487, -16545735, 16189408, -13179515, 6585652, 4523318,
+    -21045754, 43874726, -74064411, 113320783, -165370969, 240363750, -374410314, 809743359,
+    1775603781, -273015821, 82861276, -7140212, -30790243, 49811387, -57342117, 57361108,
+    -52522509, 44824362, -35828352, 26728762, -18377804, 11309345, -5775805, 1799908,
+    763559, -2163480, 2693170, -2642095, 2261971, -1747965, 1233408, -794820,
+    463360, -238874, 103458, -32495, 2206, 6249, -5500, 2578,
+    -1108, 5777, -18004, 43106, -86236, 149491, -227506, 301936,
+    -335853, 269690, -20808, -511102, 1431008, -2827114, 4741773, -7137326,
+    9861326, -12617029, 14945507, -16225033, 15691034, -12476144, 5664478, 5652726,
+    -22342661, 45256808, -75393086, 114374356, -165780445, 239414913, -370172348, 790296439,
+    1786537649, -264289552, 76795782, -2709456, -34040875, 52134588, -58916953, 58336698,
+    -53032399, 44989583, -35756207, 26510534, -18086978, 11001044, -5487612, 1553916,
+    957854, -2305875, 2789482, -2701272, 2293805, -1761512, 1236082, -792065,
+    458729, -234364, 99944, -30147, 839, 6936, -5789, 2673,
+    -1127, 5835, -18075, 43050, -85695, 147757, -223396, 293724,
+    -321331, 246420, 13338, -557103, 1487554, -2889262, 4799580, -7174708,
+    9855474, -12538704, 14760533, -15897180, 15186378, -11768804, 4743524, 6775433,
+    -23623716, 46610878, -76678249, 115365127, -166103262, 238349742, -365785047, 770861109,
+    1797192455, -255316772, 70646421, 1746504, -37288427, 54440119, -60467252, 59285722,
+    -53516789, 45132256, -35665442, 26277913, -17785801, 10685929, -5195474, 1306125,
+    1152481, -2447715, 2884805, -2759343, 2324616, -1774218, 1238127, -788876,
+    453824, -229696, 96347, -27761, -542, 7627, -6080, 2767,
+    -1145, 5889, -18136, 42972, -85113, 145959, -219200, 285419,
+    -306738, 223167, 47279, -602566, 1543042, -2949621, 4854652, -7208238,
+    9844582, -12454251, 14568686, -15562371, 14675721, -11057870, 3823260, 7890887,
+    -24888316, 47936344, -77919407, 116292851, -166339678, 237169482, -361251858, 751442688,
+    1807564947, -246098296, 64415599, 6225561, -40531238, 56726735, -61992133, 60207602,
+    -53975345, 45252230, -35556039, 26030969, -17474389, 10364139, -4899524, 1056654,
+    1347342, -2588925, 2979085, -2816275, 2354384, -1786072, 1239538, -785254,
+    448646, -224871, 92668, -25337, -1938, 8324, -6371, 2862,
+    -1161, 5939, -18185, 42871, -84492, 144100, -214923, 277024,
+    -292082, 199942, 80999, -647470, 1597450, -3008167, 4906972, -7237916,
+    9828676, -12363737, 14370091, -15220803, 14159345, -10343720, 2904156, 8998541,
+    -26135873, 49232632, -79116094, 117157318, -166489990, 235875427, -356576260, 732046472,
+    1817651959, -236635031, 58105778, 10725585, -43767638, 58993196, -63490724, 61101771,
+    -54407745, 45349368, -35427990, 25769778, -17152868, 10035814, -4599903, 805628,
+    1542336, -2729428, 3072268, -2872031, 2383086, -1797063, 1240310, -781197,
+    443195, -219890, 88908, -22877, -3348, 9023, -6662, 2957,
+    -1176, 5984, -18223, 42748, -83831, 142180, -210566, 268545,
+    -277373, 176759, 114480, -691794, 1650754, -3064880, 4956526, -7263741,
+    9807786, -12267232, 14164874, -14872677, 13637538, -9626731, 1986679, 10097855,
+    -27365807, 50499181, -80267865, 117958351, -166554535, 234468917, -351761763, 712677734,
+    1827450407, -226927972, 51719471, 15244425, -46995955, 61238267, -64962163, 61967675,
+    -54813677, 45423541, -35281299, 25494426, -16821366, 9701099, -4296750, 553168,
+    1737362, -2869150, 3164301, -2926577, 2410703, -1807181, 1240440, -776704,
+    437473, -214755, 85070, -20382, -4770, 9727, -6955, 3052,
+    -1190, 6025, -18251, 42603, -83132, 140202, -206133, 259988,
+    -262618, 153628, 147707, -735518, 1702932, -3119738, 5003301, -7285719,
+    9781942, -12164811, 13953168, -14518194, 13110584, -8907279, 1071292, 11188294,
+    -28577548, 51735450, -81374303, 118695804, -166533694, 232951337, -346811909, 693341719,
+    1836957295, -216978209, 45259247, 19779910, -50214515, 63460719, -66405599, 62804773,
+    -55192844, 45474636, -35115976, 25205005, -16480019, 9360144, -3990207, 299400,
+    1932320, -3008013, 3255130, -2979878, 2437213, -1816415, 1239922, -771774,
+    431480, -209466, 81155, -17853, -6205, 10434, -7247, 3147,
+    -1202, 6061, -18268, 42436, -82395, 138167, -201627, 251356,
+    -247826, 130561, 180665, -778624, 1753963, -3172722, 5047286, -7303854,
+    9751179, -12056548, 13735105, -14157561, 12578773, -8185743, 158459, 12269331,
+    -29770540, 52940915, -82435013, 119369565, -166427887, 231324119, -341730266, 674043643,
+    1846169713, -206786918, 38727727, 24329848, -53421640, 65659329, -67820191, 63612536,
+    -55544960, 45502546, -34932044, 24901614, -16128966, 9013100, -3680421, 44450,
+    2127109, -3145942, 3344703, -3031899, 2462599, -1824755, 1238754, -766409,
+    425219, -204027, 77163, -15291, -7652, 11144, -7540, 3241,
+    -1214, 6094, -18274, 42248, -81621, 136077, -197050, 242656,
+    -233003, 107570, 213336, -821091, 1803827, -3223813, 5088470, -7318153,
+    9715533, -11942523, 13510821, -13790984, 12042395, -7462500, -751362, 13340443,
+    -30944238, 54115069, -83449625, 119979554, -166237575, 229588738, -336520429, 654788693,
+    1855084842, -196355368, 32127582, 28892030, -56615651, 67832881, -69205113, 64390448,
+    -55869752, 45507180, -34729532, 24584361, -15768355, 8660125, -3367539, -211555,
+    2321627, -3282861, 3432967, -3082609, 2486839, -1832193, 1236932, -760607,
+    418690, -198439, 73097, -12697, -9110, 11856, -7833, 3336,
+    -1223, 6122, -18270, 42040, -80811, 133932, -192406, 233892,
+    -218159, 84668, 245707, -862902, 1852503, -3272995, 5126846, -7328626,
+    9675042, -11822818, 13280455, -13418674, 11501742, -6737927, -1657716, 14401116,
+    -32098105, 55257422, -84417795, 120525722, -165963256, 227746713, -331186018, 635582023,
+    1863699949, -185684920, 25461537, 33464227, -59794866, 69980170, -70559548, 65138007,
+    -56166962, 45488455, -34508483, 24253361, -15398336, 8301379, -3051710, -468487,
+    2515773, -3418695, 3519870, -3131973, 2509916, -1838718, 1234453, -754370,
+    411895, -192702, 68958, -10071, -10578, 12570, -8126, 3430,
+    -1232, 6145, -18256, 41810, -79966, 131736, -187698, 225070,
+    -203301, 61864, 277761, -904038, 1899973, -3320251, 5162405, -7335284,
+    9629747, -11697516, 13044150, -13040844, 10957105, -6012399, -2560149, 15450843,
+    -33231621, 56367504, -85339202, 121008056, -165605472, 225799605, -325730679, 616428755,
+    1872012394, -174777021, 18732363, 38044194, -62957607, 72099996, -71882692, 65854725,
+    -56436344, 45446304, -34268945, 23908737, -15019067, 7937024, -2733086, -726217,
+    2709443, -3553369, 3605361, -3179960, 2531812, -1844323, 1231315, -747697,
+    404836, -186821, 64747, -7416, -12056, 13286, -8418, 3524,
+    -1239, 6165, -18232, 41560, -79086, 129488, -182928, 216194,
+    -188436, 39171, 309485, -944482, 1946217, -3365566, 5195143, -7338140,
+    9579691, -11566704, 12802048, -12657706, 10408780, -5286292, -3458213, 16489122,
+    -34344276, 57444861, -86213552, 121426570, -165164799, 223749017, -320158075, 597333973,
+    1880019628, -163633211, 11942884, 42629672, -66102193, 74191170, -73173755, 66540127,
+    -56677663, 45380668, -34010979, 23550618, -14630709, 7567229, -2411821, -984614,
+    2902536, -3686807, 3689388, -3226537, 2552508, -1848999, 1227516, -740589,
+    397514, -180795, 60467, -4732, -13543, 14004, -8710, 3618,
+    -1245, 6180, -18197, 41291, -78172, 127192, -178100, 207270,
+    -173574, 16599, 340863, -984215, 1991219, -3408926, 5225056, -7337209,
+    9524920, -11430470, 12554296, -12269478, 9857059, -4559980, -4351462, 17515462,
+    -35435571, 58489058, -87040573, 121781315, -164641855, 221596590, -314471895, 578302726,
+    1887719192, -152255120, 5095968, 47218385, -69226947, 76252513, -74431961, 67193755,
+    -56890703, 45291502, -33734656, 23179142, -14233430, 7192163, -2088071, -1243549,
+    3094949, -3818934, 3771901, -3271674, 2571988, -1852739, 1223052, -733047,
+    389933, -174629, 56120, -2021, -15038, 14722, -9001, 3712,
+    -1250, 6192, -18153, 41002, -77226, 124849, -173217, 198302,
+    -158721, -5840, 371881, -1023223, 2034961, -3450318, 5252141, -7332508,
+    9465482, -11288908, 12301044, -11876378, 9302238, -3833837, -5239455, 18529377,
+    -36505021, 59499678, -87820022, 122072371, -164037295, 219344007, -308675843, 559340024,
+    1895108723, -140644467, -1805465, 51808043, -72330195, 78282856, -75656546, 67815162,
+    -57075256, 45178772, -33440053, 22794454, -13827404, 6812002, -1761992, -1502889,
+    3286580, -3949677, 3852850, -3315339, 2590235, -1855535, 1217923, -725072,
+    382093, -168323, 51705, 717, -16540, 15441, -9291, 3804,
+    -1254, 6199, -18099, 40693, -76247, 122460, -168282, 189296,
+    -143886, -28136, 402524, -1061487, 2077427, -3489731, 5276397, -7324056,
+    9401426, -11142110, 12042441, -11478625, 8744614, -3108234, -6121754, 19530390,
+    -37552155, 60476324, -88551676, 122299851, -163351811, 216992989, -302773640, 540450835,
+    1902185951, -128803059, -8758454, 56396346, -75410263, 80281041, -76846761, 68403919,
+    -57231132, 45042455, -33127261, 22396704, -13412807, 6426921, -1433746, -1762502,
+    3477327, -4078961, 3932185, -3357503, 2607233, -1857382, 1212128, -716666,
+    373998, -161880, 47227, 3479, -18049, 16160, -9580, 3897,
+    -1256, 6203, -18036, 40366, -75237, 120027, -163297, 180257,
+    -129076, -50277, 432780, -1098992, 2118601, -3527152, 5297825, -7311874,
+    9332805, -10990172, 11778643, -11076440, 8184481, -2383542, -6997928, 20518032,
+    -38576512, 61418616, -89235342, 122463898, -162586131, 214545293, -296769026, 521640087,
+    1908948701, -116732793, -15759988, 60980979, -78465486, 82245922, -78001874, 68959610,
+    -57358154, 44882544, -32796378, 21986054, -12989824, 6037101, -1103491, -2022254,
+    3667086, -4206713, 4009859, -3398136, 2622966, -1858271, 1205665, -707830,
+    365649, -155303, 42686, 6265, -19565, 16879, -9868, 3988,
+    -1258, 6203, -17964, 40021, -74197, 117552, -158267, 171189,
+    -114299, -72253, 462635, -1135724, 2158470, -3562573, 5316426, -7295984,
+    9259673, -10833194, 11509803, -10670047, 7622137, -1660128, -7867548, 21491844,
+    -39577647, 62326194, -89870850, 122564688, -161741022, 212002714, -290665751, 502912661,
+    1915394894, -104435656, -22807016, 65559619, -81494199, 84176365, -79121165, 69481836,
+    -57456159, 44699038, -32447512, 21562668, -12558640, 5642726, -771393, -2282012,
+    3855755, -4332860, 4085822, -3437210, 2637421, -1858199, 1198534, -698567,
+    357050, -148594, 38085, 9074, -21085, 17597, -10154, 4079,
+    -1258, 6198, -17882, 39658, -73127, 115037, -153193, 162099,
+    -99562, -94054, 492075, -1171667, 2197018, -3595984, 5332204, -7276411,
+    9182086, -10671277, 11236079, -10259670, 7057878, -938360, -8730190, 22451372,
+    -40555127, 63198715, -90458053, 122602428, -160817284, 209367082, -284467580, 484273396,
+    1921522547, -91913720, -29896441, 70129931, -84494748, 86071250, -80203932, 69970214,
+    -57524997, 44491955, -32080782, 21126722, -12119451, 5243982, -437614, -2541642,
+    4043233, -4457329, 4160027, -3474695, 2650581, -1857158, 1190734, -688878,
+    348203, -141755, 33425, 11903, -22610, 18314, -10439, 4169,
+    -1257, 6191, -17791, 39277, -72029, 112483, -148079, 152990,
+    -84872, -115669, 521088, -1206806, 2234233, -3627379, 5345163, -7253180,
+    9100103, -10504522, 10957631, -9845533, 6492001, -218602, -9585436, 23396175,
+    -41508533, 64035858, -90996832, 122577355, -159815756, 206640259, -278178289, 465727083,
+    1927329775, -79169147, -37025125, 74689574, -87465481, 87929470, -81249487, 70424374,
+    -57564534, 44261319, -31696315, 20678394, -11672452, 4841059, -102321, -2801008,
+    4229417, -4580048, 4232427, -3510566, 2662434, -1855145, 1182266, -678766,
+    339112, -134790, 28709, 14752, -24138, 19029, -10722, 4258,
+    -1255, 6179, -17692, 38879, -70903, 109891, -142928, 143868,
+    -70238, -137088, 549660, -1241128, 2270102, -3656751, 5355310, -7226319,
+    9013785, -10333035, 10674619, -9427864, 5924801, 498783, -10432874, 24325818,
+    -42437459, 64837319, -91487092, 122489736, -158737307, 203824144, -271801662, 447278462,
+    1932814791, -66204186, -44189888, 79236197, -90404757, 89749932, -82257160, 70843967,
+    -57574650, 44007169, -31294248, 20217874, -11217847, 4434149, 234319, -3059976,
+    4414204, -4700946, 4302977, -3544795, 2672968, -1852155, 1173130, -668233,
+    329779, -127701, 23938, 17620, -25669, 19743, -11003, 4346,
+    -1253, 6164, -17584, 38465, -69750, 107265, -137744, 134737,
+    -55666, -158301, 577780, -1274619, 2304613, -3684095, 5362653, -7195859,
+    8923193, -10156924, 10387207, -9006890, 5356574, 1213437, -11272095, 25239876,
+    -43341513, 65602814, -91928762, 122339871, -157582844, 200920665, -265341491, 428932226,
+    1937975904, -53021171, -51387513, 83767445, -93310942, 91531557, -83226299, 71228656,
+    -57555241, 43729558, -30874728, 19745355, -10755842, 4023448, 572137, -3318410,
+    4597495, -4819952, 4371631, -3577357, 2682168, -1848184, 1163327, -657282,
+    320208, -120491, 19115, 20505, -27202, 20454, -11282, 4434,
+    -1249, 6146, -17467, 38034, -68571, 104604, -132528, 125603,
+    -41164, -179299, 605435, -1307267, 2337757, -3709405, 5367200, -7161831,
+    8828392, -9976297, 10095560, -8582840, 4787616, 1925002, -12102698, 26137935,
+    -44220318, 66332078, -92321798, 122128087, -156353307, 197931783, -258801575, 410693014,
+    1942811526, -39622525, -58614741, 88280956, -96182411, 93273285, -84156266, 71578123,
+    -57506216, 43428548, -30437911, 19261039, -10286650, 3609152, 910964, -3576175,
+    4779186, -4936995, 4438344, -3608225, 2690023, -1843229, 1152858, -645917,
+    310401, -113163, 14242, 23405, -28737, 21163, -11558, 4520,
+    -1244, 6124, -17342, 37587, -67367, 101912, -127285, 116470,
+    -26739, -200071, 632615, -1339060, 2369521, -3732680, 5368963, -7124267,
+    8729449, -9791264, 9799842, -8155942, 4218221, 2633123, -12924285, 27019588,
+    -45073511, 67024865, -92666179, 121854745, -155049668, 194859489, -252185717, 392565414,
+    1947320166, -26010753, -65868277, 92774364, -99017550, 94974067, -85046443, 71892067,
+    -57427499, 43104214, -29983963, 18765135, -9810485, 3191463, 1250628, -3833134,
+    4959178, -5052008, 4503074, -3637377, 2696524, -1837287, 1141725, -634140,
+    300364, -105719, 9321, 26319, -30271, 21868, -11831, 4604,
+    -1238, 6099, -17209, 37125, -66138, 99189, -122016, 107343,
+    -12397, -220609, 659306, -1369984, 2399898, -3753916, 5367952, -7083203,
+    8626432, -9601940, 9500222, -7726426, 3648684, 3337450, -13736467, 27884439,
+    -45900742, 67680949, -92961909, 121520231, -153672930, 191705800, -245497724, 374553958,
+    1951500436, -12188449, -73144789, 97245301, -101814756, 96632875, -85896230, 72170203,
+    -57319031, 42756645, -29513059, 18257857, -9327570, 2770583, 1590957, -4089151,
+    5137370, -5164920, 4565775, -3664787, 2701657, -1830355, 1129929, -621956,
+    290099, -98164, 4354, 29245, -31805, 22569, -12102, 4688,
+    -1232, 6070, -17069, 36648, -64887, 96439, -116726, 98228,
+    1853, -240902, 685499, -1400030, 2428878, -3773113, 5364182, -7038675,
+    8519411, -9408438, 9196869, -7294523, 3079296, 4037634, -14538859, 28732103,
+    -46701677, 68300124, -93209017, 121124962, -152224132, 188472765, -238741402, 356663121,
+    1955351046, 1841712, -80440911, 101691397, -104572437, 98248695, -86705044, 72412264,
+    -57180765, 42385940, -29025383, 17739426, -8838127, 2346718, 1931778, -4344091,
+    5313663, -5275665, 4626408, -3690434, 2705415, -1822431, 1117472, -609368,
+    279610, -90499, -656, 32183, -33338, 23267, -12370, 4770,
+    -1224, 6039, -16920, 36156, -63613, 93661, -111417, 89128,
+    16006, -260942, 711183, -1429186, 2456454, -3790271, 5357666, -6990722,
+    8408457, -9210874, 8889953, -6860463, 2510351, 4733331, -15331084, 29562203,
+    -47475995, 68882202, -93407557, 120669386, -150704339, 185162456, -231920560, 338897321,
+    1958870809, 16076970, -87753242, 106110279, -107289014, 99820533, -87472322, 72618001,
+    -57012671, 41992212, -28521128, 17210072, -8342386, 1920076, 2272916, -4597816,
+    5487956, -5384174, 4684930, -3714295, 2707788, -1813515, 1104358, -596379,
+    268902, -82729, -5707, 35131, -34868, 23960, -12634, 4851,
+    -1216, 6004, -16764, 35651, -62318, 90858, -106092, 80048,
+    30054, -280721, 736347, -1457442, 2482619, -3805390, 5348422, -6939382,
+    8293645, -9009366, 8579645, -6424477, 1942137, 5424199, -16112770, 30374374,
+    -48223391, 69427017, -93557606, 120153977, -149114650, 181776974, -225039004, 321260919,
+    1962058639, 30514483, -95078348, 110499576, -109962922, 101347411, -88197519, 72787181,
+    -56814735, 41575585, -28000498, 16670028, -7840581, 1490865, 2614198, -4850191,
+    5660152, -5490382, 4741302, -3736348, 2708766, -1803605, 1090590, -582996,
+    257978, -74857, -10797, 38087, -36395, 24647, -12895, 4930,
+    -1207, 5966, -16600, 35131, -61002, 88033, -100754, 70994,
+    43991, -300228, 760980, -1484788, 2507365, -3818474, 5336466, -6884697,
+    8175049, -8804035, 8266118, -5986796, 1374945, 6109901, -16883552, 31168260,
+    -48943575, 69934419, -93659268, 119579237, -147456193, 178318441, -218100536, 303758213,
+    1964913553, 45151325, -102412764, 114856920, -112592609, 102828373, -88880111, 72919591,
+    -56586956, 41136195, -27463704, 16119535, -7332947, 1059298, 2955447, -5101081,
+    5830152, -5594224, 4795484, -3756574, 2708344, -1792701, 1076170, -569221,
+    246842, -66886, -15923, 41049, -37918, 25330, -13152, 5008,
+    -1197, 5925, -16430, 34598, -59667, 85185, -95406, 61969,
+    57811, -319457, 785075, -1511215, 2530689, -3829524, 5321817, -6826711,
+    8052746, -8595000, 7949545, -5547652, 809062, 6790102, -17643072, 31943517,
+    -49636271, 70404280, -93712668, 118945698, -145730123, 174789004, -211108955, 286393441,
+    1967434670, 59984490, -109752995, 119179943, -115176541, 104262481, -89519593, 73015035,
+    -56329349, 40674192, -26910968, 15558841, -6819726, 625588, 3296486, -5350348,
+    5997860, -5695635, 4847437, -3774953, 2706512, -1780802, 1061102, -555060,
+    235500, -58820, -21083, 44016, -39436, 26006, -13405, 5084,
+    -1186, 5881, -16252, 34053, -58313, 82318, -90051, 52978,
+    71506, -338397, 808620, -1536715, 2552585, -3838545, 5304495, -6765467,
+    7926815, -8382384, 7630101, -5107275, 244773, 7464473, -18390980, 32699811,
+    -50301217, 70836493, -93717956, 118253919, -143937627, 171190833, -204068052, 269170775,
+    1969621212, 75010893, -117095516, 123466282, -117713195, 105648815, -90115480, 73073335,
+    -56041946, 40189736, -26342518, 14988198, -6301162, 189953, 3637140, -5597859,
+    6163178, -5794552, 4897125, -3791467, 2703266, -1767911, 1045391, -540517,
+    223956, -50662, -26274, 46987, -40948, 26676, -13655, 5158,
+    -1175, 5834, -16068, 33495, -56942, 79433, -84691, 44026,
+    85070, -357042, 831607, -1561278, 2573048, -3845543, 5284521, -6701012,
+    7797336, -8166310, 7307961, -4665896, -317636, 8132689, -19126931, 33436818,
+    -50938169, 71230966, -93675308, 117504484, -142079916, 167526117, -196981613, 252094327,
+    1971472505, 90227366, -124436777, 127713578, -120201071, 106986478, -90667307, 73094331,
+    -55724793, 39683000, -25758594, 14407865, -5777503, -247392, 3977230, -5843478,
+    6326011, -5890913, 4944511, -3806096, 2698599, -1754028, 1029040, -525598,
+    212214, -42416, -31494, 49960, -42454, 27339, -13900, 5230,
+    -1162, 5785, -15877, 32925, -55553, 76531, -79331, 35117,
+    98497, -375384, 854027, -1584898, 2592077, -3850524, 5261918, -6633392,
+    7664390, -7946905, 6983301, -4223746, -877885, 8794427, -19850589, 34154226,
+    -51546895, 71587631, -93584920, 116698007, -140158230, 163797067, -189853412, 235168139,
+    1972987976, 105630664, -131773198, 131919478, -122638681, 108274595, -91174631, 73077884,
+    -55377951, 39154170, -25159443, 13818108, -5249001, -686226, 4316579, -6087070,
+    6486264, -5984656, 4989559, -3818826, 2692506, -1739154, 1012055, -510309,
+    200280, -34086, -36740, 52933, -43952, 27995, -14140, 5301,
+    -1150, 5733, -15680, 32344, -54149, 73615, -73972, 26256,
+    111782, -393414, 875872, -1607567, 2609668, -3853494, 5236709, -6562656,
+    7528061, -7724293, 6656297, -3781054, -1435693, 9449371, -20561625, 34851734,
+    -52127180, 71906437, -93447015, 115835125, -138173835, 160005912, -182687213, 218396189,
+    1974167159, 121217465, -139101178, 136081638, -125024560, 109512309, -91637028, 73023870,
+    -55001497, 38603441, -24545322, 13219198, -4715910, -1126329, 4655009, -6328502,
+    6643844, -6075721, 5032236, -3829639, 2684983, -1723292, 994440, -494655,
+    188158, -25675, -42009, 55905, -45442, 28644, -14376, 5369,
+    -1136, 5678, -15477, 31752, -52730, 70686, -68617, 17446,
+    124917, -411125, 897134, -1629280, 2625819, -3854463, 5208921, -6488856,
+    7388432, -7498603, 6327127, -3338050, -1990783, 10097208, -21259717, 35529053,
+    -52678824, 72187354, -93261837, 114916503, -136128022, 156154897, -175486770, 201782386,
+    1975009688, 136984369, -146417089, 140197721, -127357259, 110698788, -92054097, 72932186,
+    -54595523, 38031023, -23916495, 12611410, -4178490, -1567479, 4992341, -6567639,
+    6798658, -6164049, 5072507, -3838520, 2676026, -1706445, 976202, -478642,
+    175853, -17188, -47300, 58873, -46922, 29284, -14607, 5436,
+    -1122, 5621, -15268, 31150, -51296, 67746, -63270, 8693,
+    137898, -428511, 917805, -1650029, 2640531, -3853439, 5178578, -6412041,
+    7245589, -7269962, 5995969, -2894963, -2542879, 10737631, -21944552, 36185902,
+    -53201642, 72430369, -93029654, 113942831, -134022106, 152246284, -168255820, 185330569,
+    1975515304, 152927900, -153717282, 144265398, -129635350, 111833222, -92425460, 72802749,
+    -54160138, 37437137, -23273235, 11995027, -3637001, -2009451, 5328397, -6804350,
+    6950614, -6249583, 5110342, -3845456, 2665633, -1688616, 957346, -462276,
+    163372, -8628, -52609, 61838, -48391, 29915, -14832, 5500,
+    0, 5562, -15053, 30537, -49850, 64795, -57933, 0,
+    150718, -445563, 937878, -1669808, 2653801, -3850431, 5145706, -6332262,
+    7099617, -7038497, 5662997, -2452020, -3091707, 11370330, -22615812, 36821996,
+    -53695436, 72635454, -92750709, 112914765, -131857359, 148282277, -160998005, 169044420,
+    1975682832, 169044420, -160998005, 148282277, -131857359, 112914765, -92750709, 72635454,
+    -53695436, 36821996, -22615812, 11370330, -3091707, -2452020, 5662997, -7038497,
+    7099617, -6332262, 5145706, -3850431, 2653801, -1669808, 937878, -445563,
+    150718, 0, -57933, 64795, -49850, 30537, -15053, 5562,
+};
+
+#endif /* I2S_MULTILINE_SRC_COEF_H */
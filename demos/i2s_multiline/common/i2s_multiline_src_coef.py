@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 HPMicro
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""
+生成i2s_multiline_src使用的多相滤波器系数表 i2s_multiline_src_coef.h
+
+原型滤波器为Kaiser窗sinc低通，按输入采样率归一化。
+每个质量档位一个表，表中有phases + 1个相位，每个相位taps个Q31系数，
+第p个相位对应输出位于窗口中心左侧采样之后 p / phases 个输入采样处，
+最后一个相位用于相邻相位间的线性插值。每个相位的系数和归一化为1。
+相位数需为2的幂，抽头数需为4的倍数。
+
+用法: python3 i2s_multiline_src_coef.py [输出文件]
+"""
+
+import math
+import sys
+
+# 名称, 每相位抽头数, 相位数, 截止频率(相对输入奈奎斯特频率), Kaiser beta
+PRESETS = [
+    ("low", 16, 32, 0.80, 6.0),
+    ("medium", 32, 128, 0.88, 9.0),
+    ("high", 64, 128, 0.92, 12.0),
+]
+
+
+def bessel_i0(x):
+    s = 1.0
+    t = 1.0
+    k = 1
+    while t > 1e-20 * s:
+        t *= (x / (2.0 * k)) ** 2
+        s += t
+        k += 1
+    return s
+
+
+def kaiser(t, half, beta):
+    r = t / half
+    if abs(r) >= 1.0:
+        return 0.0
+    return bessel_i0(beta * math.sqrt(1.0 - r * r)) / bessel_i0(beta)
+
+
+def sinc(x):
+    return 1.0 if x == 0.0 else math.sin(math.pi * x) / (math.pi * x)
+
+
+def make_table(taps, phases, cutoff, beta):
+    half = taps / 2.0
+    table = []
+    for p in range(phases + 1):
+        frac = p / phases
+        row = []
+        for j in range(taps):
+            t = half - 1.0 + frac - j
+            row.append(cutoff * sinc(cutoff * t) * kaiser(t, half, beta))
+        s = sum(row)
+        table.append([min(int(round(c / s * 2147483648.0)), 2147483647) for c in row])
+    return table
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else "i2s_multiline_src_coef.h"
+    lines = [
+        "/*",
+        " * Copyright (c) 2025 HPMicro",
+        " *",
+        " * SPDX-License-Identifier: BSD-3-Clause",
+        " *",
+        " */",
+        "",
+        "/* 由i2s_multiline_src_coef.py生成，请勿手工修改 */",
+        "",
+        "#ifndef I2S_MULTILINE_SRC_COEF_H",
+        "#define I2S_MULTILINE_SRC_COEF_H",
+        "",
+    ]
+    for name, taps, phases, cutoff, beta in PRESETS:
+        assert phases & (phases - 1) == 0 and taps % 4 == 0
+        table = make_table(taps, phases, cutoff, beta)
+        upper = name.upper()
+        lines.append("/* %s: %d taps, %d phases, cutoff %.2f, kaiser beta %.1f */" % (name, taps, phases, cutoff, beta))
+        lines.append("#define I2S_MULTILINE_SRC_%s_TAPS        (%dU)" % (upper, taps))
+        lines.append("#define I2S_MULTILINE_SRC_%s_PHASE_BITS  (%dU)" % (upper, phases.bit_length() - 1))
+        lines.append("static const int32_t i2s_multiline_src_coef_%s[(%d + 1) * %d] = {" % (name, phases, taps))
+        for row in table:
+            for i in range(0, taps, 8):
+                lines.append("    " + " ".join("%d," % c for c in row[i:i + 8]))
+        lines.append("};")
+        lines.append("")
+    lines.append("#endif /* I2S_MULTILINE_SRC_COEF_H */")
+    with open(out, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
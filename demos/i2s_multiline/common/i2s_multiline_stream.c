@@ -0,0 +1,609 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+
+/* 描述符及缓冲区地址转换为DMA可访问的系统地址 */
+#define STREAM_SYS_ADDR(ptr)    core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)(ptr))
+
+/*
+ * 位置在环内的帧序号。位置是自由运行的32位计数，环的帧数通常不是2的幂，
+ * 相对slot_base取模，计数在2^32处回绕时映射保持连续
+ */
+static inline uint32_t stream_slot(i2s_multiline_stream_t *stream, uint32_t pos)
+{
+    return (pos - stream->slot_base) % stream->ring_frames;
+}
+
+static inline uint8_t *stream_line_addr(i2s_multiline_stream_t *stream, uint8_t line, uint32_t pos)
+{
+    return (uint8_t *)stream->config.buffer[line] + stream_slot(stream, pos) * stream->frame_bytes;
+}
+
+/*
+ * 读位置领先slot_base超过2^31帧时将其前移整数个环，并保持在读位置之前至少一个环。
+ * 只在中断中修改且为单次32位写入，生产者读到前移前后的任一值得到的帧序号相同
+ */
+static void stream_rebase(i2s_multiline_stream_t *stream)
+{
+    uint32_t ahead = stream->read_pos - stream->slot_base;
+
+    if (ahead >= 0x80000000UL) {
+        stream->slot_base += (ahead / stream->ring_frames - 1U) * stream->ring_frames;
+    }
+}
+
+/*
+ * 在[from, to)帧填充静音或重复from之前的最后一帧，区间不跨越周期边界，在环内连续
+ */
+static void stream_fill(i2s_multiline_stream_t *stream, uint32_t from, uint32_t to)
+{
+    uint8_t *last;
+    uint8_t *dst;
+
+    for (uint8_t ring = 0; ring < stream->ring_num; ring++) {
+        dst = stream_line_addr(stream, ring, from);
+        if (stream->config.repeat_last_frame) {
+            last = stream_line_addr(stream, ring, from - 1U);
+            for (uint32_t pos = from; pos < to; pos++) {
+                memcpy(dst, last, stream->frame_bytes);
+                dst += stream->frame_bytes;
+            }
+        } else {
+            memset(dst, 0, (to - from) * stream->frame_bytes);
+        }
+    }
+}
+
+/*
+ * 确保DMA即将读取的[start, end)已写满，生产者来不及写入的部分插入静音或重复最后一帧，
+ * 写位置随之前移，播放不中断
+ */
+static void stream_fill_until(i2s_multiline_stream_t *stream, uint32_t start, uint32_t end)
+{
+    uint32_t from = stream->write_pos;
+
+    if ((int32_t)(from - end) >= 0) {
+        return;
+    }
+    if ((int32_t)(from - start) < 0) {
+        from = start;
+    }
+    stream_fill(stream, from, end);
+    stream->write_pos = end;
+    if (!stream->draining) {
+        stream->underrun_count++;
+        stream->silence_frames += end - from;
+    }
+}
+
+static uint8_t stream_burst_size(uint8_t transfers)
+{
+    switch (transfers) {
+    case 2:
+        return DMA_NUM_TRANSFER_PER_BURST_2T;
+    case 4:
+        return DMA_NUM_TRANSFER_PER_BURST_4T;
+    case 8:
+        return DMA_NUM_TRANSFER_PER_BURST_8T;
+    default:
+        return DMA_NUM_TRANSFER_PER_BURST_1T;
+    }
+}
+
+/* 配置通道及循环链表描述符，通道本身承担第start_period个周期 */
+static hpm_stat_t stream_config_line_dma(i2s_multiline_stream_t *stream, uint8_t line, uint8_t start_period)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    dma_channel_config_t ch_config;
+    uint32_t period_bytes = cfg->period_frames * stream->frame_bytes;
+    /* 广播模式下所有通道读取同一个环 */
+    uint8_t *buffer = (uint8_t *)cfg->buffer[(stream->ring_num == 1U) ? 0U : line];
+    uint8_t data_width;
+    uint8_t data_shift_byte;
+    hpm_stat_t stat;
+
+    /* 有效数据位于TXD的高位，16位数据写入TXD的高半字 */
+    if (stream->sample_bytes == 2U) {
+        data_width = DMA_TRANSFER_WIDTH_HALF_WORD;
+        data_shift_byte = 2U;
+    } else {
+        data_width = DMA_TRANSFER_WIDTH_WORD;
+        data_shift_byte = 0U;
+    }
+
+    dma_default_channel_config(cfg->dma, &ch_config);
+    ch_config.dst_addr = (uint32_t)&cfg->i2s->TXD[line] + data_shift_byte;
+    ch_config.src_width = data_width;
+    ch_config.dst_width = data_width;
+    ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+    ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_FIXED;
+    ch_config.size_in_byte = period_bytes;
+    ch_config.dst_mode = DMA_HANDSHAKE_MODE_HANDSHAKE;
+    if (cfg->engine == i2s_multiline_engine_burst_dma) {
+        /* 一个burst依次写入TXD[0..line_num-1]，然后回到TXD[0] */
+        ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+        ch_config.en_dst_burst_in_fixed_trans = true;
+        ch_config.src_burst_size = stream_burst_size(cfg->line_num);
+    } else {
+        /* 每次请求传输dma_burst个采样，FIFO在请求时至少有同样多的空位 */
+        ch_config.src_burst_size = stream_burst_size(cfg->dma_burst);
+    }
+    /* 各通道同步运行，只由第0个通道产生周期中断，其余通道只报告错误 */
+    if (line == 0U) {
+        ch_config.interrupt_mask = DMA_INTERRUPT_MASK_NONE;
+    } else {
+        ch_config.interrupt_mask = DMA_INTERRUPT_MASK_TERMINAL_COUNT | DMA_INTERRUPT_MASK_HALF_TC;
+    }
+
+    /* 每个周期一个描述符，最后一个指回第一个形成环 */
+    for (uint8_t p = 0; p < cfg->period_num; p++) {
+        ch_config.src_addr = STREAM_SYS_ADDR(buffer + p * period_bytes);
+        ch_config.linked_ptr = STREAM_SYS_ADDR(&stream->desc[line][(p + 1U) % cfg->period_num]);
+        stat = dma_config_linked_descriptor(cfg->dma, &stream->desc[line][p], cfg->dma_channel[line], &ch_config);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    ch_config.src_addr = STREAM_SYS_ADDR(buffer + start_period * period_bytes);
+    ch_config.linked_ptr = STREAM_SYS_ADDR(&stream->desc[line][(start_period + 1U) % cfg->period_num]);
+    stat = dma_setup_channel(cfg->dma, cfg->dma_channel[line], &ch_config, false);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    dmamux_config(cfg->dmamux, DMA_SOC_CHN_TO_DMAMUX_CHN(cfg->dma, cfg->dma_channel[line]), cfg->dma_req[line], true);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_stream_init(i2s_multiline_stream_t *stream, const i2s_multiline_stream_config_t *config)
+{
+    if ((config->line_num == 0U) || (config->line_num > I2S_MULTILINE_MAX_LINE) ||
+        (config->period_num < 2U) || (config->period_num > I2S_MULTILINE_MAX_PERIOD) ||
+        (config->period_frames == 0U) || ((config->period_frames & 1U) != 0U) ||
+        (config->channel_per_line == 0U)) {
+        return status_invalid_argument;
+    }
+    if (config->engine == i2s_multiline_engine_burst_dma) {
+        /* burst长度只能为1/2/4，4条数据线才能在同一个burst内同步推进 */
+        if ((config->line_num == 3U) ||
+            ((config->audio_depth != 16U) && (config->audio_depth != 24U) && (config->audio_depth != 32U))) {
+            return status_invalid_argument;
+        }
+    } else if (((config->audio_depth != 16U) && (config->audio_depth != 32U)) ||
+               ((config->dma_burst > 1U) &&
+                ((config->dma_burst > 8U) || ((config->dma_burst & (config->dma_burst - 1U)) != 0U) ||
+                 (((config->period_frames * config->channel_per_line) % config->dma_burst) != 0U)))) {
+        return status_invalid_argument;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->config = *config;
+    if (config->engine == i2s_multiline_engine_burst_dma) {
+        /*
+         * DMA地址在burst内按传输宽度递增，半字宽度无法落到各TXD的高半字，
+         * 因此环中每个采样固定占32位并已左对齐，16/24位源数据由打包接口展开
+         */
+        stream->sample_bytes = 4U;
+        stream->ring_num = 1;
+        stream->dma_num = 1;
+        stream->frame_bytes = config->line_num * config->channel_per_line * stream->sample_bytes;
+    } else {
+        stream->sample_bytes = config->audio_depth / 8U;
+        stream->ring_num = config->broadcast ? 1U : config->line_num;
+        stream->dma_num = config->line_num;
+        stream->frame_bytes = config->channel_per_line * stream->sample_bytes;
+    }
+    stream->ring_frames = config->period_num * config->period_frames;
+    stream->prefill_timeout_cycles = clock_get_frequency(clock_cpu0) / 1000000U * I2S_MULTILINE_STREAM_PREFILL_TIMEOUT_US;
+
+    for (uint8_t line = 0; line < stream->ring_num; line++) {
+        if (config->buffer[line] == NULL) {
+            return status_invalid_argument;
+        }
+        memset(config->buffer[line], 0, stream->ring_frames * stream->frame_bytes);
+    }
+    return status_success;
+}
+
+/* 发送FIFO深度，每条数据线8位，一次读取得到所有数据线在同一时刻的深度 */
+static inline uint8_t stream_tx_fifo_level(uint32_t fillings, uint8_t line)
+{
+    return (uint8_t)(fillings >> (line * 8U));
+}
+
+/*
+ * 等待各数据线的发送FIFO被DMA填充到相同深度并保持稳定，之后再启动I2S，
+ * 各数据线从FIFO中的同一帧开始输出。超时(如DMA请求未生效)时仍返回，由调用者照常启动
+ */
+static void stream_wait_prefill(i2s_multiline_stream_t *stream)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint32_t start = read_csr(CSR_MCYCLE);
+    uint32_t last = 0;
+    uint32_t fillings;
+    uint8_t stable = 0;
+    uint8_t level;
+    bool equal;
+
+    while ((read_csr(CSR_MCYCLE) - start) < stream->prefill_timeout_cycles) {
+        fillings = cfg->i2s->TFIFO_FILLINGS;
+        level = stream_tx_fifo_level(fillings, 0);
+        equal = (level != 0U);
+        for (uint8_t line = 1; line < cfg->line_num; line++) {
+            if (stream_tx_fifo_level(fillings, line) != level) {
+                equal = false;
+            }
+        }
+        if (equal && (fillings == last)) {
+            if (++stable >= I2S_MULTILINE_STREAM_PREFILL_STABLE) {
+                stream->prefill_level = level;
+                return;
+            }
+        } else {
+            stable = 0;
+        }
+        last = fillings;
+    }
+    stream->prefill_level = stream_tx_fifo_level(cfg->i2s->TFIFO_FILLINGS, 0);
+    stream->prefill_timeout_count++;
+}
+
+hpm_stat_t i2s_multiline_stream_prepare(i2s_multiline_stream_t *stream)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    hpm_stat_t stat;
+    uint8_t period;
+
+    /* 从读位置所在的周期开始，读位置不必从0开始 */
+    stream->read_pos -= stream_slot(stream, stream->read_pos) % cfg->period_frames;
+    period = stream_slot(stream, stream->read_pos) / cfg->period_frames;
+    stream->half_period_count = 0;
+    stream->draining = false;
+    stream->recover_pending = false;
+    for (uint8_t line = 0; line < stream->dma_num; line++) {
+        stat = stream_config_line_dma(stream, line, period);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    /* 先清空各数据线的FIFO，使预填充从相同的起点开始 */
+    i2s_reset_tx(cfg->i2s);
+    i2s_enable_tx_dma_request(cfg->i2s);
+    for (uint8_t line = 0; line < stream->dma_num; line++) {
+        dma_enable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    stream_wait_prefill(stream);
+    stream->running = true;
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_stream_start(i2s_multiline_stream_t *stream)
+{
+    hpm_stat_t stat = i2s_multiline_stream_prepare(stream);
+
+    /* 所有数据线的FIFO已预填充，一次写控制寄存器同时启动 */
+    if (stat == status_success) {
+        i2s_start(stream->config.i2s);
+    }
+    return stat;
+}
+
+void i2s_multiline_stream_stop(i2s_multiline_stream_t *stream)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+
+    for (uint8_t line = 0; line < stream->dma_num; line++) {
+        dma_disable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    i2s_stop(cfg->i2s);
+    i2s_disable_tx_dma_request(cfg->i2s);
+    stream->recover_pending = false;
+    stream->running = false;
+}
+
+static void stream_advance_half_period(i2s_multiline_stream_t *stream, bool period_end)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint32_t period = stream->half_period_count / 2U;
+
+    stream->read_pos += cfg->period_frames / 2U;
+    stream->half_period_count++;
+    stream_rebase(stream);
+
+    if (period_end) {
+        if (cfg->period_cb != NULL) {
+            cfg->period_cb(stream, period, cfg->user_data);
+        }
+    } else {
+        if (cfg->half_period_cb != NULL) {
+            cfg->half_period_cb(stream, period, cfg->user_data);
+        }
+    }
+
+    /* DMA下一个进入的半周期，回调中可能写入了数据，回调之后再检查 */
+    stream_fill_until(stream, stream->read_pos + cfg->period_frames / 2U, stream->read_pos + cfg->period_frames);
+}
+
+/*
+ * DMA错误或I2S发送FIFO下溢后恢复的第一步，在中断中执行：停止DMA和I2S并清空所有数据线的FIFO，
+ * 从下一个周期边界重新配置并使能DMA，由DMA在I2S停止时预填充FIFO。
+ * 等待预填充并启动I2S不在中断中忙等，由i2s_multiline_stream_task完成
+ */
+static void stream_recover(i2s_multiline_stream_t *stream)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint8_t period;
+
+    stream->recover_start = read_csr(CSR_MCYCLE);
+
+    for (uint8_t line = 0; line < stream->dma_num; line++) {
+        dma_disable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    i2s_stop(cfg->i2s);
+    i2s_reset_tx(cfg->i2s);
+
+    stream->read_pos += cfg->period_frames - stream_slot(stream, stream->read_pos) % cfg->period_frames;
+    stream->half_period_count = (stream->half_period_count + 2U) & ~1UL;
+    stream_rebase(stream);
+    stream_fill_until(stream, stream->read_pos, stream->read_pos + cfg->period_frames);
+
+    period = stream_slot(stream, stream->read_pos) / cfg->period_frames;
+    for (uint8_t line = 0; line < stream->dma_num; line++) {
+        stream_config_line_dma(stream, line, period);
+        dma_enable_channel(cfg->dma, cfg->dma_channel[line]);
+    }
+    stream->recover_pending = true;
+}
+
+void i2s_multiline_stream_task(i2s_multiline_stream_t *stream)
+{
+    uint32_t cycles;
+
+    if (!stream->recover_pending) {
+        return;
+    }
+    /* DMA已停止在FIFO满处，中断不会再进入，无需关中断 */
+    stream_wait_prefill(stream);
+    i2s_start(stream->config.i2s);
+    stream->recover_pending = false;
+
+    cycles = read_csr(CSR_MCYCLE) - stream->recover_start;
+    stream->recovery_count++;
+    stream->recovery_cycles_last = cycles;
+    if (cycles > stream->recovery_cycles_max) {
+        stream->recovery_cycles_max = cycles;
+    }
+}
+
+/*
+ * 处理数据线0通道的DMA状态，recover表示其他数据线的通道已出错
+ */
+static void stream_handle_status(i2s_multiline_stream_t *stream, uint32_t stat, bool recover)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+
+    if (stat & DMA_CHANNEL_STATUS_ERROR) {
+        stream->dma_error_count++;
+        recover = true;
+    }
+    /* 中断被延迟时半周期与整周期标志可能同时置位，按顺序处理 */
+    if (((stream->half_period_count & 1U) == 0U) && (stat & DMA_CHANNEL_STATUS_HALF_TC)) {
+        stream_advance_half_period(stream, false);
+    }
+    if (stat & DMA_CHANNEL_STATUS_TC) {
+        if ((stream->half_period_count & 1U) == 0U) {
+            /* 漏掉的半周期 */
+            stream_advance_half_period(stream, false);
+        }
+        stream_advance_half_period(stream, true);
+    }
+
+    /* DMA未能及时填充FIFO时各数据线可能不再对齐 */
+    if ((i2s_get_irq_status(cfg->i2s) & I2S_STA_TX_UD_MASK) != 0U) {
+        i2s_clear_irq_status(cfg->i2s, I2S_STA_TX_UD_MASK);
+        stream->fifo_underflow_count++;
+        recover = true;
+    }
+
+    if (recover && stream->running && !stream->recover_pending) {
+        stream_recover(stream);
+    }
+}
+
+void i2s_multiline_stream_irq_handler(i2s_multiline_stream_t *stream)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint32_t stat;
+    bool recover = false;
+
+    for (uint8_t line = 1; line < stream->dma_num; line++) {
+        stat = dma_check_transfer_status(cfg->dma, cfg->dma_channel[line]);
+        if (stat & DMA_CHANNEL_STATUS_ERROR) {
+            stream->dma_error_count++;
+            recover = true;
+        }
+    }
+
+    stat = dma_check_transfer_status(cfg->dma, cfg->dma_channel[0]);
+    stream_handle_status(stream, stat, recover);
+}
+
+void i2s_multiline_stream_dma_callback(uint8_t channel, uint32_t status, void *user_data)
+{
+    i2s_multiline_stream_t *stream = (i2s_multiline_stream_t *)user_data;
+
+    if (channel == stream->config.dma_channel[0]) {
+        stream_handle_status(stream, status, false);
+    } else if (status & DMA_CHANNEL_STATUS_ERROR) {
+        stream->dma_error_count++;
+        stream_handle_status(stream, 0, true);
+    }
+}
+
+void i2s_multiline_stream_drain(i2s_multiline_stream_t *stream)
+{
+    stream->draining = true;
+}
+
+void i2s_multiline_stream_get_stats(i2s_multiline_stream_t *stream, i2s_multiline_stream_stats_t *stats)
+{
+    stats->underrun_count = stream->underrun_count;
+    stats->silence_frames = stream->silence_frames;
+    stats->dma_error_count = stream->dma_error_count;
+    stats->fifo_underflow_count = stream->fifo_underflow_count;
+    stats->recovery_count = stream->recovery_count;
+    stats->recovery_cycles_last = stream->recovery_cycles_last;
+    stats->recovery_cycles_max = stream->recovery_cycles_max;
+    stats->prefill_level = stream->prefill_level;
+    stats->prefill_timeout_count = stream->prefill_timeout_count;
+}
+
+/*
+ * 各数据线在当前周期内已送入FIFO的采样数减去仍在FIFO中的采样数，即已输出的采样数。
+ * per_line引擎每个通道的剩余传输数对应一条数据线；burst引擎的通道按line0..N-1轮流写入，
+ * 已传输w个字时数据线l收到(w + N - 1 - l) / N个采样
+ */
+static void stream_snapshot_played(i2s_multiline_stream_t *stream, uint32_t fillings, const uint32_t remaining[],
+                                   uint32_t played[])
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint32_t line_samples = cfg->period_frames * cfg->channel_per_line;
+    uint32_t words;
+
+    for (uint8_t line = 0; line < cfg->line_num; line++) {
+        if (cfg->engine == i2s_multiline_engine_burst_dma) {
+            words = line_samples * cfg->line_num - remaining[0];
+            played[line] = (words + cfg->line_num - 1U - line) / cfg->line_num;
+        } else {
+            played[line] = line_samples - remaining[line];
+        }
+        played[line] -= stream_tx_fifo_level(fillings, line);
+    }
+}
+
+hpm_stat_t i2s_multiline_stream_measure_skew(i2s_multiline_stream_t *stream, int32_t skew_samples[])
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    int32_t line_samples = (int32_t)(cfg->period_frames * cfg->channel_per_line);
+    uint32_t remaining[I2S_MULTILINE_MAX_LINE];
+    uint32_t played[I2S_MULTILINE_MAX_LINE];
+    uint32_t fillings;
+    uint32_t level;
+    int32_t diff;
+
+    if (!stream->running || stream->recover_pending) {
+        return status_fail;
+    }
+    /* 读取剩余传输数前后FIFO深度不变，说明期间DMA和I2S都没有推进 */
+    for (uint8_t retry = 0; retry < 16U; retry++) {
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        fillings = cfg->i2s->TFIFO_FILLINGS;
+        for (uint8_t i = 0; i < stream->dma_num; i++) {
+            remaining[i] = dma_get_remaining_transfer_size(cfg->dma, cfg->dma_channel[i]);
+        }
+        if (cfg->i2s->TFIFO_FILLINGS != fillings) {
+            restore_global_irq(level);
+            continue;
+        }
+        restore_global_irq(level);
+
+        stream_snapshot_played(stream, fillings, remaining, played);
+        for (uint8_t line = 0; line < cfg->line_num; line++) {
+            /* 各通道可能处于相邻的周期，差值折算到(-半周期, 半周期] */
+            diff = (int32_t)(played[line] - played[0]) % line_samples;
+            if (diff > line_samples / 2) {
+                diff -= line_samples;
+            } else if (diff <= -line_samples / 2) {
+                diff += line_samples;
+            }
+            skew_samples[line] = diff;
+        }
+        return status_success;
+    }
+    return status_timeout;
+}
+
+uint32_t i2s_multiline_stream_get_line0_played(i2s_multiline_stream_t *stream, uint32_t fillings)
+{
+    i2s_multiline_stream_config_t *cfg = &stream->config;
+    uint32_t remaining[I2S_MULTILINE_MAX_LINE] = {0};
+    uint32_t played[I2S_MULTILINE_MAX_LINE];
+
+    remaining[0] = dma_get_remaining_transfer_size(cfg->dma, cfg->dma_channel[0]);
+    stream_snapshot_played(stream, fillings, remaining, played);
+    return played[0];
+}
+
+uint32_t i2s_multiline_stream_get_queued_frames(i2s_multiline_stream_t *stream)
+{
+    int32_t queued = (int32_t)(stream->data_pos - stream->read_pos);
+
+    return (queued > 0) ? (uint32_t)queued : 0U;
+}
+
+uint32_t i2s_multiline_stream_get_free_frames(i2s_multiline_stream_t *stream)
+{
+    return stream->ring_frames - (stream->write_pos - stream->read_pos);
+}
+
+uint32_t i2s_multiline_stream_get_write_ptr(i2s_multiline_stream_t *stream, void *line_ptr[])
+{
+    uint32_t free_frames = i2s_multiline_stream_get_free_frames(stream);
+    uint32_t contiguous = stream->ring_frames - stream_slot(stream, stream->write_pos);
+
+    stream->pending_pos = stream->write_pos;
+    for (uint8_t line = 0; line < stream->ring_num; line++) {
+        line_ptr[line] = stream_line_addr(stream, line, stream->pending_pos);
+    }
+    return (free_frames < contiguous) ? free_frames : contiguous;
+}
+
+void i2s_multiline_stream_commit(i2s_multiline_stream_t *stream, uint32_t frames)
+{
+    uint32_t end = stream->pending_pos + frames;
+    uint32_t level;
+
+    /* 数据写入完成后再发布写位置 */
+    fencerw();
+    /* 写入期间中断可能已插入静音并前移写位置，只发布超出部分 */
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if ((int32_t)(end - stream->write_pos) > 0) {
+        stream->write_pos = end;
+    }
+    stream->data_pos = stream->write_pos;
+    restore_global_irq(level);
+}
+
+uint32_t i2s_multiline_stream_write(i2s_multiline_stream_t *stream, const void *const line_data[], uint32_t frames)
+{
+    void *line_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t written = 0;
+    uint32_t chunk;
+
+    while (written < frames) {
+        chunk = i2s_multiline_stream_get_write_ptr(stream, line_ptr);
+        if (chunk == 0U) {
+            break;
+        }
+        if (chunk > frames - written) {
+            chunk = frames - written;
+        }
+        for (uint8_t line = 0; line < stream->ring_num; line++) {
+            memcpy(line_ptr[line], (const uint8_t *)line_data[line] + written * stream->frame_bytes,
+                   chunk * stream->frame_bytes);
+        }
+        i2s_multiline_stream_commit(stream, chunk);
+        written += chunk;
+    }
+    return written;
+}
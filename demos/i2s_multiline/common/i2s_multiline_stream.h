@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_STREAM_H
+#define I2S_MULTILINE_STREAM_H
+
+/*
+ * I2S多数据线流式发送接口
+ *
+ * 环形缓冲区由period_num个周期组成，DMA通道使用循环链表描述符不停地搬运，
+ * 播放不会因重新配置DMA而中断。生产者通过写指针向环中写入数据，DMA中断按
+ * 半周期推进读指针并回调应用，延迟上限为 period_num * period_frames 帧。
+ *
+ * 生产者来不及写入时，中断在DMA进入下一个半周期之前插入静音(或重复最后一帧)，
+ * DMA错误或I2S发送FIFO下溢时中断从下一个周期边界重新配置DMA，
+ * 由i2s_multiline_stream_task在任务中等待FIFO预填充后重新启动I2S，各数据线重新在帧边界对齐，
+ * 播放不会因此终止，相关次数和恢复耗时通过i2s_multiline_stream_get_stats获取。
+ *
+ * 支持两种DMA引擎：
+ * - per_line：每条数据线一个DMA通道和一个环(需每条line独立DMA请求，如HPM6P00)；
+ *   广播模式下所有数据线的DMA通道读取同一个环，各数据线发送相同的数据
+ * - burst：单个DMA通道和一个环，环内按line0..lineN-1的顺序交织，
+ *   使用DMAv2的burst小循环功能依次写入TXD[0..N-1](如HPM6E00)。
+ *   环中每个采样占32位并左对齐，16/24位数据由i2s_multiline_pack在写入时展开
+ *
+ * 同步启动：使能所有DMA通道后等待各数据线的发送FIFO被DMA填充到相同且稳定的深度，
+ * 再以一次写I2S控制寄存器同时启动所有数据线，各数据线从同一帧开始输出。
+ * i2s_multiline_stream_measure_skew在播放中根据DMA剩余传输数和FIFO深度自检各数据线的相对偏移。
+ */
+
+#include "hpm_common.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+
+#define I2S_MULTILINE_MAX_LINE      (4U)
+#define I2S_MULTILINE_MAX_PERIOD    (8U)
+
+/* 启动前等待发送FIFO预填充的超时时间，超时后仍启动并计入统计 */
+#define I2S_MULTILINE_STREAM_PREFILL_TIMEOUT_US (200U)
+/* FIFO深度连续保持不变的读取次数，视为DMA已停止填充 */
+#define I2S_MULTILINE_STREAM_PREFILL_STABLE     (8U)
+
+typedef enum {
+    i2s_multiline_engine_per_line_dma = 0,          /* 每条数据线一个DMA通道 */
+    i2s_multiline_engine_burst_dma,                 /* 单个DMA通道，burst模式写入各数据线 */
+} i2s_multiline_engine_t;
+
+typedef struct i2s_multiline_stream i2s_multiline_stream_t;
+
+/* 周期回调，在DMA中断上下文中调用，period为刚播放完(或播放完一半)的周期序号 */
+typedef void (*i2s_multiline_stream_cb_t)(i2s_multiline_stream_t *stream, uint32_t period, void *user_data);
+
+typedef struct {
+    I2S_Type *i2s;
+    DMAV2_Type *dma;
+    DMAMUX_Type *dmamux;
+    i2s_multiline_engine_t engine;                  /* DMA引擎 */
+    uint8_t line_num;                               /* 使用的数据线数，burst引擎下为1、2或4 */
+    uint8_t dma_channel[I2S_MULTILINE_MAX_LINE];    /* 每条数据线的DMA通道，burst引擎只使用[0] */
+    uint8_t dma_req[I2S_MULTILINE_MAX_LINE];        /* 每条数据线的DMA请求源，burst引擎只使用[0] */
+    uint8_t dma_burst;                              /* per_line引擎每次DMA请求传输的采样数(1/2/4/8，0同1)，不能超过FIFO深度减阈值 */
+    uint8_t channel_per_line;                       /* 每条数据线每帧的通道数 */
+    uint8_t audio_depth;                            /* 音频位深 (16/32 bits，burst引擎还支持24 bits) */
+    uint8_t period_num;                             /* 周期数 (2 ~ I2S_MULTILINE_MAX_PERIOD) */
+    uint32_t period_frames;                         /* 每个周期的帧数，需为偶数 */
+    void *buffer[I2S_MULTILINE_MAX_LINE];           /* 环形缓冲区，需位于非缓存区；burst引擎及广播模式只使用[0] */
+    bool broadcast;                                 /* per_line引擎广播模式，burst引擎由打包接口实现广播 */
+    bool repeat_last_frame;                         /* 欠载时重复最后一帧，否则插入静音 */
+    i2s_multiline_stream_cb_t half_period_cb;       /* 半周期回调，可为NULL */
+    i2s_multiline_stream_cb_t period_cb;            /* 整周期回调，可为NULL */
+    void *user_data;
+} i2s_multiline_stream_config_t;
+
+/* 流实例，包含DMA链表描述符，需放置在非缓存区 */
+struct i2s_multiline_stream {
+    dma_linked_descriptor_t desc[I2S_MULTILINE_MAX_LINE][I2S_MULTILINE_MAX_PERIOD];
+    i2s_multiline_stream_config_t config;
+    uint8_t sample_bytes;                           /* 每个采样在缓冲区中占用的字节数 */
+    uint8_t ring_num;                               /* 环的个数 */
+    uint8_t dma_num;                                /* DMA通道的个数 */
+    uint32_t frame_bytes;                           /* 每个环中每帧占用的字节数 */
+    uint32_t ring_frames;                           /* 环的总帧数 */
+    volatile uint32_t write_pos;                    /* 生产者写位置(帧，单调递增，含插入的静音) */
+    volatile uint32_t data_pos;                     /* 生产者写入的有效数据末尾 */
+    uint32_t pending_pos;                           /* get_write_ptr返回区域的起始位置 */
+    volatile uint32_t read_pos;                     /* DMA读位置(帧，按半周期推进) */
+    volatile uint32_t slot_base;                    /* 环内第0帧对应的位置，由中断按整环前移 */
+    volatile uint32_t half_period_count;            /* 已完成的半周期数 */
+    volatile uint32_t underrun_count;               /* 欠载次数 */
+    volatile uint32_t silence_frames;               /* 欠载时插入的帧数 */
+    volatile uint32_t dma_error_count;              /* DMA错误次数 */
+    volatile uint32_t fifo_underflow_count;         /* I2S发送FIFO下溢次数 */
+    volatile uint32_t recovery_count;               /* 重新启动次数 */
+    uint32_t recovery_cycles_last;                  /* 最近一次恢复耗时(CPU周期，从中断中检测到错误至I2S重新启动) */
+    uint32_t recovery_cycles_max;                   /* 最长恢复耗时(CPU周期) */
+    uint32_t recover_start;                         /* 检测到错误时的CPU周期 */
+    uint32_t prefill_timeout_cycles;                /* 预填充超时(CPU周期)，初始化时计算 */
+    uint8_t prefill_level;                          /* 最近一次启动时各数据线的FIFO深度 */
+    volatile uint32_t prefill_timeout_count;        /* FIFO预填充超时次数 */
+    volatile bool draining;
+    volatile bool recover_pending;                  /* 中断已重新配置DMA，等待任务中启动I2S */
+    bool running;
+};
+
+typedef struct {
+    uint32_t underrun_count;
+    uint32_t silence_frames;
+    uint32_t dma_error_count;
+    uint32_t fifo_underflow_count;
+    uint32_t recovery_count;
+    uint32_t recovery_cycles_last;
+    uint32_t recovery_cycles_max;
+    uint8_t prefill_level;
+    uint32_t prefill_timeout_count;
+} i2s_multiline_stream_stats_t;
+
+/* per_line引擎下每条数据线的环形缓冲区大小(字节) */
+#define I2S_MULTILINE_STREAM_LINE_BUF_SIZE(period_num, period_frames, channel_per_line, audio_depth) \
+    ((period_num) * (period_frames) * (channel_per_line) * ((audio_depth) / 8U))
+
+/* burst引擎下交织环形缓冲区大小(字节) */
+#define I2S_MULTILINE_STREAM_BURST_BUF_SIZE(period_num, period_frames, line_num, channel_per_line) \
+    ((period_num) * (period_frames) * (line_num) * (channel_per_line) * sizeof(uint32_t))
+
+hpm_stat_t i2s_multiline_stream_init(i2s_multiline_stream_t *stream, const i2s_multiline_stream_config_t *config);
+
+/*
+ * 配置并使能DMA但不启动I2S，用于与接收共用一个I2S时由一次i2s_start同时启动收发；
+ * start相当于prepare后调用i2s_start
+ */
+hpm_stat_t i2s_multiline_stream_prepare(i2s_multiline_stream_t *stream);
+hpm_stat_t i2s_multiline_stream_start(i2s_multiline_stream_t *stream);
+void i2s_multiline_stream_stop(i2s_multiline_stream_t *stream);
+
+/* 在应用的DMA中断处理函数中调用 */
+void i2s_multiline_stream_irq_handler(i2s_multiline_stream_t *stream);
+
+/*
+ * 在任务(主循环)中周期调用：中断检测到DMA错误或FIFO下溢后只停止并重新配置DMA，
+ * 在此等待各数据线的FIFO预填充(最长I2S_MULTILINE_STREAM_PREFILL_TIMEOUT_US)后重新启动I2S，
+ * 恢复期间不输出数据。不能在中断中调用
+ */
+void i2s_multiline_stream_task(i2s_multiline_stream_t *stream);
+
+/*
+ * 使用i2s_multiline_dma_mgr分发中断时，注册为流的每个DMA通道的回调，user_data为流实例，
+ * 代替i2s_multiline_stream_irq_handler
+ */
+void i2s_multiline_stream_dma_callback(uint8_t channel, uint32_t status, void *user_data);
+
+/*
+ * 自检：在播放中测量各数据线相对数据线0的偏移，skew_samples[line]为采样数，
+ * 除以channel_per_line即为帧数，各数据线对齐时全部为0。
+ * 偏移需小于半个周期，DMA或FIFO在读取期间持续变化时返回status_timeout
+ */
+hpm_stat_t i2s_multiline_stream_measure_skew(i2s_multiline_stream_t *stream, int32_t skew_samples[]);
+
+/*
+ * 数据线0在当前周期内已输出的采样数，fillings为调用前读取的TFIFO_FILLINGS，用于多个流之间比较相位。
+ * 调用者需关中断，并在之后再次读取TFIFO_FILLINGS，不变时结果有效
+ */
+uint32_t i2s_multiline_stream_get_line0_played(i2s_multiline_stream_t *stream, uint32_t fillings);
+
+/* 标记数据已全部写入，之后插入的静音不再计为欠载 */
+void i2s_multiline_stream_drain(i2s_multiline_stream_t *stream);
+
+void i2s_multiline_stream_get_stats(i2s_multiline_stream_t *stream, i2s_multiline_stream_stats_t *stats);
+
+/* 可写入的帧数 */
+uint32_t i2s_multiline_stream_get_free_frames(i2s_multiline_stream_t *stream);
+/* 已写入但尚未播放的有效数据帧数，即当前延迟 */
+uint32_t i2s_multiline_stream_get_queued_frames(i2s_multiline_stream_t *stream);
+
+/*
+ * 拷贝方式写入，返回实际写入的帧数
+ * per_line引擎：line_data[line]指向该数据线frames帧的交织数据(每帧channel_per_line个采样，已左对齐)，
+ * 广播模式只使用line_data[0]
+ * burst引擎：line_data[0]指向已按burst顺序交织的数据
+ */
+uint32_t i2s_multiline_stream_write(i2s_multiline_stream_t *stream, const void *const line_data[], uint32_t frames);
+
+/*
+ * 零拷贝方式写入：获取写指针处可连续写入的区域，生产者直接填充后调用commit提交
+ * 返回可连续写入的帧数，line_ptr[]为各环的写地址(burst引擎及广播模式只有line_ptr[0])
+ */
+uint32_t i2s_multiline_stream_get_write_ptr(i2s_multiline_stream_t *stream, void *line_ptr[]);
+void i2s_multiline_stream_commit(i2s_multiline_stream_t *stream, uint32_t frames);
+
+#endif /* I2S_MULTILINE_STREAM_H */
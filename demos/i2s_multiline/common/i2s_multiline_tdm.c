@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "i2s_multiline_tdm.h"
+#include "i2s_multiline_tune.h"
+
+static uint8_t tdm_slot_count(uint32_t mask)
+{
+    uint8_t count = 0;
+
+    while (mask != 0U) {
+        mask &= mask - 1U;
+        count++;
+    }
+    return count;
+}
+
+/* 各数据线使能的时隙数需相同，返回该值，不同时返回0 */
+static uint8_t tdm_channel_per_line(const i2s_multiline_tdm_config_t *config, const uint32_t *mask)
+{
+    uint32_t all = (1UL << config->slot_num) - 1U;
+    uint8_t count = 0;
+    uint8_t n;
+
+    for (uint8_t line = 0; line < config->line_num; line++) {
+        n = tdm_slot_count(((mask[line] == 0U) ? all : mask[line]) & all);
+        if ((line > 0U) && (n != count)) {
+            return 0;
+        }
+        count = n;
+    }
+    return count;
+}
+
+/*
+ * burst引擎的DMA请求只取决于第0条数据线的FIFO深度。各数据线的时隙掩码不同时，一帧内同一时刻各数据线已移出(接收为移入)的
+ * 采样数不同，behind和ahead为其他数据线比第0条数据线少和多的最大采样数
+ */
+static void tdm_line_skew(const i2s_multiline_tdm_config_t *config, const uint32_t *mask, uint32_t *behind,
+                          uint32_t *ahead)
+{
+    uint32_t all = (1UL << config->slot_num) - 1U;
+    uint32_t m0 = ((mask[0] == 0U) ? all : mask[0]) & all;
+    uint32_t m;
+    int32_t d;
+
+    *behind = 0;
+    *ahead = 0;
+    for (uint8_t line = 1; line < config->line_num; line++) {
+        m = ((mask[line] == 0U) ? all : mask[line]) & all;
+        d = 0;
+        for (uint8_t slot = 0; slot < config->slot_num; slot++) {
+            d += (int32_t)((m0 >> slot) & 1U) - (int32_t)((m >> slot) & 1U);
+            if ((d > 0) && ((uint32_t)d > *behind)) {
+                *behind = (uint32_t)d;
+            } else if ((d < 0) && ((uint32_t)-d > *ahead)) {
+                *ahead = (uint32_t)-d;
+            }
+        }
+    }
+}
+
+/*
+ * 阈值触发后第0条数据线FIFO中可用的采样数(发送为剩余数据，接收为剩余空间)。
+ * 领先的数据线可用的采样数少ahead个，因此需求加上ahead；落后的数据线多出behind个，
+ * DMA补满第0条数据线时不能使其溢出(接收时不能读空)，阈值最多为 深度 - 1 - behind
+ */
+static hpm_stat_t tdm_threshold(const i2s_multiline_tdm_config_t *config, bool enable, const uint32_t *mask,
+                                uint32_t line_rate, uint32_t latency_ns, uint32_t depth, uint32_t *thr,
+                                uint32_t *headroom_ns)
+{
+    uint32_t behind = 0;
+    uint32_t ahead = 0;
+    uint32_t need;
+
+    if (enable) {
+        tdm_line_skew(config, mask, &behind, &ahead);
+    }
+    if (behind + ahead + 2U > depth) {
+        return status_invalid_argument;
+    }
+    need = I2S_MULTILINE_TUNE_NEED_SAMPLES(line_rate, latency_ns) + ahead;
+    *thr = I2S_MULTILINE_TUNE_THRESHOLD(true, need, depth);
+    if (*thr > depth - 1U - behind) {
+        *thr = depth - 1U - behind;
+    }
+    *headroom_ns = I2S_MULTILINE_TUNE_HEADROOM_NS(*thr - ahead, line_rate);
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_tdm_get_layout(const i2s_multiline_tdm_config_t *config, i2s_multiline_tdm_layout_t *layout)
+{
+    uint32_t latency_ns = (config->dma_latency_ns != 0U) ? config->dma_latency_ns
+                                                         : I2S_MULTILINE_TDM_DEFAULT_DMA_LATENCY_NS;
+    uint32_t frame_clk;
+    uint32_t headroom_ns;
+    uint32_t thr;
+
+    if ((config->line_num == 0U) || (config->line_num > I2S_MULTILINE_TDM_MAX_LINE) ||
+        ((config->slot_num != 2U) && (config->slot_num != 4U) && (config->slot_num != 8U) &&
+         (config->slot_num != 16U)) ||
+        ((config->audio_depth != 16U) && (config->audio_depth != 24U) && (config->audio_depth != 32U)) ||
+        (config->sample_rate == 0U) || (!config->tx_enable && !config->rx_enable)) {
+        return status_invalid_argument;
+    }
+
+    /* BCLK需由MCLK整数分频得到，32位时隙不可行时16位音频退回16位时隙 */
+    frame_clk = config->sample_rate * config->slot_num;
+    if ((config->mclk_hz >= frame_clk * 32U) && ((config->mclk_hz % (frame_clk * 32U)) == 0U)) {
+        layout->channel_length = i2s_channel_length_32_bits;
+        layout->bclk_hz = frame_clk * 32U;
+    } else if ((config->audio_depth == 16U) && (config->mclk_hz >= frame_clk * 16U) &&
+               ((config->mclk_hz % (frame_clk * 16U)) == 0U)) {
+        layout->channel_length = i2s_channel_length_16_bits;
+        layout->bclk_hz = frame_clk * 16U;
+    } else {
+        return status_invalid_argument;
+    }
+
+    layout->tx_channel_per_line = config->tx_enable ? tdm_channel_per_line(config, config->tx_slot_mask) : 0U;
+    layout->rx_channel_per_line = config->rx_enable ? tdm_channel_per_line(config, config->rx_slot_mask) : 0U;
+    if ((config->tx_enable && (layout->tx_channel_per_line == 0U)) ||
+        (config->rx_enable && (layout->rx_channel_per_line == 0U))) {
+        return status_invalid_argument;
+    }
+    layout->tx_line_rate = config->sample_rate * layout->tx_channel_per_line;
+    layout->rx_line_rate = config->sample_rate * layout->rx_channel_per_line;
+
+    /*
+     * 发送：FIFO剩余数据不多于阈值时请求DMA，阈值即可支撑的采样数；
+     * 接收：FIFO数据不少于阈值时请求DMA，深度减阈值即可容纳的采样数。
+     * 与i2s_multiline_tune的DMA引擎规则相同：低速时至少保留半个FIFO的余量，速率升高后余量随之扩大到接近整个FIFO
+     */
+    if (tdm_threshold(config, config->tx_enable, config->tx_slot_mask, layout->tx_line_rate, latency_ns,
+                      I2S_SOC_MAX_TX_FIFO_DEPTH, &thr, &headroom_ns) != status_success) {
+        return status_invalid_argument;
+    }
+    layout->tx_fifo_threshold = (uint8_t)thr;
+    layout->tx_headroom_ns = headroom_ns;
+
+    if (tdm_threshold(config, config->rx_enable, config->rx_slot_mask, layout->rx_line_rate, latency_ns,
+                      I2S_SOC_MAX_RX_FIFO_DEPTH, &thr, &headroom_ns) != status_success) {
+        return status_invalid_argument;
+    }
+    layout->rx_fifo_threshold = (uint8_t)(I2S_SOC_MAX_RX_FIFO_DEPTH - thr);
+    layout->rx_headroom_ns = headroom_ns;
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_tdm_init(I2S_Type *i2s, const i2s_multiline_tdm_config_t *config,
+                                  const i2s_multiline_tdm_layout_t *layout)
+{
+    i2s_config_t i2s_config;
+    i2s_multiline_transfer_config_t transfer;
+    uint32_t all = (1UL << config->slot_num) - 1U;
+
+    i2s_get_default_config(i2s, &i2s_config);
+    i2s_config.tx_fifo_threshold = layout->tx_fifo_threshold;
+    i2s_config.rx_fifo_threshold = layout->rx_fifo_threshold;
+    i2s_config.enable_mclk_out = config->master_mode;
+    i2s_init(i2s, &i2s_config);
+
+    i2s_get_default_multiline_transfer_config(&transfer);
+    transfer.sample_rate = config->sample_rate;
+    transfer.enable_tdm_mode = (config->slot_num > 2U);
+    transfer.channel_num_per_frame = config->slot_num;
+    transfer.audio_depth = config->audio_depth;
+    transfer.channel_length = layout->channel_length;
+    transfer.master_mode = config->master_mode;
+    transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;
+    for (uint8_t line = 0; line < config->line_num; line++) {
+        if (config->tx_enable) {
+            transfer.tx_data_line_en[line] = true;
+            transfer.tx_channel_slot_mask[line] = (config->tx_slot_mask[line] == 0U) ? all
+                                                                                     : (config->tx_slot_mask[line] & all);
+        }
+        if (config->rx_enable) {
+            transfer.rx_data_line_en[line] = true;
+            transfer.rx_channel_slot_mask[line] = (config->rx_slot_mask[line] == 0U) ? all
+                                                                                     : (config->rx_slot_mask[line] & all);
+        }
+    }
+
+    return i2s_config_multiline_transfer(i2s, config->mclk_hz, &transfer);
+}
+
+uint32_t i2s_multiline_tdm_period_frames(uint8_t line_num, uint8_t channel_per_line, uint32_t ring_bytes,
+                                         uint8_t period_num)
+{
+    uint32_t frame_bytes = line_num * channel_per_line * sizeof(uint32_t);
+
+    if ((frame_bytes == 0U) || (period_num == 0U)) {
+        return 0;
+    }
+    return (ring_bytes / period_num / frame_bytes) & ~1UL;
+}
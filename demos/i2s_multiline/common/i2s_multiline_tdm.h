@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_TDM_H
+#define I2S_MULTILINE_TDM_H
+
+/*
+ * I2S多数据线TDM配置接口
+ *
+ * 每条数据线每帧可有2、4、8或16个时隙，各时隙由掩码单独使能，
+ * 一个I2S实例4条数据线最多可传输64个通道。被屏蔽的时隙不占用FIFO和DMA缓冲区，
+ * 缓冲区中每帧只包含使能的时隙，因此各数据线使能的时隙数需相同。
+ *
+ * 根据采样率、时隙数和主时钟计算布局：
+ * - 时隙长度：优先32位，主时钟不足以分频出32位时隙的BCLK时(如16时隙)，16位音频改用16位时隙
+ * - 每条数据线的数据速率及对应的FIFO阈值：阈值触发后FIFO中的剩余数据(发送)或剩余空间(接收)
+ *   需能覆盖DMA响应请求的最长延迟，速率越高阈值越靠近FIFO两端。
+ *   burst引擎只按第0条数据线的FIFO请求DMA，各数据线掩码不同时一帧内的FIFO深度相差若干采样，
+ *   阈值同时保证领先的数据线有足够余量、落后的数据线不溢出，相差过大时不可行
+ * - 流式收发接口所需的channel_per_line，以及给定环形缓冲区大小下的周期帧数
+ */
+
+#include "hpm_common.h"
+#include "hpm_i2s_drv.h"
+
+#define I2S_MULTILINE_TDM_MAX_LINE              (4U)
+#define I2S_MULTILINE_TDM_MAX_SLOT              (16U)
+
+/* DMA响应请求的默认最长延迟(ns) */
+#define I2S_MULTILINE_TDM_DEFAULT_DMA_LATENCY_NS (2000U)
+
+typedef struct {
+    uint32_t mclk_hz;                                       /* I2S主时钟频率 */
+    uint32_t sample_rate;                                   /* 采样率(Hz) */
+    uint8_t line_num;                                       /* 使用的数据线数 */
+    uint8_t slot_num;                                       /* 每条数据线每帧的时隙数：2、4、8或16 */
+    uint8_t audio_depth;                                    /* 音频位深 (16/24/32 bits) */
+    bool master_mode;
+    bool tx_enable;                                         /* 使能发送数据线 */
+    bool rx_enable;                                         /* 使能接收数据线 */
+    uint32_t tx_slot_mask[I2S_MULTILINE_TDM_MAX_LINE];      /* 每条数据线使能的发送时隙，0表示全部时隙 */
+    uint32_t rx_slot_mask[I2S_MULTILINE_TDM_MAX_LINE];      /* 每条数据线使能的接收时隙，0表示全部时隙 */
+    uint32_t dma_latency_ns;                                /* DMA响应请求的最长延迟，0使用默认值 */
+} i2s_multiline_tdm_config_t;
+
+typedef struct {
+    uint8_t channel_length;                                 /* 时隙长度，i2s_channel_length_16_bits/32_bits */
+    uint8_t tx_channel_per_line;                            /* 每条数据线使能的发送时隙数 */
+    uint8_t rx_channel_per_line;                            /* 每条数据线使能的接收时隙数 */
+    uint8_t tx_fifo_threshold;
+    uint8_t rx_fifo_threshold;
+    uint32_t bclk_hz;
+    uint32_t tx_line_rate;                                  /* 每条数据线每秒发送的采样数 */
+    uint32_t rx_line_rate;                                  /* 每条数据线每秒接收的采样数 */
+    uint32_t tx_headroom_ns;                                /* 发送阈值触发后FIFO可支撑的时间 */
+    uint32_t rx_headroom_ns;                                /* 接收阈值触发后FIFO可容纳的时间 */
+} i2s_multiline_tdm_layout_t;
+
+/*
+ * 计算布局，时钟无法分频出所需BCLK、各数据线使能的时隙数不同或各数据线的时隙位置相差超过FIFO可容纳的范围时
+ * 返回status_invalid_argument
+ */
+hpm_stat_t i2s_multiline_tdm_get_layout(const i2s_multiline_tdm_config_t *config, i2s_multiline_tdm_layout_t *layout);
+
+/* 按布局初始化I2S，包括FIFO阈值、时隙长度、数据线和时隙掩码 */
+hpm_stat_t i2s_multiline_tdm_init(I2S_Type *i2s, const i2s_multiline_tdm_config_t *config,
+                                  const i2s_multiline_tdm_layout_t *layout);
+
+/*
+ * burst引擎下ring_bytes字节的环形缓冲区分为period_num个周期时，每个周期的帧数(偶数)，
+ * channel_per_line为layout中对应方向的值
+ */
+uint32_t i2s_multiline_tdm_period_frames(uint8_t line_num, uint8_t channel_per_line, uint32_t ring_bytes,
+                                         uint8_t period_num);
+
+#endif /* I2S_MULTILINE_TDM_H */
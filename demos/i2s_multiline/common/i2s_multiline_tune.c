@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_i2s_drv.h"
+#include "i2s_multiline_tune.h"
+
+#define TUNE_MAX_DMA_BURST  (8U)
+#define TUNE_MAX_LINE       (4U)
+#define TUNE_MAX_PERIOD     (8U)    /* 与I2S_MULTILINE_MAX_PERIOD一致 */
+
+static uint32_t tune_align_up(uint32_t frames)
+{
+    return (frames + I2S_MULTILINE_TUNE_PERIOD_ALIGN - 1U) / I2S_MULTILINE_TUNE_PERIOD_ALIGN * I2S_MULTILINE_TUNE_PERIOD_ALIGN;
+}
+
+static uint32_t tune_align_down(uint32_t frames)
+{
+    frames = frames / I2S_MULTILINE_TUNE_PERIOD_ALIGN * I2S_MULTILINE_TUNE_PERIOD_ALIGN;
+    return (frames == 0U) ? I2S_MULTILINE_TUNE_PERIOD_ALIGN : frames;
+}
+
+static uint32_t tune_load_permille(uint32_t irq_per_second, uint32_t isr_cycles, uint32_t cpu_hz)
+{
+    return (uint32_t)((uint64_t)irq_per_second * isr_cycles * 1000U / cpu_hz);
+}
+
+/* 中断引擎：取满足响应延迟的最小阈值，每次中断写入的采样数最多 */
+static void tune_compute_irq(i2s_multiline_tune_t *tune, uint32_t need, uint32_t budget)
+{
+    i2s_multiline_tune_config_t *cfg = &tune->config;
+    i2s_multiline_tune_point_t *p = &tune->point;
+    uint32_t line_rate = cfg->sample_rate * cfg->channel_per_line;
+    uint32_t base = (cfg->isr_cycles != 0U) ? cfg->isr_cycles : I2S_MULTILINE_TUNE_DEFAULT_IRQ_BASE_CYCLES;
+    uint32_t per_sample = (cfg->isr_sample_cycles != 0U) ? cfg->isr_sample_cycles
+                                                         : I2S_MULTILINE_TUNE_DEFAULT_IRQ_SAMPLE_CYCLES;
+    uint32_t thr = I2S_MULTILINE_TUNE_THRESHOLD(false, need, I2S_SOC_MAX_TX_FIFO_DEPTH);
+
+    p->fifo_threshold = (uint8_t)thr;
+    p->batch = (uint8_t)(I2S_SOC_MAX_TX_FIFO_DEPTH - thr);
+    p->period_num = 0;
+    p->period_frames = 0;
+    p->irq_per_second = line_rate / p->batch;
+    p->cpu_load_permille = tune_load_permille(p->irq_per_second, base + per_sample * p->batch * cfg->line_num,
+                                              cfg->cpu_hz);
+    p->latency_us = (uint32_t)((uint64_t)I2S_SOC_MAX_TX_FIFO_DEPTH * 1000000U / line_rate);
+    p->headroom_ns = I2S_MULTILINE_TUNE_HEADROOM_NS(thr, line_rate);
+    p->budget_met = (need <= thr) && (p->cpu_load_permille <= budget);
+}
+
+/* DMA引擎：至少保留半个FIFO的余量，周期按目标延迟或CPU预算选择 */
+static void tune_compute_dma(i2s_multiline_tune_t *tune, uint32_t need, uint32_t budget)
+{
+    i2s_multiline_tune_config_t *cfg = &tune->config;
+    i2s_multiline_tune_point_t *p = &tune->point;
+    uint32_t line_rate = cfg->sample_rate * cfg->channel_per_line;
+    uint32_t isr = (cfg->isr_cycles != 0U) ? cfg->isr_cycles : I2S_MULTILINE_TUNE_DEFAULT_DMA_ISR_CYCLES;
+    uint32_t thr = I2S_MULTILINE_TUNE_THRESHOLD(true, need, I2S_SOC_MAX_TX_FIFO_DEPTH);
+    uint32_t space;
+    uint32_t floor_frames;
+    uint32_t budget_frames;
+    uint32_t frames;
+    uint8_t burst;
+
+    p->fifo_threshold = (uint8_t)thr;
+
+    /* 请求时FIFO至少有 深度 - 阈值 个空位，burst不能超过该值 */
+    if (cfg->engine == i2s_multiline_tune_burst_dma) {
+        p->batch = cfg->line_num;
+    } else {
+        space = I2S_SOC_MAX_TX_FIFO_DEPTH - thr;
+        burst = 1;
+        while (((uint32_t)burst * 2U <= space) && (burst * 2U <= TUNE_MAX_DMA_BURST)) {
+            burst *= 2U;
+        }
+        p->batch = burst;
+    }
+
+    /* 每个周期有半周期和整周期两次中断 */
+    p->period_num = (cfg->period_num != 0U) ? cfg->period_num : I2S_MULTILINE_TUNE_DEFAULT_PERIOD_NUM;
+    floor_frames = tune_align_up((tune->min_period_frames > I2S_MULTILINE_TUNE_MIN_PERIOD_FRAMES)
+                                 ? tune->min_period_frames : I2S_MULTILINE_TUNE_MIN_PERIOD_FRAMES);
+    if (cfg->target_latency_us != 0U) {
+        frames = tune_align_down((uint32_t)((uint64_t)cfg->target_latency_us * cfg->sample_rate / 1000000U / p->period_num));
+        if (frames < floor_frames) {
+            frames = floor_frames;
+        }
+    } else {
+        budget_frames = (uint32_t)(((uint64_t)2U * cfg->sample_rate * isr * 1000U + (uint64_t)budget * cfg->cpu_hz - 1U) /
+                                   ((uint64_t)budget * cfg->cpu_hz));
+        frames = tune_align_up((budget_frames > floor_frames) ? budget_frames : floor_frames);
+    }
+    if ((cfg->max_ring_frames != 0U) && (frames * p->period_num > cfg->max_ring_frames)) {
+        frames = tune_align_down(cfg->max_ring_frames / p->period_num);
+    }
+
+    p->period_frames = frames;
+    p->irq_per_second = 2U * cfg->sample_rate / frames;
+    p->cpu_load_permille = tune_load_permille(p->irq_per_second, isr, cfg->cpu_hz);
+    p->latency_us = (uint32_t)((uint64_t)p->period_num * frames * 1000000U / cfg->sample_rate);
+    p->headroom_ns = I2S_MULTILINE_TUNE_HEADROOM_NS(thr, line_rate);
+    p->budget_met = (need <= thr) && (p->cpu_load_permille <= budget) && (frames >= tune->min_period_frames) &&
+                    ((cfg->target_latency_us == 0U) || (p->latency_us <= cfg->target_latency_us));
+}
+
+static void tune_compute(i2s_multiline_tune_t *tune)
+{
+    i2s_multiline_tune_config_t *cfg = &tune->config;
+    uint32_t budget = (cfg->cpu_budget_permille != 0U) ? cfg->cpu_budget_permille
+                                                        : I2S_MULTILINE_TUNE_DEFAULT_CPU_BUDGET_PERMILLE;
+    uint32_t need = I2S_MULTILINE_TUNE_NEED_SAMPLES(cfg->sample_rate * cfg->channel_per_line, tune->latency_ns);
+
+    if (cfg->engine == i2s_multiline_tune_irq) {
+        tune_compute_irq(tune, need, budget);
+    } else {
+        tune_compute_dma(tune, need, budget);
+    }
+}
+
+hpm_stat_t i2s_multiline_tune_init(i2s_multiline_tune_t *tune, const i2s_multiline_tune_config_t *config)
+{
+    if ((config->cpu_hz == 0U) || (config->sample_rate == 0U) || (config->channel_per_line == 0U) ||
+        (config->line_num == 0U) || (config->line_num > TUNE_MAX_LINE) ||
+        ((config->engine == i2s_multiline_tune_burst_dma) && (config->line_num == 3U)) ||
+        ((config->period_num != 0U) && ((config->period_num < 2U) || (config->period_num > TUNE_MAX_PERIOD)))) {
+        return status_invalid_argument;
+    }
+
+    memset(tune, 0, sizeof(*tune));
+    tune->config = *config;
+    tune->latency_ns = (config->latency_ns != 0U) ? config->latency_ns : I2S_MULTILINE_TUNE_DEFAULT_LATENCY_NS;
+    tune_compute(tune);
+    return status_success;
+}
+
+bool i2s_multiline_tune_update(i2s_multiline_tune_t *tune, uint32_t underflow_count, uint32_t underrun_count)
+{
+    i2s_multiline_tune_point_t old = tune->point;
+
+    if (underflow_count != tune->underflow_count) {
+        tune->underflow_count = underflow_count;
+        tune->latency_ns = (tune->latency_ns * 2U > I2S_MULTILINE_TUNE_MAX_LATENCY_NS) ? I2S_MULTILINE_TUNE_MAX_LATENCY_NS
+                                                                                      : tune->latency_ns * 2U;
+    }
+    if (underrun_count != tune->underrun_count) {
+        tune->underrun_count = underrun_count;
+        if (tune->config.engine != i2s_multiline_tune_irq) {
+            tune->min_period_frames = old.period_frames * 2U;
+        }
+    }
+    tune_compute(tune);
+
+    if ((old.fifo_threshold == tune->point.fifo_threshold) && (old.batch == tune->point.batch) &&
+        (old.period_frames == tune->point.period_frames)) {
+        return false;
+    }
+    tune->backoff_count++;
+    return true;
+}
+
+const i2s_multiline_tune_point_t *i2s_multiline_tune_get_point(i2s_multiline_tune_t *tune)
+{
+    return &tune->point;
+}
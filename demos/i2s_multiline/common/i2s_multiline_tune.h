@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_TUNE_H
+#define I2S_MULTILINE_TUNE_H
+
+/*
+ * I2S多数据线发送参数整定
+ *
+ * 根据采样率、每条数据线的时隙数以及目标延迟或CPU预算，计算FIFO阈值、DMA burst长度和周期帧数：
+ * - FIFO阈值：阈值触发后FIFO中的剩余采样需能覆盖中断或DMA响应的最长延迟。
+ *   中断引擎每次中断写入 FIFO深度 - 阈值 个采样，因此取满足延迟的最小阈值，使中断次数最少；
+ *   DMA引擎至少保留半个FIFO的余量，速率升高后阈值随之升高
+ * - DMA burst长度：per_line引擎取不超过 FIFO深度 - 阈值 的最大2的幂(最大8)，减少总线请求次数；
+ *   burst引擎固定为数据线数
+ * - 周期帧数：DMA引擎每个周期有半周期和整周期两次中断。设置了目标延迟时取延迟内最长的周期，
+ *   CPU占用最低；否则取满足CPU预算的最短周期，延迟最低
+ *
+ * 中断耗时按配置的周期数估计，可用引擎实测的平均值代替默认值。
+ * 工作点中的budget_met表示阈值能覆盖响应延迟，且CPU预算和目标延迟都能满足；
+ * 不满足时仍给出最接近的工作点，由应用决定是否改用其他引擎。
+ *
+ * 运行时自动整定：应用周期性地传入引擎统计的累计下溢和欠载次数，
+ * - FIFO下溢说明响应延迟超过了估计值，估计值加倍后重新计算，阈值随之升高
+ * - 欠载(生产者或中断来不及在半周期内完成)时周期帧数加倍
+ * 工作点改变时返回true，应用按新的工作点重新配置I2S和引擎。
+ */
+
+#include "hpm_common.h"
+
+/* 中断或DMA响应请求的默认最长延迟(ns) */
+#define I2S_MULTILINE_TUNE_DEFAULT_LATENCY_NS           (2000U)
+/* 默认CPU预算(千分比) */
+#define I2S_MULTILINE_TUNE_DEFAULT_CPU_BUDGET_PERMILLE  (100U)
+/* 中断引擎每次中断的固定开销及每写入一个采样的开销(CPU周期) */
+#define I2S_MULTILINE_TUNE_DEFAULT_IRQ_BASE_CYCLES      (150U)
+#define I2S_MULTILINE_TUNE_DEFAULT_IRQ_SAMPLE_CYCLES    (4U)
+/* DMA引擎每次周期中断的开销(CPU周期) */
+#define I2S_MULTILINE_TUNE_DEFAULT_DMA_ISR_CYCLES       (400U)
+#define I2S_MULTILINE_TUNE_DEFAULT_PERIOD_NUM           (4U)
+/* 周期帧数的下限及对齐，对齐保证周期内的采样数是任意burst长度的整数倍 */
+#define I2S_MULTILINE_TUNE_MIN_PERIOD_FRAMES            (32U)
+#define I2S_MULTILINE_TUNE_PERIOD_ALIGN                 (8U)
+/* 自动整定时响应延迟估计值的上限(ns) */
+#define I2S_MULTILINE_TUNE_MAX_LATENCY_NS               (100000U)
+
+/*
+ * 阈值规则，本模块、i2s_multiline_tdm和i2s_multiline_cfg.h的编译期配置共用，参数为常量时可用于常量表达式。
+ * line_rate为每条数据线每秒的采样数；need为阈值触发后需覆盖响应延迟的采样数，另加正在移出的一个采样
+ */
+#define I2S_MULTILINE_TUNE_NEED_SAMPLES(line_rate, latency_ns) \
+    ((uint32_t)((((uint64_t)(line_rate) * (latency_ns) + 999999999ULL) / 1000000000ULL) + 1U))
+
+/* 中断引擎取满足延迟的最小阈值，DMA引擎至少保留半个FIFO，均不超过 FIFO深度 - 1 */
+#define I2S_MULTILINE_TUNE_THRESHOLD(dma, need, fifo_depth)                                              \
+    (((dma) && ((need) < (fifo_depth) / 2U)) ? ((fifo_depth) / 2U)                                       \
+        : ((need) > (fifo_depth) - 1U) ? ((fifo_depth) - 1U) : (need))
+
+/* 阈值触发后FIFO中的samples个采样可支撑的时间(ns) */
+#define I2S_MULTILINE_TUNE_HEADROOM_NS(samples, line_rate) \
+    (((line_rate) == 0U) ? 0U : (uint32_t)((uint64_t)(samples) * 1000000000U / (line_rate)))
+
+typedef enum {
+    i2s_multiline_tune_irq = 0,                     /* 中断引擎 */
+    i2s_multiline_tune_per_line_dma,                /* 流式发送per_line引擎 */
+    i2s_multiline_tune_burst_dma,                   /* 流式发送burst引擎 */
+} i2s_multiline_tune_engine_t;
+
+typedef struct {
+    i2s_multiline_tune_engine_t engine;
+    uint32_t cpu_hz;                                /* CPU频率，用于换算CPU占用率 */
+    uint32_t sample_rate;                           /* 采样率(Hz) */
+    uint8_t line_num;                               /* 使用的数据线数 */
+    uint8_t channel_per_line;                       /* 每条数据线每帧的时隙数 */
+    uint8_t period_num;                             /* DMA引擎的周期数，0使用默认值 */
+    uint32_t target_latency_us;                     /* DMA引擎环形缓冲区的目标延迟，0表示按CPU预算选择 */
+    uint32_t max_ring_frames;                       /* 环形缓冲区可容纳的帧数，0表示不限制 */
+    uint16_t cpu_budget_permille;                   /* 发送占用CPU的上限(千分比)，0使用默认值 */
+    uint32_t latency_ns;                            /* 中断或DMA响应的最长延迟，0使用默认值 */
+    uint32_t isr_cycles;                            /* 每次中断的固定开销，0使用默认值 */
+    uint32_t isr_sample_cycles;                     /* 中断引擎每写入一个采样的开销，0使用默认值 */
+} i2s_multiline_tune_config_t;
+
+/* 工作点 */
+typedef struct {
+    uint8_t fifo_threshold;                         /* I2S发送FIFO阈值 */
+    uint8_t batch;                                  /* 每次请求每条数据线写入的采样数：中断引擎为每次中断，DMA引擎为burst长度 */
+    uint8_t period_num;                             /* DMA引擎的周期数，中断引擎为0 */
+    uint32_t period_frames;                         /* DMA引擎的周期帧数，中断引擎为0 */
+    uint32_t irq_per_second;                        /* 每秒中断次数 */
+    uint32_t cpu_load_permille;                     /* 估计的CPU占用率(千分比) */
+    uint32_t latency_us;                            /* 缓冲延迟：DMA引擎为整个环，中断引擎为FIFO */
+    uint32_t headroom_ns;                           /* 阈值触发后FIFO可支撑的时间 */
+    bool budget_met;                                /* 响应延迟、CPU预算和目标延迟都能满足 */
+} i2s_multiline_tune_point_t;
+
+typedef struct {
+    i2s_multiline_tune_config_t config;
+    i2s_multiline_tune_point_t point;
+    uint32_t latency_ns;                            /* 当前使用的响应延迟估计值 */
+    uint32_t min_period_frames;                     /* 欠载退让后的最短周期帧数 */
+    uint32_t underflow_count;                       /* 上次整定时的累计下溢次数 */
+    uint32_t underrun_count;                        /* 上次整定时的累计欠载次数 */
+    uint32_t backoff_count;                         /* 工作点因退让改变的次数 */
+} i2s_multiline_tune_t;
+
+/* 计算初始工作点，参数无效时返回status_invalid_argument */
+hpm_stat_t i2s_multiline_tune_init(i2s_multiline_tune_t *tune, const i2s_multiline_tune_config_t *config);
+
+/*
+ * 运行时自动整定，underflow_count和underrun_count为引擎统计的累计值(中断引擎没有欠载，传入0)，
+ * 工作点改变时返回true
+ */
+bool i2s_multiline_tune_update(i2s_multiline_tune_t *tune, uint32_t underflow_count, uint32_t underrun_count);
+
+/* 当前工作点 */
+const i2s_multiline_tune_point_t *i2s_multiline_tune_get_point(i2s_multiline_tune_t *tune);
+
+#endif /* I2S_MULTILINE_TUNE_H */
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "i2s_multiline_xcore.h"
+
+/* 读取对端写入的line前丢弃本核的旧副本 */
+static inline void xcore_fetch(const i2s_multiline_xcore_end_t *end, volatile void *addr, uint32_t size)
+{
+    if (end->cached) {
+        l1c_dc_invalidate((uint32_t)addr, size);
+    }
+}
+
+/* 本端写入的line在对端读取之前推到存储器 */
+static inline void xcore_flush(const i2s_multiline_xcore_end_t *end, volatile void *addr, uint32_t size)
+{
+    __sync_synchronize();
+    if (end->cached) {
+        l1c_dc_writeback((uint32_t)addr, size);
+        __sync_synchronize();
+    }
+}
+
+static inline uint8_t *xcore_slot(const i2s_multiline_xcore_end_t *end)
+{
+    return end->buffer + (end->index % end->slot_num) * end->slot_bytes;
+}
+
+hpm_stat_t i2s_multiline_xcore_ring_init(i2s_multiline_xcore_ring_t *ring, uint32_t buffer_sys_addr,
+                                         uint32_t slot_num, uint32_t slot_bytes)
+{
+    if ((slot_num < 2U) || (slot_num > I2S_MULTILINE_XCORE_MAX_SLOT) || (slot_bytes == 0U) ||
+        ((slot_bytes % I2S_MULTILINE_XCORE_LINE_SIZE) != 0U) ||
+        ((buffer_sys_addr % I2S_MULTILINE_XCORE_LINE_SIZE) != 0U)) {
+        return status_invalid_argument;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->layout.slot_num = slot_num;
+    ring->layout.slot_bytes = slot_bytes;
+    ring->layout.buffer = buffer_sys_addr;
+    /* 布局写完后再写魔数，对端看到魔数即可使用布局 */
+    __sync_synchronize();
+    ring->layout.magic = I2S_MULTILINE_XCORE_MAGIC;
+    __sync_synchronize();
+    return status_success;
+}
+
+static hpm_stat_t xcore_attach(i2s_multiline_xcore_end_t *end, i2s_multiline_xcore_ring_t *ring, void *buffer,
+                               bool cached)
+{
+    memset(end, 0, sizeof(*end));
+    end->ring = ring;
+    end->buffer = (uint8_t *)buffer;
+    end->cached = cached;
+
+    xcore_fetch(end, &ring->layout, sizeof(ring->layout));
+    if (ring->layout.magic != I2S_MULTILINE_XCORE_MAGIC) {
+        return status_fail;
+    }
+    __sync_synchronize();
+    end->slot_num = ring->layout.slot_num;
+    end->slot_bytes = ring->layout.slot_bytes;
+    if (buffer == NULL) {
+        end->buffer = (uint8_t *)ring->layout.buffer;
+    }
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_xcore_attach_producer(i2s_multiline_xcore_end_t *end, i2s_multiline_xcore_ring_t *ring,
+                                               void *buffer, bool cached)
+{
+    hpm_stat_t stat = xcore_attach(end, ring, buffer, cached);
+
+    if (stat != status_success) {
+        return stat;
+    }
+    xcore_fetch(end, &ring->consumer, sizeof(ring->consumer));
+    xcore_fetch(end, &ring->producer, sizeof(ring->producer));
+    end->peer_index = ring->consumer.tail;
+    end->index = ring->producer.head;
+    end->producer = true;
+    ring->producer.attached = I2S_MULTILINE_XCORE_MAGIC;
+    xcore_flush(end, &ring->producer, sizeof(ring->producer));
+    return status_success;
+}
+
+hpm_stat_t i2s_multiline_xcore_attach_consumer(i2s_multiline_xcore_end_t *end, i2s_multiline_xcore_ring_t *ring,
+                                               void *buffer, bool cached)
+{
+    hpm_stat_t stat = xcore_attach(end, ring, buffer, cached);
+
+    if (stat != status_success) {
+        return stat;
+    }
+    xcore_fetch(end, &ring->producer, sizeof(ring->producer));
+    xcore_fetch(end, &ring->consumer, sizeof(ring->consumer));
+    end->peer_index = ring->producer.head;
+    end->index = ring->consumer.tail;
+    return status_success;
+}
+
+bool i2s_multiline_xcore_producer_attached(i2s_multiline_xcore_end_t *end)
+{
+    xcore_fetch(end, &end->ring->producer, sizeof(end->ring->producer));
+    return end->ring->producer.attached == I2S_MULTILINE_XCORE_MAGIC;
+}
+
+void *i2s_multiline_xcore_acquire(i2s_multiline_xcore_end_t *end)
+{
+    /* 缓存的tail仍显示有空槽时不访问共享的line */
+    if ((end->index - end->peer_index) >= end->slot_num) {
+        xcore_fetch(end, &end->ring->consumer, sizeof(end->ring->consumer));
+        end->peer_index = end->ring->consumer.tail;
+        if ((end->index - end->peer_index) >= end->slot_num) {
+            end->stall_count++;
+            return NULL;
+        }
+        /* tail之后才能覆盖消费者已读完的槽 */
+        __sync_synchronize();
+    }
+    return xcore_slot(end);
+}
+
+void i2s_multiline_xcore_set_work_cycles(i2s_multiline_xcore_end_t *end, uint32_t cycles)
+{
+    i2s_multiline_xcore_ring_t *ring = end->ring;
+
+    ring->producer.work_cycles_last = cycles;
+    if (cycles > ring->producer.work_cycles_max) {
+        ring->producer.work_cycles_max = cycles;
+    }
+}
+
+void i2s_multiline_xcore_publish(i2s_multiline_xcore_end_t *end)
+{
+    i2s_multiline_xcore_ring_t *ring = end->ring;
+
+    /* 先让槽中的数据到达存储器，再移动head */
+    xcore_flush(end, xcore_slot(end), end->slot_bytes);
+    end->index++;
+    ring->producer.head = end->index;
+    xcore_flush(end, &ring->producer, sizeof(ring->producer));
+}
+
+const void *i2s_multiline_xcore_peek(i2s_multiline_xcore_end_t *end)
+{
+    uint8_t *slot;
+
+    if (end->index == end->peer_index) {
+        xcore_fetch(end, &end->ring->producer, sizeof(end->ring->producer));
+        end->peer_index = end->ring->producer.head;
+        if (end->index == end->peer_index) {
+            end->stall_count++;
+            return NULL;
+        }
+        __sync_synchronize();
+    }
+    slot = xcore_slot(end);
+    xcore_fetch(end, slot, end->slot_bytes);
+    return slot;
+}
+
+void i2s_multiline_xcore_release(i2s_multiline_xcore_end_t *end)
+{
+    i2s_multiline_xcore_ring_t *ring = end->ring;
+
+    /* 槽读完之后才交还，生产者看到tail后即可覆盖 */
+    __sync_synchronize();
+    end->index++;
+    ring->consumer.tail = end->index;
+    xcore_flush(end, &ring->consumer, sizeof(ring->consumer));
+}
+
+uint32_t i2s_multiline_xcore_get_filled(i2s_multiline_xcore_end_t *end)
+{
+    i2s_multiline_xcore_ring_t *ring = end->ring;
+
+    /* 只失效对端的line，本端的line可能还有未发布的修改 */
+    if (end->producer) {
+        xcore_fetch(end, &ring->consumer, sizeof(ring->consumer));
+        end->peer_index = ring->consumer.tail;
+        return end->index - end->peer_index;
+    }
+    xcore_fetch(end, &ring->producer, sizeof(ring->producer));
+    end->peer_index = ring->producer.head;
+    return end->peer_index - end->index;
+}
+
+void i2s_multiline_xcore_get_work_cycles(i2s_multiline_xcore_end_t *end, uint32_t *last, uint32_t *max)
+{
+    xcore_fetch(end, &end->ring->producer, sizeof(end->ring->producer));
+    *last = end->ring->producer.work_cycles_last;
+    *max = end->ring->producer.work_cycles_max;
+}
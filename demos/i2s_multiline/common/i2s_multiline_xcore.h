@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef I2S_MULTILINE_XCORE_H
+#define I2S_MULTILINE_XCORE_H
+
+/*
+ * 跨核周期环
+ *
+ * 两个核之间的单生产者单消费者环：生产者核(如核1)运行DSP处理并填充DMA周期缓冲区，
+ * 消费者核(如核0)拥有I2S/DMA，取出周期写入i2s_multiline_stream。所有接口都是无等待的：
+ * 每次调用只做常数次访问，环满或环空时立即返回NULL，由调用者决定睡眠还是轮询。
+ *
+ * 控制块按cache line划分，每个line只由一端写入：head和生产者统计由生产者写，tail由消费者写，
+ * 布局(槽数、槽大小、缓冲区地址)在初始化时写入之后只读，两端互不写同一个line，无需加锁。
+ * 发布顺序为：写数据 -> (回写) -> 屏障 -> 写索引 -> (回写)，对端先读索引、屏障后再读数据。
+ *
+ * 控制块和周期缓冲区放在两个核都能访问的存储器中。以可缓存方式访问的一端在attach时置cached，
+ * 接口对其访问的line做显式维护：写完后回写，读对端的line前失效；以非缓存方式访问的一端不做维护。
+ * 通常DMA所在的核把环放在自己的非缓存区并调用ring_init，另一个核以可缓存方式访问。
+ *
+ * 通知方式由应用决定，例如发布或释放后写邮箱唤醒对端，接口本身不依赖邮箱外设。
+ */
+
+#include "hpm_common.h"
+#include "hpm_l1c_drv.h"
+
+#define I2S_MULTILINE_XCORE_LINE_SIZE   HPM_L1C_CACHELINE_SIZE
+#define I2S_MULTILINE_XCORE_MAX_SLOT    (8U)
+#define I2S_MULTILINE_XCORE_MAGIC       (0x58434F52UL)
+
+/* 控制块，放置在两个核共享的存储器中 */
+typedef struct {
+    /* 只由生产者写 */
+    struct {
+        volatile uint32_t head;                 /* 已发布的周期数 */
+        volatile uint32_t attached;             /* 生产者attach后为I2S_MULTILINE_XCORE_MAGIC */
+        volatile uint32_t work_cycles_last;     /* 生产者最近一个周期的处理耗时(生产者核周期) */
+        volatile uint32_t work_cycles_max;
+    } ATTR_ALIGN(I2S_MULTILINE_XCORE_LINE_SIZE) producer;
+    /* 只由消费者写 */
+    struct {
+        volatile uint32_t tail;                 /* 已释放的周期数 */
+    } ATTR_ALIGN(I2S_MULTILINE_XCORE_LINE_SIZE) consumer;
+    /* ring_init写入，之后只读 */
+    struct {
+        uint32_t magic;
+        uint32_t slot_num;
+        uint32_t slot_bytes;
+        uint32_t buffer;                        /* 周期缓冲区的系统地址 */
+    } ATTR_ALIGN(I2S_MULTILINE_XCORE_LINE_SIZE) layout;
+} i2s_multiline_xcore_ring_t;
+
+/* 一端的本地状态，放置在本核的存储器中 */
+typedef struct {
+    i2s_multiline_xcore_ring_t *ring;
+    uint8_t *buffer;                            /* 本核访问周期缓冲区的地址 */
+    uint32_t slot_num;
+    uint32_t slot_bytes;
+    uint32_t index;                             /* 本端索引：生产者为head，消费者为tail */
+    uint32_t peer_index;                        /* 最近一次读到的对端索引 */
+    bool cached;                                /* 本核以可缓存方式访问环和缓冲区 */
+    bool producer;                              /* 本端为生产者 */
+    uint32_t stall_count;                       /* 生产者遇到环满或消费者遇到环空的次数 */
+} i2s_multiline_xcore_end_t;
+
+/* 周期缓冲区大小(字节) */
+#define I2S_MULTILINE_XCORE_BUF_SIZE(slot_num, slot_bytes)  ((slot_num) * (slot_bytes))
+
+/*
+ * 初始化控制块，由以非缓存方式访问环的一端在对端attach之前调用。
+ * buffer_sys_addr为周期缓冲区的系统地址，需按cache line对齐；slot_bytes需为cache line的整数倍
+ */
+hpm_stat_t i2s_multiline_xcore_ring_init(i2s_multiline_xcore_ring_t *ring, uint32_t buffer_sys_addr,
+                                         uint32_t slot_num, uint32_t slot_bytes);
+
+/*
+ * 连接到已初始化的环，控制块未初始化时返回status_fail。
+ * buffer为本核访问周期缓冲区的地址，为NULL时使用控制块中的系统地址
+ */
+hpm_stat_t i2s_multiline_xcore_attach_producer(i2s_multiline_xcore_end_t *end, i2s_multiline_xcore_ring_t *ring,
+                                               void *buffer, bool cached);
+hpm_stat_t i2s_multiline_xcore_attach_consumer(i2s_multiline_xcore_end_t *end, i2s_multiline_xcore_ring_t *ring,
+                                               void *buffer, bool cached);
+
+/* 消费者查询生产者是否已attach */
+bool i2s_multiline_xcore_producer_attached(i2s_multiline_xcore_end_t *end);
+
+/* 生产者：获取下一个空闲槽，环满返回NULL。槽需整体写入后调用publish */
+void *i2s_multiline_xcore_acquire(i2s_multiline_xcore_end_t *end);
+/* 生产者：记录本周期的处理耗时，随下一次publish一起发布 */
+void i2s_multiline_xcore_set_work_cycles(i2s_multiline_xcore_end_t *end, uint32_t cycles);
+void i2s_multiline_xcore_publish(i2s_multiline_xcore_end_t *end);
+
+/* 消费者：获取最早发布的槽，环空返回NULL。使用完后调用release交还生产者 */
+const void *i2s_multiline_xcore_peek(i2s_multiline_xcore_end_t *end);
+void i2s_multiline_xcore_release(i2s_multiline_xcore_end_t *end);
+
+/* 已发布但尚未释放的槽数 */
+uint32_t i2s_multiline_xcore_get_filled(i2s_multiline_xcore_end_t *end);
+
+/* 消费者读取生产者发布的处理耗时 */
+void i2s_multiline_xcore_get_work_cycles(i2s_multiline_xcore_end_t *end, uint32_t *last, uint32_t *max);
+
+#endif /* I2S_MULTILINE_XCORE_H */
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "host_line_check.h"
+
+void host_line_check_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data)
+{
+    host_line_check_t *check = (host_line_check_t *)user_data;
+    uint32_t *prev = &check->prev[line][slot];
+
+    (void)i2s;
+    check->words[line]++;
+    if (word == 0U) {
+        check->silent[line]++;
+        return;
+    }
+    if (!check->valid(line, slot, word)) {
+        check->invalid[line]++;
+        return;
+    }
+    if ((*prev != 0U) && !check->follows(*prev, word)) {
+        check->breaks[line]++;
+    }
+    *prev = word;
+}
+
+int host_line_check_report(const host_line_check_t *check, FILE *fp)
+{
+    int fails = 0;
+
+    for (uint8_t line = 0; line < I2S_SOC_MAX_LINE_NUM; line++) {
+        if (check->words[line] == 0U) {
+            continue;
+        }
+        fprintf(fp, "check line%u: %llu words, %llu silent, %llu invalid, %llu discontinuities\n", line,
+                (unsigned long long)check->words[line], (unsigned long long)check->silent[line],
+                (unsigned long long)check->invalid[line], (unsigned long long)check->breaks[line]);
+        if ((check->invalid[line] != 0U) || (check->silent[line] == check->words[line])) {
+            fails++;
+        }
+    }
+    return fails;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HOST_LINE_CHECK_H
+#define HOST_LINE_CHECK_H
+
+/*
+ * 数据线输出检查
+ *
+ * 作为I2S发送sink，逐字检查示例的测试数据：非零字须符合valid(数据线和时隙对应的声道)，
+ * 同一时隙相邻的两个非零字须符合follows(源数据连续)。零为启动或恢复时的静音。
+ * 不连续的次数写入报告但不计为失败，下溢和重新启动都会造成不连续，由golden比较其次数。
+ */
+
+#include "host_model.h"
+
+typedef struct {
+    bool (*valid)(uint8_t line, uint8_t slot, uint32_t word);
+    bool (*follows)(uint32_t prev, uint32_t word);
+    uint64_t words[I2S_SOC_MAX_LINE_NUM];
+    uint64_t silent[I2S_SOC_MAX_LINE_NUM];
+    uint64_t invalid[I2S_SOC_MAX_LINE_NUM];
+    uint64_t breaks[I2S_SOC_MAX_LINE_NUM];
+    uint32_t prev[I2S_SOC_MAX_LINE_NUM][I2S_SOC_MAX_CHANNEL_NUM];
+} host_line_check_t;
+
+/* 作为host_i2s_set_tx_sink的sink，user_data为host_line_check_t */
+void host_line_check_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data);
+
+/* 写入各数据线的检查结果，返回失败数 */
+int host_line_check_report(const host_line_check_t *check, FILE *fp);
+
+#endif /* HOST_LINE_CHECK_H */
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _HPM_BOARD_H
+#define _HPM_BOARD_H
+
+/*
+ * 主机模型的板级接口：时钟固定，板级初始化为空操作，中断由模型按优先级之外的顺序(中断号从小到大)响应
+ */
+
+#include <stdio.h>
+#include "hpm_common.h"
+#include "hpm_soc.h"
+#include "hpm_clock_drv.h"
+#include "hpm_interrupt.h"
+
+#define BOARD_APP_DMAMUX            HPM_DMAMUX
+#define BOARD_APP_HDMA              HPM_HDMA
+#define BOARD_APP_XDMA              HPM_XDMA
+#define BOARD_APP_HDMA_IRQ          IRQn_HDMA
+#define BOARD_APP_XDMA_IRQ          IRQn_XDMA
+#define BOARD_APP_SPI_BASE          HPM_SPI1
+#define BOARD_APP_SPI_RX_DMA        HPM_DMA_SRC_SPI1_RX
+#define BOARD_APP_SPI_TX_DMA        HPM_DMA_SRC_SPI1_TX
+
+void board_init(void);
+void board_delay_ms(uint32_t ms);
+void board_delay_us(uint32_t us);
+uint32_t board_config_i2s_clock(I2S_Type *ptr, uint32_t sample_rate);
+void board_init_i2s_pins(I2S_Type *ptr);
+uint32_t board_init_spi_clock(SPI_Type *ptr);
+
+#endif /* _HPM_BOARD_H */
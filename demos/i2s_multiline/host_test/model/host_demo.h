@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HOST_DEMO_H
+#define HOST_DEMO_H
+
+/*
+ * 编译示例源文件时强制包含：示例的空闲循环__asm("nop")改为等待下一个外设事件
+ */
+
+#include "host_model.h"
+
+#define __asm(x) host_cpu_idle()
+
+#endif /* HOST_DEMO_H */
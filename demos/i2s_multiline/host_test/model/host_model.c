@@ -0,0 +1,1827 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+/* 模型维护只读寄存器(深度、CHEN等)的值 */
+#define __R volatile
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_mchtmr_drv.h"
+#include "hpm_csr_drv.h"
+#include "host_model.h"
+
+/*
+ * 外设窗口：同一块共享内存映射两次，固定地址处只读供示例访问，另一处可写供模型维护寄存器。
+ * 示例写寄存器时触发SIGSEGV，由信号处理函数按x86-64存储指令解码出写入值和长度，交给外设模型后跳过该指令
+ */
+#define HOST_WINDOW_BASE        (0xF0000000UL)
+#define HOST_WINDOW_SIZE        (0x20000UL)
+#define HOST_I2S_NUM            (4U)
+#define HOST_I2S_STRIDE         (0x1000UL)
+#define HOST_DMA_NUM            (2U)
+#define HOST_IRQ_NUM            (64U)
+#define HOST_FIRST_WORDS        (8U)
+
+/* CPU各操作消耗的周期数 */
+#define HOST_CALL_CYCLES        (10U)       /* 函数入口或出口 */
+#define HOST_STORE_CYCLES       (4U)        /* 写外设寄存器 */
+#define HOST_DRV_CYCLES         (20U)       /* 驱动接口调用 */
+#define HOST_CSR_CYCLES         (4U)        /* 读周期计数器 */
+#define HOST_IRQ_CYCLES         (40U)       /* 中断进入和退出 */
+
+/* 一次外设事件中DMA最多执行的burst数，超过说明请求无法撤销 */
+#define HOST_DMA_RUNAWAY        (4096U)
+
+/* 模型内部的DMA通道控制字，描述符中的ctrl与之相同 */
+#define HOST_DMA_CTRL_EN                (1UL << 0)
+#define HOST_DMA_CTRL_INTMASK_SHIFT     (1U)
+#define HOST_DMA_CTRL_SRCMODE           (1UL << 5)
+#define HOST_DMA_CTRL_DSTMODE           (1UL << 6)
+#define HOST_DMA_CTRL_SRCADDRCTRL_SHIFT (8U)
+#define HOST_DMA_CTRL_DSTADDRCTRL_SHIFT (10U)
+#define HOST_DMA_CTRL_SRCWIDTH_SHIFT    (12U)
+#define HOST_DMA_CTRL_DSTWIDTH_SHIFT    (15U)
+#define HOST_DMA_CTRL_BURST_SHIFT       (18U)
+#define HOST_DMA_CTRL_SRC_FIXED_BURST   (1UL << 22)
+#define HOST_DMA_CTRL_DST_FIXED_BURST   (1UL << 23)
+
+#define HOST_ALIAS(addr)        ((void *)(host_alias + ((uintptr_t)(addr) - HOST_WINDOW_BASE)))
+
+typedef enum {
+    host_end_none = 0,
+    host_end_idle,
+    host_end_return,
+    host_end_timeout,
+} host_end_t;
+
+typedef struct {
+    uint32_t data[I2S_SOC_MAX_TX_FIFO_DEPTH];
+    uint8_t head;
+    uint8_t count;
+} host_fifo_t;
+
+typedef struct {
+    uint64_t words;
+    uint32_t crc;
+    uint32_t first[HOST_FIRST_WORDS];
+    uint64_t underflow;
+    uint64_t overflow;
+} host_line_stats_t;
+
+typedef struct {
+    I2S_Type *regs;                 /* 可写的寄存器别名 */
+    host_fifo_t tx[I2S_SOC_MAX_LINE_NUM];
+    host_fifo_t rx[I2S_SOC_MAX_LINE_NUM];
+    uint8_t tx_threshold;
+    uint8_t rx_threshold;
+    uint32_t irq_enable;
+    uint32_t mclk_hz;
+    uint32_t sample_rate;
+    uint8_t slots;
+    bool slave;                     /* 从模式：BCLK/FCLK来自I2S0 */
+    uint32_t tx_slot_mask[I2S_SOC_MAX_LINE_NUM];
+    uint32_t rx_slot_mask[I2S_SOC_MAX_LINE_NUM];
+    bool running;
+    uint64_t start;
+    uint64_t tick;
+    uint64_t next;
+    uint8_t slot;
+    bool loopback;
+    host_i2s_sink_t sink;
+    void *sink_user_data;
+    uint32_t start_count;
+    uint64_t ticks;
+    host_line_stats_t tx_stats[I2S_SOC_MAX_LINE_NUM];
+    host_line_stats_t rx_stats[I2S_SOC_MAX_LINE_NUM];
+} host_i2s_t;
+
+typedef struct {
+    uint32_t total;
+    bool half_done;
+    uint64_t bursts;
+    uint64_t descriptors;
+    uint64_t half;
+    uint64_t tc;
+    uint64_t error;
+    uint64_t abort;
+} host_dma_ch_t;
+
+typedef struct {
+    DMAV2_Type *regs;
+    const char *name;
+    uint32_t irq;
+    host_dma_ch_t ch[DMA_SOC_CHANNEL_NUM];
+} host_dma_t;
+
+DMAMUX_Type host_dmamux;
+IOC_Type host_ioc;
+MCHTMR_Type host_mchtmr;
+SPI_Type host_spi1;
+
+static uint8_t *host_alias;
+static host_i2s_t host_i2s[HOST_I2S_NUM];
+static host_dma_t host_dma[HOST_DMA_NUM];
+
+static void (*host_isr[HOST_IRQ_NUM])(void);
+static uint64_t host_irq_enable_mask;
+static uint64_t host_isr_count[HOST_IRQ_NUM];
+
+static uint64_t host_now;
+static uint64_t host_event_at = UINT64_MAX;    /* 最近的外设事件时间 */
+static uint64_t host_deadline;
+static uint64_t host_fault_at = UINT64_MAX;
+static void (*host_fault)(void);
+static bool host_active;
+static bool host_mie = true;
+static bool host_in_isr;
+static bool host_in_signal;
+static bool host_deadline_hit;
+static bool host_dma_busy;
+static jmp_buf host_end_jmp;
+
+static uint64_t host_store_count;
+static uint64_t host_l1c_count;
+static uint64_t host_l1c_unaligned;
+static uint64_t host_dma_runaway;
+
+/*
+ * CRC-32(IEEE)，按小端字节序累加每个字
+ */
+static uint32_t host_crc32(uint32_t crc, uint32_t word)
+{
+    crc = ~crc;
+    for (uint8_t i = 0; i < 32U; i++) {
+        if (((crc ^ (word >> i)) & 1U) != 0U) {
+            crc = (crc >> 1) ^ 0xEDB88320UL;
+        } else {
+            crc >>= 1;
+        }
+    }
+    return ~crc;
+}
+
+static void host_stats_add(host_line_stats_t *stats, uint32_t word)
+{
+    if (stats->words < HOST_FIRST_WORDS) {
+        stats->first[stats->words] = word;
+    }
+    stats->words++;
+    stats->crc = host_crc32(stats->crc, word);
+}
+
+static bool host_fifo_push(host_fifo_t *fifo, uint32_t word)
+{
+    if (fifo->count >= I2S_SOC_MAX_TX_FIFO_DEPTH) {
+        return false;
+    }
+    fifo->data[(fifo->head + fifo->count) % I2S_SOC_MAX_TX_FIFO_DEPTH] = word;
+    fifo->count++;
+    return true;
+}
+
+static bool host_fifo_pop(host_fifo_t *fifo, uint32_t *word)
+{
+    if (fifo->count == 0U) {
+        return false;
+    }
+    *word = fifo->data[fifo->head];
+    fifo->head = (fifo->head + 1U) % I2S_SOC_MAX_TX_FIFO_DEPTH;
+    fifo->count--;
+    return true;
+}
+
+static void host_dma_kick(void);
+static void host_cpu_advance(uint64_t cycles);
+
+/*
+ * I2S
+ */
+static host_i2s_t *host_i2s_find(I2S_Type *ptr)
+{
+    uintptr_t index = ((uintptr_t)ptr - HPM_I2S0_BASE) / HOST_I2S_STRIDE;
+
+    assert(index < HOST_I2S_NUM);
+    return &host_i2s[index];
+}
+
+static uint32_t host_i2s_tx_lines(const host_i2s_t *i2s)
+{
+    return (i2s->regs->CTRL & I2S_CTRL_TX_EN_MASK) >> I2S_CTRL_TX_EN_SHIFT;
+}
+
+static uint32_t host_i2s_rx_lines(const host_i2s_t *i2s)
+{
+    return (i2s->regs->CTRL & I2S_CTRL_RX_EN_MASK) >> I2S_CTRL_RX_EN_SHIFT;
+}
+
+static bool host_i2s_tx_need(const host_i2s_t *i2s, uint8_t line)
+{
+    return ((host_i2s_tx_lines(i2s) & (1UL << line)) != 0U) && (i2s->tx[line].count <= i2s->tx_threshold);
+}
+
+static bool host_i2s_rx_avail(const host_i2s_t *i2s, uint8_t line)
+{
+    uint8_t threshold = (i2s->rx_threshold == 0U) ? 1U : i2s->rx_threshold;
+
+    return ((host_i2s_rx_lines(i2s) & (1UL << line)) != 0U) && (i2s->rx[line].count >= threshold);
+}
+
+/* 由FIFO深度更新深度寄存器和状态寄存器中的电平状态，TX_UD和RX_OV保持到写1清除 */
+static void host_i2s_update(host_i2s_t *i2s)
+{
+    uint32_t tfill = 0;
+    uint32_t rfill = 0;
+    uint32_t sta = i2s->regs->STA & (I2S_STA_TX_UD_MASK | I2S_STA_RX_OV_MASK);
+
+    for (uint8_t line = 0; line < I2S_SOC_MAX_LINE_NUM; line++) {
+        tfill |= (uint32_t)i2s->tx[line].count << (line * 8U);
+        rfill |= (uint32_t)i2s->rx[line].count << (line * 8U);
+        if (host_i2s_tx_need(i2s, line)) {
+            sta |= 1UL << (I2S_STA_TX_DN_SHIFT + line);
+        }
+        if (host_i2s_rx_avail(i2s, line)) {
+            sta |= 1UL << (I2S_STA_RX_DA_SHIFT + line);
+        }
+    }
+    i2s->regs->TFIFO_FILLINGS = tfill;
+    i2s->regs->RFIFO_FILLINGS = rfill;
+    i2s->regs->STA = sta;
+}
+
+static uint64_t host_i2s_tick_time(const host_i2s_t *i2s, uint64_t tick)
+{
+    return i2s->start + (tick + 1U) * HOST_CPU_HZ / ((uint64_t)i2s->sample_rate * i2s->slots);
+}
+
+static void host_event_update(void)
+{
+    host_event_at = UINT64_MAX;
+    for (uint8_t i = 0; i < HOST_I2S_NUM; i++) {
+        if (host_i2s[i].running && (host_i2s[i].next < host_event_at)) {
+            host_event_at = host_i2s[i].next;
+        }
+    }
+}
+
+/* 第一个时隙在一个BCLK时隙之后开始移出，tick为起始时刻start之后的节拍序号 */
+static void host_i2s_run(host_i2s_t *i2s, uint64_t start, uint64_t tick)
+{
+    i2s->running = true;
+    i2s->start = start;
+    i2s->tick = tick;
+    i2s->slot = 0;
+    i2s->next = host_i2s_tick_time(i2s, tick);
+    i2s->start_count++;
+}
+
+/*
+ * 从模式的实例按板上的连接使用I2S0的BCLK/FCLK，帧长须与I2S0相同：
+ * 使能时若I2S0正在输出时钟，在其下一个帧边界开始移出，否则等待I2S0启动，与I2S0在同一节拍开始；
+ * I2S0停止后从设备没有时钟，保持使能，I2S0再次启动时重新从第一个时隙开始
+ */
+static void host_i2s_set_ctrl(host_i2s_t *i2s, uint32_t ctrl)
+{
+    host_i2s_t *master = &host_i2s[0];
+    bool was_enabled = (i2s->regs->CTRL & I2S_CTRL_I2S_EN_MASK) != 0U;
+    bool enabled = (ctrl & I2S_CTRL_I2S_EN_MASK) != 0U;
+
+    i2s->regs->CTRL = ctrl;
+    if (enabled && !was_enabled && (i2s->sample_rate != 0U) && (i2s->slots != 0U)) {
+        if (!i2s->slave) {
+            host_i2s_run(i2s, host_now, 0);
+        } else if ((i2s != master) && master->running && !master->slave) {
+            host_i2s_run(i2s, master->start, master->tick + (master->slots - master->slot) % master->slots);
+        }
+    } else if (!enabled) {
+        i2s->running = false;
+    }
+    if ((i2s == master) && (enabled != was_enabled) && !i2s->slave) {
+        for (uint8_t i = 1; i < HOST_I2S_NUM; i++) {
+            if (!host_i2s[i].slave || ((host_i2s[i].regs->CTRL & I2S_CTRL_I2S_EN_MASK) == 0U)) {
+                continue;
+            }
+            if (enabled) {
+                host_i2s_run(&host_i2s[i], host_now, 0);
+            } else {
+                host_i2s[i].running = false;
+            }
+        }
+    }
+    host_event_update();
+    host_i2s_update(i2s);
+    host_dma_kick();
+}
+
+static void host_i2s_push_tx(host_i2s_t *i2s, uint8_t line, uint32_t word)
+{
+    if (!host_fifo_push(&i2s->tx[line], word)) {
+        i2s->tx_stats[line].overflow++;
+    }
+    host_i2s_update(i2s);
+}
+
+static uint32_t host_i2s_pop_rx(host_i2s_t *i2s, uint8_t line)
+{
+    uint32_t word = 0;
+
+    if (!host_fifo_pop(&i2s->rx[line], &word)) {
+        i2s->rx_stats[line].underflow++;
+    }
+    host_i2s_update(i2s);
+    return word;
+}
+
+/* 一个时隙节拍：各数据线移出一个字，回环时同时移入接收FIFO */
+static void host_i2s_tick(host_i2s_t *i2s)
+{
+    uint32_t tx_lines = host_i2s_tx_lines(i2s);
+    uint32_t rx_lines = host_i2s_rx_lines(i2s);
+    uint32_t slot_bit = 1UL << i2s->slot;
+    uint32_t word;
+
+    for (uint8_t line = 0; line < I2S_SOC_MAX_LINE_NUM; line++) {
+        word = 0;
+        if (((tx_lines & (1UL << line)) != 0U) && ((i2s->tx_slot_mask[line] & slot_bit) != 0U)) {
+            if (!host_fifo_pop(&i2s->tx[line], &word)) {
+                word = 0;
+                i2s->tx_stats[line].underflow++;
+                i2s->regs->STA |= 1UL << (I2S_STA_TX_UD_SHIFT + line);
+            }
+            host_stats_add(&i2s->tx_stats[line], word);
+            if (i2s->sink != NULL) {
+                i2s->sink((I2S_Type *)(HPM_I2S0_BASE + (uintptr_t)(i2s - host_i2s) * HOST_I2S_STRIDE), line,
+                          i2s->slot, word, i2s->sink_user_data);
+            }
+        }
+        if (((rx_lines & (1UL << line)) != 0U) && ((i2s->rx_slot_mask[line] & slot_bit) != 0U)) {
+            if (!i2s->loopback) {
+                word = 0;
+            }
+            if (!host_fifo_push(&i2s->rx[line], word)) {
+                i2s->rx_stats[line].overflow++;
+                i2s->regs->STA |= 1UL << (I2S_STA_RX_OV_SHIFT + line);
+            } else {
+                host_stats_add(&i2s->rx_stats[line], word);
+            }
+        }
+    }
+    i2s->slot = (uint8_t)((i2s->slot + 1U) % i2s->slots);
+    i2s->tick++;
+    i2s->ticks++;
+    i2s->next = host_i2s_tick_time(i2s, i2s->tick);
+    host_event_update();
+    host_i2s_update(i2s);
+    host_dma_kick();
+}
+
+static void host_i2s_write(host_i2s_t *i2s, uint32_t offset, uint32_t value, uint8_t size, uint32_t merged)
+{
+    uint32_t reg = offset & ~3UL;
+
+    if ((reg >= offsetof(I2S_Type, TXD)) && (reg < offsetof(I2S_Type, TXD) + sizeof(i2s->regs->TXD))) {
+        /* 半字写入TXD的高半字时数据位于字的高16位 */
+        host_i2s_push_tx(i2s, (uint8_t)((reg - offsetof(I2S_Type, TXD)) / 4U), value << ((offset & 3U) * 8U));
+        (void)size;
+        return;
+    }
+    switch (reg) {
+    case offsetof(I2S_Type, CTRL):
+        host_i2s_set_ctrl(i2s, merged);
+        break;
+    case offsetof(I2S_Type, STA):
+        i2s->regs->STA &= ~((value << ((offset & 3U) * 8U)) & (I2S_STA_TX_UD_MASK | I2S_STA_RX_OV_MASK));
+        host_i2s_update(i2s);
+        break;
+    case offsetof(I2S_Type, FIFO_THRESH):
+        i2s->regs->FIFO_THRESH = merged;
+        i2s->tx_threshold = (uint8_t)(merged >> 8);
+        i2s->rx_threshold = (uint8_t)merged;
+        host_i2s_update(i2s);
+        host_dma_kick();
+        break;
+    default:
+        *(volatile uint32_t *)((uint8_t *)i2s->regs + reg) = merged;
+        break;
+    }
+}
+
+static uint32_t host_i2s_read(host_i2s_t *i2s, uint32_t offset)
+{
+    uint32_t reg = offset & ~3UL;
+
+    if ((reg >= offsetof(I2S_Type, RXD)) && (reg < offsetof(I2S_Type, RXD) + sizeof(i2s->regs->RXD))) {
+        return host_i2s_pop_rx(i2s, (uint8_t)((reg - offsetof(I2S_Type, RXD)) / 4U)) >> ((offset & 3U) * 8U);
+    }
+    return *(volatile uint32_t *)((uint8_t *)i2s->regs + reg) >> ((offset & 3U) * 8U);
+}
+
+/*
+ * DMA
+ */
+static host_dma_t *host_dma_find(DMAV2_Type *ptr)
+{
+    return &host_dma[(ptr == HPM_XDMA) ? 1U : 0U];
+}
+
+/* DMAMUX连接的外设请求是否有效 */
+static bool host_dma_request(uint8_t src)
+{
+    host_i2s_t *i2s;
+    uint8_t line = 0;
+    bool tx;
+
+    if ((src >= HPM_DMA_SRC_I2S0_RX) && (src <= HPM_DMA_SRC_I2S3_TX)) {
+        i2s = &host_i2s[(src - HPM_DMA_SRC_I2S0_RX) / 2U];
+        tx = ((src - HPM_DMA_SRC_I2S0_RX) & 1U) != 0U;
+    } else if ((src >= HPM_DMA_SRC_I2S0_TX_0) && (src <= HPM_DMA_SRC_I2S3_TX_3)) {
+        i2s = &host_i2s[(src - HPM_DMA_SRC_I2S0_TX_0) / 4U];
+        line = (src - HPM_DMA_SRC_I2S0_TX_0) % 4U;
+        tx = true;
+    } else if ((src >= HPM_DMA_SRC_I2S0_RX_0) && (src <= HPM_DMA_SRC_I2S0_RX_3)) {
+        i2s = &host_i2s[0];
+        line = src - HPM_DMA_SRC_I2S0_RX_0;
+        tx = false;
+    } else {
+        return false;
+    }
+    if (tx) {
+        return ((i2s->regs->CTRL & I2S_CTRL_TX_DMA_EN_MASK) != 0U) && host_i2s_tx_need(i2s, line);
+    }
+    return ((i2s->regs->CTRL & I2S_CTRL_RX_DMA_EN_MASK) != 0U) && host_i2s_rx_avail(i2s, line);
+}
+
+static uint32_t host_periph_read(uint32_t addr, uint8_t size);
+static void host_periph_write(uint32_t addr, uint32_t value, uint8_t size);
+
+static uint32_t host_bus_read(uint32_t addr, uint8_t size)
+{
+    if ((addr >= HOST_WINDOW_BASE) && (addr < HOST_WINDOW_BASE + HOST_WINDOW_SIZE)) {
+        return host_periph_read(addr, size);
+    }
+    switch (size) {
+    case 1:
+        return *(volatile uint8_t *)(uintptr_t)addr;
+    case 2:
+        return *(volatile uint16_t *)(uintptr_t)addr;
+    default:
+        return *(volatile uint32_t *)(uintptr_t)addr;
+    }
+}
+
+static void host_bus_write(uint32_t addr, uint32_t value, uint8_t size)
+{
+    if ((addr >= HOST_WINDOW_BASE) && (addr < HOST_WINDOW_BASE + HOST_WINDOW_SIZE)) {
+        host_periph_write(addr, value, size);
+        return;
+    }
+    switch (size) {
+    case 1:
+        *(volatile uint8_t *)(uintptr_t)addr = (uint8_t)value;
+        break;
+    case 2:
+        *(volatile uint16_t *)(uintptr_t)addr = (uint16_t)value;
+        break;
+    default:
+        *(volatile uint32_t *)(uintptr_t)addr = value;
+        break;
+    }
+}
+
+static uint32_t host_dma_step_addr(uint32_t addr, uint32_t ctrl, uint8_t width)
+{
+    switch (ctrl) {
+    case DMA_ADDRESS_CONTROL_INCREMENT:
+        return addr + width;
+    case DMA_ADDRESS_CONTROL_DECREMENT:
+        return addr - width;
+    default:
+        return addr;
+    }
+}
+
+/* 置位状态，对应的中断被屏蔽时不置位 */
+static void host_dma_status(host_dma_t *dma, uint8_t ch, uint32_t int_mask)
+{
+    uint32_t ctrl = dma->regs->CHCTRL[ch].CTRL;
+    uint32_t bit = 1UL << ch;
+
+    if (((ctrl >> HOST_DMA_CTRL_INTMASK_SHIFT) & int_mask) != 0U) {
+        return;
+    }
+    switch (int_mask) {
+    case DMA_INTERRUPT_MASK_ERROR:
+        dma->regs->INTERRSTS |= bit;
+        break;
+    case DMA_INTERRUPT_MASK_ABORT:
+        dma->regs->INTABORTSTS |= bit;
+        break;
+    case DMA_INTERRUPT_MASK_TERMINAL_COUNT:
+        dma->regs->INTTCSTS |= bit;
+        break;
+    default:
+        dma->regs->INTHALFSTS |= bit;
+        break;
+    }
+}
+
+static void host_dma_channel_on(host_dma_t *dma, uint8_t ch)
+{
+    dma->regs->CHCTRL[ch].CTRL |= HOST_DMA_CTRL_EN;
+    dma->regs->CHEN |= 1UL << ch;
+    dma->ch[ch].total = dma->regs->CHCTRL[ch].TRANSIZE;
+    dma->ch[ch].half_done = false;
+}
+
+static void host_dma_channel_off(host_dma_t *dma, uint8_t ch)
+{
+    dma->regs->CHCTRL[ch].CTRL &= ~HOST_DMA_CTRL_EN;
+    dma->regs->CHEN &= ~(1UL << ch);
+}
+
+static void host_dma_load_descriptor(host_dma_t *dma, uint8_t ch)
+{
+    const dma_linked_descriptor_t *desc = (const dma_linked_descriptor_t *)(uintptr_t)dma->regs->CHCTRL[ch].LLPOINTER;
+
+    dma->regs->CHCTRL[ch].CTRL = desc->ctrl | HOST_DMA_CTRL_EN;
+    dma->regs->CHCTRL[ch].TRANSIZE = desc->trans_size;
+    dma->regs->CHCTRL[ch].SRCADDR = desc->src_addr;
+    dma->regs->CHCTRL[ch].CHANREQCTRL = desc->req_ctrl;
+    dma->regs->CHCTRL[ch].DSTADDR = desc->dst_addr;
+    dma->regs->CHCTRL[ch].LLPOINTER = desc->linked_ptr;
+    dma->ch[ch].total = desc->trans_size;
+    dma->ch[ch].half_done = false;
+    dma->ch[ch].descriptors++;
+}
+
+/* 传输一个burst，非握手通道一次传输全部数据 */
+static void host_dma_burst(host_dma_t *dma, uint8_t ch, bool handshake)
+{
+    uint32_t ctrl = dma->regs->CHCTRL[ch].CTRL;
+    uint8_t src_width = 1U << ((ctrl >> HOST_DMA_CTRL_SRCWIDTH_SHIFT) & 7U);
+    uint8_t dst_width = 1U << ((ctrl >> HOST_DMA_CTRL_DSTWIDTH_SHIFT) & 7U);
+    uint32_t src_ctrl = (ctrl >> HOST_DMA_CTRL_SRCADDRCTRL_SHIFT) & 3U;
+    uint32_t dst_ctrl = (ctrl >> HOST_DMA_CTRL_DSTADDRCTRL_SHIFT) & 3U;
+    uint32_t n = handshake ? (1UL << ((ctrl >> HOST_DMA_CTRL_BURST_SHIFT) & 0xFU)) : UINT32_MAX;
+    uint32_t src = dma->regs->CHCTRL[ch].SRCADDR;
+    uint32_t dst = dma->regs->CHCTRL[ch].DSTADDR;
+    host_dma_ch_t *state = &dma->ch[ch];
+
+    for (uint32_t i = 0; (i < n) && (dma->regs->CHCTRL[ch].TRANSIZE > 0U); i++) {
+        host_bus_write(dst, host_bus_read(src, src_width), dst_width);
+        src = host_dma_step_addr(src, src_ctrl, src_width);
+        dst = host_dma_step_addr(dst, dst_ctrl, dst_width);
+        dma->regs->CHCTRL[ch].TRANSIZE--;
+    }
+    /* burst小循环：每个burst结束后地址回到burst起点 */
+    if ((ctrl & HOST_DMA_CTRL_SRC_FIXED_BURST) == 0U) {
+        dma->regs->CHCTRL[ch].SRCADDR = src;
+    }
+    if ((ctrl & HOST_DMA_CTRL_DST_FIXED_BURST) == 0U) {
+        dma->regs->CHCTRL[ch].DSTADDR = dst;
+    }
+    state->bursts++;
+
+    if (!state->half_done && (dma->regs->CHCTRL[ch].TRANSIZE <= state->total / 2U)) {
+        state->half_done = true;
+        state->half++;
+        host_dma_status(dma, ch, DMA_INTERRUPT_MASK_HALF_TC);
+    }
+    if (dma->regs->CHCTRL[ch].TRANSIZE == 0U) {
+        state->tc++;
+        host_dma_status(dma, ch, DMA_INTERRUPT_MASK_TERMINAL_COUNT);
+        if (dma->regs->CHCTRL[ch].LLPOINTER != 0U) {
+            host_dma_load_descriptor(dma, ch);
+        } else {
+            host_dma_channel_off(dma, ch);
+        }
+    }
+}
+
+/* 执行所有请求有效的通道，直到没有通道可以继续 */
+static void host_dma_kick(void)
+{
+    uint32_t budget = HOST_DMA_RUNAWAY;
+    bool progress = true;
+    uint32_t ctrl;
+    uint32_t mux;
+    bool handshake;
+
+    /* 传输中写TXD或读RXD会再次触发，由最外层统一处理 */
+    if (host_dma_busy || (host_alias == NULL)) {
+        return;
+    }
+    host_dma_busy = true;
+    while (progress && (budget > 0U)) {
+        progress = false;
+        for (uint8_t d = 0; d < HOST_DMA_NUM; d++) {
+            host_dma_t *dma = &host_dma[d];
+            uint32_t chen = dma->regs->CHEN;
+
+            while (chen != 0U) {
+                uint8_t ch = (uint8_t)__builtin_ctz(chen);
+
+                chen &= chen - 1U;
+                ctrl = dma->regs->CHCTRL[ch].CTRL;
+                handshake = (ctrl & (HOST_DMA_CTRL_SRCMODE | HOST_DMA_CTRL_DSTMODE)) != 0U;
+                if (handshake) {
+                    mux = host_dmamux.MUXCFG[DMA_SOC_CHN_TO_DMAMUX_CHN((d == 1U) ? HPM_XDMA : HPM_HDMA, ch)];
+                    if (((mux & DMAMUX_MUXCFG_ENABLE_MASK) == 0U) ||
+                        !host_dma_request((uint8_t)(mux & DMAMUX_MUXCFG_SOURCE_MASK))) {
+                        continue;
+                    }
+                }
+                host_dma_burst(dma, ch, handshake);
+                progress = true;
+                budget--;
+            }
+        }
+    }
+    if (budget == 0U) {
+        host_dma_runaway++;
+    }
+    host_dma_busy = false;
+}
+
+static void host_dma_write(host_dma_t *dma, uint32_t offset, uint32_t value, uint32_t merged)
+{
+    uint32_t reg = offset & ~3UL;
+    uint32_t bits = value << ((offset & 3U) * 8U);
+    uint8_t ch;
+
+    switch (reg) {
+    case offsetof(DMAV2_Type, INTHALFSTS):
+        dma->regs->INTHALFSTS &= ~bits;
+        break;
+    case offsetof(DMAV2_Type, INTTCSTS):
+        dma->regs->INTTCSTS &= ~bits;
+        break;
+    case offsetof(DMAV2_Type, INTABORTSTS):
+        dma->regs->INTABORTSTS &= ~bits;
+        break;
+    case offsetof(DMAV2_Type, INTERRSTS):
+        dma->regs->INTERRSTS &= ~bits;
+        break;
+    case offsetof(DMAV2_Type, CHABORT):
+        while (bits != 0U) {
+            ch = (uint8_t)__builtin_ctz(bits);
+            bits &= bits - 1U;
+            host_dma_channel_off(dma, ch);
+            dma->ch[ch].abort++;
+            host_dma_status(dma, ch, DMA_INTERRUPT_MASK_ABORT);
+        }
+        break;
+    default:
+        *(volatile uint32_t *)((uint8_t *)dma->regs + reg) = merged;
+        if ((reg >= offsetof(DMAV2_Type, CHCTRL)) &&
+            ((reg - offsetof(DMAV2_Type, CHCTRL)) % sizeof(dma->regs->CHCTRL[0]) == 0U)) {
+            ch = (uint8_t)((reg - offsetof(DMAV2_Type, CHCTRL)) / sizeof(dma->regs->CHCTRL[0]));
+            if ((merged & HOST_DMA_CTRL_EN) != 0U) {
+                host_dma_channel_on(dma, ch);
+                host_dma_kick();
+            } else {
+                host_dma_channel_off(dma, ch);
+            }
+        }
+        break;
+    }
+}
+
+/*
+ * 外设窗口的总线访问，TXD/RXD和写1清除的寄存器按访问语义处理，其他寄存器按字节合并
+ */
+static void host_periph_write(uint32_t addr, uint32_t value, uint8_t size)
+{
+    uint32_t word_addr = addr & ~3UL;
+    uint32_t shift = (addr & 3U) * 8U;
+    uint32_t mask = (size >= 4U) ? UINT32_MAX : (((1UL << (size * 8U)) - 1U) << shift);
+    uint32_t merged = (*(volatile uint32_t *)HOST_ALIAS(word_addr) & ~mask) | ((value << shift) & mask);
+
+    if (size < 4U) {
+        value &= (1UL << (size * 8U)) - 1U;
+    }
+    if ((addr >= HPM_I2S0_BASE) && (addr < HPM_I2S0_BASE + HOST_I2S_NUM * HOST_I2S_STRIDE)) {
+        host_i2s_write(&host_i2s[(addr - HPM_I2S0_BASE) / HOST_I2S_STRIDE], addr % HOST_I2S_STRIDE, value, size,
+                       merged);
+    } else if ((addr >= HPM_HDMA_BASE) && (addr < HPM_HDMA_BASE + HOST_DMA_NUM * 0x1000UL)) {
+        host_dma_write(&host_dma[(addr - HPM_HDMA_BASE) / 0x1000UL], addr % 0x1000UL, value, merged);
+    } else {
+        *(volatile uint32_t *)HOST_ALIAS(word_addr) = merged;
+    }
+}
+
+static uint32_t host_periph_read(uint32_t addr, uint8_t size)
+{
+    uint32_t value;
+
+    if ((addr >= HPM_I2S0_BASE) && (addr < HPM_I2S0_BASE + HOST_I2S_NUM * HOST_I2S_STRIDE)) {
+        value = host_i2s_read(&host_i2s[(addr - HPM_I2S0_BASE) / HOST_I2S_STRIDE], addr % HOST_I2S_STRIDE);
+    } else {
+        value = *(volatile uint32_t *)HOST_ALIAS(addr & ~3UL) >> ((addr & 3U) * 8U);
+    }
+    if (size < 4U) {
+        value &= (1UL << (size * 8U)) - 1U;
+    }
+    return value;
+}
+
+/*
+ * CPU、中断和时间
+ */
+static bool host_irq_asserted(uint32_t irq)
+{
+    host_i2s_t *i2s;
+    uint32_t sta;
+
+    for (uint8_t d = 0; d < HOST_DMA_NUM; d++) {
+        if (irq == host_dma[d].irq) {
+            DMAV2_Type *regs = host_dma[d].regs;
+            return (regs->INTHALFSTS | regs->INTTCSTS | regs->INTABORTSTS | regs->INTERRSTS) != 0U;
+        }
+    }
+    if ((irq >= IRQn_I2S0) && (irq <= IRQn_I2S3)) {
+        i2s = &host_i2s[irq - IRQn_I2S0];
+        sta = i2s->regs->STA;
+        return (((i2s->irq_enable & i2s_tx_fifo_threshold_irq_mask) != 0U) && ((sta & I2S_STA_TX_DN_MASK) != 0U)) ||
+               (((i2s->irq_enable & i2s_rx_fifo_threshold_irq_mask) != 0U) && ((sta & I2S_STA_RX_DA_MASK) != 0U)) ||
+               (((i2s->irq_enable & i2s_fifo_error_irq_mask) != 0U) &&
+                ((sta & (I2S_STA_TX_UD_MASK | I2S_STA_RX_OV_MASK)) != 0U));
+    }
+    return false;
+}
+
+static void host_end(host_end_t reason)
+{
+    longjmp(host_end_jmp, (int)reason);
+}
+
+/* 响应挂起的中断，中断处理函数不嵌套 */
+static void host_cpu_deliver(void)
+{
+    bool again = true;
+    uint64_t pending;
+    uint32_t irq;
+
+    if (host_in_isr || host_in_signal || !host_mie) {
+        return;
+    }
+    while (again) {
+        again = false;
+        pending = host_irq_enable_mask;
+        while (pending != 0U) {
+            irq = (uint32_t)__builtin_ctzll(pending);
+            pending &= pending - 1U;
+            if ((host_isr[irq] == NULL) || !host_irq_asserted(irq)) {
+                continue;
+            }
+            host_in_isr = true;
+            host_isr_count[irq]++;
+            host_cpu_advance(HOST_IRQ_CYCLES / 2U);
+            host_isr[irq]();
+            host_cpu_advance(HOST_IRQ_CYCLES / 2U);
+            host_in_isr = false;
+            again = true;
+            break;
+        }
+    }
+}
+
+static uint64_t host_next_event(void)
+{
+    return host_event_at;
+}
+
+/* 时间前进，期间到期的外设事件按时间顺序执行 */
+static void host_cpu_advance(uint64_t cycles)
+{
+    uint64_t target = host_now + cycles;
+    host_i2s_t *first;
+
+    if (!host_active) {
+        return;
+    }
+    while (target >= host_event_at) {
+        first = NULL;
+        for (uint8_t i = 0; i < HOST_I2S_NUM; i++) {
+            if (host_i2s[i].running && (host_i2s[i].next <= target) &&
+                ((first == NULL) || (host_i2s[i].next < first->next))) {
+                first = &host_i2s[i];
+            }
+        }
+        host_now = first->next;
+        host_i2s_tick(first);
+    }
+    host_now = target;
+    if ((host_now >= host_fault_at) && !host_in_signal) {
+        host_fault_at = UINT64_MAX;
+        host_fault();
+    }
+    if (host_now >= host_deadline) {
+        host_deadline_hit = true;
+        if (!host_in_signal) {
+            host_end(host_end_timeout);
+        }
+    }
+}
+
+static void host_cpu_step(uint32_t cycles)
+{
+    host_cpu_advance(cycles);
+    host_cpu_deliver();
+}
+
+uint64_t host_cycles(void)
+{
+    return host_now;
+}
+
+void host_cpu_idle(void)
+{
+    uint64_t next;
+
+    if (!host_active) {
+        return;
+    }
+    host_cpu_deliver();
+    next = host_next_event();
+    if (next == UINT64_MAX) {
+        /* 没有外设在运行，示例已进入最终的空闲循环 */
+        if (!host_in_isr) {
+            host_end(host_end_idle);
+        }
+        next = host_now + 1U;
+    }
+    if (next <= host_now) {
+        next = host_now + 1U;
+    }
+    host_cpu_advance(next - host_now);
+    host_cpu_deliver();
+}
+
+void __cyg_profile_func_enter(void *fn, void *site)
+{
+    (void)fn;
+    (void)site;
+    if (host_active) {
+        host_cpu_step(HOST_CALL_CYCLES);
+    }
+}
+
+void __cyg_profile_func_exit(void *fn, void *site)
+{
+    (void)fn;
+    (void)site;
+    if (host_active) {
+        host_cpu_advance(HOST_CALL_CYCLES);
+    }
+}
+
+/*
+ * 寄存器写解码：x86-64上编译器为volatile写生成的mov/算术存储指令
+ */
+static const int host_gregs[16] = {
+    REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+    REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15,
+};
+
+static uint64_t host_reg_value(const ucontext_t *uc, uint8_t reg, uint8_t rex, uint8_t size)
+{
+    /* 没有REX前缀时字节寄存器4~7为AH/CH/DH/BH */
+    if ((size == 1U) && (rex == 0U) && (reg >= 4U) && (reg < 8U)) {
+        return ((uint64_t)uc->uc_mcontext.gregs[host_gregs[reg - 4U]] >> 8) & 0xFFU;
+    }
+    return (uint64_t)uc->uc_mcontext.gregs[host_gregs[reg]];
+}
+
+static uint64_t host_alu(uint8_t op, uint64_t old, uint64_t src)
+{
+    switch (op) {
+    case 0:
+        return old + src;
+    case 1:
+        return old | src;
+    case 4:
+        return old & src;
+    case 5:
+        return old - src;
+    case 6:
+        return old ^ src;
+    default:
+        fprintf(stderr, "host model: unsupported read-modify-write operation %u on a peripheral register\n", op);
+        abort();
+    }
+}
+
+static void host_segv_handler(int sig, siginfo_t *si, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t addr = (uintptr_t)si->si_addr;
+    const uint8_t *ip = (const uint8_t *)uc->uc_mcontext.gregs[REG_RIP];
+    const uint8_t *start = ip;
+    bool opsize16 = false;
+    uint8_t rex = 0;
+    uint8_t op;
+    uint8_t modrm;
+    uint8_t mod;
+    uint8_t reg;
+    uint8_t rm;
+    uint8_t size;
+    int alu = -1;
+    uint64_t value;
+
+    if ((addr < HOST_WINDOW_BASE) || (addr >= HOST_WINDOW_BASE + HOST_WINDOW_SIZE)) {
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    while ((*ip == 0x66U) || (*ip == 0x2EU) || (*ip == 0x3EU) || (*ip == 0xF0U)) {
+        opsize16 |= (*ip == 0x66U);
+        ip++;
+    }
+    if ((*ip & 0xF0U) == 0x40U) {
+        rex = *ip++;
+    }
+    op = *ip++;
+    modrm = *ip++;
+    mod = modrm >> 6;
+    reg = (uint8_t)(((modrm >> 3) & 7U) | (((rex & 4U) != 0U) ? 8U : 0U));
+    rm = modrm & 7U;
+    if (mod != 3U) {
+        if (rm == 4U) {
+            uint8_t sib = *ip++;
+            if ((mod == 0U) && ((sib & 7U) == 5U)) {
+                ip += 4;
+            }
+        } else if ((mod == 0U) && (rm == 5U)) {
+            ip += 4;
+        }
+        if (mod == 1U) {
+            ip += 1;
+        } else if (mod == 2U) {
+            ip += 4;
+        }
+    }
+    size = ((rex & 8U) != 0U) ? 8U : (opsize16 ? 2U : 4U);
+
+    switch (op) {
+    case 0x88:
+        size = 1;
+        value = host_reg_value(uc, reg, rex, size);
+        break;
+    case 0x89:
+        value = host_reg_value(uc, reg, rex, size);
+        break;
+    case 0x00:
+    case 0x08:
+    case 0x20:
+    case 0x28:
+    case 0x30:
+        size = 1;
+        value = host_reg_value(uc, reg, rex, size);
+        alu = op >> 3;
+        break;
+    case 0x01:
+    case 0x09:
+    case 0x21:
+    case 0x29:
+    case 0x31:
+        value = host_reg_value(uc, reg, rex, size);
+        alu = op >> 3;
+        break;
+    case 0xC6:
+        size = 1;
+        value = *ip++;
+        break;
+    case 0xC7:
+        if (size == 2U) {
+            value = *(const uint16_t *)ip;
+            ip += 2;
+        } else {
+            value = (uint64_t)(int64_t)*(const int32_t *)ip;
+            ip += 4;
+        }
+        break;
+    case 0x80:
+        size = 1;
+        value = *ip++;
+        alu = (modrm >> 3) & 7U;
+        break;
+    case 0x81:
+        if (size == 2U) {
+            value = *(const uint16_t *)ip;
+            ip += 2;
+        } else {
+            value = (uint64_t)(int64_t)*(const int32_t *)ip;
+            ip += 4;
+        }
+        alu = (modrm >> 3) & 7U;
+        break;
+    case 0x83:
+        value = (uint64_t)(int64_t)*(const int8_t *)ip;
+        ip += 1;
+        alu = (modrm >> 3) & 7U;
+        break;
+    default:
+        fprintf(stderr, "host model: unsupported store to 0x%08lx (opcode 0x%02x at %p)\n", (unsigned long)addr, op,
+                (const void *)start);
+        abort();
+    }
+
+    host_in_signal = true;
+    if (alu >= 0) {
+        value = host_alu((uint8_t)alu, *(volatile uint64_t *)HOST_ALIAS(addr), value);
+    }
+    host_store_count++;
+    if (size == 8U) {
+        host_periph_write((uint32_t)addr, (uint32_t)value, 4);
+        host_periph_write((uint32_t)addr + 4U, (uint32_t)(value >> 32), 4);
+    } else {
+        host_periph_write((uint32_t)addr, (uint32_t)value, size);
+    }
+    host_cpu_advance(HOST_STORE_CYCLES);
+    host_in_signal = false;
+    uc->uc_mcontext.gregs[REG_RIP] = (greg_t)(uintptr_t)ip;
+}
+
+static void host_model_init(uint32_t timeout_ms)
+{
+    struct sigaction sa;
+    int fd;
+
+    if (host_alias == NULL) {
+        fd = memfd_create("host_periph", 0);
+        if ((fd < 0) || (ftruncate(fd, HOST_WINDOW_SIZE) != 0) ||
+            (mmap((void *)HOST_WINDOW_BASE, HOST_WINDOW_SIZE, PROT_READ, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0) !=
+             (void *)HOST_WINDOW_BASE)) {
+            perror("host model: map peripheral window");
+            exit(2);
+        }
+        host_alias = mmap(NULL, HOST_WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (host_alias == MAP_FAILED) {
+            perror("host model: map peripheral alias");
+            exit(2);
+        }
+        close(fd);
+
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_sigaction = host_segv_handler;
+        sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+        sigaction(SIGSEGV, &sa, NULL);
+    }
+
+    for (uint8_t i = 0; i < HOST_I2S_NUM; i++) {
+        host_i2s[i].regs = HOST_ALIAS(HPM_I2S0_BASE + i * HOST_I2S_STRIDE);
+        host_i2s[i].mclk_hz = 24576000UL;
+        host_i2s[i].tx_threshold = 4;
+        host_i2s[i].rx_threshold = 4;
+        host_i2s_update(&host_i2s[i]);
+    }
+    host_dma[0].regs = HOST_ALIAS(HPM_HDMA_BASE);
+    host_dma[0].name = "hdma";
+    host_dma[0].irq = IRQn_HDMA;
+    host_dma[1].regs = HOST_ALIAS(HPM_XDMA_BASE);
+    host_dma[1].name = "xdma";
+    host_dma[1].irq = IRQn_XDMA;
+    host_deadline = (uint64_t)timeout_ms * (HOST_CPU_HZ / 1000U);
+}
+
+static void host_model_report(FILE *fp, host_end_t reason)
+{
+    static const char *const end_name[] = {"none", "idle", "returned", "timeout"};
+    host_line_stats_t *stats;
+
+    fprintf(fp, "end: %s\n", end_name[reason]);
+    for (uint8_t i = 0; i < HOST_I2S_NUM; i++) {
+        host_i2s_t *i2s = &host_i2s[i];
+        if (i2s->start_count == 0U) {
+            continue;
+        }
+        fprintf(fp, "i2s%u: %u Hz x %u slots, %u starts, %llu ticks\n", i, i2s->sample_rate, i2s->slots,
+                i2s->start_count, (unsigned long long)i2s->ticks);
+        for (uint8_t dir = 0; dir < 2U; dir++) {
+            for (uint8_t line = 0; line < I2S_SOC_MAX_LINE_NUM; line++) {
+                stats = (dir == 0U) ? &i2s->tx_stats[line] : &i2s->rx_stats[line];
+                if (stats->words == 0U) {
+                    continue;
+                }
+                fprintf(fp, "  %s line%u: %llu words, crc32 %08x, %s %llu, %s %llu\n", (dir == 0U) ? "tx" : "rx",
+                        line, (unsigned long long)stats->words, stats->crc,
+                        (dir == 0U) ? "underflow" : "read empty", (unsigned long long)stats->underflow,
+                        "overflow", (unsigned long long)stats->overflow);
+                fprintf(fp, "    first:");
+                for (uint8_t w = 0; (w < HOST_FIRST_WORDS) && (w < stats->words); w++) {
+                    fprintf(fp, " %08x", stats->first[w]);
+                }
+                fprintf(fp, "\n");
+            }
+        }
+    }
+    for (uint32_t irq = 0; irq < HOST_IRQ_NUM; irq++) {
+        if (host_isr_count[irq] != 0U) {
+            fprintf(fp, "irq %u: %llu isr calls\n", irq, (unsigned long long)host_isr_count[irq]);
+        }
+    }
+    for (uint8_t d = 0; d < HOST_DMA_NUM; d++) {
+        for (uint8_t ch = 0; ch < DMA_SOC_CHANNEL_NUM; ch++) {
+            host_dma_ch_t *state = &host_dma[d].ch[ch];
+            if ((state->bursts == 0U) && (state->error == 0U) && (state->abort == 0U)) {
+                continue;
+            }
+            fprintf(fp, "%s ch%u: %llu bursts, %llu descriptors, %llu half, %llu tc, %llu errors, %llu aborts\n",
+                    host_dma[d].name, ch, (unsigned long long)state->bursts, (unsigned long long)state->descriptors,
+                    (unsigned long long)state->half, (unsigned long long)state->tc,
+                    (unsigned long long)state->error, (unsigned long long)state->abort);
+        }
+    }
+    fprintf(fp, "dma runaway %llu, unaligned cache maintenance %llu of %llu\n", (unsigned long long)host_dma_runaway,
+            (unsigned long long)host_l1c_unaligned, (unsigned long long)host_l1c_count);
+}
+
+/* 与golden文件比较，HOST_TEST_UPDATE_GOLDEN非空时写入golden文件 */
+static int host_golden(const char *name, const char *report)
+{
+    char path[512];
+    char *expected = NULL;
+    size_t len = 0;
+    FILE *fp;
+    const char *update = getenv("HOST_TEST_UPDATE_GOLDEN");
+    int fails = 0;
+
+    snprintf(path, sizeof(path), "%s/%s.txt", HOST_GOLDEN_DIR, name);
+    if ((update != NULL) && (update[0] != '\0')) {
+        fp = fopen(path, "w");
+        if (fp == NULL) {
+            perror(path);
+            return 1;
+        }
+        fputs(report, fp);
+        fclose(fp);
+        printf("golden updated: %s\n", path);
+        return 0;
+    }
+    fp = fopen(path, "r");
+    if (fp == NULL) {
+        perror(path);
+        return 1;
+    }
+    if (getdelim(&expected, &len, '\0', fp) < 0) {
+        fails = 1;
+    } else if (strcmp(expected, report) != 0) {
+        fails = 1;
+    }
+    fclose(fp);
+    if (fails != 0) {
+        printf("golden mismatch: %s\n--- expected\n%s", path, (expected != NULL) ? expected : "");
+    }
+    free(expected);
+    return fails;
+}
+
+int host_model_run(const host_demo_t *demo)
+{
+    char *report = NULL;
+    size_t report_len = 0;
+    FILE *fp;
+    host_end_t reason;
+    int fails = 0;
+
+    host_model_init(demo->timeout_ms);
+    if (demo->fault != NULL) {
+        host_fault = demo->fault;
+        host_fault_at = (uint64_t)demo->fault_ms * (HOST_CPU_HZ / 1000U);
+    }
+    if (demo->setup != NULL) {
+        demo->setup();
+    }
+
+    reason = (host_end_t)setjmp(host_end_jmp);
+    if (reason == host_end_none) {
+        host_active = true;
+        demo->entry();
+        reason = host_end_return;
+    }
+    host_active = false;
+    host_in_isr = false;
+    fflush(stdout);
+
+    fp = open_memstream(&report, &report_len);
+    host_model_report(fp, reason);
+    if (reason == host_end_timeout) {
+        fails++;
+    }
+    if (demo->check != NULL) {
+        fails += demo->check(fp);
+    }
+    fclose(fp);
+
+    printf("--- %s: simulated %llu ms, %llu register writes trapped\n%s", demo->name,
+           (unsigned long long)(host_now / (HOST_CPU_HZ / 1000U)), (unsigned long long)host_store_count, report);
+    fails += host_golden(demo->name, report);
+    free(report);
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
+
+void host_i2s_set_tx_sink(I2S_Type *i2s, host_i2s_sink_t sink, void *user_data)
+{
+    host_i2s_find(i2s)->sink = sink;
+    host_i2s_find(i2s)->sink_user_data = user_data;
+}
+
+void host_i2s_set_loopback(I2S_Type *i2s, bool enable)
+{
+    host_i2s_find(i2s)->loopback = enable;
+}
+
+void host_dma_inject_error(DMAV2_Type *dma, uint8_t ch)
+{
+    host_dma_t *state = host_dma_find(dma);
+
+    host_dma_channel_off(state, ch);
+    state->ch[ch].error++;
+    host_dma_status(state, ch, DMA_INTERRUPT_MASK_ERROR);
+}
+
+void host_irq_register(uint32_t irq, void (*isr)(void))
+{
+    assert(irq < HOST_IRQ_NUM);
+    host_isr[irq] = isr;
+}
+
+/*
+ * 板级和SoC驱动
+ */
+void board_init(void)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+static void host_wait(uint64_t cycles)
+{
+    uint64_t target = host_now + cycles;
+    uint64_t next;
+
+    while (host_now < target) {
+        host_cpu_deliver();
+        next = host_next_event();
+        if (next > target) {
+            next = target;
+        }
+        host_cpu_advance((next > host_now) ? (next - host_now) : 1U);
+    }
+    host_cpu_deliver();
+}
+
+void host_cpu_wait(uint64_t cycles)
+{
+    host_wait(cycles);
+}
+
+void board_delay_ms(uint32_t ms)
+{
+    host_wait((uint64_t)ms * (HOST_CPU_HZ / 1000U));
+}
+
+void board_delay_us(uint32_t us)
+{
+    host_wait((uint64_t)us * (HOST_CPU_HZ / 1000000U));
+}
+
+uint32_t board_config_i2s_clock(I2S_Type *ptr, uint32_t sample_rate)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    i2s->mclk_hz = sample_rate * 512U;
+    return i2s->mclk_hz;
+}
+
+void board_init_i2s_pins(I2S_Type *ptr)
+{
+    (void)ptr;
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+uint32_t board_init_spi_clock(SPI_Type *ptr)
+{
+    (void)ptr;
+    host_cpu_step(HOST_DRV_CYCLES);
+    return 80000000UL;
+}
+
+uint32_t clock_get_frequency(clock_name_t clock_name)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    switch (clock_name) {
+    case clock_cpu0:
+    case clock_cpu1:
+        return HOST_CPU_HZ;
+    case clock_mchtmr0:
+        return HOST_MCHTMR_HZ;
+    case clock_ahb:
+        return 200000000UL;
+    default:
+        return host_i2s[clock_name - clock_i2s0].mclk_hz;
+    }
+}
+
+uint32_t disable_global_irq(uint32_t mask)
+{
+    uint32_t level = host_mie ? CSR_MSTATUS_MIE_MASK : 0U;
+
+    if ((mask & CSR_MSTATUS_MIE_MASK) != 0U) {
+        host_mie = false;
+    }
+    return level & mask;
+}
+
+void restore_global_irq(uint32_t mask)
+{
+    if ((mask & CSR_MSTATUS_MIE_MASK) != 0U) {
+        host_mie = true;
+        host_cpu_deliver();
+    }
+}
+
+void intc_m_enable_irq(uint32_t irq)
+{
+    host_irq_enable_mask |= 1ULL << irq;
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+void intc_m_disable_irq(uint32_t irq)
+{
+    host_irq_enable_mask &= ~(1ULL << irq);
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+void intc_m_enable_irq_with_priority(uint32_t irq, uint32_t priority)
+{
+    (void)priority;
+    intc_m_enable_irq(irq);
+}
+
+uint32_t host_read_csr(uint32_t csr)
+{
+    (void)csr;
+    host_cpu_step(HOST_CSR_CYCLES);
+    return (uint32_t)host_now;
+}
+
+uint64_t hpm_csr_get_core_cycle(void)
+{
+    host_cpu_step(HOST_CSR_CYCLES);
+    return host_now;
+}
+
+uint64_t mchtmr_get_count(MCHTMR_Type *ptr)
+{
+    (void)ptr;
+    host_cpu_step(HOST_CSR_CYCLES);
+    return host_now / (HOST_CPU_HZ / HOST_MCHTMR_HZ);
+}
+
+static void host_l1c_op(uint32_t address, uint32_t size)
+{
+    host_l1c_count++;
+    if (((address % HPM_L1C_CACHELINE_SIZE) != 0U) || ((size % HPM_L1C_CACHELINE_SIZE) != 0U)) {
+        host_l1c_unaligned++;
+    }
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+void l1c_dc_writeback(uint32_t address, uint32_t size)
+{
+    host_l1c_op(address, size);
+}
+
+void l1c_dc_invalidate(uint32_t address, uint32_t size)
+{
+    host_l1c_op(address, size);
+}
+
+void l1c_dc_flush(uint32_t address, uint32_t size)
+{
+    host_l1c_op(address, size);
+}
+
+void l1c_dc_writeback_all(void)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+void l1c_dc_invalidate_all(void)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+}
+
+void dmamux_config(DMAMUX_Type *ptr, uint8_t dmamux_ch, uint8_t src, bool enable)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    ptr->MUXCFG[dmamux_ch] = (src & DMAMUX_MUXCFG_SOURCE_MASK) | (enable ? DMAMUX_MUXCFG_ENABLE_MASK : 0U);
+    host_dma_kick();
+}
+
+/*
+ * I2S驱动
+ */
+void i2s_get_default_config(I2S_Type *ptr, i2s_config_t *config)
+{
+    (void)ptr;
+    host_cpu_step(HOST_DRV_CYCLES);
+    memset(config, 0, sizeof(*config));
+    config->tx_fifo_threshold = 4;
+    config->rx_fifo_threshold = 4;
+}
+
+void i2s_init(I2S_Type *ptr, i2s_config_t *config)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, 0);
+    memset(i2s->tx, 0, sizeof(i2s->tx));
+    memset(i2s->rx, 0, sizeof(i2s->rx));
+    i2s->irq_enable = 0;
+    host_periph_write((uint32_t)(uintptr_t)&ptr->FIFO_THRESH,
+                      ((uint32_t)config->tx_fifo_threshold << 8) | config->rx_fifo_threshold, 4);
+    i2s->regs->STA = 0;
+    host_i2s_update(i2s);
+}
+
+void i2s_get_default_multiline_transfer_config(i2s_multiline_transfer_config_t *transfer)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    memset(transfer, 0, sizeof(*transfer));
+    transfer->sample_rate = 48000;
+    transfer->channel_num_per_frame = 2;
+    transfer->channel_length = i2s_channel_length_32_bits;
+    transfer->audio_depth = 32;
+    transfer->master_mode = true;
+    transfer->protocol = I2S_PROTOCOL_I2S_PHILIPS;
+    for (uint8_t line = 0; line < 4U; line++) {
+        transfer->tx_channel_slot_mask[line] = 0x3;
+        transfer->rx_channel_slot_mask[line] = 0x3;
+    }
+}
+
+hpm_stat_t i2s_config_multiline_transfer(I2S_Type *ptr, uint32_t mclk_in_hz, i2s_multiline_transfer_config_t *config)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+    uint32_t channel_bits = (config->channel_length == i2s_channel_length_16_bits) ? 16U : 32U;
+    uint32_t bclk_hz = config->sample_rate * config->channel_num_per_frame * channel_bits;
+    uint32_t ctrl = 0;
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    if ((config->channel_num_per_frame == 0U) || (config->channel_num_per_frame > I2S_SOC_MAX_CHANNEL_NUM) ||
+        (!config->enable_tdm_mode && (config->channel_num_per_frame != 2U)) ||
+        (config->audio_depth > channel_bits) || (bclk_hz == 0U) || ((mclk_in_hz % bclk_hz) != 0U)) {
+        return status_invalid_argument;
+    }
+
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL & ~I2S_CTRL_I2S_EN_MASK);
+    i2s->sample_rate = config->sample_rate;
+    i2s->slots = config->channel_num_per_frame;
+    i2s->slave = !config->master_mode;
+    for (uint8_t line = 0; line < I2S_SOC_MAX_LINE_NUM; line++) {
+        if (config->tx_data_line_en[line]) {
+            ctrl |= 1UL << (I2S_CTRL_TX_EN_SHIFT + line);
+        }
+        if (config->rx_data_line_en[line]) {
+            ctrl |= 1UL << (I2S_CTRL_RX_EN_SHIFT + line);
+        }
+        i2s->tx_slot_mask[line] = config->tx_channel_slot_mask[line];
+        i2s->rx_slot_mask[line] = config->rx_channel_slot_mask[line];
+        i2s->regs->TXDSLOT[line] = config->tx_channel_slot_mask[line];
+        i2s->regs->RXDSLOT[line] = config->rx_channel_slot_mask[line];
+    }
+    host_i2s_set_ctrl(i2s, (i2s->regs->CTRL & ~(I2S_CTRL_TX_EN_MASK | I2S_CTRL_RX_EN_MASK)) | ctrl);
+    return status_success;
+}
+
+void i2s_start(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL | I2S_CTRL_I2S_EN_MASK);
+}
+
+void i2s_stop(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL & ~I2S_CTRL_I2S_EN_MASK);
+}
+
+void i2s_enable(I2S_Type *ptr)
+{
+    i2s_start(ptr);
+}
+
+void i2s_disable(I2S_Type *ptr)
+{
+    i2s_stop(ptr);
+}
+
+void i2s_reset_tx(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    memset(i2s->tx, 0, sizeof(i2s->tx));
+    host_i2s_update(i2s);
+    host_dma_kick();
+}
+
+void i2s_reset_rx(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    memset(i2s->rx, 0, sizeof(i2s->rx));
+    host_i2s_update(i2s);
+}
+
+void i2s_reset_tx_rx(I2S_Type *ptr)
+{
+    i2s_reset_tx(ptr);
+    i2s_reset_rx(ptr);
+}
+
+void i2s_enable_tx_dma_request(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL | I2S_CTRL_TX_DMA_EN_MASK);
+}
+
+void i2s_disable_tx_dma_request(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL & ~I2S_CTRL_TX_DMA_EN_MASK);
+}
+
+void i2s_enable_rx_dma_request(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL | I2S_CTRL_RX_DMA_EN_MASK);
+}
+
+void i2s_disable_rx_dma_request(I2S_Type *ptr)
+{
+    host_i2s_t *i2s = host_i2s_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_set_ctrl(i2s, i2s->regs->CTRL & ~I2S_CTRL_RX_DMA_EN_MASK);
+}
+
+void i2s_enable_irq(I2S_Type *ptr, uint32_t mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_find(ptr)->irq_enable |= mask;
+}
+
+void i2s_disable_irq(I2S_Type *ptr, uint32_t mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_i2s_find(ptr)->irq_enable &= ~mask;
+}
+
+uint32_t i2s_get_irq_status(I2S_Type *ptr)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    return host_i2s_find(ptr)->regs->STA;
+}
+
+void i2s_clear_irq_status(I2S_Type *ptr, uint32_t mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_periph_write((uint32_t)(uintptr_t)&ptr->STA, mask, 4);
+}
+
+uint32_t i2s_get_tx_line_fifo_level(I2S_Type *ptr, uint8_t line)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    return host_i2s_find(ptr)->tx[line].count;
+}
+
+uint32_t i2s_get_rx_line_fifo_level(I2S_Type *ptr, uint8_t line)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    return host_i2s_find(ptr)->rx[line].count;
+}
+
+void i2s_send_data(I2S_Type *ptr, uint8_t line, uint32_t data)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_periph_write((uint32_t)(uintptr_t)&ptr->TXD[line], data, 4);
+}
+
+void i2s_receive_data(I2S_Type *ptr, uint8_t line, uint32_t *data)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    *data = host_periph_read((uint32_t)(uintptr_t)&ptr->RXD[line], 4);
+}
+
+/*
+ * DMAv2驱动
+ */
+static uint32_t host_dma_encode_ctrl(const dma_channel_config_t *ch)
+{
+    uint32_t ctrl = 0;
+
+    ctrl |= (uint32_t)(ch->interrupt_mask & DMA_INTERRUPT_MASK_ALL) << HOST_DMA_CTRL_INTMASK_SHIFT;
+    ctrl |= (ch->src_mode == DMA_HANDSHAKE_MODE_HANDSHAKE) ? HOST_DMA_CTRL_SRCMODE : 0U;
+    ctrl |= (ch->dst_mode == DMA_HANDSHAKE_MODE_HANDSHAKE) ? HOST_DMA_CTRL_DSTMODE : 0U;
+    ctrl |= (uint32_t)ch->src_addr_ctrl << HOST_DMA_CTRL_SRCADDRCTRL_SHIFT;
+    ctrl |= (uint32_t)ch->dst_addr_ctrl << HOST_DMA_CTRL_DSTADDRCTRL_SHIFT;
+    ctrl |= (uint32_t)ch->src_width << HOST_DMA_CTRL_SRCWIDTH_SHIFT;
+    ctrl |= (uint32_t)ch->dst_width << HOST_DMA_CTRL_DSTWIDTH_SHIFT;
+    ctrl |= (uint32_t)ch->src_burst_size << HOST_DMA_CTRL_BURST_SHIFT;
+    ctrl |= ch->en_src_burst_in_fixed_trans ? HOST_DMA_CTRL_SRC_FIXED_BURST : 0U;
+    ctrl |= ch->en_dst_burst_in_fixed_trans ? HOST_DMA_CTRL_DST_FIXED_BURST : 0U;
+    return ctrl;
+}
+
+static hpm_stat_t host_dma_check_config(const dma_channel_config_t *ch)
+{
+    uint32_t width = 1UL << ch->src_width;
+
+    if ((ch->src_width > DMA_TRANSFER_WIDTH_WORD) || (ch->dst_width != ch->src_width) ||
+        (ch->src_burst_size > DMA_NUM_TRANSFER_PER_BURST_16T) || ((ch->size_in_byte % width) != 0U) ||
+        ((ch->src_addr % width) != 0U) || ((ch->dst_addr % width) != 0U) || ((ch->linked_ptr % 8U) != 0U)) {
+        return status_invalid_argument;
+    }
+    return status_success;
+}
+
+void dma_default_channel_config(DMAV2_Type *ptr, dma_channel_config_t *ch)
+{
+    (void)ptr;
+    host_cpu_step(HOST_DRV_CYCLES);
+    memset(ch, 0, sizeof(*ch));
+    ch->src_mode = DMA_HANDSHAKE_MODE_NORMAL;
+    ch->dst_mode = DMA_HANDSHAKE_MODE_NORMAL;
+    ch->src_burst_size = DMA_NUM_TRANSFER_PER_BURST_1T;
+    ch->src_width = DMA_TRANSFER_WIDTH_WORD;
+    ch->dst_width = DMA_TRANSFER_WIDTH_WORD;
+    ch->src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+    ch->dst_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;
+    ch->interrupt_mask = DMA_INTERRUPT_MASK_HALF_TC;
+}
+
+hpm_stat_t dma_setup_channel(DMAV2_Type *ptr, uint8_t ch_num, dma_channel_config_t *ch, bool start_transfer)
+{
+    host_dma_t *dma = host_dma_find(ptr);
+    uint32_t bit = 1UL << ch_num;
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    if ((ch_num >= DMA_SOC_CHANNEL_NUM) || (host_dma_check_config(ch) != status_success)) {
+        return status_invalid_argument;
+    }
+    host_dma_channel_off(dma, ch_num);
+    dma->regs->INTHALFSTS &= ~bit;
+    dma->regs->INTTCSTS &= ~bit;
+    dma->regs->INTABORTSTS &= ~bit;
+    dma->regs->INTERRSTS &= ~bit;
+    dma->regs->CHCTRL[ch_num].CTRL = host_dma_encode_ctrl(ch);
+    dma->regs->CHCTRL[ch_num].TRANSIZE = ch->size_in_byte >> ch->src_width;
+    dma->regs->CHCTRL[ch_num].SRCADDR = ch->src_addr;
+    dma->regs->CHCTRL[ch_num].DSTADDR = ch->dst_addr;
+    dma->regs->CHCTRL[ch_num].LLPOINTER = ch->linked_ptr;
+    dma->regs->CHCTRL[ch_num].CHANREQCTRL = 0;
+    if (start_transfer) {
+        host_dma_channel_on(dma, ch_num);
+        host_dma_kick();
+    }
+    return status_success;
+}
+
+hpm_stat_t dma_config_linked_descriptor(DMAV2_Type *ptr, dma_linked_descriptor_t *descriptor, uint8_t ch_num,
+                                        dma_channel_config_t *config)
+{
+    (void)ptr;
+    host_cpu_step(HOST_DRV_CYCLES);
+    if ((ch_num >= DMA_SOC_CHANNEL_NUM) || (host_dma_check_config(config) != status_success) ||
+        (((uintptr_t)descriptor % 8U) != 0U)) {
+        return status_invalid_argument;
+    }
+    descriptor->ctrl = host_dma_encode_ctrl(config) | HOST_DMA_CTRL_EN;
+    descriptor->trans_size = config->size_in_byte >> config->src_width;
+    descriptor->src_addr = config->src_addr;
+    descriptor->req_ctrl = 0;
+    descriptor->dst_addr = config->dst_addr;
+    descriptor->reserved0 = 0;
+    descriptor->linked_ptr = config->linked_ptr;
+    descriptor->reserved1 = 0;
+    return status_success;
+}
+
+hpm_stat_t dma_enable_channel(DMAV2_Type *ptr, uint32_t ch_index)
+{
+    host_dma_t *dma = host_dma_find(ptr);
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_dma_channel_on(dma, (uint8_t)ch_index);
+    host_dma_kick();
+    return status_success;
+}
+
+void dma_disable_channel(DMAV2_Type *ptr, uint32_t ch_index)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_dma_channel_off(host_dma_find(ptr), (uint8_t)ch_index);
+}
+
+bool dma_channel_is_enable(DMAV2_Type *ptr, uint32_t ch_index)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    return (host_dma_find(ptr)->regs->CHEN & (1UL << ch_index)) != 0U;
+}
+
+void dma_abort_channel(DMAV2_Type *ptr, uint32_t ch_index_mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_periph_write((uint32_t)(uintptr_t)&ptr->CHABORT, ch_index_mask, 4);
+}
+
+uint32_t dma_check_transfer_status(DMAV2_Type *ptr, uint8_t ch_index)
+{
+    DMAV2_Type *regs = host_dma_find(ptr)->regs;
+    uint32_t bit = 1UL << ch_index;
+    uint32_t status = 0;
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    if ((regs->INTTCSTS & bit) != 0U) {
+        status |= DMA_CHANNEL_STATUS_TC;
+        regs->INTTCSTS &= ~bit;
+    }
+    if ((regs->INTHALFSTS & bit) != 0U) {
+        status |= DMA_CHANNEL_STATUS_HALF_TC;
+        regs->INTHALFSTS &= ~bit;
+    }
+    if ((regs->INTERRSTS & bit) != 0U) {
+        status |= DMA_CHANNEL_STATUS_ERROR;
+        regs->INTERRSTS &= ~bit;
+    }
+    if ((regs->INTABORTSTS & bit) != 0U) {
+        status |= DMA_CHANNEL_STATUS_ABORT;
+        regs->INTABORTSTS &= ~bit;
+    }
+    if (status == 0U) {
+        status = DMA_CHANNEL_STATUS_ONGOING;
+    }
+    return status;
+}
+
+void dma_clear_transfer_status(DMAV2_Type *ptr, uint8_t ch_index)
+{
+    DMAV2_Type *regs = host_dma_find(ptr)->regs;
+    uint32_t bit = 1UL << ch_index;
+
+    host_cpu_step(HOST_DRV_CYCLES);
+    regs->INTTCSTS &= ~bit;
+    regs->INTHALFSTS &= ~bit;
+    regs->INTERRSTS &= ~bit;
+    regs->INTABORTSTS &= ~bit;
+}
+
+uint32_t dma_get_remaining_transfer_size(DMAV2_Type *ptr, uint32_t ch_index)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    return host_dma_find(ptr)->regs->CHCTRL[ch_index].TRANSIZE;
+}
+
+void dma_enable_channel_interrupt(DMAV2_Type *ptr, uint8_t ch_index, int32_t interrupt_mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_dma_find(ptr)->regs->CHCTRL[ch_index].CTRL &= ~((uint32_t)interrupt_mask << HOST_DMA_CTRL_INTMASK_SHIFT);
+}
+
+void dma_disable_channel_interrupt(DMAV2_Type *ptr, uint8_t ch_index, int32_t interrupt_mask)
+{
+    host_cpu_step(HOST_DRV_CYCLES);
+    host_dma_find(ptr)->regs->CHCTRL[ch_index].CTRL |= (uint32_t)interrupt_mask << HOST_DMA_CTRL_INTMASK_SHIFT;
+}
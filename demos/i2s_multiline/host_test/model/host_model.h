@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HOST_MODEL_H
+#define HOST_MODEL_H
+
+/*
+ * I2S多数据线示例的主机模型
+ *
+ * 在Linux上以单线程确定性地模拟CPU、中断、DMAv2和I2S：
+ * - CPU时间以周期计，函数入口/出口(-finstrument-functions)、寄存器写、驱动调用各消耗固定周期，
+ *   示例中的nop(由__asm重定向到host_cpu_idle)直接前进到下一个外设事件；
+ * - I2S的BCLK按采样率和每帧时隙数产生时隙节拍，每个节拍各数据线从发送FIFO取一个字，
+ *   FIFO空时输出0并置位TX_UD，FIFO深度不超过阈值时置位TX_DN并产生中断或DMA请求；
+ * - DMAv2按DMAMUX连接的请求以burst为单位传输，支持burst小循环和链表描述符；
+ * - 中断在函数入口、驱动调用和恢复全局中断时响应，中断处理函数不嵌套。
+ *
+ * 示例的main以demo_main的名字编译，由host_model_run调用，示例进入空闲且没有外设事件时结束，
+ * 输出各数据线的采样数和CRC、中断和DMA事件计数，与golden文件比较。
+ */
+
+#include <stdio.h>
+#include "hpm_common.h"
+#include "hpm_soc.h"
+
+#define HOST_CPU_HZ             (600000000UL)
+#define HOST_MCHTMR_HZ          (24000000UL)
+
+/* 每个时隙节拍调用，word为该数据线在时隙slot输出的字 */
+typedef void (*host_i2s_sink_t)(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data);
+
+typedef struct {
+    const char *name;           /* golden文件名 */
+    int (*entry)(void);         /* 示例的main */
+    uint32_t timeout_ms;        /* 模拟时间上限，超过时示例仍未结束视为失败 */
+    void (*setup)(void);        /* 示例启动前调用，设置sink、回环等 */
+    int (*check)(FILE *fp);     /* 示例结束后调用，向报告写入检查结果，返回失败数 */
+    uint32_t fault_ms;          /* 模拟时间到达fault_ms时调用一次fault，用于注入故障 */
+    void (*fault)(void);
+} host_demo_t;
+
+/* 运行示例并与golden比较，环境变量HOST_TEST_UPDATE_GOLDEN非空时改为更新golden，返回进程退出码 */
+int host_model_run(const host_demo_t *demo);
+
+/* 当前CPU周期数 */
+uint64_t host_cycles(void);
+
+/* 示例中的nop：响应中断并前进到下一个外设事件 */
+void host_cpu_idle(void);
+
+/* CPU忙等cycles个周期(如等待模型之外的外设完成)，期间外设事件照常执行并响应中断 */
+void host_cpu_wait(uint64_t cycles);
+
+void host_i2s_set_tx_sink(I2S_Type *i2s, host_i2s_sink_t sink, void *user_data);
+/* 接收数据线l的输入连接到发送数据线l的输出 */
+void host_i2s_set_loopback(I2S_Type *i2s, bool enable);
+
+/* 使通道立即以错误结束，用于测试恢复流程 */
+void host_dma_inject_error(DMAV2_Type *dma, uint8_t ch);
+
+#endif /* HOST_MODEL_H */
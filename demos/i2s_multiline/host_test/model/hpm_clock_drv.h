@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_CLOCK_DRV_H
+#define HPM_CLOCK_DRV_H
+
+#include "hpm_common.h"
+
+typedef enum {
+    clock_cpu0 = 0,
+    clock_cpu1,
+    clock_mchtmr0,
+    clock_ahb,
+    clock_i2s0,
+    clock_i2s1,
+    clock_i2s2,
+    clock_i2s3,
+} clock_name_t;
+
+uint32_t clock_get_frequency(clock_name_t clock_name);
+
+#endif /* HPM_CLOCK_DRV_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_COMMON_H
+#define HPM_COMMON_H
+
+/*
+ * 主机模型的hpm_common.h
+ *
+ * 只提供公共模块和示例用到的类型、属性和宏，内存放置属性在主机上只保留对齐，
+ * 中断开关和屏障由host_model.c实现
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+typedef uint32_t hpm_stat_t;
+
+#define MAKE_STATUS(group, code) ((uint32_t)(group) * 1000U + (uint32_t)(code))
+
+enum {
+    status_group_common = 0,
+};
+
+enum {
+    status_success = MAKE_STATUS(status_group_common, 0),
+    status_fail = MAKE_STATUS(status_group_common, 1),
+    status_invalid_argument = MAKE_STATUS(status_group_common, 2),
+    status_timeout = MAKE_STATUS(status_group_common, 3),
+    status_busy = MAKE_STATUS(status_group_common, 4),
+};
+
+#define ATTR_ALIGN(alignment)                               __attribute__((aligned(alignment)))
+#define ATTR_WEAK                                           __attribute__((weak))
+#define ATTR_RAMFUNC
+#define ATTR_SHARE_MEM
+#define ATTR_PLACE_AT(section_name)
+#define ATTR_PLACE_AT_WITH_ALIGNMENT(section_name, alignment) ATTR_ALIGN(alignment)
+#define ATTR_PLACE_AT_NONCACHEABLE
+#define ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(alignment) ATTR_ALIGN(alignment)
+#define ATTR_PLACE_AT_NONCACHEABLE_BSS
+#define ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(alignment) ATTR_ALIGN(alignment)
+
+#define HPM_ALIGN_DOWN(a, n)    ((uint32_t)(a) & ~((n) - 1U))
+#define HPM_ALIGN_UP(a, n)      (((uint32_t)(a) + ((n) - 1U)) & ~((n) - 1U))
+#define ARRAY_SIZE(a)           (sizeof(a) / sizeof((a)[0]))
+
+#define HPM_L1C_CACHELINE_SIZE  (64U)
+#define HPM_L1C_CACHELINE_ALIGN_DOWN(n) ((uint32_t)(n) & ~(HPM_L1C_CACHELINE_SIZE - 1U))
+#define HPM_L1C_CACHELINE_ALIGN_UP(n)   (((uint32_t)(n) + (HPM_L1C_CACHELINE_SIZE - 1U)) & ~(HPM_L1C_CACHELINE_SIZE - 1U))
+
+#define HPM_CORE0               (0U)
+#define HPM_CORE1               (1U)
+
+#define CSR_MSTATUS_MIE_MASK    (0x8UL)
+
+#define fencerw()               __sync_synchronize()
+
+/* 模型中的存储器即系统地址，核本地存储器不需要转换 */
+static inline uint32_t core_local_mem_to_sys_address(uint8_t core_id, uint32_t addr)
+{
+    (void)core_id;
+    return addr;
+}
+
+/* 全局中断开关，恢复时立即响应挂起的中断 */
+uint32_t disable_global_irq(uint32_t mask);
+void restore_global_irq(uint32_t mask);
+
+#endif /* HPM_COMMON_H */
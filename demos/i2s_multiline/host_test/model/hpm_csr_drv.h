@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_CSR_DRV_H
+#define HPM_CSR_DRV_H
+
+#include "hpm_common.h"
+
+/* 周期计数器为模型的CPU时间，每次读取本身也消耗少量周期 */
+#define CSR_MCYCLE                  (0xB00U)
+
+uint32_t host_read_csr(uint32_t csr);
+uint64_t hpm_csr_get_core_cycle(void);
+
+#define read_csr(csr)               host_read_csr(csr)
+
+#endif /* HPM_CSR_DRV_H */
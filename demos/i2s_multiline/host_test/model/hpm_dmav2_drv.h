@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_DMAV2_DRV_H
+#define HPM_DMAV2_DRV_H
+
+/*
+ * 主机模型的DMAv2驱动，接口与HPM SDK相同，由host_model.c实现：
+ * 握手模式的通道在请求有效时每次传输一个burst，非握手通道使能后连续传输，
+ * 传输完成一半和全部时置位状态，按链表指针装载下一个描述符，burst小循环时目的/源地址在每个burst后回到起点
+ */
+
+#include "hpm_soc.h"
+
+#define DMA_CHANNEL_STATUS_ONGOING          (1U)
+#define DMA_CHANNEL_STATUS_ERROR            (2U)
+#define DMA_CHANNEL_STATUS_ABORT            (4U)
+#define DMA_CHANNEL_STATUS_TC               (8U)
+#define DMA_CHANNEL_STATUS_HALF_TC          (16U)
+
+#define DMA_INTERRUPT_MASK_NONE             (0U)
+#define DMA_INTERRUPT_MASK_ERROR            (1U << 0)
+#define DMA_INTERRUPT_MASK_ABORT            (1U << 1)
+#define DMA_INTERRUPT_MASK_TERMINAL_COUNT   (1U << 2)
+#define DMA_INTERRUPT_MASK_HALF_TC          (1U << 3)
+#define DMA_INTERRUPT_MASK_ALL              (0xFU)
+
+#define DMA_TRANSFER_WIDTH_BYTE             (0U)
+#define DMA_TRANSFER_WIDTH_HALF_WORD        (1U)
+#define DMA_TRANSFER_WIDTH_WORD             (2U)
+#define DMA_TRANSFER_WIDTH_DOUBLE_WORD      (3U)
+
+#define DMA_ADDRESS_CONTROL_INCREMENT       (0U)
+#define DMA_ADDRESS_CONTROL_DECREMENT       (1U)
+#define DMA_ADDRESS_CONTROL_FIXED           (2U)
+
+#define DMA_HANDSHAKE_MODE_NORMAL           (0U)
+#define DMA_HANDSHAKE_MODE_HANDSHAKE        (1U)
+
+#define DMA_NUM_TRANSFER_PER_BURST_1T       (0U)
+#define DMA_NUM_TRANSFER_PER_BURST_2T       (1U)
+#define DMA_NUM_TRANSFER_PER_BURST_4T       (2U)
+#define DMA_NUM_TRANSFER_PER_BURST_8T       (3U)
+#define DMA_NUM_TRANSFER_PER_BURST_16T      (4U)
+
+#define DMA_SWAP_MODE_TABLE                 (0U)
+
+typedef struct {
+    uint32_t ctrl;
+    uint32_t trans_size;
+    uint32_t src_addr;
+    uint32_t req_ctrl;
+    uint32_t dst_addr;
+    uint32_t reserved0;
+    uint32_t linked_ptr;
+    uint32_t reserved1;
+} dma_linked_descriptor_t;
+
+typedef struct {
+    uint8_t priority;
+    uint8_t src_mode;
+    uint8_t dst_mode;
+    uint8_t src_burst_size;
+    uint8_t src_width;
+    uint8_t dst_width;
+    uint8_t src_addr_ctrl;
+    uint8_t dst_addr_ctrl;
+    uint16_t interrupt_mask;
+    uint32_t src_addr;
+    uint32_t dst_addr;
+    uint32_t linked_ptr;
+    uint32_t size_in_byte;
+    bool en_infiniteloop;
+    uint8_t handshake_opt;
+    uint8_t burst_opt;
+    bool en_src_burst_in_fixed_trans;
+    bool en_dst_burst_in_fixed_trans;
+    uint8_t swap_mode;
+    uint32_t swap_table;
+} dma_channel_config_t;
+
+void dma_default_channel_config(DMAV2_Type *ptr, dma_channel_config_t *ch);
+hpm_stat_t dma_setup_channel(DMAV2_Type *ptr, uint8_t ch_num, dma_channel_config_t *ch, bool start_transfer);
+hpm_stat_t dma_config_linked_descriptor(DMAV2_Type *ptr, dma_linked_descriptor_t *descriptor, uint8_t ch_num,
+                                        dma_channel_config_t *config);
+hpm_stat_t dma_enable_channel(DMAV2_Type *ptr, uint32_t ch_index);
+void dma_disable_channel(DMAV2_Type *ptr, uint32_t ch_index);
+bool dma_channel_is_enable(DMAV2_Type *ptr, uint32_t ch_index);
+void dma_abort_channel(DMAV2_Type *ptr, uint32_t ch_index_mask);
+uint32_t dma_check_transfer_status(DMAV2_Type *ptr, uint8_t ch_index);
+void dma_clear_transfer_status(DMAV2_Type *ptr, uint8_t ch_index);
+uint32_t dma_get_remaining_transfer_size(DMAV2_Type *ptr, uint32_t ch_index);
+void dma_enable_channel_interrupt(DMAV2_Type *ptr, uint8_t ch_index, int32_t interrupt_mask);
+void dma_disable_channel_interrupt(DMAV2_Type *ptr, uint8_t ch_index, int32_t interrupt_mask);
+
+#endif /* HPM_DMAV2_DRV_H */
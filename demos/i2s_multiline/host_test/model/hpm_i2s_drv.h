@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_I2S_DRV_H
+#define HPM_I2S_DRV_H
+
+/*
+ * 主机模型的I2S驱动，接口与HPM SDK相同，由host_model.c实现：
+ * 发送/接收FIFO深度为I2S_SOC_MAX_TX/RX_FIFO_DEPTH，FIFO深度不超过发送阈值时置位TX_DN并请求DMA，
+ * 接收FIFO深度达到接收阈值时置位RX_DA并请求DMA，发送FIFO空时输出0并置位TX_UD
+ */
+
+#include "hpm_soc.h"
+
+#define I2S_PROTOCOL_I2S_PHILIPS    (0U)
+#define I2S_PROTOCOL_MSB_JUSTIFIED  (1U)
+#define I2S_PROTOCOL_LSB_JUSTIFIED  (2U)
+#define I2S_PROTOCOL_PCM            (3U)
+
+typedef enum {
+    i2s_channel_length_16_bits = 0,
+    i2s_channel_length_32_bits,
+} i2s_channel_length_t;
+
+enum {
+    i2s_rx_fifo_threshold_irq_mask = 1U << 0,
+    i2s_tx_fifo_threshold_irq_mask = 1U << 1,
+    i2s_fifo_error_irq_mask = 1U << 2,
+};
+
+typedef struct {
+    bool invert_mclk_out;
+    bool invert_mclk_in;
+    bool use_external_mclk;
+    bool invert_bclk_out;
+    bool invert_bclk_in;
+    bool use_external_bclk;
+    bool invert_fclk_out;
+    bool invert_fclk_in;
+    bool use_external_fclk;
+    bool enable_mclk_out;
+    bool frame_start_at_rising_edge;
+    uint16_t tx_fifo_threshold;
+    uint16_t rx_fifo_threshold;
+} i2s_config_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    bool enable_tdm_mode;
+    uint8_t channel_num_per_frame;
+    uint8_t channel_length;
+    uint8_t audio_depth;
+    bool master_mode;
+    uint8_t protocol;
+    bool tx_data_line_en[4];
+    bool rx_data_line_en[4];
+    uint32_t tx_channel_slot_mask[4];
+    uint32_t rx_channel_slot_mask[4];
+} i2s_multiline_transfer_config_t;
+
+void i2s_get_default_config(I2S_Type *ptr, i2s_config_t *config);
+void i2s_init(I2S_Type *ptr, i2s_config_t *config);
+void i2s_get_default_multiline_transfer_config(i2s_multiline_transfer_config_t *transfer);
+hpm_stat_t i2s_config_multiline_transfer(I2S_Type *ptr, uint32_t mclk_in_hz, i2s_multiline_transfer_config_t *config);
+
+void i2s_start(I2S_Type *ptr);
+void i2s_stop(I2S_Type *ptr);
+void i2s_enable(I2S_Type *ptr);
+void i2s_disable(I2S_Type *ptr);
+void i2s_reset_tx(I2S_Type *ptr);
+void i2s_reset_rx(I2S_Type *ptr);
+void i2s_reset_tx_rx(I2S_Type *ptr);
+void i2s_enable_tx_dma_request(I2S_Type *ptr);
+void i2s_disable_tx_dma_request(I2S_Type *ptr);
+void i2s_enable_rx_dma_request(I2S_Type *ptr);
+void i2s_disable_rx_dma_request(I2S_Type *ptr);
+void i2s_enable_irq(I2S_Type *ptr, uint32_t mask);
+void i2s_disable_irq(I2S_Type *ptr, uint32_t mask);
+uint32_t i2s_get_irq_status(I2S_Type *ptr);
+void i2s_clear_irq_status(I2S_Type *ptr, uint32_t mask);
+uint32_t i2s_get_tx_line_fifo_level(I2S_Type *ptr, uint8_t line);
+uint32_t i2s_get_rx_line_fifo_level(I2S_Type *ptr, uint8_t line);
+
+/* 读RXD会从接收FIFO中取出数据，由模型实现 */
+void i2s_send_data(I2S_Type *ptr, uint8_t line, uint32_t data);
+void i2s_receive_data(I2S_Type *ptr, uint8_t line, uint32_t *data);
+
+#endif /* HPM_I2S_DRV_H */
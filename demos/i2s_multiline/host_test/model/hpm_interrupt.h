@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_INTERRUPT_H
+#define HPM_INTERRUPT_H
+
+#include "hpm_common.h"
+
+/* 中断服务函数在程序启动时登记到模型，由模型在指令边界(函数入口)响应 */
+void host_irq_register(uint32_t irq, void (*isr)(void));
+
+#define SDK_DECLARE_EXT_ISR_M(irq, isr)                                                  \
+    void isr(void);                                                                      \
+    __attribute__((constructor, no_instrument_function)) static void host_isr_##isr(void) \
+    {                                                                                    \
+        host_irq_register((irq), isr);                                                   \
+    }
+
+void intc_m_enable_irq(uint32_t irq);
+void intc_m_disable_irq(uint32_t irq);
+void intc_m_enable_irq_with_priority(uint32_t irq, uint32_t priority);
+
+#endif /* HPM_INTERRUPT_H */
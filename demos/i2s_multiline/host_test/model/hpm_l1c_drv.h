@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_L1C_DRV_H
+#define HPM_L1C_DRV_H
+
+#include "hpm_common.h"
+
+/*
+ * 主机上没有数据缓存，维护操作只检查地址和长度是否按cache line对齐，
+ * 未对齐的操作在硬件上会波及相邻数据，由模型计数并在报告中给出
+ */
+void l1c_dc_writeback(uint32_t address, uint32_t size);
+void l1c_dc_invalidate(uint32_t address, uint32_t size);
+void l1c_dc_flush(uint32_t address, uint32_t size);
+void l1c_dc_writeback_all(void);
+void l1c_dc_invalidate_all(void);
+
+#endif /* HPM_L1C_DRV_H */
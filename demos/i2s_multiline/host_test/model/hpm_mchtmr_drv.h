@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_MCHTMR_DRV_H
+#define HPM_MCHTMR_DRV_H
+
+#include "hpm_soc.h"
+
+/* 计数值由模型的CPU时间按clock_mchtmr0换算 */
+uint64_t mchtmr_get_count(MCHTMR_Type *ptr);
+
+#endif /* HPM_MCHTMR_DRV_H */
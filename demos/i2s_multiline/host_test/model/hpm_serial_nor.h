@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_SERIAL_NOR_H
+#define HPM_SERIAL_NOR_H
+
+/*
+ * 主机上的串行NOR Flash组件接口，只包含flash_service和i2s_nor_flash_stream用到的部分，由使用它的测试实现
+ */
+
+#include "hpm_serial_nor_host.h"
+
+typedef struct {
+    uint32_t size_in_kbytes;
+    uint32_t sector_size_kbytes;
+    uint32_t block_size_kbytes;
+    uint32_t page_size;
+} hpm_serial_nor_info_t;
+
+typedef struct hpm_serial_nor {
+    hpm_serial_nor_host_t host;
+    hpm_serial_nor_info_t flash_info;
+} hpm_serial_nor_t;
+
+hpm_stat_t hpm_serial_nor_init(hpm_serial_nor_t *flash, hpm_serial_nor_info_t *info);
+hpm_stat_t hpm_serial_nor_get_info(hpm_serial_nor_t *flash, hpm_serial_nor_info_t *info);
+hpm_stat_t hpm_serial_nor_read(hpm_serial_nor_t *flash, uint8_t *buf, uint32_t data_len, uint32_t address);
+hpm_stat_t hpm_serial_nor_program_blocking(hpm_serial_nor_t *flash, uint8_t *buf, uint32_t data_len,
+                                           uint32_t address);
+hpm_stat_t hpm_serial_nor_erase_blocking(hpm_serial_nor_t *flash, uint32_t start, uint32_t length);
+
+#endif /* HPM_SERIAL_NOR_H */
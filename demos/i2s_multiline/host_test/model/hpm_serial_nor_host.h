@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_SERIAL_NOR_HOST_H
+#define HPM_SERIAL_NOR_HOST_H
+
+/*
+ * 主机上的串行NOR Flash主机参数，只包含示例和移植层用到的字段
+ */
+
+#include "hpm_common.h"
+#include "hpm_soc.h"
+
+typedef struct {
+    void *dma_base;
+    void *dmamux_base;
+    uint8_t rx_dma_ch;
+    uint8_t tx_dma_ch;
+    uint8_t rx_dma_req;
+    uint8_t tx_dma_req;
+} hpm_nor_host_dma_control_t;
+
+typedef struct {
+    void *host_base;
+    uint32_t frequency;
+    hpm_nor_host_dma_control_t dma_control;
+} hpm_nor_host_param_t;
+
+typedef struct {
+    uint32_t flags;
+    hpm_nor_host_param_t param;
+} hpm_serial_nor_host_param_t;
+
+typedef struct {
+    hpm_serial_nor_host_param_t host_param;
+} hpm_serial_nor_host_t;
+
+#endif /* HPM_SERIAL_NOR_HOST_H */
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_SERIAL_NOR_HOST_PORT_H
+#define HPM_SERIAL_NOR_HOST_PORT_H
+
+/*
+ * 主机上的spi_nor_flash移植层接口，与spi_nor_flash/common/port相同，由使用它的测试实现
+ */
+
+#include "hpm_serial_nor_host.h"
+
+hpm_stat_t serial_nor_get_board_dma_channel(void *dma_base, uint8_t *rx_dma_ch, uint8_t *tx_dma_ch);
+hpm_stat_t serial_nor_get_board_host(hpm_serial_nor_host_t *host);
+void serial_nor_spi_pins_init(SPI_Type *spi);
+
+#endif /* HPM_SERIAL_NOR_HOST_PORT_H */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_SOC_H
+#define HPM_SOC_H
+
+/*
+ * 主机模型的SoC定义
+ *
+ * 寄存器布局与HPM SDK一致，外设位于固定的32位地址窗口，CPU以只读方式映射该窗口，
+ * 写寄存器产生的异常由host_model.c解码后交给外设模型(写TXD入FIFO、写1清除状态等)，
+ * 因此示例中直接写TXD和状态寄存器的代码不需要修改。
+ * 模型SoC同时具有HPM6E00的DMAv2 burst小循环功能和HPM6P00每条数据线独立的I2S DMA请求，
+ * 两种DMA引擎的示例都能运行。
+ */
+
+#include "hpm_common.h"
+
+/* 模型内部需要写只读寄存器，包含本文件前可将__R定义为volatile */
+#ifndef __R
+#define __R     volatile const
+#endif
+#define __W     volatile
+#define __RW    volatile
+
+/* I2S */
+typedef struct {
+    __RW uint32_t CTRL;                 /* 0x0 */
+    __R  uint32_t RFIFO_FILLINGS;       /* 0x4: 每条数据线8位 */
+    __R  uint32_t TFIFO_FILLINGS;       /* 0x8: 每条数据线8位 */
+    __RW uint32_t FIFO_THRESH;          /* 0xC */
+    __RW uint32_t STA;                  /* 0x10 */
+    __R  uint8_t  RESERVED0[12];
+    __R  uint32_t RXD[4];               /* 0x20 */
+    __W  uint32_t TXD[4];               /* 0x30 */
+    __R  uint8_t  RESERVED1[16];
+    __RW uint32_t CFGR;                 /* 0x50 */
+    __R  uint8_t  RESERVED2[4];
+    __RW uint32_t MISC_CFGR;            /* 0x58 */
+    __R  uint8_t  RESERVED3[4];
+    __RW uint32_t RXDSLOT[4];           /* 0x60 */
+    __RW uint32_t TXDSLOT[4];           /* 0x70 */
+} I2S_Type;
+
+#define I2S_CTRL_I2S_EN_MASK        (0x1UL)
+#define I2S_CTRL_RX_EN_SHIFT        (8U)
+#define I2S_CTRL_RX_EN_MASK         (0xF00UL)
+#define I2S_CTRL_TX_EN_SHIFT        (12U)
+#define I2S_CTRL_TX_EN_MASK         (0xF000UL)
+#define I2S_CTRL_RX_DMA_EN_MASK     (0x10000UL)
+#define I2S_CTRL_TX_DMA_EN_MASK     (0x20000UL)
+
+#define I2S_STA_RX_DA_SHIFT         (0U)
+#define I2S_STA_RX_DA_MASK          (0xFUL)
+#define I2S_STA_TX_DN_SHIFT         (4U)
+#define I2S_STA_TX_DN_MASK          (0xF0UL)
+#define I2S_STA_RX_OV_SHIFT         (8U)
+#define I2S_STA_RX_OV_MASK          (0xF00UL)
+#define I2S_STA_TX_UD_SHIFT         (12U)
+#define I2S_STA_TX_UD_MASK          (0xF000UL)
+
+#define I2S_SOC_MAX_LINE_NUM        (4U)
+#define I2S_SOC_MAX_CHANNEL_NUM     (16U)
+#define I2S_SOC_MAX_TX_FIFO_DEPTH   (8U)
+#define I2S_SOC_MAX_RX_FIFO_DEPTH   (8U)
+
+/* DMAv2 */
+typedef struct {
+    __R  uint8_t  RESERVED0[16];
+    __R  uint32_t IDMISC;               /* 0x10 */
+    __R  uint8_t  RESERVED1[12];
+    __RW uint32_t DMACTRL;              /* 0x20 */
+    __W  uint32_t CHABORT;              /* 0x24 */
+    __R  uint8_t  RESERVED2[8];
+    __RW uint32_t INTHALFSTS;           /* 0x30: 写1清除 */
+    __RW uint32_t INTTCSTS;             /* 0x34: 写1清除 */
+    __RW uint32_t INTABORTSTS;          /* 0x38: 写1清除 */
+    __RW uint32_t INTERRSTS;            /* 0x3C: 写1清除 */
+    __R  uint32_t CHEN;                 /* 0x40 */
+    __R  uint8_t  RESERVED3[60];
+    struct {
+        __RW uint32_t CTRL;             /* 0x80 */
+        __RW uint32_t TRANSIZE;         /* 0x84: 剩余传输数 */
+        __RW uint32_t SRCADDR;          /* 0x88 */
+        __RW uint32_t CHANREQCTRL;      /* 0x8C */
+        __RW uint32_t DSTADDR;          /* 0x90 */
+        __R  uint8_t  RESERVED0[4];
+        __RW uint32_t LLPOINTER;        /* 0x98 */
+        __R  uint8_t  RESERVED1[4];
+    } CHCTRL[32];
+} DMAV2_Type;
+
+#define DMA_SOC_CHANNEL_NUM         (32U)
+#define DMA_SOC_MAX_COUNT           (2U)
+#define DMA_SOC_TRANSFER_WIDTH_MAX(x) (3U)
+#define DMA_SOC_TRANSFER_PER_BURST_MAX(x) (10U)
+
+/* DMAMUX：HDMA使用输出0~31，XDMA使用输出32~63 */
+typedef struct {
+    __RW uint32_t MUXCFG[64];
+} DMAMUX_Type;
+
+#define DMAMUX_MUXCFG_ENABLE_MASK   (0x80000000UL)
+#define DMAMUX_MUXCFG_SOURCE_MASK   (0x7FUL)
+
+/* IOC */
+typedef struct {
+    struct {
+        __RW uint32_t FUNC_CTL;
+        __RW uint32_t PAD_CTL;
+    } PAD[256];
+} IOC_Type;
+
+/* SPI：SPI NOR读取由测试中的Flash模型直接完成，寄存器不使用 */
+typedef struct {
+    __RW uint32_t REG[64];
+} SPI_Type;
+
+/* MCHTMR */
+typedef struct {
+    __RW uint64_t MTIME;
+    __RW uint64_t MTIMECMP;
+} MCHTMR_Type;
+
+/* 外设地址窗口，CPU只读映射，写操作由模型解码 */
+#define HPM_I2S0_BASE               (0xF0000000UL)
+#define HPM_I2S1_BASE               (0xF0001000UL)
+#define HPM_I2S2_BASE               (0xF0002000UL)
+#define HPM_I2S3_BASE               (0xF0003000UL)
+#define HPM_HDMA_BASE               (0xF0010000UL)
+#define HPM_XDMA_BASE               (0xF0011000UL)
+
+#define HPM_I2S0                    ((I2S_Type *)HPM_I2S0_BASE)
+#define HPM_I2S1                    ((I2S_Type *)HPM_I2S1_BASE)
+#define HPM_I2S2                    ((I2S_Type *)HPM_I2S2_BASE)
+#define HPM_I2S3                    ((I2S_Type *)HPM_I2S3_BASE)
+#define HPM_HDMA                    ((DMAV2_Type *)HPM_HDMA_BASE)
+#define HPM_XDMA                    ((DMAV2_Type *)HPM_XDMA_BASE)
+
+/* 不需要拦截写操作的外设为普通全局变量 */
+extern DMAMUX_Type host_dmamux;
+extern IOC_Type host_ioc;
+extern MCHTMR_Type host_mchtmr;
+extern SPI_Type host_spi1;
+#define HPM_DMAMUX                  (&host_dmamux)
+#define HPM_IOC                     (&host_ioc)
+#define HPM_MCHTMR                  (&host_mchtmr)
+#define HPM_SPI1                    (&host_spi1)
+
+#define DMA_SOC_CHN_TO_DMAMUX_CHN(ptr, n) (((ptr) == HPM_XDMA) ? (32U + (n)) : (n))
+
+#define HPM_IP_FEATURE_DMAV2_BURST_IN_FIXED_TRANS (1)
+
+/* 中断号 */
+#define IRQn_HDMA                   (10U)
+#define IRQn_XDMA                   (11U)
+#define IRQn_I2S0                   (20U)
+#define IRQn_I2S1                   (21U)
+#define IRQn_I2S2                   (22U)
+#define IRQn_I2S3                   (23U)
+#define IRQn_MBX0A                  (30U)
+#define IRQn_MBX0B                  (31U)
+
+/* DMA请求源：SPI1，每个I2S一对公共请求(按数据线0的深度)和每条数据线独立的请求 */
+#define HPM_DMA_SRC_SPI1_RX         (0x02U)
+#define HPM_DMA_SRC_SPI1_TX         (0x03U)
+#define HPM_DMA_SRC_I2S0_RX         (0x10U)
+#define HPM_DMA_SRC_I2S0_TX         (0x11U)
+#define HPM_DMA_SRC_I2S1_RX         (0x12U)
+#define HPM_DMA_SRC_I2S1_TX         (0x13U)
+#define HPM_DMA_SRC_I2S2_RX         (0x14U)
+#define HPM_DMA_SRC_I2S2_TX         (0x15U)
+#define HPM_DMA_SRC_I2S3_RX         (0x16U)
+#define HPM_DMA_SRC_I2S3_TX         (0x17U)
+#define HPM_DMA_SRC_I2S0_TX_0       (0x20U)
+#define HPM_DMA_SRC_I2S0_TX_1       (0x21U)
+#define HPM_DMA_SRC_I2S0_TX_2       (0x22U)
+#define HPM_DMA_SRC_I2S0_TX_3       (0x23U)
+#define HPM_DMA_SRC_I2S1_TX_0       (0x24U)
+#define HPM_DMA_SRC_I2S1_TX_1       (0x25U)
+#define HPM_DMA_SRC_I2S1_TX_2       (0x26U)
+#define HPM_DMA_SRC_I2S1_TX_3       (0x27U)
+#define HPM_DMA_SRC_I2S2_TX_0       (0x28U)
+#define HPM_DMA_SRC_I2S2_TX_1       (0x29U)
+#define HPM_DMA_SRC_I2S2_TX_2       (0x2AU)
+#define HPM_DMA_SRC_I2S2_TX_3       (0x2BU)
+#define HPM_DMA_SRC_I2S3_TX_0       (0x2CU)
+#define HPM_DMA_SRC_I2S3_TX_1       (0x2DU)
+#define HPM_DMA_SRC_I2S3_TX_2       (0x2EU)
+#define HPM_DMA_SRC_I2S3_TX_3       (0x2FU)
+#define HPM_DMA_SRC_I2S0_RX_0       (0x30U)
+#define HPM_DMA_SRC_I2S0_RX_1       (0x31U)
+#define HPM_DMA_SRC_I2S0_RX_2       (0x32U)
+#define HPM_DMA_SRC_I2S0_RX_3       (0x33U)
+
+/* 引脚：端口A~D各32个 */
+#define IOC_PAD_PB00                (32U)
+#define IOC_PAD_PB01                (33U)
+#define IOC_PAD_PB02                (34U)
+#define IOC_PAD_PB03                (35U)
+#define IOC_PAD_PB04                (36U)
+#define IOC_PAD_PB05                (37U)
+#define IOC_PAD_PB06                (38U)
+#define IOC_PAD_PB07                (39U)
+#define IOC_PAD_PB08                (40U)
+#define IOC_PAD_PB09                (41U)
+#define IOC_PAD_PB10                (42U)
+#define IOC_PAD_PB11                (43U)
+#define IOC_PAD_PD01                (97U)
+#define IOC_PAD_PD02                (98U)
+#define IOC_PAD_PD03                (99U)
+#define IOC_PAD_PD18                (114U)
+#define IOC_PAD_PD19                (115U)
+#define IOC_PAD_PD20                (116U)
+#define IOC_PAD_PD21                (117U)
+
+#define IOC_PB00_FUNC_CTL_I2S0_TXD_0    (8U)
+#define IOC_PB01_FUNC_CTL_I2S0_BCLK     (8U)
+#define IOC_PB02_FUNC_CTL_I2S0_TXD_3    (8U)
+#define IOC_PB03_FUNC_CTL_I2S0_TXD_1    (8U)
+#define IOC_PB05_FUNC_CTL_I2S0_TXD_2    (8U)
+#define IOC_PB06_FUNC_CTL_I2S0_RXD_0    (8U)
+#define IOC_PB07_FUNC_CTL_I2S0_RXD_1    (8U)
+#define IOC_PB08_FUNC_CTL_I2S0_RXD_2    (8U)
+#define IOC_PB09_FUNC_CTL_I2S0_RXD_3    (8U)
+#define IOC_PB10_FUNC_CTL_I2S0_FCLK     (8U)
+#define IOC_PB11_FUNC_CTL_I2S0_MCLK     (8U)
+#define IOC_PD01_FUNC_CTL_I2S0_MCLK     (8U)
+#define IOC_PD02_FUNC_CTL_I2S0_BCLK     (8U)
+#define IOC_PD03_FUNC_CTL_I2S0_FCLK     (8U)
+#define IOC_PD18_FUNC_CTL_I2S0_TXD_0    (8U)
+#define IOC_PD19_FUNC_CTL_I2S0_TXD_1    (8U)
+#define IOC_PD20_FUNC_CTL_I2S0_TXD_2    (8U)
+#define IOC_PD21_FUNC_CTL_I2S0_TXD_3    (8U)
+
+#endif /* HPM_SOC_H */
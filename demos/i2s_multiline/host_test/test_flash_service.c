@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * spi_nor_flash双核Flash服务的环：主线程作为客户端，另一个线程作为服务端，门铃和等待用信号量实现。
+ * 服务端操作内存中的NOR模型(擦除为0xFF，编程按位与)，客户端随机读、编程和擦除，
+ * 每次读取与影子副本比较。覆盖：
+ * 1. 读和编程超过一个中转缓冲区时分块，擦除长度超过中转缓冲区时整体执行；
+ * 2. 环满时客户端等待，投递的编程失败由flush报告，之后恢复正常；
+ * 3. 服务端的cache维护操作都按cache line对齐(对齐的请求槽不会使相邻的槽失效)。
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <time.h>
+#include "hpm_l1c_drv.h"
+#include "flash_service.h"
+
+#define TEST_FLASH_SIZE     (256U * 1024U)
+#define TEST_SECTOR_SIZE    (4096U)
+#define TEST_BLOCK_SIZE     (64U * 1024U)
+#define TEST_BAD_SECTOR     (TEST_FLASH_SIZE - TEST_SECTOR_SIZE)   /* 编程总是失败的扇区 */
+#define TEST_OPS            (50000U)
+#define TEST_WAIT_MS        (2000U)
+
+typedef struct {
+    uint8_t mem[TEST_FLASH_SIZE];
+    uint32_t reads;
+    uint32_t programs;
+    uint32_t erases;
+} test_nor_t;
+
+static hpm_serial_nor_t nor;
+static test_nor_t nor_model;
+static uint8_t shadow[TEST_FLASH_SIZE];
+static uint8_t io_buf[3U * FLASH_SERVICE_XFER_SIZE];
+static flash_service_ring_t ring;
+static uint8_t pool[FLASH_SERVICE_RING_SIZE * FLASH_SERVICE_XFER_SIZE] ATTR_ALIGN(FLASH_SERVICE_LINE_SIZE);
+static flash_service_client_t client;
+static flash_service_server_t server;
+static sem_t to_server;
+static sem_t to_client;
+static volatile bool server_stop;
+static volatile uint32_t l1c_ops;
+static volatile uint32_t l1c_unaligned;
+
+static uint32_t rand_state = 1;
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1664525UL + 1013904223UL;
+    return rand_state >> 8;
+}
+
+/* NOR模型，每次操作让出CPU，使两个线程的执行交错 */
+hpm_stat_t hpm_serial_nor_get_info(hpm_serial_nor_t *flash, hpm_serial_nor_info_t *info)
+{
+    (void)flash;
+    info->size_in_kbytes = TEST_FLASH_SIZE / 1024U;
+    info->sector_size_kbytes = TEST_SECTOR_SIZE / 1024U;
+    info->block_size_kbytes = TEST_BLOCK_SIZE / 1024U;
+    info->page_size = 256U;
+    return status_success;
+}
+
+hpm_stat_t hpm_serial_nor_read(hpm_serial_nor_t *flash, uint8_t *buf, uint32_t data_len, uint32_t address)
+{
+    (void)flash;
+    if ((address > TEST_FLASH_SIZE) || (data_len > TEST_FLASH_SIZE - address)) {
+        return status_invalid_argument;
+    }
+    sched_yield();
+    memcpy(buf, &nor_model.mem[address], data_len);
+    nor_model.reads++;
+    return status_success;
+}
+
+hpm_stat_t hpm_serial_nor_program_blocking(hpm_serial_nor_t *flash, uint8_t *buf, uint32_t data_len,
+                                           uint32_t address)
+{
+    (void)flash;
+    if ((address > TEST_FLASH_SIZE) || (data_len > TEST_FLASH_SIZE - address)) {
+        return status_invalid_argument;
+    }
+    if (address + data_len > TEST_BAD_SECTOR) {
+        return status_fail;
+    }
+    sched_yield();
+    for (uint32_t i = 0; i < data_len; i++) {
+        nor_model.mem[address + i] &= buf[i];
+    }
+    nor_model.programs++;
+    return status_success;
+}
+
+hpm_stat_t hpm_serial_nor_erase_blocking(hpm_serial_nor_t *flash, uint32_t start, uint32_t length)
+{
+    (void)flash;
+    if (((start % TEST_SECTOR_SIZE) != 0U) || ((length % TEST_SECTOR_SIZE) != 0U) ||
+        (start > TEST_FLASH_SIZE) || (length > TEST_FLASH_SIZE - start)) {
+        return status_invalid_argument;
+    }
+    sched_yield();
+    memset(&nor_model.mem[start], 0xFF, length);
+    nor_model.erases++;
+    return status_success;
+}
+
+/* 主机上没有数据缓存，只检查服务端的维护操作是否按cache line对齐 */
+static void test_l1c_op(uint32_t address, uint32_t size)
+{
+    l1c_ops++;
+    if (((address % FLASH_SERVICE_LINE_SIZE) != 0U) || ((size % FLASH_SERVICE_LINE_SIZE) != 0U)) {
+        l1c_unaligned++;
+    }
+}
+
+void l1c_dc_writeback(uint32_t address, uint32_t size)
+{
+    test_l1c_op(address, size);
+}
+
+void l1c_dc_invalidate(uint32_t address, uint32_t size)
+{
+    test_l1c_op(address, size);
+}
+
+void l1c_dc_flush(uint32_t address, uint32_t size)
+{
+    test_l1c_op(address, size);
+}
+
+static void doorbell(void *context)
+{
+    sem_post((sem_t *)context);
+}
+
+static hpm_stat_t wait_server(void *context)
+{
+    struct timespec ts;
+
+    (void)context;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += TEST_WAIT_MS / 1000U;
+    return (sem_timedwait(&to_client, &ts) == 0) ? status_success : status_timeout;
+}
+
+static void *server_thread(void *arg)
+{
+    struct timespec ts;
+
+    (void)arg;
+    flash_service_server_init(&server, &ring, &nor, status_success, doorbell, &to_client);
+    while (!server_stop) {
+        if (!flash_service_server_poll(&server)) {
+            clock_gettime(CLOCK_REALTIME, &ts);
+            ts.tv_nsec += 10000000L;
+            if (ts.tv_nsec >= 1000000000L) {
+                ts.tv_sec++;
+                ts.tv_nsec -= 1000000000L;
+            }
+            sem_timedwait(&to_server, &ts);
+        }
+    }
+    return NULL;
+}
+
+static int check_read(uint32_t addr, uint32_t len)
+{
+    hpm_stat_t stat = flash_service_read(&client, io_buf, len, addr);
+
+    if (stat != status_success) {
+        printf("FAIL: read 0x%lx+%lu returned %lu\n", (unsigned long)addr, (unsigned long)len, (unsigned long)stat);
+        return 1;
+    }
+    if (memcmp(io_buf, &shadow[addr], len) != 0) {
+        printf("FAIL: read 0x%lx+%lu differs from the shadow copy\n", (unsigned long)addr, (unsigned long)len);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_all(void)
+{
+    int fails = 0;
+
+    uint32_t len;
+
+    for (uint32_t addr = 0; addr < TEST_FLASH_SIZE; addr += len) {
+        len = (TEST_FLASH_SIZE - addr < sizeof(io_buf)) ? TEST_FLASH_SIZE - addr : sizeof(io_buf);
+        fails += check_read(addr, len);
+    }
+    return fails;
+}
+
+static int random_ops(void)
+{
+    uint32_t op;
+    uint32_t addr;
+    uint32_t len;
+    hpm_stat_t stat;
+    int fails = 0;
+
+    for (uint32_t i = 0; (i < TEST_OPS) && (fails == 0); i++) {
+        op = test_rand() % 20U;
+        if (op < 8U) {
+            len = 1U + test_rand() % sizeof(io_buf);
+            addr = test_rand() % (TEST_FLASH_SIZE - len);
+            fails += check_read(addr, len);
+        } else if (op < 17U) {
+            /* 编程避开失败扇区，长度最多两个半中转缓冲区 */
+            len = 1U + test_rand() % (5U * FLASH_SERVICE_XFER_SIZE / 2U);
+            addr = test_rand() % (TEST_BAD_SECTOR - len);
+            for (uint32_t k = 0; k < len; k++) {
+                io_buf[k] = (uint8_t)test_rand();
+                shadow[addr + k] &= io_buf[k];
+            }
+            stat = flash_service_program(&client, io_buf, len, addr);
+            if (stat != status_success) {
+                printf("FAIL: program 0x%lx+%lu returned %lu\n", (unsigned long)addr, (unsigned long)len,
+                       (unsigned long)stat);
+                fails++;
+            }
+        } else {
+            /* 1 ~ 24个扇区，多数超过一个中转缓冲区 */
+            len = (1U + test_rand() % 24U) * TEST_SECTOR_SIZE;
+            addr = (test_rand() % ((TEST_FLASH_SIZE - len) / TEST_SECTOR_SIZE + 1U)) * TEST_SECTOR_SIZE;
+            memset(&shadow[addr], 0xFF, len);
+            stat = flash_service_erase(&client, addr, len);
+            if (stat != status_success) {
+                printf("FAIL: erase 0x%lx+%lu returned %lu\n", (unsigned long)addr, (unsigned long)len,
+                       (unsigned long)stat);
+                fails++;
+            }
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    pthread_t thread;
+    hpm_serial_nor_info_t info;
+    hpm_stat_t stat;
+    int fails = 0;
+
+    memset(nor_model.mem, 0xA5, sizeof(nor_model.mem));
+    memset(shadow, 0xA5, sizeof(shadow));
+    sem_init(&to_server, 0, 0);
+    sem_init(&to_client, 0, 0);
+    flash_service_client_init(&client, &ring, pool, (uint32_t)pool, doorbell, wait_server, &to_server);
+    pthread_create(&thread, NULL, server_thread, NULL);
+
+    stat = flash_service_client_wait_ready(&client, &info);
+    if ((stat != status_success) || (info.size_in_kbytes != TEST_FLASH_SIZE / 1024U) ||
+        (info.sector_size_kbytes != TEST_SECTOR_SIZE / 1024U)) {
+        printf("FAIL: flash geometry not published\n");
+        fails++;
+    }
+
+    /* 整片擦除，一个请求 */
+    memset(shadow, 0xFF, sizeof(shadow));
+    if ((flash_service_erase(&client, 0, TEST_FLASH_SIZE) != status_success) ||
+        (flash_service_flush(&client) != status_success)) {
+        printf("FAIL: full chip erase\n");
+        fails++;
+    }
+    fails += check_all();
+
+    fails += random_ops();
+    if (flash_service_flush(&client) != status_success) {
+        printf("FAIL: flush after random operations\n");
+        fails++;
+    }
+    fails += check_all();
+
+    /* 投递的编程失败由flush报告一次，之后的请求正常 */
+    memset(io_buf, 0, TEST_SECTOR_SIZE);
+    if ((flash_service_program(&client, io_buf, TEST_SECTOR_SIZE, TEST_BAD_SECTOR) != status_success) ||
+        (flash_service_flush(&client) != status_fail) || (flash_service_flush(&client) != status_success)) {
+        printf("FAIL: deferred program failure not reported exactly once\n");
+        fails++;
+    }
+    fails += check_read(0, sizeof(io_buf));
+
+    server_stop = true;
+    sem_post(&to_server);
+    pthread_join(thread, NULL);
+
+    printf("flash service: %lu requests served (%lu reads, %lu programs, %lu erases), %lu posts found the ring full\n",
+           (unsigned long)server.served, (unsigned long)nor_model.reads, (unsigned long)nor_model.programs,
+           (unsigned long)nor_model.erases, (unsigned long)client.full_waits);
+    printf("cache maintenance: %lu operations, %lu not line aligned\n", (unsigned long)l1c_ops,
+           (unsigned long)l1c_unaligned);
+    if (l1c_unaligned != 0U) {
+        fails++;
+    }
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
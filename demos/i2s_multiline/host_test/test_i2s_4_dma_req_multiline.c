@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_4_dma_req_multiline：每条数据线一个DMA请求和通道，4个通道广播同一个环，
+ * 先运行DMA中断轮询和分发的性能测试，再播放
+ */
+
+#include "host_line_check.h"
+
+int demo_main(void);
+
+/* 示例的test_data，立体声交替，4条数据线发送相同的数据 */
+static const uint32_t test_data[] = {
+    0x11111111, 0x22222222, 0x33333333, 0x44444444, 0x55555555, 0x66666666, 0x77777777, 0x88888888,
+    0x99999999, 0xAAAAAAAA, 0xBBBBBBBB, 0xCCCCCCCC, 0xDDDDDDDD, 0xEEEEEEEE, 0xFFFFFFFF, 0x5A5A5A5A,
+};
+
+static int32_t test_data_index(uint32_t word)
+{
+    for (uint32_t i = 0; i < ARRAY_SIZE(test_data); i++) {
+        if (test_data[i] == word) {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+static bool broadcast_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    int32_t index = test_data_index(word);
+
+    (void)line;
+    return (index >= 0) && (((uint32_t)index & 1U) == slot);
+}
+
+static bool broadcast_follows(uint32_t prev, uint32_t word)
+{
+    return ((test_data_index(prev) + 2) % (int32_t)ARRAY_SIZE(test_data)) == test_data_index(word);
+}
+
+static host_line_check_t line_check = {
+    .valid = broadcast_valid,
+    .follows = broadcast_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static int check(FILE *fp)
+{
+    return host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_4_dma_req_multiline",
+        .entry = demo_main,
+        .timeout_ms = 12000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
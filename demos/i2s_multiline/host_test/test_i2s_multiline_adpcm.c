@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * IMA-ADPCM编解码：
+ * 1. 已知编码向量：手工构造的编码值序列的解码结果须与逐步计算的期望值相同，覆盖步长增大、正负饱和和索引下限；
+ * 2. 查表解码与参考解码逐位相同，覆盖随机编码值和损坏的块头(步长索引超出范围)；
+ * 3. 正弦、噪声和满幅方波经编码再解码，编码器的预测值与解码输出一致，正弦(250Hz ~ 1kHz)的信噪比不低于下限；
+ * 4. 输出为burst顺序，声道编号为 line * channel_per_line + slot；分块编码与一次编码结果相同。
+ */
+
+#include <math.h>
+#include "hpm_common.h"
+#include "i2s_multiline_adpcm.h"
+
+#define TEST_BLOCK_FRAMES   (64U)
+#define TEST_BLOCKS         (40U)
+#define TEST_MAX_CHANNEL    (16U)
+#define TEST_FRAMES         (TEST_BLOCK_FRAMES * TEST_BLOCKS)
+#define TEST_MAX_BYTES      (TEST_BLOCKS * TEST_MAX_CHANNEL * I2S_MULTILINE_ADPCM_CHANNEL_BLOCK_BYTES(TEST_BLOCK_FRAMES))
+#define TEST_MIN_SNR_DB     (25.0)      /* 250Hz ~ 1kHz、-1dBFS正弦，4位IMA在1kHz约为27dB */
+
+static int16_t pcm[TEST_MAX_CHANNEL][TEST_FRAMES];
+static uint8_t coded[TEST_MAX_BYTES];
+static uint8_t coded_chunk[TEST_MAX_BYTES];
+static uint32_t out[TEST_FRAMES * TEST_MAX_CHANNEL];
+static uint32_t ref[TEST_FRAMES * TEST_MAX_CHANNEL];
+
+static uint32_t rand_state = 1;
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1664525UL + 1013904223UL;
+    return rand_state;
+}
+
+/*
+ * 已知编码向量：预测值0、步长索引0开始，前5个采样可以手工验算：
+ * 编码7在步长7时差值为 7/8 + 7 + 7/2 + 7/4 = 0 + 7 + 3 + 1 = 11，索引加8到步长16，
+ * 差值 2 + 16 + 8 + 4 = 30，预测值41；依次为104、240、533。
+ * 之后正向饱和到32767，编码0xF使预测值负向饱和，最后用编码0/8把步长索引降回0附近
+ */
+static const uint8_t known_codes[32] = {
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0, 8, 0, 8, 3, 0xB, 5, 0xD,
+};
+static const int16_t known_samples[32] = {
+    11, 41, 104, 240, 533, 1164, 2521, 5431, 11667, 25039, 32767, 32767,
+    -28669, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -28673, -32397, -29012, -32089, -12503, -30308, -4871, -32768,
+};
+
+static int check_known_vector(void)
+{
+    i2s_multiline_adpcm_t adpcm;
+    i2s_multiline_adpcm_config_t config = {1, 1, 32};
+    uint8_t block[I2S_MULTILINE_ADPCM_CHANNEL_BLOCK_BYTES(32)] = {0};
+    int fails = 0;
+
+    i2s_multiline_adpcm_init(&adpcm, &config);
+    for (uint32_t f = 0; f < 32U; f++) {
+        block[I2S_MULTILINE_ADPCM_HEADER_BYTES + f / 2U] |= (uint8_t)(known_codes[f] << ((f & 1U) * 4U));
+    }
+    i2s_multiline_adpcm_decode(&adpcm, out, block, 1);
+    i2s_multiline_adpcm_decode_ref(&adpcm, ref, block, 1);
+    for (uint32_t f = 0; f < 32U; f++) {
+        if ((out[f] != ((uint32_t)(int32_t)known_samples[f] << 16)) ||
+            (ref[f] != ((uint32_t)(int32_t)known_samples[f] << 16))) {
+            printf("FAIL: known vector sample %lu: decode %ld, reference %ld, expected %d\n", (unsigned long)f,
+                   (long)((int32_t)out[f] >> 16), (long)((int32_t)ref[f] >> 16), known_samples[f]);
+            fails++;
+        }
+    }
+    return fails;
+}
+
+/* 随机编码值和块头，包括超出范围的步长索引 */
+static int check_random_streams(const i2s_multiline_adpcm_t *adpcm)
+{
+    uint32_t bytes = TEST_BLOCKS * adpcm->block_bytes;
+    uint8_t *p;
+
+    for (uint32_t i = 0; i < bytes; i++) {
+        coded[i] = (uint8_t)(test_rand() >> 24);
+    }
+    for (uint32_t b = 0; b < TEST_BLOCKS * adpcm->channel_num; b++) {
+        p = &coded[b * adpcm->channel_block_bytes];
+        p[2] = (uint8_t)((b % 3U == 0U) ? (test_rand() >> 24) : (test_rand() >> 24) % 89U);
+    }
+    i2s_multiline_adpcm_decode(adpcm, out, coded, TEST_BLOCKS);
+    i2s_multiline_adpcm_decode_ref(adpcm, ref, coded, TEST_BLOCKS);
+    return (memcmp(out, ref, TEST_FRAMES * adpcm->channel_num * sizeof(uint32_t)) != 0) ? 1 : 0;
+}
+
+static void fill_pcm(uint8_t channels)
+{
+    for (uint8_t ch = 0; ch < channels; ch++) {
+        for (uint32_t f = 0; f < TEST_FRAMES; f++) {
+            switch (ch % 3U) {
+            case 0:
+                pcm[ch][f] = (int16_t)(29000.0 * sin(2.0 * M_PI * (250.0 + 50.0 * ch) * f / 48000.0));
+                break;
+            case 1:
+                pcm[ch][f] = (int16_t)((int32_t)test_rand() >> 16);
+                break;
+            default:
+                pcm[ch][f] = ((f / 37U) & 1U) ? INT16_MAX : INT16_MIN;
+                break;
+            }
+        }
+    }
+}
+
+static double sine_snr_db(const i2s_multiline_adpcm_t *adpcm, uint8_t ch, uint8_t pos)
+{
+    double sig = 0;
+    double err = 0;
+    double e;
+
+    for (uint32_t f = 0; f < TEST_FRAMES; f++) {
+        e = (double)((int32_t)out[f * adpcm->channel_num + pos] >> 16) - pcm[ch][f];
+        sig += (double)pcm[ch][f] * pcm[ch][f];
+        err += e * e;
+    }
+    return 10.0 * log10(sig / err);
+}
+
+static int check_round_trip(const i2s_multiline_adpcm_t *adpcm)
+{
+    i2s_multiline_adpcm_state_t state[TEST_MAX_CHANNEL];
+    i2s_multiline_adpcm_state_t chunk_state[TEST_MAX_CHANNEL];
+    const int16_t *src[TEST_MAX_CHANNEL];
+    uint8_t lines = adpcm->config.line_num;
+    uint8_t cpl = adpcm->config.channel_per_line;
+    uint8_t n = adpcm->channel_num;
+    uint8_t ch;
+    uint8_t pos;
+    double snr;
+    int fails = 0;
+
+    fill_pcm(n);
+    for (ch = 0; ch < n; ch++) {
+        src[ch] = pcm[ch];
+    }
+    i2s_multiline_adpcm_reset_state(adpcm, state);
+    i2s_multiline_adpcm_encode(adpcm, coded, src, 0, TEST_BLOCKS, state);
+
+    /* 分块编码：每次一块或三块，状态跨调用保留 */
+    i2s_multiline_adpcm_reset_state(adpcm, chunk_state);
+    for (uint32_t b = 0; b < TEST_BLOCKS;) {
+        uint32_t k = ((b % 2U) == 0U) ? 1U : 3U;
+        k = (b + k > TEST_BLOCKS) ? TEST_BLOCKS - b : k;
+        i2s_multiline_adpcm_encode(adpcm, &coded_chunk[b * adpcm->block_bytes], src, b * TEST_BLOCK_FRAMES, k,
+                                   chunk_state);
+        b += k;
+    }
+    if (memcmp(coded, coded_chunk, TEST_BLOCKS * adpcm->block_bytes) != 0) {
+        printf("  FAIL: chunked encode differs\n");
+        fails++;
+    }
+
+    i2s_multiline_adpcm_decode(adpcm, out, coded, TEST_BLOCKS);
+    i2s_multiline_adpcm_decode_ref(adpcm, ref, coded, TEST_BLOCKS);
+    if (memcmp(out, ref, TEST_FRAMES * n * sizeof(uint32_t)) != 0) {
+        printf("  FAIL: decode differs from the reference\n");
+        fails++;
+    }
+
+    for (uint8_t line = 0; line < lines; line++) {
+        for (uint8_t slot = 0; slot < cpl; slot++) {
+            ch = line * cpl + slot;
+            pos = slot * lines + line;
+            /* 编码结束时的预测值等于最后一个解码采样 */
+            if ((int16_t)(out[(TEST_FRAMES - 1U) * n + pos] >> 16) != state[ch].predictor) {
+                printf("  FAIL: channel %u encoder predictor %d, decoded %ld\n", ch, state[ch].predictor,
+                       (long)((int32_t)out[(TEST_FRAMES - 1U) * n + pos] >> 16));
+                fails++;
+            }
+            if ((ch % 3U) == 0U) {
+                snr = sine_snr_db(adpcm, ch, pos);
+                if (snr < TEST_MIN_SNR_DB) {
+                    printf("  FAIL: channel %u sine SNR %.1f dB\n", ch, snr);
+                    fails++;
+                }
+            }
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    static const uint8_t cpl_list[] = {1, 2, 4};
+    i2s_multiline_adpcm_t adpcm;
+    i2s_multiline_adpcm_config_t config;
+    uint32_t cases = 0;
+    int fails;
+
+    fails = check_known_vector();
+    for (uint8_t lines = 1; lines <= 4U; lines++) {
+        for (uint8_t c = 0; c < ARRAY_SIZE(cpl_list); c++) {
+            config.line_num = lines;
+            config.channel_per_line = cpl_list[c];
+            config.block_frames = TEST_BLOCK_FRAMES;
+            if (status_success != i2s_multiline_adpcm_init(&adpcm, &config)) {
+                printf("FAIL: init %u lines x %u\n", lines, cpl_list[c]);
+                fails++;
+                continue;
+            }
+            if (check_random_streams(&adpcm) != 0) {
+                printf("FAIL: %u lines x %u random streams differ from the reference\n", lines, cpl_list[c]);
+                fails++;
+            }
+            if (check_round_trip(&adpcm) != 0) {
+                printf("FAIL: %u lines x %u round trip\n", lines, cpl_list[c]);
+                fails++;
+            }
+            cases++;
+        }
+    }
+    printf("adpcm: known vector and %lu layouts, %d failed\n", (unsigned long)cases, fails);
+
+    config.block_frames = 12;
+    if (status_success == i2s_multiline_adpcm_init(&adpcm, &config)) {
+        printf("FAIL: block_frames not a multiple of 8 accepted\n");
+        fails++;
+    }
+
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
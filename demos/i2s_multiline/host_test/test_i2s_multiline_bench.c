@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_multiline_bench：三种方式的整个测试矩阵，每个测试点运行时间缩短，
+ * 报告中写入各组合的最高可持续采样率(与示例最后输出的CSV相同)，与golden比较
+ */
+
+#include "host_model.h"
+
+#define BENCH_MODE_NUM      (3U)
+#define BENCH_DEPTH_NUM     (3U)
+#define BENCH_LINE_NUM      (3U)
+#define BENCH_THRESHOLD_NUM (3U)
+
+int demo_main(void);
+
+extern uint32_t bench_max_rate[BENCH_MODE_NUM][BENCH_DEPTH_NUM][BENCH_LINE_NUM][BENCH_THRESHOLD_NUM];
+
+static int check(FILE *fp)
+{
+    static const char *const mode_name[BENCH_MODE_NUM] = {"irq", "per_line_dma", "burst_dma"};
+    static const uint8_t depth[BENCH_DEPTH_NUM] = {16, 24, 32};
+    static const uint8_t line[BENCH_LINE_NUM] = {1, 2, 4};
+    static const uint8_t threshold[BENCH_THRESHOLD_NUM] = {2, 4, 6};
+    uint32_t best;
+    int fails = 0;
+
+    fprintf(fp, "mode,bits,lines,fifo_threshold,max_sample_rate\n");
+    for (uint8_t mode = 0; mode < BENCH_MODE_NUM; mode++) {
+        best = 0;
+        for (uint8_t d = 0; d < BENCH_DEPTH_NUM; d++) {
+            for (uint8_t l = 0; l < BENCH_LINE_NUM; l++) {
+                for (uint8_t t = 0; t < BENCH_THRESHOLD_NUM; t++) {
+                    fprintf(fp, "%s,%u,%u,%u,%u\n", mode_name[mode], depth[d], line[l], threshold[t],
+                            bench_max_rate[mode][d][l][t]);
+                    if (bench_max_rate[mode][d][l][t] > best) {
+                        best = bench_max_rate[mode][d][l][t];
+                    }
+                }
+            }
+        }
+        fprintf(fp, "%s,all,all,all,%u\n", mode_name[mode], best);
+        /* 模型SoC具有三种方式所需的全部功能，每种方式至少有一个可持续的组合 */
+        if (best == 0U) {
+            fprintf(fp, "FAIL: %s has no sustainable configuration\n", mode_name[mode]);
+            fails++;
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_bench",
+        .entry = demo_main,
+        .timeout_ms = 60000,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 接收的位置计数回绕：发送数据线回环到接收数据线，接收环的帧数不是2的幂(4个周期 x 48帧)，
+ * 接收位置从2^32之前0.2秒开始，slot_base在0.1秒时前移，回绕之后的300ms时注入接收DMA错误，
+ * 由i2s_multiline_capture_task在任务中恢复。回绕和恢复前后接收的声道对应关系及数据连续性不变
+ */
+
+#include "host_line_check.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_interrupt.h"
+#include "i2s_multiline_capture.h"
+#include "i2s_multiline_cfg.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_stream.h"
+
+#define WRAP_SAMPLE_RATE      (48000U)
+#define WRAP_LINE_NUM         (4U)
+#define WRAP_CHANNEL_PER_LINE (2U)
+#define WRAP_CHANNEL_NUM      (WRAP_LINE_NUM * WRAP_CHANNEL_PER_LINE)
+#define WRAP_PERIOD_NUM       (4U)
+#define WRAP_PERIOD_FRAMES    (48U)
+#define WRAP_RING_FRAMES      (WRAP_PERIOD_NUM * WRAP_PERIOD_FRAMES)
+#define WRAP_PLANAR_FRAMES    (256U)
+#define WRAP_RX_THRESHOLD     (4U)
+#define WRAP_TX_DMA_CHANNEL   (0U)
+#define WRAP_RX_DMA_CHANNEL   (1U)
+
+/* 0.2秒后接收位置计数回绕，0.1秒后写位置领先slot_base达到2^31帧 */
+#define WRAP_START_POS        (0U - WRAP_SAMPLE_RATE / 5U)
+#define WRAP_BASE_AHEAD       ((0x80000000UL - WRAP_SAMPLE_RATE / 10U) / WRAP_RING_FRAMES * WRAP_RING_FRAMES)
+
+/* 接收0.5秒 */
+#define WRAP_RUN_FRAMES       (WRAP_SAMPLE_RATE / 2U)
+
+I2S_MULTILINE_CFG_DEFINE(wrap_cfg, WRAP_LINE_NUM, 32, WRAP_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         WRAP_SAMPLE_RATE)
+
+typedef struct {
+    i2s_multiline_capture_stats_t stats;
+    uint32_t write_pos;
+    uint32_t slot_base;
+    uint32_t samples;
+    uint32_t silent;
+    uint32_t invalid;
+    uint32_t breaks;
+} wrap_result_t;
+
+static i2s_multiline_stream_t tx_stream;
+static i2s_multiline_capture_t rx_capture;
+static uint32_t tx_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(WRAP_PERIOD_NUM, WRAP_PERIOD_FRAMES, WRAP_LINE_NUM,
+                                                              WRAP_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+static uint32_t rx_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(WRAP_PERIOD_NUM, WRAP_PERIOD_FRAMES, WRAP_LINE_NUM,
+                                                              WRAP_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+static int32_t planar_tx[WRAP_CHANNEL_NUM][WRAP_PLANAR_FRAMES];
+static int32_t planar_rx[WRAP_CHANNEL_NUM][WRAP_RING_FRAMES];
+static wrap_result_t wrap_result;
+
+SDK_DECLARE_EXT_ISR_M(IRQn_XDMA, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&tx_stream);
+    i2s_multiline_capture_irq_handler(&rx_capture);
+}
+
+static uint32_t feed_tx(i2s_multiline_pack_t *pack, const void *const src[], uint32_t *src_frame)
+{
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t n = i2s_multiline_stream_get_write_ptr(&tx_stream, ring_ptr);
+
+    if (n > WRAP_PLANAR_FRAMES - *src_frame) {
+        n = WRAP_PLANAR_FRAMES - *src_frame;
+    }
+    if (n > 0U) {
+        i2s_multiline_pack(pack, (uint32_t *)ring_ptr[0], src, *src_frame, n);
+        i2s_multiline_stream_commit(&tx_stream, n);
+        *src_frame = (*src_frame + n) % WRAP_PLANAR_FRAMES;
+    }
+    return n;
+}
+
+/* 高4位为声道号+1，同一声道相邻的两个非零采样的帧序号相差1 */
+static void check_rx(uint32_t frames, uint32_t prev[])
+{
+    uint32_t v;
+
+    for (uint32_t ch = 0; ch < WRAP_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < frames; i++) {
+            v = (uint32_t)planar_rx[ch][i];
+            wrap_result.samples++;
+            if (v == 0U) {
+                wrap_result.silent++;
+                continue;
+            }
+            if (((v >> 28) != ch + 1U) || ((v & 0x0F00FFFFUL) != 0U)) {
+                wrap_result.invalid++;
+            } else if ((prev[ch] != 0U) && ((((prev[ch] >> 16) + 1U) & 0xFFU) != ((v >> 16) & 0xFFU))) {
+                wrap_result.breaks++;
+            }
+            prev[ch] = v;
+        }
+    }
+}
+
+static int wrap_main(void)
+{
+    i2s_multiline_stream_config_t tx_config = {0};
+    i2s_multiline_capture_config_t rx_config = {0};
+    i2s_multiline_pack_config_t pack_config = {0};
+    i2s_multiline_pack_t pack;
+    const void *tx_src[WRAP_CHANNEL_NUM];
+    void *rx_dst[WRAP_CHANNEL_NUM];
+    const void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t prev[WRAP_CHANNEL_NUM] = {0};
+    uint32_t captured = 0;
+    uint32_t src_frame = 0;
+    uint32_t n;
+
+    for (uint32_t ch = 0; ch < WRAP_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < WRAP_PLANAR_FRAMES; i++) {
+            planar_tx[ch][i] = (int32_t)(((ch + 1U) << 28) | (i << 16));
+        }
+        tx_src[ch] = planar_tx[ch];
+        rx_dst[ch] = planar_rx[ch];
+    }
+
+    board_config_i2s_clock(HPM_I2S0, WRAP_SAMPLE_RATE);
+    wrap_cfg_config_i2s_duplex(HPM_I2S0, clock_get_frequency(clock_i2s0), wrap_cfg_fifo_threshold,
+                               WRAP_RX_THRESHOLD);
+
+    pack_config.format = i2s_multiline_pack_s32;
+    pack_config.line_num = WRAP_LINE_NUM;
+    pack_config.channel_per_line = WRAP_CHANNEL_PER_LINE;
+    i2s_multiline_pack_init(&pack, &pack_config);
+
+    tx_config.i2s = HPM_I2S0;
+    tx_config.dma = HPM_XDMA;
+    tx_config.dmamux = HPM_DMAMUX;
+    tx_config.engine = i2s_multiline_engine_burst_dma;
+    tx_config.line_num = WRAP_LINE_NUM;
+    tx_config.dma_channel[0] = WRAP_TX_DMA_CHANNEL;
+    tx_config.dma_req[0] = HPM_DMA_SRC_I2S0_TX;
+    tx_config.channel_per_line = WRAP_CHANNEL_PER_LINE;
+    tx_config.audio_depth = 32;
+    tx_config.period_num = WRAP_PERIOD_NUM;
+    tx_config.period_frames = WRAP_PERIOD_FRAMES;
+    tx_config.buffer[0] = tx_buffer;
+    if (i2s_multiline_stream_init(&tx_stream, &tx_config) != status_success) {
+        return 1;
+    }
+
+    rx_config.i2s = HPM_I2S0;
+    rx_config.dma = HPM_XDMA;
+    rx_config.dmamux = HPM_DMAMUX;
+    rx_config.engine = i2s_multiline_engine_burst_dma;
+    rx_config.line_num = WRAP_LINE_NUM;
+    rx_config.dma_channel[0] = WRAP_RX_DMA_CHANNEL;
+    rx_config.dma_req[0] = HPM_DMA_SRC_I2S0_RX;
+    rx_config.channel_per_line = WRAP_CHANNEL_PER_LINE;
+    rx_config.audio_depth = 32;
+    rx_config.period_num = WRAP_PERIOD_NUM;
+    rx_config.period_frames = WRAP_PERIOD_FRAMES;
+    rx_config.buffer[0] = rx_buffer;
+    if (i2s_multiline_capture_init(&rx_capture, &rx_config) != status_success) {
+        return 1;
+    }
+
+    /* 模拟长时间运行后的状态：接收位置接近2^32，slot_base落后写位置整数个环 */
+    rx_capture.write_pos = WRAP_START_POS;
+    rx_capture.read_pos = WRAP_START_POS;
+    rx_capture.pending_pos = WRAP_START_POS;
+    rx_capture.slot_base = WRAP_START_POS - WRAP_BASE_AHEAD;
+
+    intc_m_enable_irq_with_priority(IRQn_XDMA, 1);
+
+    while (feed_tx(&pack, tx_src, &src_frame) > 0U) {
+    }
+    if ((i2s_multiline_stream_prepare(&tx_stream) != status_success) ||
+        (i2s_multiline_capture_prepare(&rx_capture) != status_success)) {
+        return 1;
+    }
+    i2s_start(HPM_I2S0);
+
+    while (captured < WRAP_RUN_FRAMES) {
+        i2s_multiline_stream_task(&tx_stream);
+        i2s_multiline_capture_task(&rx_capture);
+        feed_tx(&pack, tx_src, &src_frame);
+
+        n = i2s_multiline_capture_get_read_ptr(&rx_capture, ring_ptr);
+        if (n == 0U) {
+            host_cpu_idle();
+            continue;
+        }
+        i2s_multiline_unpack(&pack, rx_dst, 0, (const uint32_t *)ring_ptr[0], n);
+        i2s_multiline_capture_release(&rx_capture, n);
+        check_rx(n, prev);
+        captured += n;
+    }
+
+    i2s_multiline_capture_stop(&rx_capture);
+    i2s_multiline_stream_stop(&tx_stream);
+
+    i2s_multiline_capture_get_stats(&rx_capture, &wrap_result.stats);
+    wrap_result.write_pos = rx_capture.write_pos;
+    wrap_result.slot_base = rx_capture.slot_base;
+    return 0;
+}
+
+static bool planar_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == (uint32_t)line * 2U + slot + 1U) && ((word & 0x0F00FFFFUL) == 0U);
+}
+
+static bool planar_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 16) + 1U) & 0xFFU) == ((word >> 16) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = planar_valid,
+    .follows = planar_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+    host_i2s_set_loopback(HPM_I2S0, true);
+}
+
+static void fault(void)
+{
+    host_dma_inject_error(HPM_XDMA, WRAP_RX_DMA_CHANNEL);
+}
+
+static int check(FILE *fp)
+{
+    const wrap_result_t *r = &wrap_result;
+
+    fprintf(fp, "rx: write_pos %08x, slot_base %08x, %u dma errors, %u fifo overflows, %u recoveries, "
+            "%u overruns (%u frames dropped)\n",
+            r->write_pos, r->slot_base, r->stats.dma_error_count, r->stats.fifo_overflow_count,
+            r->stats.recovery_count, r->stats.overrun_count, r->stats.dropped_frames);
+    fprintf(fp, "rx check: %u samples, %u silent, %u invalid, %u discontinuities\n",
+            r->samples, r->silent, r->invalid, r->breaks);
+    return host_line_check_report(&line_check, fp) + ((r->invalid != 0U) ? 1 : 0);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_capture_wrap",
+        .entry = wrap_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+        .fault_ms = 300,
+        .fault = fault,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_multiline_dmav2：一个DMA通道以burst小循环写4条数据线，48kHz，16位平面数据打包
+ */
+
+#include "host_line_check.h"
+
+int demo_main(void);
+
+/* 平面测试数据：声道ch第i帧为((ch + 1) << 28) | (i << 16)，声道编号为line * 2 + slot */
+static bool planar_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == (uint32_t)line * 2U + slot + 1U) && ((word & 0x0F00FFFFUL) == 0U);
+}
+
+static bool planar_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 16) + 1U) & 0xFFU) == ((word >> 16) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = planar_valid,
+    .follows = planar_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static int check(FILE *fp)
+{
+    return host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_dmav2",
+        .entry = demo_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_multiline_dmav2：播放中途使DMA通道以错误结束，检查流的恢复：
+ * 恢复期间输出静音或下溢，之后数据线和声道的对应关系不变
+ */
+
+#include "host_line_check.h"
+
+int demo_main(void);
+
+/* 平面测试数据：声道ch第i帧为((ch + 1) << 28) | (i << 16)，声道编号为line * 2 + slot */
+static bool planar_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == (uint32_t)line * 2U + slot + 1U) && ((word & 0x0F00FFFFUL) == 0U);
+}
+
+static bool planar_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 16) + 1U) & 0xFFU) == ((word >> 16) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = planar_valid,
+    .follows = planar_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static void fault(void)
+{
+    host_dma_inject_error(HPM_XDMA, 0);
+}
+
+static int check(FILE *fp)
+{
+    return host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_dmav2_recovery",
+        .entry = demo_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+        .fault_ms = 400,
+        .fault = fault,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * UAC2异步反馈的时钟漂移仿真，参数与i2s_multiline_uac2相同：
+ * 高速每微帧一个包，主机每8个微帧(bInterval 4)读取一次反馈值，按反馈值累加小数帧决定每个包的帧数；
+ * 流的环为4个1ms周期，缓冲到1.75个周期后启动，DMA进入下一个半周期时数据不足则插入静音(欠载)，
+ * 环满时丢弃(溢出)。I2S、USB和CPU时钟各自带频偏，中断时间戳带随机延迟。
+ * 每种频偏组合仿真60秒，启动2秒后须无欠载和溢出，测得的I2S采样率误差不超过10ppm，
+ * 平均缓冲量与目标值相差不超过3帧。另有一个全速(Q10.14)的组合。
+ * 另有几个组合的读写位置从2^32之前30秒开始，在仿真中途回绕。
+ */
+
+#include <math.h>
+#include "hpm_common.h"
+#include "i2s_multiline_feedback.h"
+
+#define TEST_CPU_HZ         (600000000U)
+#define TEST_SECONDS        (60.0)
+#define TEST_SETTLE_SECONDS (2.0)
+#define TEST_PERIOD_NUM     (4U)
+#define TEST_FILL_PERCENT   (175U)
+#define TEST_FB_INTERVAL    (8U)        /* 高速主机读取反馈值的间隔(微帧) */
+#define TEST_MAX_RATE_PPM   (10.0)
+#define TEST_MAX_FILL_ERR   (3.0)       /* 平均缓冲量与目标值之差(帧) */
+
+typedef struct {
+    uint32_t sample_rate;
+    bool high_speed;
+    double i2s_ppm;
+    double usb_ppm;
+    double cpu_ppm;
+    uint32_t start_pos;         /* 读写位置的初值 */
+} test_case_t;
+
+typedef struct {
+    uint32_t underruns;
+    uint32_t overruns;
+    uint32_t fill_min;
+    uint32_t fill_max;
+    double fill_avg;
+    double rate_err_ppm;
+} test_result_t;
+
+static uint32_t rand_state = 1;
+
+/* 0 ~ max_us的中断延迟 */
+static double test_latency(double max_us)
+{
+    rand_state = rand_state * 1664525UL + 1013904223UL;
+    return (double)(rand_state >> 8) / 16777216.0 * max_us * 1e-6;
+}
+
+static void run_case(const test_case_t *tc, test_result_t *res)
+{
+    i2s_multiline_feedback_t fb;
+    i2s_multiline_feedback_config_t config = {0};
+    i2s_multiline_feedback_stats_t stats;
+    uint32_t period = tc->sample_rate / 1000U;
+    uint32_t ring_frames = TEST_PERIOD_NUM * period;
+    uint32_t pps = tc->high_speed ? 8000U : 1000U;
+    double cpu_hz = TEST_CPU_HZ * (1.0 + tc->cpu_ppm * 1e-6);
+    double fs = tc->sample_rate * (1.0 + tc->i2s_ppm * 1e-6);
+    double packet_t = 1.0 / (pps * (1.0 + tc->usb_ppm * 1e-6));
+    double half_t = (period / 2U) / fs;
+    double next_packet = 0;
+    double next_half = INFINITY;
+    double start_t = 0;
+    double fill_sum = 0;
+    uint32_t fill_count = 0;
+    uint32_t write_pos = tc->start_pos;
+    uint32_t read_pos = tc->start_pos;
+    uint32_t halves = 0;
+    uint32_t host_fb;
+    uint32_t polls = 0;
+    uint64_t acc = 0;
+    uint32_t n;
+    uint32_t fill;
+    double t;
+    bool running = false;
+
+    config.cpu_hz = TEST_CPU_HZ;
+    config.sample_rate = tc->sample_rate;
+    config.packet_per_second = pps;
+    config.high_speed = tc->high_speed;
+    config.period_frames = period;
+    config.target_fill = period * TEST_FILL_PERCENT / 100U;
+    i2s_multiline_feedback_init(&fb, &config);
+    host_fb = i2s_multiline_feedback_get_value(&fb);
+    memset(res, 0, sizeof(*res));
+    res->fill_min = UINT32_MAX;
+
+    for (;;) {
+        if (next_packet < next_half) {
+            t = next_packet;
+            if (t > TEST_SECONDS) {
+                break;
+            }
+            /* 主机：按最近读到的反馈值累加，整数部分为本包的帧数 */
+            if (!tc->high_speed || (++polls >= TEST_FB_INTERVAL)) {
+                polls = 0;
+                host_fb = i2s_multiline_feedback_get_value(&fb);
+            }
+            acc += tc->high_speed ? host_fb : ((uint64_t)host_fb << 2);
+            n = (uint32_t)(acc >> 16);
+            acc -= (uint64_t)n << 16;
+
+            /* 设备：OUT回调先更新反馈，再写入环 */
+            fill = i2s_multiline_feedback_usb_event(&fb, write_pos, (uint64_t)((t + test_latency(5)) * cpu_hz));
+            if (running && (t > TEST_SETTLE_SECONDS)) {
+                res->fill_min = (fill < res->fill_min) ? fill : res->fill_min;
+                res->fill_max = (fill > res->fill_max) ? fill : res->fill_max;
+                fill_sum += fill;
+                fill_count++;
+            }
+            if (write_pos + n - read_pos > ring_frames) {
+                if (t > TEST_SETTLE_SECONDS) {
+                    res->overruns++;
+                }
+                n = ring_frames - (write_pos - read_pos);
+            }
+            write_pos += n;
+            if (!running && (write_pos - read_pos >= config.target_fill)) {
+                running = true;
+                start_t = t;
+                next_half = t + half_t;
+            }
+            next_packet += packet_t;
+        } else {
+            t = next_half;
+            if (t > TEST_SECONDS) {
+                break;
+            }
+            /* 流的半周期中断：回调记录播放位置，DMA进入的下一个半周期数据不足时插入静音 */
+            halves++;
+            read_pos += period / 2U;
+            i2s_multiline_feedback_i2s_event(&fb, read_pos, (uint64_t)((t + test_latency(2)) * cpu_hz));
+            if ((int32_t)(write_pos - (read_pos + period)) < 0) {
+                if (t > TEST_SETTLE_SECONDS) {
+                    res->underruns++;
+                }
+                write_pos = read_pos + period;
+            }
+            next_half = start_t + (halves + 1U) * half_t;
+        }
+    }
+
+    i2s_multiline_feedback_get_stats(&fb, &stats);
+    res->fill_avg = (fill_count == 0U) ? 0.0 : fill_sum / fill_count;
+    /* 以USB时钟计的I2S采样率 */
+    res->rate_err_ppm = (stats.i2s_rate_mhz / 1000.0 / (fs / (1.0 + tc->usb_ppm * 1e-6)) - 1.0) * 1e6;
+}
+
+int main(void)
+{
+    static const test_case_t cases[] = {
+        {48000, true, 0, 0, 0},
+        {48000, true, 500, 0, 0},
+        {48000, true, -500, 0, 0},
+        {48000, true, 0, 300, 50},
+        {48000, true, 250, -250, -30},
+        {48000, true, -1000, 100, 0},
+        {96000, true, 0, 0, 0},
+        {96000, true, 500, -100, 20},
+        {96000, true, -500, 200, -50},
+        {96000, true, 1000, 0, 0},
+        {48000, false, 300, -100, 0},
+        {48000, true, 250, -250, -30, 0U - 48000U * 30U},
+        {96000, true, -500, 200, -50, 0U - 96000U * 30U},
+        {48000, false, 300, -100, 0, 0U - 48000U * 30U},
+    };
+    test_result_t res;
+    double target;
+    int fails = 0;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(cases); i++) {
+        const test_case_t *tc = &cases[i];
+
+        run_case(tc, &res);
+        target = tc->sample_rate / 1000U * TEST_FILL_PERCENT / 100U;
+        printf("%s %2lu kHz, i2s %+5.0f ppm, usb %+4.0f ppm, cpu %+3.0f ppm, start %08lx: underruns %lu, "
+               "overruns %lu, fill %lu/%.1f/%lu (target %.0f), rate error %+.2f ppm\n",
+               tc->high_speed ? "HS" : "FS", (unsigned long)(tc->sample_rate / 1000U), tc->i2s_ppm, tc->usb_ppm,
+               tc->cpu_ppm, (unsigned long)tc->start_pos, (unsigned long)res.underruns, (unsigned long)res.overruns,
+               (unsigned long)res.fill_min, res.fill_avg, (unsigned long)res.fill_max, target, res.rate_err_ppm);
+        if ((res.underruns != 0U) || (res.overruns != 0U) || (fabs(res.rate_err_ppm) > TEST_MAX_RATE_PPM) ||
+            (fabs(res.fill_avg - target) > TEST_MAX_FILL_ERR)) {
+            printf("  FAIL\n");
+            fails++;
+        }
+    }
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * float32转PCM与双精度参考实现逐位比较。参考实现按接口说明独立计算：
+ * NaN为0，限幅到[-1, 1]，32位输出直接截断到Q31(1.0为INT32_MAX)；16/24位先截断到Q30，
+ * 叠加TPDF抖动(xorshift32随机数低16位减高16位，单位2^-16 LSB，向下取整到Q30)，再四舍五入并限幅。
+ * 随机数每个采样取一个，每次调用内按写入顺序：burst布局逐帧按时隙、数据线，per_line布局逐条数据线。
+ * 覆盖16/24/32位、burst和per_line布局、平面和交织源、1~4条数据线、TDM时隙数、特殊值和舍入临界值，
+ * 分两次转换，随机数状态在两次调用间连续。另检查抖动误差的均值和方差(TPDF+舍入为1/4 LSB^2)。
+ */
+
+#include <math.h>
+#include "hpm_common.h"
+#include "i2s_multiline_float.h"
+
+#define TEST_FRAMES         (96U)
+#define TEST_FIRST          (3U)
+#define TEST_MAX_CHANNEL    (32U)
+#define TEST_DEFAULT_SEED   (0x9E3779B9UL)
+#define TEST_STAT_SAMPLES   (1UL << 18)
+
+static float planar[TEST_MAX_CHANNEL][TEST_FRAMES];
+static float interleaved[TEST_FRAMES * TEST_MAX_CHANNEL];
+static uint32_t out32[4][TEST_FRAMES * TEST_MAX_CHANNEL];
+static uint32_t ref32[4][TEST_FRAMES * TEST_MAX_CHANNEL];
+static float stat_in[TEST_STAT_SAMPLES];
+static uint32_t stat_out[TEST_STAT_SAMPLES];
+
+static uint32_t ref_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* 参考实现，返回左对齐的32位字 */
+static uint32_t ref_convert(float in, uint8_t bits, bool dither, uint32_t *state)
+{
+    double x = isnan(in) ? 0.0 : (double)in;
+    double q30;
+    double lsb = ldexp(1.0, 31 - bits);     /* 输出1 LSB对应的Q30单位 */
+    double q;
+    double max = ldexp(1.0, bits - 1) - 1.0;
+    uint32_t r;
+
+    x = (x > 1.0) ? 1.0 : ((x < -1.0) ? -1.0 : x);
+    if (bits == 32U) {
+        return (x >= 1.0) ? (uint32_t)INT32_MAX : (uint32_t)(int32_t)trunc(x * 2147483648.0);
+    }
+    q30 = trunc(x * 1073741824.0);
+    if (dither) {
+        r = ref_rand(state);
+        q30 += floor(((double)(r & 0xFFFFU) - (double)(r >> 16)) * lsb / 65536.0);
+    }
+    q = floor(q30 / lsb + 0.5);
+    q = (q > max) ? max : ((q < -max - 1.0) ? -max - 1.0 : q);
+    return (uint32_t)(int32_t)q << (32U - bits);
+}
+
+/* 按接口说明的输出布局计算一次调用的参考输出，帧号相对于第一次调用 */
+static void ref_layout(const i2s_multiline_float_config_t *config, uint32_t *state, uint32_t first, uint32_t start,
+                       uint32_t frames)
+{
+    uint8_t lines = config->line_num;
+    uint8_t cpl = config->channel_per_line;
+    bool dither = config->dither && (config->out_bits != 32U);
+    bool half = (config->layout == i2s_multiline_float_per_line) && (config->out_bits == 16U);
+    uint32_t w;
+
+    if (config->layout == i2s_multiline_float_burst) {
+        for (uint32_t f = start; f < start + frames; f++) {
+            for (uint8_t slot = 0; slot < cpl; slot++) {
+                for (uint8_t line = 0; line < lines; line++) {
+                    ref32[0][(f * cpl + slot) * lines + line] =
+                        ref_convert(planar[line * cpl + slot][first + f], config->out_bits, dither, state);
+                }
+            }
+        }
+        return;
+    }
+    for (uint8_t line = 0; line < lines; line++) {
+        for (uint32_t f = start; f < start + frames; f++) {
+            for (uint8_t slot = 0; slot < cpl; slot++) {
+                w = ref_convert(planar[line * cpl + slot][first + f], config->out_bits, dither, state);
+                if (half) {
+                    ((uint16_t *)ref32[line])[f * cpl + slot] = (uint16_t)(w >> 16);
+                } else {
+                    ref32[line][f * cpl + slot] = w;
+                }
+            }
+        }
+    }
+}
+
+static void init_input(void)
+{
+    uint32_t state = 1;
+    static const float special[] = {
+        NAN, 1.0f, -1.0f, 0.0f, -0.0f, INFINITY, -INFINITY, 1.5f, -1.5f, 1e-30f, -1e-30f,
+        0.99999994f, -0.99999994f,
+        /* 16位和24位输出的舍入临界值(x.5 LSB)及其相邻值 */
+        0.5f / 32768.0f, -0.5f / 32768.0f, 1.5f / 32768.0f, -1.5f / 32768.0f, 32767.5f / 32768.0f,
+        -32767.5f / 32768.0f, 0.5f / 8388608.0f, -0.5f / 8388608.0f, 2.5f / 8388608.0f, -2.5f / 8388608.0f,
+        8388607.5f / 8388608.0f, 1000.5f / 8388608.0f, -1000.5f / 8388608.0f,
+    };
+
+    for (uint8_t ch = 0; ch < TEST_MAX_CHANNEL; ch++) {
+        for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+            planar[ch][i] = (float)((double)ref_rand(&state) / 4294967296.0 * 2.4 - 1.2);
+        }
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(special); i++) {
+        planar[i % TEST_MAX_CHANNEL][TEST_FIRST + i] = special[i];
+        planar[(i * 7U + 3U) % TEST_MAX_CHANNEL][TEST_FIRST + 40U + i] = special[i];
+    }
+}
+
+static int run_case(const i2s_multiline_float_config_t *config, bool interleave, uint32_t split)
+{
+    i2s_multiline_float_t conv;
+    const float *src[TEST_MAX_CHANNEL];
+    void *dst[4];
+    uint8_t ch_num = config->line_num * config->channel_per_line;
+    uint8_t lines = config->line_num;
+    bool half = (config->layout == i2s_multiline_float_per_line) && (config->out_bits == 16U);
+    uint32_t frames = TEST_FRAMES - TEST_FIRST;
+    uint32_t words = (config->layout == i2s_multiline_float_burst) ? frames * ch_num : frames * config->channel_per_line;
+    i2s_multiline_float_config_t c = *config;
+    uint32_t state = (config->seed == 0U) ? TEST_DEFAULT_SEED : config->seed;
+
+    for (uint8_t ch = 0; ch < ch_num; ch++) {
+        for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+            interleaved[i * ch_num + ch] = planar[ch][i];
+        }
+        src[ch] = interleave ? &interleaved[ch] : planar[ch];
+    }
+    c.src_stride = interleave ? ch_num : 0U;
+    if (status_success != i2s_multiline_float_init(&conv, &c)) {
+        return 1;
+    }
+    memset(out32, 0, sizeof(out32));
+
+    /* 分两次转换，第二次从split帧继续 */
+    for (uint8_t line = 0; line < 4U; line++) {
+        dst[line] = out32[line];
+    }
+    i2s_multiline_float_convert(&conv, dst, src, TEST_FIRST, split);
+    for (uint8_t line = 0; line < 4U; line++) {
+        if (config->layout == i2s_multiline_float_burst) {
+            dst[line] = &out32[line][split * ch_num];
+        } else if (half) {
+            dst[line] = (uint16_t *)out32[line] + split * config->channel_per_line;
+        } else {
+            dst[line] = &out32[line][split * config->channel_per_line];
+        }
+    }
+    i2s_multiline_float_convert(&conv, dst, src, TEST_FIRST + split, frames - split);
+
+    memset(ref32, 0, sizeof(ref32));
+    ref_layout(config, &state, TEST_FIRST, 0, split);
+    ref_layout(config, &state, TEST_FIRST, split, frames - split);
+    if (config->layout == i2s_multiline_float_burst) {
+        lines = 1;
+    }
+    for (uint8_t line = 0; line < lines; line++) {
+        if (memcmp(out32[line], ref32[line], words * (half ? 2U : 4U)) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* 常数输入加抖动：误差(输出减输入，单位LSB)的均值应接近0，方差为TPDF的1/6加舍入的1/12 */
+static int dither_statistics(uint8_t bits, float x)
+{
+    i2s_multiline_float_t conv;
+    i2s_multiline_float_config_t config = {0};
+    const float *src[1] = {stat_in};
+    void *dst[1] = {stat_out};
+    double target = (double)x * ldexp(1.0, bits - 1);
+    double mean = 0;
+    double var = 0;
+    double e;
+
+    config.layout = i2s_multiline_float_burst;
+    config.line_num = 1;
+    config.channel_per_line = 1;
+    config.out_bits = bits;
+    config.dither = true;
+    for (uint32_t i = 0; i < TEST_STAT_SAMPLES; i++) {
+        stat_in[i] = x;
+    }
+    i2s_multiline_float_init(&conv, &config);
+    i2s_multiline_float_convert(&conv, dst, src, 0, TEST_STAT_SAMPLES);
+    for (uint32_t i = 0; i < TEST_STAT_SAMPLES; i++) {
+        e = (double)((int32_t)stat_out[i] >> (32U - bits)) - target;
+        mean += e;
+        var += e * e;
+    }
+    mean /= TEST_STAT_SAMPLES;
+    var = var / TEST_STAT_SAMPLES - mean * mean;
+    printf("%u bit dither at %.9f: error mean %+.4f LSB, variance %.4f LSB^2\n", bits, (double)x, mean, var);
+    return ((fabs(mean) < 0.01) && (fabs(var - 0.25) < 0.01)) ? 0 : 1;
+}
+
+int main(void)
+{
+    static const uint8_t bits_list[] = {16, 24, 32};
+    static const uint8_t cpl_list[] = {1, 2, 8};
+    static const uint32_t seed_list[] = {0, 12345};
+    i2s_multiline_float_config_t config = {0};
+    uint32_t cases = 0;
+    int fails = 0;
+
+    init_input();
+    for (uint8_t b = 0; b < ARRAY_SIZE(bits_list); b++) {
+        for (uint8_t layout = 0; layout < 2U; layout++) {
+            for (uint8_t lines = 1; lines <= 4U; lines++) {
+                for (uint8_t c = 0; c < ARRAY_SIZE(cpl_list); c++) {
+                    for (uint8_t dither = 0; dither < 2U; dither++) {
+                        for (uint8_t s = 0; s < ARRAY_SIZE(seed_list); s++) {
+                            for (uint8_t interleave = 0; interleave < 2U; interleave++) {
+                                config.layout = (i2s_multiline_float_layout_t)layout;
+                                config.line_num = lines;
+                                config.channel_per_line = cpl_list[c];
+                                config.out_bits = bits_list[b];
+                                config.dither = (dither != 0U);
+                                config.seed = seed_list[s];
+                                if (run_case(&config, interleave != 0U, 37) != 0) {
+                                    printf("FAIL: %u bit, layout %u, %u lines x %u, dither %u, seed %lu, %s\n",
+                                           bits_list[b], layout, lines, cpl_list[c], dither,
+                                           (unsigned long)seed_list[s], interleave ? "interleaved" : "planar");
+                                    fails++;
+                                }
+                                cases++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    printf("float to pcm: %lu cases bit-exact against the reference, %d failed\n", (unsigned long)cases, fails);
+
+    fails += dither_statistics(16, 0.123456789f);
+    fails += dither_statistics(16, 0.5f / 32768.0f);
+    fails += dither_statistics(24, -0.31415926f);
+    fails += dither_statistics(24, 0.5f / 8388608.0f);
+
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 多实例联动的启动偏移：I2S0为时钟主设备，I2S1~I2S3为从设备，共16条数据线，48kHz，每条2个时隙。
+ * per_line引擎每个实例4个DMA通道，每个控制器只开放8个通道，I2S2和I2S3的通道须分配到第二个控制器；
+ * burst引擎每个实例一个通道。每个节拍各实例的每条数据线须与I2S0数据线0在同一时刻输出同一帧的同一时隙，
+ * i2s_multiline_gang_measure_skew测得的偏移报告在golden中。
+ * 150ms时向I2S2注入DMA错误，该实例自行恢复后与其他实例错开，i2s_multiline_gang_task重新共同启动，之后重新对齐
+ */
+
+#include <string.h>
+#include "board.h"
+#include "host_model.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_interrupt.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_gang.h"
+
+#define GANG_SAMPLE_RATE       (48000U)
+#define GANG_INSTANCE_NUM      (4U)
+#define GANG_LINE_PER_INSTANCE (4U)
+#define GANG_LINE_NUM          (GANG_INSTANCE_NUM * GANG_LINE_PER_INSTANCE)
+#define GANG_CHANNEL_PER_LINE  (2U)
+#define GANG_FIFO_THRESHOLD    (4U)
+#define GANG_DMA_BURST         (2U)
+#define GANG_PERIOD_NUM        (4U)
+#define GANG_PERIOD_FRAMES     (128U)
+#define GANG_DMA_CHANNEL_MASK  (0x000000FFUL)
+#define GANG_RUN_MS            (300U)
+#define GANG_SKEW_MS           (100U)    /* 注入错误之前测量一次偏移 */
+#define GANG_FAULT_MS          (150U)
+#define GANG_FAULT_INSTANCE    (2U)
+
+#define GANG_MS_CYCLES(ms)     ((uint64_t)(ms) * (HOST_CPU_HZ / 1000U))
+#define GANG_LINE_BUF_SIZE     I2S_MULTILINE_STREAM_LINE_BUF_SIZE(GANG_PERIOD_NUM, GANG_PERIOD_FRAMES, \
+                                                                  GANG_CHANNEL_PER_LINE, 32)
+
+typedef struct {
+    const char *name;
+    i2s_multiline_engine_t engine;
+} gang_case_t;
+
+/* 各数据线的输出检查，以同一时刻I2S0数据线0输出的字为参照 */
+typedef struct {
+    uint64_t words;
+    uint64_t silent;
+    uint64_t invalid;
+    uint64_t misaligned;        /* 未注入错误或已重新同步时，与I2S0数据线0不在同一帧或同一时隙 */
+    uint64_t slipped;           /* 注入错误到重新同步之间错开的字 */
+    uint64_t ref_at;
+    uint32_t ref_frame;
+    uint8_t ref_slot;
+    bool ref_valid;
+    bool slipping;
+} gang_check_t;
+
+typedef struct {
+    i2s_multiline_gang_dma_plan_t plan[GANG_INSTANCE_NUM];
+    i2s_multiline_gang_stats_t stats;
+    int32_t skew_before[GANG_LINE_NUM];
+    int32_t skew_after[GANG_LINE_NUM];
+    hpm_stat_t skew_stat;
+    gang_check_t check;
+} gang_result_t;
+
+static const gang_case_t gang_cases[] = {
+    {"per_line", i2s_multiline_engine_per_line_dma},
+    {"burst", i2s_multiline_engine_burst_dma},
+};
+
+#define GANG_CASE_NUM          (sizeof(gang_cases) / sizeof(gang_cases[0]))
+
+static I2S_Type *const gang_i2s[GANG_INSTANCE_NUM] = {HPM_I2S0, HPM_I2S1, HPM_I2S2, HPM_I2S3};
+static const uint8_t gang_per_line_req[GANG_INSTANCE_NUM][I2S_MULTILINE_MAX_LINE] = {
+    {HPM_DMA_SRC_I2S0_TX_0, HPM_DMA_SRC_I2S0_TX_1, HPM_DMA_SRC_I2S0_TX_2, HPM_DMA_SRC_I2S0_TX_3},
+    {HPM_DMA_SRC_I2S1_TX_0, HPM_DMA_SRC_I2S1_TX_1, HPM_DMA_SRC_I2S1_TX_2, HPM_DMA_SRC_I2S1_TX_3},
+    {HPM_DMA_SRC_I2S2_TX_0, HPM_DMA_SRC_I2S2_TX_1, HPM_DMA_SRC_I2S2_TX_2, HPM_DMA_SRC_I2S2_TX_3},
+    {HPM_DMA_SRC_I2S3_TX_0, HPM_DMA_SRC_I2S3_TX_1, HPM_DMA_SRC_I2S3_TX_2, HPM_DMA_SRC_I2S3_TX_3},
+};
+static const uint8_t gang_burst_req[GANG_INSTANCE_NUM] = {
+    HPM_DMA_SRC_I2S0_TX, HPM_DMA_SRC_I2S1_TX, HPM_DMA_SRC_I2S2_TX, HPM_DMA_SRC_I2S3_TX,
+};
+
+static i2s_multiline_gang_t gang;
+static uint32_t gang_buffer[GANG_INSTANCE_NUM][GANG_LINE_BUF_SIZE * GANG_LINE_PER_INSTANCE / sizeof(uint32_t)];
+static gang_result_t gang_result[GANG_CASE_NUM];
+static gang_check_t *gang_check;
+static uint32_t write_frames;
+
+SDK_DECLARE_EXT_ISR_M(IRQn_XDMA, isr_xdma)
+void isr_xdma(void)
+{
+    i2s_multiline_dma_mgr_irq_handler(HPM_XDMA);
+}
+
+SDK_DECLARE_EXT_ISR_M(IRQn_HDMA, isr_hdma)
+void isr_hdma(void)
+{
+    i2s_multiline_dma_mgr_irq_handler(HPM_HDMA);
+}
+
+/* 高8位为全局数据线号+1，次4位为时隙号，低20位为帧序号，与i2s_multiline_gang示例相同 */
+static inline uint32_t gang_sample(uint32_t line, uint32_t slot, uint32_t frame)
+{
+    return ((line + 1U) << 24) | (slot << 20) | (frame & 0xFFFFFU);
+}
+
+static uint32_t gang_produce(i2s_multiline_engine_t engine)
+{
+    void *ptr[I2S_MULTILINE_GANG_MAX_LINE];
+    uint32_t frames = i2s_multiline_gang_get_write_ptr(&gang, ptr);
+    uint32_t *ring;
+    uint32_t line;
+
+    for (uint32_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+        for (uint32_t f = 0; f < frames; f++) {
+            for (uint32_t s = 0; s < GANG_CHANNEL_PER_LINE; s++) {
+                for (uint32_t l = 0; l < GANG_LINE_PER_INSTANCE; l++) {
+                    line = i * GANG_LINE_PER_INSTANCE + l;
+                    if (engine == i2s_multiline_engine_per_line_dma) {
+                        ring = (uint32_t *)ptr[line];
+                        ring[f * GANG_CHANNEL_PER_LINE + s] = gang_sample(line, s, write_frames + f);
+                    } else {
+                        ring = (uint32_t *)ptr[i];
+                        ring[(f * GANG_CHANNEL_PER_LINE + s) * GANG_LINE_PER_INSTANCE + l] =
+                            gang_sample(line, s, write_frames + f);
+                    }
+                }
+            }
+        }
+    }
+    if (frames > 0U) {
+        i2s_multiline_gang_commit(&gang, frames);
+        write_frames += frames;
+    }
+    return frames;
+}
+
+static hpm_stat_t gang_open(const gang_case_t *c)
+{
+    i2s_multiline_gang_config_t config = {0};
+    hpm_stat_t stat;
+
+    config.instance_num = GANG_INSTANCE_NUM;
+    for (uint8_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+        config.instance[i].i2s = gang_i2s[i];
+        if (c->engine == i2s_multiline_engine_per_line_dma) {
+            memcpy(config.instance[i].dma_req, gang_per_line_req[i], sizeof(config.instance[i].dma_req));
+        } else {
+            config.instance[i].dma_req[0] = gang_burst_req[i];
+        }
+        for (uint8_t l = 0; l < GANG_LINE_PER_INSTANCE; l++) {
+            config.instance[i].buffer[l] = (uint8_t *)gang_buffer[i] + l * GANG_LINE_BUF_SIZE;
+        }
+    }
+    config.dma_num = 2;
+    config.dma[0] = HPM_XDMA;
+    config.dma[1] = HPM_HDMA;
+    config.dmamux = HPM_DMAMUX;
+    config.engine = c->engine;
+    config.line_per_instance = GANG_LINE_PER_INSTANCE;
+    config.channel_per_line = GANG_CHANNEL_PER_LINE;
+    config.audio_depth = 32;
+    config.period_num = GANG_PERIOD_NUM;
+    config.period_frames = GANG_PERIOD_FRAMES;
+    config.dma_burst = GANG_DMA_BURST;
+
+    stat = i2s_multiline_gang_init(&gang, &config);
+    if (stat != status_success) {
+        return stat;
+    }
+    stat = i2s_multiline_gang_config_i2s(&gang, GANG_SAMPLE_RATE, clock_get_frequency(clock_i2s0),
+                                         GANG_FIFO_THRESHOLD);
+    if (stat == status_success) {
+        write_frames = 0;
+        while (gang_produce(c->engine) > 0U) {
+        }
+        stat = i2s_multiline_gang_start(&gang);
+    }
+    if (stat != status_success) {
+        i2s_multiline_gang_deinit(&gang);
+    }
+    return stat;
+}
+
+static int gang_run(const gang_case_t *c, gang_result_t *result)
+{
+    i2s_multiline_gang_dma_plan_t *plan = &gang.plan[GANG_FAULT_INSTANCE];
+    bool skew_done = false;
+    bool fault_done = false;
+    uint64_t start;
+    uint64_t now;
+
+    gang_check = &result->check;
+    if (gang_open(c) != status_success) {
+        return 1;
+    }
+    memcpy(result->plan, gang.plan, sizeof(result->plan));
+    start = host_cycles();
+    do {
+        now = host_cycles();
+        gang_produce(c->engine);
+        if (i2s_multiline_gang_task(&gang)) {
+            gang_check->slipping = false;
+        }
+        if (!skew_done && (now - start >= GANG_MS_CYCLES(GANG_SKEW_MS))) {
+            result->skew_stat = i2s_multiline_gang_measure_skew(&gang, result->skew_before);
+            skew_done = true;
+        }
+        if (!fault_done && (now - start >= GANG_MS_CYCLES(GANG_FAULT_MS))) {
+            gang_check->slipping = true;
+            host_dma_inject_error(plan->dma, plan->channel[0]);
+            fault_done = true;
+        }
+        host_cpu_idle();
+    } while (now - start < GANG_MS_CYCLES(GANG_RUN_MS));
+
+    if (result->skew_stat == status_success) {
+        result->skew_stat = i2s_multiline_gang_measure_skew(&gang, result->skew_after);
+    }
+    i2s_multiline_gang_get_stats(&gang, &result->stats);
+    i2s_multiline_gang_deinit(&gang);
+    gang_check = NULL;
+    return 0;
+}
+
+static int gang_main(void)
+{
+    if ((i2s_multiline_dma_mgr_add_controller(HPM_XDMA, HPM_DMAMUX, GANG_DMA_CHANNEL_MASK) != status_success) ||
+        (i2s_multiline_dma_mgr_add_controller(HPM_HDMA, HPM_DMAMUX, GANG_DMA_CHANNEL_MASK) != status_success)) {
+        return 1;
+    }
+    for (uint8_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+        board_config_i2s_clock(gang_i2s[i], GANG_SAMPLE_RATE);
+    }
+    intc_m_enable_irq_with_priority(IRQn_XDMA, 1);
+    intc_m_enable_irq_with_priority(IRQn_HDMA, 1);
+
+    for (uint32_t i = 0; i < GANG_CASE_NUM; i++) {
+        if (gang_run(&gang_cases[i], &gang_result[i]) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void gang_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data)
+{
+    uint32_t instance = ((uintptr_t)i2s - HPM_I2S0_BASE) / (HPM_I2S1_BASE - HPM_I2S0_BASE);
+    uint32_t global = instance * GANG_LINE_PER_INSTANCE + line;
+    gang_check_t *check = gang_check;
+
+    (void)user_data;
+    if (check == NULL) {
+        return;
+    }
+    if (global == 0U) {
+        check->ref_at = host_cycles();
+        check->ref_frame = word & 0xFFFFFU;
+        check->ref_slot = slot;
+        check->ref_valid = (word != 0U);
+    }
+    check->words++;
+    if (word == 0U) {
+        check->silent++;
+        return;
+    }
+    if (((word >> 24) != global + 1U) || (((word >> 20) & 0xFU) != slot)) {
+        check->invalid++;
+    } else if (!check->ref_valid || (check->ref_at != host_cycles()) || (check->ref_slot != slot) ||
+               (check->ref_frame != (word & 0xFFFFFU))) {
+        if (check->slipping) {
+            check->slipped++;
+        } else {
+            check->misaligned++;
+        }
+    }
+}
+
+static void setup(void)
+{
+    for (uint8_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+        host_i2s_set_tx_sink(gang_i2s[i], gang_sink, NULL);
+    }
+}
+
+static int check(FILE *fp)
+{
+    const gang_result_t *r;
+    int fails = 0;
+    bool aligned;
+
+    for (uint32_t c = 0; c < GANG_CASE_NUM; c++) {
+        r = &gang_result[c];
+        fprintf(fp, "%s:", gang_cases[c].name);
+        for (uint32_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+            fprintf(fp, " i2s%u %s x %u", i, (r->plan[i].dma == HPM_XDMA) ? "xdma" : "hdma", r->plan[i].channel_num);
+        }
+        fprintf(fp, "\n  %llu words, %llu silent, %llu invalid, %llu misaligned, %llu slipped before resync\n",
+                (unsigned long long)r->check.words, (unsigned long long)r->check.silent,
+                (unsigned long long)r->check.invalid, (unsigned long long)r->check.misaligned,
+                (unsigned long long)r->check.slipped);
+        fprintf(fp, "  underrun %u, dma error %u, fifo underflow %u, recovery %u, resync %u\n",
+                r->stats.underrun_count, r->stats.dma_error_count, r->stats.fifo_underflow_count,
+                r->stats.recovery_count, r->stats.resync_count);
+        fprintf(fp, "  skew before fault:");
+        for (uint32_t line = 0; line < GANG_LINE_NUM; line++) {
+            fprintf(fp, " %d", r->skew_before[line]);
+        }
+        fprintf(fp, "\n  skew after resync:");
+        for (uint32_t line = 0; line < GANG_LINE_NUM; line++) {
+            fprintf(fp, " %d", r->skew_after[line]);
+        }
+        fprintf(fp, "\n");
+
+        /* 主设备最后启动，所有实例从同一节拍开始；重新同步后仍然对齐，第二个控制器承担后两个实例 */
+        aligned = (r->skew_stat == status_success);
+        for (uint32_t line = 0; line < GANG_LINE_NUM; line++) {
+            if ((r->skew_before[line] != 0) || (r->skew_after[line] != 0)) {
+                aligned = false;
+            }
+        }
+        if ((r->check.invalid != 0U) || (r->check.misaligned != 0U) || !aligned || (r->stats.resync_count != 1U) ||
+            ((gang_cases[c].engine == i2s_multiline_engine_per_line_dma) &&
+             ((r->plan[0].dma != HPM_XDMA) || (r->plan[GANG_INSTANCE_NUM - 1U].dma != HPM_HDMA)))) {
+            fprintf(fp, "  FAIL\n");
+            fails++;
+        } else {
+            fprintf(fp, "  PASS\n");
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_gang",
+        .entry = gang_main,
+        .timeout_ms = 1000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_multiline_interrupt：中断引擎直接写TXD，96kHz，4条数据线
+ */
+
+#include "host_line_check.h"
+
+int demo_main(void);
+
+/* 测试数据：数据线line时隙slot第i帧为((line + 1) << 28) | (slot << 24) | (i << 12)，256帧循环 */
+static bool interrupt_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == line + 1U) && (((word >> 24) & 0xFU) == slot) && ((word & 0xFFFU) == 0U);
+}
+
+static bool interrupt_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 12) + 1U) & 0xFFU) == ((word >> 12) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = interrupt_valid,
+    .follows = interrupt_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static int check(FILE *fp)
+{
+    return host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_interrupt",
+        .entry = demo_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
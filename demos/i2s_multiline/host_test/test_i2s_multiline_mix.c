@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 增益/混音矩阵与逐帧参考实现比较。参考实现按接口说明独立计算：
+ * Q31输出为sum(x * g) / 2^31四舍五入(加2^30后向下取整)并饱和，以128位整数计算；
+ * Q15先把Q31增益四舍五入为Q15(1.0饱和为0x7FFF)，输出为sum(x * g15) / 2^15四舍五入并饱和。
+ * 增益过渡：设置后的第k个16帧段使用 起始增益 + k * 步长(步长 = 增益差 / 段数，向0取整)，段数之后为目标值。
+ * 覆盖1~16个输入输出声道的随机稀疏和满矩阵、满幅输入、±1.0增益的饱和、分块调用、
+ * 过渡中再次修改增益，以及单位阵直接返回输入指针且不写输出缓冲区。
+ */
+
+#include <string.h>
+#include "hpm_common.h"
+#include "i2s_multiline_mix.h"
+
+#define TEST_MAX_CHANNEL    (I2S_MULTILINE_MIX_MAX_CHANNEL)
+#define TEST_FRAMES         (300U)
+#define TEST_GUARD16        ((int16_t)0x5A5A)
+#define TEST_GUARD32        ((int32_t)0x5A5A5A5A)
+
+static int16_t in16[TEST_MAX_CHANNEL][TEST_FRAMES];
+static int32_t in32[TEST_MAX_CHANNEL][TEST_FRAMES];
+static int16_t out16[TEST_MAX_CHANNEL][TEST_FRAMES];
+static int32_t out32[TEST_MAX_CHANNEL][TEST_FRAMES];
+static int32_t ref_gain[TEST_FRAMES][TEST_MAX_CHANNEL][TEST_MAX_CHANNEL];
+static bool passthru[TEST_FRAMES];
+
+static uint32_t rand_state = 1;
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1664525UL + 1013904223UL;
+    return rand_state;
+}
+
+/* 随机采样，约1/4为满幅正负值 */
+static int32_t rand_sample32(void)
+{
+    switch (test_rand() >> 30) {
+    case 0:
+        return (test_rand() & 1U) ? INT32_MAX : INT32_MIN;
+    default:
+        return (int32_t)test_rand();
+    }
+}
+
+/* 随机增益：0、±1.0、-1.0(INT32_MIN)或任意Q31值 */
+static int32_t rand_gain(uint32_t density)
+{
+    if ((test_rand() >> 24) >= density) {
+        return 0;
+    }
+    switch (test_rand() >> 29) {
+    case 0:
+        return I2S_MULTILINE_MIX_UNITY;
+    case 1:
+        return -I2S_MULTILINE_MIX_UNITY;
+    case 2:
+        return INT32_MIN;
+    default:
+        return (int32_t)test_rand();
+    }
+}
+
+static void fill_input(uint8_t in_num)
+{
+    for (uint8_t m = 0; m < in_num; m++) {
+        for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+            in32[m][i] = rand_sample32();
+            in16[m][i] = (int16_t)(in32[m][i] >> 16);
+        }
+    }
+}
+
+static int32_t ref_q31(const int32_t gain[][TEST_MAX_CHANNEL], uint8_t n, uint8_t in_num, uint32_t i)
+{
+    __int128 acc = (__int128)1 << 30;
+
+    for (uint8_t m = 0; m < in_num; m++) {
+        acc += (__int128)in32[m][i] * gain[n][m];
+    }
+    acc >>= 31;
+    return (acc > INT32_MAX) ? INT32_MAX : ((acc < INT32_MIN) ? INT32_MIN : (int32_t)acc);
+}
+
+static int16_t ref_q15(const int32_t gain[][TEST_MAX_CHANNEL], uint8_t n, uint8_t in_num, uint32_t i)
+{
+    int64_t acc = 1LL << 14;
+    int64_t g;
+
+    for (uint8_t m = 0; m < in_num; m++) {
+        g = ((int64_t)gain[n][m] + 0x8000) >> 16;
+        g = (g > INT16_MAX) ? INT16_MAX : g;
+        acc += (int64_t)in16[m][i] * g;
+    }
+    acc >>= 15;
+    return (acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : (int16_t)acc);
+}
+
+/*
+ * 参考增益序列：从start帧开始向target过渡，ramp_frames为过渡帧数，
+ * 结果写入ref_gain[start..TEST_FRAMES)，cur为start帧之前生效的增益
+ */
+static void ref_ramp(const int32_t cur[][TEST_MAX_CHANNEL], const int32_t target[][TEST_MAX_CHANNEL],
+                     uint8_t out_num, uint8_t in_num, uint32_t ramp_frames, uint32_t start)
+{
+    uint32_t segments = (ramp_frames + I2S_MULTILINE_MIX_RAMP_BLOCK - 1U) / I2S_MULTILINE_MIX_RAMP_BLOCK;
+    uint32_t k;
+    int64_t step;
+
+    for (uint32_t i = start; i < TEST_FRAMES; i++) {
+        k = (i - start) / I2S_MULTILINE_MIX_RAMP_BLOCK;
+        for (uint8_t n = 0; n < out_num; n++) {
+            for (uint8_t m = 0; m < in_num; m++) {
+                if (k >= segments) {
+                    ref_gain[i][n][m] = target[n][m];
+                } else {
+                    step = ((int64_t)target[n][m] - cur[n][m]) / (int64_t)segments;
+                    ref_gain[i][n][m] = (int32_t)(cur[n][m] + step * (int64_t)k);
+                }
+            }
+        }
+    }
+}
+
+/* 分块处理[from, to)帧，块长由chunk列表循环给出，比较输出并检查返回的指针 */
+static int run_frames(i2s_multiline_mix_t *mix, uint32_t from, uint32_t to, const uint32_t *chunk, uint8_t chunk_num)
+{
+    const i2s_multiline_mix_config_t *cfg = &mix->config;
+    const void *in[TEST_MAX_CHANNEL];
+    void *out[TEST_MAX_CHANNEL];
+    const void *const *ret;
+    uint32_t n;
+    uint8_t c = 0;
+    int fails = 0;
+
+    for (uint32_t i = from; i < to; i += n) {
+        n = chunk[c++ % chunk_num];
+        n = (n > to - i) ? (to - i) : n;
+        for (uint8_t m = 0; m < cfg->in_num; m++) {
+            in[m] = (cfg->format == i2s_multiline_mix_q15) ? (const void *)&in16[m][i] : (const void *)&in32[m][i];
+        }
+        for (uint8_t k = 0; k < cfg->out_num; k++) {
+            out[k] = (cfg->format == i2s_multiline_mix_q15) ? (void *)&out16[k][i] : (void *)&out32[k][i];
+        }
+        ret = i2s_multiline_mix_process(mix, in, out, n);
+        if ((ret != (const void *const *)out) && (ret != in)) {
+            fails++;
+        }
+        /* 单位阵时返回输入，这些帧直接与输入比较(Q15非单位阵路径中1.0为0x7FFF) */
+        memset(&passthru[i], (ret == in) ? 1 : 0, n * sizeof(bool));
+        for (uint8_t k = 0; (ret == in) && (k < cfg->out_num); k++) {
+            if (cfg->format == i2s_multiline_mix_q15) {
+                memcpy(&out16[k][i], ret[k], n * sizeof(int16_t));
+            } else {
+                memcpy(&out32[k][i], ret[k], n * sizeof(int32_t));
+            }
+        }
+    }
+
+    for (uint32_t i = from; i < to; i++) {
+        for (uint8_t k = 0; k < cfg->out_num; k++) {
+            if (passthru[i]) {
+                fails += (cfg->format == i2s_multiline_mix_q15) ? (out16[k][i] != in16[k][i])
+                                                                : (out32[k][i] != in32[k][i]);
+            } else if (cfg->format == i2s_multiline_mix_q15) {
+                fails += (out16[k][i] != ref_q15(ref_gain[i], k, cfg->in_num, i)) ? 1 : 0;
+            } else {
+                fails += (out32[k][i] != ref_q31(ref_gain[i], k, cfg->in_num, i)) ? 1 : 0;
+            }
+        }
+    }
+    return fails;
+}
+
+/* 随机矩阵，立即生效，整块与分块处理 */
+static int test_matrix(i2s_multiline_mix_format_t format, uint8_t in_num, uint8_t out_num, uint32_t density)
+{
+    static const uint32_t whole[] = {TEST_FRAMES};
+    static const uint32_t odd[] = {1, 7, 16, 33, 2};
+    i2s_multiline_mix_config_t config = {format, in_num, out_num, 0};
+    i2s_multiline_mix_t mix;
+    int32_t matrix[TEST_MAX_CHANNEL * TEST_MAX_CHANNEL];
+    int32_t target[TEST_MAX_CHANNEL][TEST_MAX_CHANNEL];
+    int fails = 0;
+
+    i2s_multiline_mix_init(&mix, &config);
+    for (uint8_t n = 0; n < out_num; n++) {
+        for (uint8_t m = 0; m < in_num; m++) {
+            target[n][m] = rand_gain(density);
+            matrix[n * in_num + m] = target[n][m];
+        }
+    }
+    i2s_multiline_mix_set_matrix(&mix, matrix);
+    fill_input(in_num);
+    ref_ramp(target, target, out_num, in_num, 0, 0);
+    fails += run_frames(&mix, 0, TEST_FRAMES, whole, 1);
+    fails += run_frames(&mix, 0, TEST_FRAMES, odd, ARRAY_SIZE(odd));
+    return fails;
+}
+
+/* 满幅输入和16个±1.0增益，结果须饱和 */
+static int test_saturation(i2s_multiline_mix_format_t format)
+{
+    i2s_multiline_mix_config_t config = {format, TEST_MAX_CHANNEL, 2, 0};
+    i2s_multiline_mix_t mix;
+    const void *in[TEST_MAX_CHANNEL];
+    void *out[2];
+    int fails = 0;
+
+    i2s_multiline_mix_init(&mix, &config);
+    for (uint8_t m = 0; m < TEST_MAX_CHANNEL; m++) {
+        i2s_multiline_mix_set_gain(&mix, 0, m, I2S_MULTILINE_MIX_UNITY);
+        i2s_multiline_mix_set_gain(&mix, 1, m, INT32_MIN);
+        for (uint32_t i = 0; i < 4U; i++) {
+            in32[m][i] = (i & 1U) ? INT32_MIN : INT32_MAX;
+            in16[m][i] = (i & 1U) ? INT16_MIN : INT16_MAX;
+        }
+        in[m] = (format == i2s_multiline_mix_q15) ? (const void *)in16[m] : (const void *)in32[m];
+    }
+    out[0] = (format == i2s_multiline_mix_q15) ? (void *)out16[0] : (void *)out32[0];
+    out[1] = (format == i2s_multiline_mix_q15) ? (void *)out16[1] : (void *)out32[1];
+    i2s_multiline_mix_process(&mix, in, out, 4);
+    for (uint32_t i = 0; i < 4U; i++) {
+        if (format == i2s_multiline_mix_q15) {
+            fails += (out16[0][i] != ((i & 1U) ? INT16_MIN : INT16_MAX)) ? 1 : 0;
+            fails += (out16[1][i] != ((i & 1U) ? INT16_MAX : INT16_MIN)) ? 1 : 0;
+        } else {
+            fails += (out32[0][i] != ((i & 1U) ? INT32_MIN : INT32_MAX)) ? 1 : 0;
+            fails += (out32[1][i] != ((i & 1U) ? INT32_MAX : INT32_MIN)) ? 1 : 0;
+        }
+    }
+    return fails;
+}
+
+/* 增益过渡：过渡中途再次修改，分块边界不与16帧段对齐 */
+static int test_ramp(i2s_multiline_mix_format_t format, uint8_t in_num, uint8_t out_num, uint32_t ramp_frames)
+{
+    static const uint32_t odd[] = {5, 11, 16, 3, 40};
+    i2s_multiline_mix_config_t config = {format, in_num, out_num, ramp_frames};
+    i2s_multiline_mix_t mix;
+    int32_t matrix[TEST_MAX_CHANNEL * TEST_MAX_CHANNEL];
+    int32_t cur[TEST_MAX_CHANNEL][TEST_MAX_CHANNEL];
+    int32_t target[TEST_MAX_CHANNEL][TEST_MAX_CHANNEL];
+    uint32_t split = (ramp_frames / 2U + I2S_MULTILINE_MIX_RAMP_BLOCK - 1U) / I2S_MULTILINE_MIX_RAMP_BLOCK *
+                     I2S_MULTILINE_MIX_RAMP_BLOCK;
+    int fails = 0;
+
+    i2s_multiline_mix_init(&mix, &config);
+    fill_input(in_num);
+    for (uint8_t n = 0; n < out_num; n++) {
+        for (uint8_t m = 0; m < in_num; m++) {
+            cur[n][m] = ((in_num == out_num) && (n == m)) ? I2S_MULTILINE_MIX_UNITY : 0;
+            target[n][m] = rand_gain(160);
+            matrix[n * in_num + m] = target[n][m];
+        }
+    }
+    i2s_multiline_mix_set_matrix(&mix, matrix);
+    ref_ramp(cur, target, out_num, in_num, ramp_frames, 0);
+
+    /* 在段边界处修改一个增益，新的过渡从当时生效的增益开始 */
+    fails += run_frames(&mix, 0, split, odd, ARRAY_SIZE(odd));
+    memcpy(cur, ref_gain[split], sizeof(cur));
+    target[out_num - 1U][0] = -target[out_num - 1U][0] / 2;
+    i2s_multiline_mix_set_gain(&mix, out_num - 1U, 0, target[out_num - 1U][0]);
+    ref_ramp(cur, target, out_num, in_num, ramp_frames, split);
+    fails += run_frames(&mix, split, TEST_FRAMES, odd, ARRAY_SIZE(odd));
+    return fails;
+}
+
+/* 单位阵：返回输入指针且不写输出；过渡回单位阵期间计算输出，过渡结束后恢复零拷贝 */
+static int test_identity(i2s_multiline_mix_format_t format)
+{
+    static const uint32_t block[] = {I2S_MULTILINE_MIX_RAMP_BLOCK};
+    i2s_multiline_mix_config_t config = {format, 8, 8, 2U * I2S_MULTILINE_MIX_RAMP_BLOCK};
+    i2s_multiline_mix_t mix;
+    const void *in[TEST_MAX_CHANNEL];
+    void *out[TEST_MAX_CHANNEL];
+    int32_t cur[TEST_MAX_CHANNEL][TEST_MAX_CHANNEL] = {0};
+    int32_t target[TEST_MAX_CHANNEL][TEST_MAX_CHANNEL] = {0};
+    int fails = 0;
+
+    i2s_multiline_mix_init(&mix, &config);
+    fill_input(8);
+    for (uint8_t k = 0; k < 8U; k++) {
+        in[k] = (format == i2s_multiline_mix_q15) ? (const void *)in16[k] : (const void *)in32[k];
+        out[k] = (format == i2s_multiline_mix_q15) ? (void *)out16[k] : (void *)out32[k];
+        for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+            out16[k][i] = TEST_GUARD16;
+            out32[k][i] = TEST_GUARD32;
+        }
+        cur[k][k] = I2S_MULTILINE_MIX_UNITY;
+        target[k][k] = I2S_MULTILINE_MIX_UNITY;
+    }
+    if (i2s_multiline_mix_process(&mix, in, out, TEST_FRAMES) != in) {
+        fails++;
+    }
+    for (uint8_t k = 0; k < 8U; k++) {
+        for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+            fails += ((out16[k][i] != TEST_GUARD16) || (out32[k][i] != TEST_GUARD32)) ? 1 : 0;
+        }
+    }
+
+    /* 立即生效的非单位增益，再过渡回单位阵 */
+    mix.config.ramp_frames = 0;
+    i2s_multiline_mix_set_gain(&mix, 3, 3, I2S_MULTILINE_MIX_UNITY / 2);
+    cur[3][3] = I2S_MULTILINE_MIX_UNITY / 2;
+    ref_ramp(cur, cur, 8, 8, 0, 0);
+    fails += run_frames(&mix, 0, I2S_MULTILINE_MIX_RAMP_BLOCK, block, 1);
+    if (mix.identity) {
+        fails++;
+    }
+    mix.config.ramp_frames = 2U * I2S_MULTILINE_MIX_RAMP_BLOCK;
+    i2s_multiline_mix_set_gain(&mix, 3, 3, I2S_MULTILINE_MIX_UNITY);
+    ref_ramp(cur, target, 8, 8, 2U * I2S_MULTILINE_MIX_RAMP_BLOCK, I2S_MULTILINE_MIX_RAMP_BLOCK);
+    fails += run_frames(&mix, I2S_MULTILINE_MIX_RAMP_BLOCK, 3U * I2S_MULTILINE_MIX_RAMP_BLOCK, block, 1);
+    if (i2s_multiline_mix_process(&mix, in, out, TEST_FRAMES) != in) {
+        fails++;
+    }
+
+    /* 输入输出声道数不同时不是单位阵 */
+    config.out_num = 6;
+    i2s_multiline_mix_init(&mix, &config);
+    if (mix.identity || (i2s_multiline_mix_process(&mix, in, out, 4) != (const void *const *)out)) {
+        fails++;
+    }
+    return fails;
+}
+
+int main(void)
+{
+    static const char *const format_name[] = {"q15", "q31"};
+    static const uint8_t channel_list[] = {1, 2, 3, 8, 16};
+    static const uint32_t density_list[] = {40, 256};
+    static const uint32_t ramp_list[] = {1, 16, 100, 160};
+    i2s_multiline_mix_config_t bad = {i2s_multiline_mix_q15, 0, 2, 0};
+    i2s_multiline_mix_t mix;
+    uint32_t cases = 0;
+    int fails = 0;
+    int f;
+
+    if ((i2s_multiline_mix_init(&mix, &bad) != status_invalid_argument)) {
+        printf("FAIL init accepts 0 inputs\n");
+        fails++;
+    }
+    bad.in_num = TEST_MAX_CHANNEL + 1U;
+    if ((i2s_multiline_mix_init(&mix, &bad) != status_invalid_argument)) {
+        printf("FAIL init accepts %u inputs\n", TEST_MAX_CHANNEL + 1U);
+        fails++;
+    }
+
+    for (uint8_t format = 0; format < 2U; format++) {
+        for (uint8_t a = 0; a < ARRAY_SIZE(channel_list); a++) {
+            for (uint8_t b = 0; b < ARRAY_SIZE(channel_list); b++) {
+                for (uint8_t d = 0; d < ARRAY_SIZE(density_list); d++) {
+                    f = test_matrix((i2s_multiline_mix_format_t)format, channel_list[a], channel_list[b],
+                                    density_list[d]);
+                    if (f != 0) {
+                        printf("FAIL %s matrix %u->%u density %lu: %d\n", format_name[format], channel_list[a],
+                               channel_list[b], (unsigned long)density_list[d], f);
+                        fails++;
+                    }
+                    cases++;
+                }
+                for (uint8_t r = 0; r < ARRAY_SIZE(ramp_list); r++) {
+                    f = test_ramp((i2s_multiline_mix_format_t)format, channel_list[a], channel_list[b], ramp_list[r]);
+                    if (f != 0) {
+                        printf("FAIL %s ramp %u->%u over %lu frames: %d\n", format_name[format], channel_list[a],
+                               channel_list[b], (unsigned long)ramp_list[r], f);
+                        fails++;
+                    }
+                    cases++;
+                }
+            }
+        }
+        f = test_saturation((i2s_multiline_mix_format_t)format);
+        if (f != 0) {
+            printf("FAIL %s saturation: %d\n", format_name[format], f);
+            fails++;
+        }
+        f = test_identity((i2s_multiline_mix_format_t)format);
+        if (f != 0) {
+            printf("FAIL %s identity: %d\n", format_name[format], f);
+            fails++;
+        }
+        cases += 2U;
+    }
+
+    printf("%lu cases, %s\n", (unsigned long)cases, (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 打包和解包与逐采样参考实现比较，覆盖16/24/32位、有效位数、广播、1~4条数据线和TDM时隙数，
+ * 以及起始帧不对齐、帧数不足一组和源地址不对齐的情况。
+ * 解包的输入在采样以下的低位填入随机数据(接收的32位时隙中采样以外的位)，结果须与源数据一致，
+ * 且不写入请求范围以外的帧。
+ */
+
+#include <stdlib.h>
+#include "hpm_common.h"
+#include "i2s_multiline_pack.h"
+
+#define TEST_MAX_CHANNEL    (I2S_MULTILINE_PACK_MAX_CHANNEL)
+#define TEST_MAX_FRAMES     (80U)
+#define TEST_GUARD          (0xA5U)
+
+/* 平面缓冲区，多留4字节用于源地址不对齐 */
+static uint8_t planar_src[TEST_MAX_CHANNEL][TEST_MAX_FRAMES * 4U + 4U] ATTR_ALIGN(4);
+static uint8_t planar_dst[TEST_MAX_CHANNEL][TEST_MAX_FRAMES * 4U + 4U] ATTR_ALIGN(4);
+static uint32_t packed[TEST_MAX_FRAMES * TEST_MAX_CHANNEL];
+static uint32_t expect[TEST_MAX_FRAMES * TEST_MAX_CHANNEL];
+
+static uint32_t rand_state = 1;
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1664525UL + 1013904223UL;
+    return rand_state;
+}
+
+static uint8_t sample_bytes(i2s_multiline_pack_format_t format)
+{
+    return (format == i2s_multiline_pack_s16) ? 2U : ((format == i2s_multiline_pack_s24) ? 3U : 4U);
+}
+
+static uint8_t sample_bits(const i2s_multiline_pack_config_t *config)
+{
+    if (config->format != i2s_multiline_pack_s32) {
+        return sample_bytes(config->format) * 8U;
+    }
+    return (config->valid_bits == 0U) ? 32U : config->valid_bits;
+}
+
+/* 读取小端采样并符号扩展 */
+static int32_t read_sample(const uint8_t *p, uint8_t bytes, uint8_t bits)
+{
+    uint32_t v = 0;
+
+    for (uint8_t i = 0; i < bytes; i++) {
+        v |= (uint32_t)p[i] << (8U * i);
+    }
+    return (int32_t)(v << (32U - bits)) >> (32U - bits);
+}
+
+static void write_sample(uint8_t *p, uint8_t bytes, int32_t v)
+{
+    for (uint8_t i = 0; i < bytes; i++) {
+        p[i] = (uint8_t)((uint32_t)v >> (8U * i));
+    }
+}
+
+/* 参考实现：每帧依次为slot0的各数据线、slot1的各数据线...，采样左对齐 */
+static void reference_pack(const i2s_multiline_pack_config_t *config, const uint8_t *src[], uint32_t first,
+                           uint32_t frames)
+{
+    uint8_t bytes = sample_bytes(config->format);
+    uint8_t bits = sample_bits(config);
+    uint32_t *dst = expect;
+    uint8_t ch;
+
+    for (uint32_t f = first; f < first + frames; f++) {
+        for (uint8_t slot = 0; slot < config->channel_per_line; slot++) {
+            for (uint8_t line = 0; line < config->line_num; line++) {
+                ch = config->broadcast ? slot : (uint8_t)(line * config->channel_per_line + slot);
+                *dst++ = (uint32_t)read_sample(src[ch] + f * bytes, bytes, bits) << (32U - bits);
+            }
+        }
+    }
+}
+
+static int run_case(const i2s_multiline_pack_config_t *config, uint32_t first, uint32_t frames, uint8_t misalign)
+{
+    i2s_multiline_pack_t pack;
+    const uint8_t *src[TEST_MAX_CHANNEL];
+    void *dst[TEST_MAX_CHANNEL];
+    uint8_t bytes = sample_bytes(config->format);
+    uint8_t bits = sample_bits(config);
+    uint8_t src_num = config->broadcast ? config->channel_per_line : config->line_num * config->channel_per_line;
+    uint32_t words = frames * config->line_num * config->channel_per_line;
+    uint32_t garbage_mask = (bits == 32U) ? 0U : (0xFFFFFFFFUL >> bits);
+    int fails = 0;
+
+    if (status_success != i2s_multiline_pack_init(&pack, config)) {
+        printf("init failed\n");
+        return 1;
+    }
+    for (uint8_t ch = 0; ch < src_num; ch++) {
+        for (uint32_t f = 0; f < TEST_MAX_FRAMES; f++) {
+            write_sample(&planar_src[ch][misalign + f * bytes], bytes,
+                         (int32_t)(test_rand() << (32U - bits)) >> (32U - bits));
+        }
+        src[ch] = &planar_src[ch][misalign];
+    }
+
+    memset(packed, 0, sizeof(packed));
+    i2s_multiline_pack(&pack, packed, (const void *const *)src, first, frames);
+    reference_pack(config, src, first, frames);
+    if (memcmp(packed, expect, words * sizeof(uint32_t)) != 0) {
+        fails++;
+    }
+    if (config->broadcast) {
+        return fails;
+    }
+
+    /* 解包：低位填入随机数据，采样须还原且范围外的帧不变 */
+    for (uint32_t i = 0; i < words; i++) {
+        expect[i] |= test_rand() & garbage_mask;
+    }
+    memset(planar_dst, TEST_GUARD, sizeof(planar_dst));
+    for (uint8_t ch = 0; ch < src_num; ch++) {
+        dst[ch] = &planar_dst[ch][misalign];
+    }
+    i2s_multiline_unpack(&pack, dst, first, expect, frames);
+    for (uint8_t ch = 0; ch < src_num; ch++) {
+        for (uint32_t f = 0; f < TEST_MAX_FRAMES; f++) {
+            const uint8_t *d = &planar_dst[ch][misalign + f * bytes];
+            bool inside = (f >= first) && (f < first + frames);
+            for (uint8_t b = 0; b < bytes; b++) {
+                if (inside ? (d[b] != planar_src[ch][misalign + f * bytes + b]) : (d[b] != TEST_GUARD)) {
+                    fails++;
+                    f = TEST_MAX_FRAMES;
+                    break;
+                }
+            }
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    static const char *const format_name[] = {"s16", "s24", "s32"};
+    static const uint8_t cpl_list[] = {1, 2, 3, 8, 16};
+    static const uint8_t valid_list[] = {0, 24, 20};
+    static const uint32_t first_list[] = {0, 1, 2, 3, 5};
+    static const uint32_t frames_list[] = {0, 1, 3, 4, 7, 64, 67};
+    i2s_multiline_pack_config_t config;
+    uint32_t cases = 0;
+    int fails = 0;
+    int f;
+
+    for (uint8_t format = 0; format < 3U; format++) {
+        for (uint8_t lines = 1; lines <= 4U; lines++) {
+            for (uint8_t c = 0; c < ARRAY_SIZE(cpl_list); c++) {
+                if (lines * cpl_list[c] > TEST_MAX_CHANNEL) {
+                    continue;
+                }
+                for (uint8_t v = 0; v < ((format == i2s_multiline_pack_s32) ? ARRAY_SIZE(valid_list) : 1U); v++) {
+                    for (uint8_t broadcast = 0; broadcast < 2U; broadcast++) {
+                        for (uint8_t i = 0; i < ARRAY_SIZE(first_list); i++) {
+                            for (uint8_t j = 0; j < ARRAY_SIZE(frames_list); j++) {
+                                for (uint8_t misalign = 0; misalign < 2U; misalign++) {
+                                    config.format = (i2s_multiline_pack_format_t)format;
+                                    config.line_num = lines;
+                                    config.channel_per_line = cpl_list[c];
+                                    config.valid_bits = valid_list[v];
+                                    config.broadcast = (broadcast != 0U);
+                                    f = run_case(&config, first_list[i], frames_list[j], misalign);
+                                    if (f != 0) {
+                                        printf("FAIL %s lines %u cpl %u valid %u broadcast %u first %lu frames %lu "
+                                               "misalign %u\n", format_name[format], lines, cpl_list[c],
+                                               valid_list[v], broadcast, (unsigned long)first_list[i],
+                                               (unsigned long)frames_list[j], misalign);
+                                        fails++;
+                                    }
+                                    cases++;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    printf("pack/unpack: %lu cases, %d failed\n", (unsigned long)cases, fails);
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * mchtmr定时启动和呈现时间戳：burst引擎，48kHz，4条数据线，每条2个时隙，4个周期 x 256帧。
+ * i2s_multiline_sched_start_at在请求的mchtmr计数启动I2S，模型的I2S在使能一个时隙之后开始移出第一帧，
+ * 因此第一帧及每个周期第一帧的实际输出时刻须比start_tick和pts_cb给出的时间戳晚一个时隙。
+ * 第二种情况调度器的标称采样率比I2S实际的采样率高约104ppm，拟合之前时间戳按标称速率逐渐偏离，
+ * 拟合之后的漂移须与实际的偏差一致，时间戳重新与实际输出对齐；运行结束时tick_to_frame须给出正在输出的帧
+ */
+
+#include "board.h"
+#include "host_model.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_interrupt.h"
+#include "hpm_mchtmr_drv.h"
+#include "i2s_multiline_cfg.h"
+#include "i2s_multiline_sched.h"
+
+#define SCHED_SAMPLE_RATE      (48000U)
+#define SCHED_LINE_NUM         (4U)
+#define SCHED_CHANNEL_PER_LINE (2U)
+#define SCHED_PERIOD_NUM       (4U)
+#define SCHED_PERIOD_FRAMES    (256U)
+#define SCHED_DMA_CHANNEL      (0U)
+#define SCHED_LEAD_US          (3000U)   /* 请求的启动时刻距当前的时间 */
+#define SCHED_RUN_MS           (400U)
+#define SCHED_MAX_PERIOD       (96U)
+#define SCHED_TOLERANCE_NS     (1000)    /* 启动和时间戳相对实际输出的误差上限，为一个时隙的约1/10 */
+#define SCHED_TOLERANCE_PPB    (1000)
+/* 模型的I2S在使能一个时隙之后开始移出第一个字 */
+#define SCHED_SLOT_CYCLES      (HOST_CPU_HZ / (SCHED_SAMPLE_RATE * SCHED_CHANNEL_PER_LINE))
+#define SCHED_TICK_CYCLES      (HOST_CPU_HZ / HOST_MCHTMR_HZ)
+#define SCHED_FIT_PERIODS      ((I2S_MULTILINE_SCHED_MIN_FIT_MS * SCHED_SAMPLE_RATE / 1000U + \
+                                 SCHED_PERIOD_FRAMES - 1U) / SCHED_PERIOD_FRAMES)
+
+I2S_MULTILINE_CFG_DEFINE(sched_cfg, SCHED_LINE_NUM, 32, SCHED_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         SCHED_SAMPLE_RATE)
+
+typedef struct {
+    const char *name;
+    uint32_t nominal_rate;      /* 告知调度器的标称采样率 */
+} sched_case_t;
+
+typedef struct {
+    uint64_t start_tick;
+    int32_t start_error;
+    uint64_t first_cycles;      /* 第一帧开始输出的CPU周期 */
+    uint64_t out_cycles[SCHED_MAX_PERIOD];  /* 各周期第一帧开始输出的CPU周期 */
+    uint64_t pts[SCHED_MAX_PERIOD];
+    uint32_t pts_num;
+    uint32_t out_num;
+    int32_t drift_ppb;
+    uint32_t end_frame;         /* 结束时tick_to_frame给出的帧序号 */
+    uint32_t end_out_frame;     /* 结束时数据线0正在输出的帧 */
+    uint32_t period_count;
+    uint32_t measure_fail_count;
+    i2s_multiline_stream_stats_t stats;
+} sched_result_t;
+
+static const sched_case_t sched_cases[] = {
+    {"nominal 48000 Hz", SCHED_SAMPLE_RATE},
+    {"nominal 48005 Hz", SCHED_SAMPLE_RATE + 5U},
+};
+
+#define SCHED_CASE_NUM         (sizeof(sched_cases) / sizeof(sched_cases[0]))
+
+static i2s_multiline_stream_t sched_stream;
+static i2s_multiline_sched_t sched;
+static uint32_t sched_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(SCHED_PERIOD_NUM, SCHED_PERIOD_FRAMES,
+                                                                 SCHED_LINE_NUM, SCHED_CHANNEL_PER_LINE) /
+                             sizeof(uint32_t)];
+static sched_result_t sched_result[SCHED_CASE_NUM];
+static sched_result_t *sched_current;
+static uint32_t write_frames;
+
+SDK_DECLARE_EXT_ISR_M(IRQn_XDMA, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&sched_stream);
+}
+
+static void sched_pts(i2s_multiline_sched_t *s, uint32_t period, uint64_t pts, void *user_data)
+{
+    sched_result_t *result = (sched_result_t *)user_data;
+
+    (void)s;
+    if (period < SCHED_MAX_PERIOD) {
+        result->pts[period] = pts;
+        result->pts_num = period + 1U;
+    }
+}
+
+/* 高8位为数据线号+1，次4位为时隙号，低20位为帧序号，与i2s_multiline_sched示例相同 */
+static uint32_t sched_produce(void)
+{
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t n = i2s_multiline_stream_get_write_ptr(&sched_stream, ring_ptr);
+    uint32_t *ring = (uint32_t *)ring_ptr[0];
+
+    for (uint32_t f = 0; f < n; f++) {
+        for (uint32_t s = 0; s < SCHED_CHANNEL_PER_LINE; s++) {
+            for (uint32_t l = 0; l < SCHED_LINE_NUM; l++) {
+                *ring++ = ((l + 1U) << 24) | (s << 20) | ((write_frames + f) & 0xFFFFFU);
+            }
+        }
+    }
+    if (n > 0U) {
+        i2s_multiline_stream_commit(&sched_stream, n);
+        write_frames += n;
+    }
+    return n;
+}
+
+static int sched_run(const sched_case_t *c, sched_result_t *result)
+{
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_sched_config_t sched_config = {0};
+    uint64_t stop_tick;
+
+    config.i2s = HPM_I2S0;
+    config.dma = HPM_XDMA;
+    config.dmamux = HPM_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = SCHED_LINE_NUM;
+    config.dma_channel[0] = SCHED_DMA_CHANNEL;
+    config.dma_req[0] = HPM_DMA_SRC_I2S0_TX;
+    config.channel_per_line = SCHED_CHANNEL_PER_LINE;
+    config.audio_depth = 32;
+    config.period_num = SCHED_PERIOD_NUM;
+    config.period_frames = SCHED_PERIOD_FRAMES;
+    config.buffer[0] = sched_buffer;
+    if (i2s_multiline_stream_init(&sched_stream, &config) != status_success) {
+        return 1;
+    }
+    sched_config.mchtmr = HPM_MCHTMR;
+    sched_config.mchtmr_hz = clock_get_frequency(clock_mchtmr0);
+    sched_config.sample_rate = c->nominal_rate;
+    sched_config.pts_cb = sched_pts;
+    sched_config.user_data = result;
+    if (i2s_multiline_sched_init(&sched, &sched_stream, &sched_config) != status_success) {
+        return 1;
+    }
+
+    write_frames = 0;
+    while (sched_produce() > 0U) {
+    }
+    sched_current = result;
+    result->start_tick = i2s_multiline_sched_now(&sched) + i2s_multiline_sched_us_to_tick(&sched, SCHED_LEAD_US);
+    stop_tick = result->start_tick + i2s_multiline_sched_us_to_tick(&sched, SCHED_RUN_MS * 1000U);
+    if (i2s_multiline_sched_start_at(&sched, result->start_tick) != status_success) {
+        return 1;
+    }
+    result->start_error = sched.start_error;
+
+    while (i2s_multiline_sched_now(&sched) < stop_tick) {
+        i2s_multiline_stream_task(&sched_stream);
+        sched_produce();
+        host_cpu_idle();
+    }
+    result->end_frame = i2s_multiline_sched_tick_to_frame(&sched, i2s_multiline_sched_now(&sched));
+    result->drift_ppb = i2s_multiline_sched_get_drift_ppb(&sched);
+    result->period_count = sched.period_count;
+    result->measure_fail_count = sched.measure_fail_count;
+    i2s_multiline_stream_stop(&sched_stream);
+    i2s_multiline_stream_get_stats(&sched_stream, &result->stats);
+    sched_current = NULL;
+    return 0;
+}
+
+static int sched_main(void)
+{
+    board_config_i2s_clock(HPM_I2S0, SCHED_SAMPLE_RATE);
+    if (sched_cfg_config_i2s(HPM_I2S0, clock_get_frequency(clock_i2s0), sched_cfg_fifo_threshold) !=
+        status_success) {
+        return 1;
+    }
+    intc_m_enable_irq_with_priority(IRQn_XDMA, 1);
+
+    for (uint32_t i = 0; i < SCHED_CASE_NUM; i++) {
+        if (sched_run(&sched_cases[i], &sched_result[i]) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* 记录数据线0各周期第一帧开始输出的时刻 */
+static void sched_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data)
+{
+    sched_result_t *result = sched_current;
+    uint32_t frame = word & 0xFFFFFU;
+
+    (void)i2s;
+    (void)user_data;
+    if ((result == NULL) || (line != 0U) || (slot != 0U) || (word == 0U)) {
+        return;
+    }
+    if (result->first_cycles == 0U) {
+        result->first_cycles = host_cycles();
+    }
+    result->end_out_frame = frame;
+    if ((frame % SCHED_PERIOD_FRAMES == 0U) && (frame / SCHED_PERIOD_FRAMES < SCHED_MAX_PERIOD)) {
+        result->out_cycles[frame / SCHED_PERIOD_FRAMES] = host_cycles();
+        result->out_num = frame / SCHED_PERIOD_FRAMES + 1U;
+    }
+}
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, sched_sink, NULL);
+}
+
+/* 实际输出时刻减时间戳再减一个时隙(ns) */
+static int32_t sched_error_ns(uint64_t out_cycles, uint64_t tick)
+{
+    int64_t cycles = (int64_t)(out_cycles - tick * SCHED_TICK_CYCLES) - (int64_t)SCHED_SLOT_CYCLES;
+
+    return (int32_t)(cycles * 1000000000LL / (int64_t)HOST_CPU_HZ);
+}
+
+static int check(FILE *fp)
+{
+    const sched_result_t *r;
+    int64_t expected_ppb;
+    int32_t start_ns;
+    int32_t err;
+    int32_t early_max;
+    int32_t fit_max;
+    uint32_t periods;
+    int fails = 0;
+
+    for (uint32_t c = 0; c < SCHED_CASE_NUM; c++) {
+        r = &sched_result[c];
+        periods = (r->pts_num < r->out_num) ? r->pts_num : r->out_num;
+        start_ns = sched_error_ns(r->first_cycles, r->start_tick);
+        early_max = 0;
+        fit_max = 0;
+        for (uint32_t p = 0; p < periods; p++) {
+            err = sched_error_ns(r->out_cycles[p], r->pts[p]);
+            err = (err < 0) ? -err : err;
+            if (p < SCHED_FIT_PERIODS) {
+                early_max = (err > early_max) ? err : early_max;
+            } else {
+                fit_max = (err > fit_max) ? err : fit_max;
+            }
+        }
+        expected_ppb = ((int64_t)SCHED_SAMPLE_RATE - (int64_t)sched_cases[c].nominal_rate) * 1000000000LL /
+                       (int64_t)sched_cases[c].nominal_rate;
+
+        fprintf(fp, "%s:\n", sched_cases[c].name);
+        fprintf(fp, "  start error %d ticks, first frame %d ns after start tick + 1 slot\n", r->start_error, start_ns);
+        fprintf(fp, "  %u periods, pts error max %d ns before the fit (%u periods), %d ns after\n", periods,
+                early_max, SCHED_FIT_PERIODS, fit_max);
+        fprintf(fp, "  drift %d ppb (expected %lld), tick_to_frame %u at end, frame %u on line 0\n", r->drift_ppb,
+                (long long)expected_ppb, r->end_frame, r->end_out_frame);
+        fprintf(fp, "  %u pts callbacks, %u measure failures, %u underruns, %u recoveries\n", r->period_count,
+                r->measure_fail_count, r->stats.underrun_count, r->stats.recovery_count);
+
+        /*
+         * 对应点在整周期中断中测量，比最近一次出队晚中断响应的时间，拟合的漂移因此略偏慢，
+         * 误差随运行时间增长而减小
+         */
+        if ((r->start_error < 0) || (r->start_error > 1) || (start_ns < 0) || (start_ns > SCHED_TOLERANCE_NS) ||
+            (periods < SCHED_MAX_PERIOD / 2U) || (fit_max > SCHED_TOLERANCE_NS) ||
+            ((sched_cases[c].nominal_rate == SCHED_SAMPLE_RATE) && (early_max > SCHED_TOLERANCE_NS)) ||
+            (r->drift_ppb - expected_ppb > SCHED_TOLERANCE_PPB) || (expected_ppb - r->drift_ppb > SCHED_TOLERANCE_PPB) ||
+            (r->end_frame - r->end_out_frame > 1U) || (r->measure_fail_count != 0U) ||
+            (r->stats.underrun_count != 0U)) {
+            fprintf(fp, "  FAIL\n");
+            fails++;
+        } else {
+            fprintf(fp, "  PASS\n");
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_sched",
+        .entry = sched_main,
+        .timeout_ms = 1000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 采样率转换的THD+N：1秒-1dBFS正弦，44.1k/32k/16k转换到48k，各质量档位在1kHz和0.4倍输入采样率处
+ * 须不高于README中给出的范围。对输出做正弦最小二乘拟合，残差与拟合正弦的能量比即THD+N。
+ * 同时检查：8个声道(初相不同)都满足指标，输出帧数与采样率之比一致，
+ * 分块调用(输入37帧、输出53帧)与一次调用的结果逐位相同，相同采样率时为直通。
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "hpm_common.h"
+#include "i2s_multiline_src.h"
+
+#define TEST_OUT_RATE       (48000U)
+#define TEST_CHANNEL_NUM    (8U)
+#define TEST_MAX_FRAMES     (TEST_OUT_RATE + 1024U)
+#define TEST_EDGE_FRAMES    (200U)      /* 起止处滤波器未填满的输出不参与统计 */
+#define TEST_AMPLITUDE      (0.89)      /* -1dBFS */
+
+static int32_t in_buf[TEST_CHANNEL_NUM][TEST_MAX_FRAMES];
+static int32_t out_buf[TEST_CHANNEL_NUM][TEST_MAX_FRAMES];
+static int32_t ref_buf[TEST_CHANNEL_NUM][TEST_MAX_FRAMES];
+
+/* 拟合 a*sin + b*cos + c，返回残差与正弦能量比(dB) */
+static double thd_n_db(const int32_t *y, uint32_t n, double freq, double rate)
+{
+    double s[3][4] = {{0}};
+    double x[3];
+    double err = 0;
+    double sig = 0;
+    double v[3];
+    double m;
+
+    for (uint32_t i = 0; i < n; i++) {
+        double t = 2.0 * M_PI * freq * i / rate;
+        v[0] = sin(t);
+        v[1] = cos(t);
+        v[2] = 1.0;
+        for (uint8_t a = 0; a < 3U; a++) {
+            s[a][3] += v[a] * y[i];
+            for (uint8_t b = 0; b < 3U; b++) {
+                s[a][b] += v[a] * v[b];
+            }
+        }
+    }
+    for (uint8_t a = 0; a < 3U; a++) {
+        for (uint8_t r = 0; r < 3U; r++) {
+            if (r != a) {
+                double k = s[r][a] / s[a][a];
+                for (uint8_t c = 0; c < 4U; c++) {
+                    s[r][c] -= k * s[a][c];
+                }
+            }
+        }
+    }
+    for (uint8_t a = 0; a < 3U; a++) {
+        x[a] = s[a][3] / s[a][a];
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        double t = 2.0 * M_PI * freq * i / rate;
+        m = x[0] * sin(t) + x[1] * cos(t) + x[2];
+        err += (y[i] - m) * (y[i] - m);
+        sig += m * m;
+    }
+    return 10.0 * log10(err / sig);
+}
+
+/* 分块转换全部输入，返回输出帧数 */
+static uint32_t convert(i2s_multiline_src_t *src, uint32_t in_frames, int32_t (*out)[TEST_MAX_FRAMES],
+                        uint32_t in_chunk, uint32_t out_chunk)
+{
+    const int32_t *in[TEST_CHANNEL_NUM];
+    int32_t *o[TEST_CHANNEL_NUM];
+    uint32_t in_pos = 0;
+    uint32_t out_pos = 0;
+    uint32_t n;
+    uint32_t produced;
+
+    /* 输入全部交出后继续调用，直到历史缓冲区中不能再产生输出 */
+    for (;;) {
+        n = in_frames - in_pos;
+        if (n > in_chunk) {
+            n = in_chunk;
+        }
+        for (uint8_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+            in[ch] = &in_buf[ch][in_pos];
+            o[ch] = &out[ch][out_pos];
+        }
+        produced = i2s_multiline_src_process(src, in, &n, o,
+                                             (TEST_MAX_FRAMES - out_pos < out_chunk) ? TEST_MAX_FRAMES - out_pos
+                                                                                     : out_chunk);
+        in_pos += n;
+        out_pos += produced;
+        if ((n == 0U) && (produced == 0U)) {
+            break;
+        }
+    }
+    return out_pos;
+}
+
+int main(void)
+{
+    static const uint32_t rates[] = {44100, 32000, 16000};
+    static const char *const quality_name[] = {"low", "medium", "high"};
+    /* README中的上限，[质量][0: 1kHz, 1: 0.4倍输入采样率] */
+    static const double limit_db[3][2] = {{-61.0, -64.0}, {-105.0, -88.0}, {-123.0, -93.0}};
+    i2s_multiline_src_t src;
+    i2s_multiline_src_config_t config;
+    uint32_t frames;
+    uint32_t ref_frames;
+    uint32_t expect;
+    double freq;
+    double worst;
+    double d;
+    int fails = 0;
+
+    for (uint8_t q = 0; q < 3U; q++) {
+        for (uint8_t r = 0; r < ARRAY_SIZE(rates); r++) {
+            for (uint8_t k = 0; k < 2U; k++) {
+                freq = (k == 0U) ? 1000.0 : 0.4 * rates[r];
+                for (uint32_t i = 0; i < rates[r]; i++) {
+                    for (uint8_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+                        in_buf[ch][i] = (int32_t)(TEST_AMPLITUDE * INT32_MAX *
+                                                  sin(2.0 * M_PI * freq * i / rates[r] + ch));
+                    }
+                }
+                config.in_rate = rates[r];
+                config.out_rate = TEST_OUT_RATE;
+                config.channel_num = TEST_CHANNEL_NUM;
+                config.quality = (i2s_multiline_src_quality_t)q;
+                if (status_success != i2s_multiline_src_init(&src, &config)) {
+                    printf("init failed\n");
+                    return 1;
+                }
+                frames = convert(&src, rates[r], out_buf, 37, 53);
+                i2s_multiline_src_reset(&src);
+                ref_frames = convert(&src, rates[r], ref_buf, UINT32_MAX, UINT32_MAX);
+
+                worst = -1000.0;
+                for (uint8_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+                    d = thd_n_db(&out_buf[ch][TEST_EDGE_FRAMES], frames - 2U * TEST_EDGE_FRAMES, freq,
+                                 TEST_OUT_RATE);
+                    worst = (d > worst) ? d : worst;
+                }
+                /* 输出帧数为输入帧数按比例换算，减去滤波器延迟 */
+                expect = TEST_OUT_RATE -
+                         (uint32_t)((uint64_t)i2s_multiline_src_get_delay(&src) * 2U * TEST_OUT_RATE / rates[r]);
+                printf("%-6s %5lu -> %lu Hz, %7.0f Hz: %lu frames, THD+N %6.1f dB (limit %6.1f)\n",
+                       quality_name[q], (unsigned long)rates[r], (unsigned long)TEST_OUT_RATE, freq,
+                       (unsigned long)frames, worst, limit_db[q][k]);
+                if (worst > limit_db[q][k]) {
+                    printf("  FAIL: THD+N above limit\n");
+                    fails++;
+                }
+                if ((frames > TEST_OUT_RATE) || (frames + I2S_MULTILINE_SRC_MAX_TAPS * 2U < expect)) {
+                    printf("  FAIL: %lu output frames, expected about %lu\n", (unsigned long)frames,
+                           (unsigned long)expect);
+                    fails++;
+                }
+                if ((frames != ref_frames) || (memcmp(out_buf, ref_buf, sizeof(out_buf)) != 0)) {
+                    printf("  FAIL: chunked output differs from a single call\n");
+                    fails++;
+                }
+                memset(out_buf, 0, sizeof(out_buf));
+                memset(ref_buf, 0, sizeof(ref_buf));
+            }
+        }
+    }
+
+    /* 直通：输入输出采样率相同 */
+    config.in_rate = TEST_OUT_RATE;
+    config.out_rate = TEST_OUT_RATE;
+    config.channel_num = TEST_CHANNEL_NUM;
+    config.quality = i2s_multiline_src_quality_high;
+    if ((status_success != i2s_multiline_src_init(&src, &config)) ||
+        (convert(&src, TEST_OUT_RATE, out_buf, 37, 53) != TEST_OUT_RATE)) {
+        printf("FAIL: bypass frame count\n");
+        fails++;
+    }
+    for (uint8_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        if (memcmp(out_buf[ch], in_buf[ch], TEST_OUT_RATE * sizeof(int32_t)) != 0) {
+            printf("FAIL: bypass channel %u differs\n", ch);
+            fails++;
+        }
+    }
+
+    /* 降采样不支持 */
+    config.in_rate = 96000;
+    if (status_success == i2s_multiline_src_init(&src, &config)) {
+        printf("FAIL: downsampling accepted\n");
+        fails++;
+    }
+
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
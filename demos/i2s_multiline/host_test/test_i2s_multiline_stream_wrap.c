@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 流的位置计数回绕：环的帧数不是2的幂(4个周期 x 48帧)，读写位置从2^32之前0.2秒开始，
+ * slot_base在0.1秒时前移，运行中途制造一次欠载，分别以静音和重复最后一帧填充。
+ * 回绕前后数据线和声道的对应关系及源数据的连续性不变
+ */
+
+#include "host_line_check.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_interrupt.h"
+#include "i2s_multiline_cfg.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_stream.h"
+
+#define WRAP_SAMPLE_RATE      (48000U)
+#define WRAP_LINE_NUM         (4U)
+#define WRAP_CHANNEL_PER_LINE (2U)
+#define WRAP_CHANNEL_NUM      (WRAP_LINE_NUM * WRAP_CHANNEL_PER_LINE)
+#define WRAP_PERIOD_NUM       (4U)
+#define WRAP_PERIOD_FRAMES    (48U)
+#define WRAP_RING_FRAMES      (WRAP_PERIOD_NUM * WRAP_PERIOD_FRAMES)
+#define WRAP_PLANAR_FRAMES    (256U)
+
+/* 0.2秒后位置计数回绕，0.1秒后读位置领先slot_base达到2^31帧 */
+#define WRAP_START_POS        (0U - WRAP_SAMPLE_RATE / 5U)
+#define WRAP_BASE_AHEAD       ((0x80000000UL - WRAP_SAMPLE_RATE / 10U) / WRAP_RING_FRAMES * WRAP_RING_FRAMES)
+
+/* 每次运行0.5秒，写入0.35秒的数据后生产者暂停10毫秒 */
+#define WRAP_RUN_FRAMES       (WRAP_SAMPLE_RATE / 2U)
+#define WRAP_PAUSE_FRAMES     (WRAP_SAMPLE_RATE * 7U / 20U)
+#define WRAP_PAUSE_CYCLES     (HOST_CPU_HZ / 100U)
+
+I2S_MULTILINE_CFG_DEFINE(wrap_cfg, WRAP_LINE_NUM, 32, WRAP_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         WRAP_SAMPLE_RATE)
+
+typedef struct {
+    i2s_multiline_stream_stats_t stats;
+    uint32_t read_pos;
+    uint32_t slot_base;
+} wrap_result_t;
+
+static i2s_multiline_stream_t wrap_stream;
+static uint32_t wrap_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(WRAP_PERIOD_NUM, WRAP_PERIOD_FRAMES, WRAP_LINE_NUM,
+                                                                WRAP_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+static int32_t planar[WRAP_CHANNEL_NUM][WRAP_PLANAR_FRAMES];
+static wrap_result_t wrap_result[2];
+static uint8_t wrap_dma_channel;
+
+SDK_DECLARE_EXT_ISR_M(IRQn_XDMA, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_dma_mgr_irq_handler(HPM_XDMA);
+}
+
+static hpm_stat_t wrap_run(bool repeat_last_frame, wrap_result_t *result)
+{
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_pack_config_t pack_config = {0};
+    i2s_multiline_pack_t pack;
+    const void *src[WRAP_CHANNEL_NUM];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t written = 0;
+    uint32_t src_frame = 0;
+    uint64_t until;
+    uint32_t n;
+    hpm_stat_t stat;
+
+    pack_config.format = i2s_multiline_pack_s32;
+    pack_config.line_num = WRAP_LINE_NUM;
+    pack_config.channel_per_line = WRAP_CHANNEL_PER_LINE;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < WRAP_CHANNEL_NUM; ch++) {
+        src[ch] = planar[ch];
+    }
+
+    config.i2s = HPM_I2S0;
+    config.dma = HPM_XDMA;
+    config.dmamux = HPM_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = WRAP_LINE_NUM;
+    config.dma_channel[0] = wrap_dma_channel;
+    config.dma_req[0] = HPM_DMA_SRC_I2S0_TX;
+    config.channel_per_line = WRAP_CHANNEL_PER_LINE;
+    config.audio_depth = 32;
+    config.period_num = WRAP_PERIOD_NUM;
+    config.period_frames = WRAP_PERIOD_FRAMES;
+    config.buffer[0] = wrap_buffer;
+    config.repeat_last_frame = repeat_last_frame;
+    stat = i2s_multiline_stream_init(&wrap_stream, &config);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    /* 模拟长时间运行后的状态：各位置接近2^32，slot_base落后读位置整数个环 */
+    wrap_stream.write_pos = WRAP_START_POS;
+    wrap_stream.data_pos = WRAP_START_POS;
+    wrap_stream.pending_pos = WRAP_START_POS;
+    wrap_stream.read_pos = WRAP_START_POS;
+    wrap_stream.slot_base = WRAP_START_POS - WRAP_BASE_AHEAD;
+
+    while (written < WRAP_RUN_FRAMES) {
+        i2s_multiline_stream_task(&wrap_stream);
+        if (written == WRAP_PAUSE_FRAMES) {
+            until = host_cycles() + WRAP_PAUSE_CYCLES;
+            while (host_cycles() < until) {
+                host_cpu_idle();
+            }
+        }
+        n = i2s_multiline_stream_get_write_ptr(&wrap_stream, ring_ptr);
+        if (n > WRAP_PLANAR_FRAMES - src_frame) {
+            n = WRAP_PLANAR_FRAMES - src_frame;
+        }
+        if ((written < WRAP_PAUSE_FRAMES) && (n > WRAP_PAUSE_FRAMES - written)) {
+            n = WRAP_PAUSE_FRAMES - written;
+        }
+        if (n > 0U) {
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], src, src_frame, n);
+            i2s_multiline_stream_commit(&wrap_stream, n);
+            src_frame = (src_frame + n) % WRAP_PLANAR_FRAMES;
+            written += n;
+        } else {
+            host_cpu_idle();
+        }
+        if ((!wrap_stream.running) && (i2s_multiline_stream_get_free_frames(&wrap_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&wrap_stream);
+            if (stat != status_success) {
+                return stat;
+            }
+        }
+    }
+
+    i2s_multiline_stream_drain(&wrap_stream);
+    while (i2s_multiline_stream_get_queued_frames(&wrap_stream) > 0U) {
+        i2s_multiline_stream_task(&wrap_stream);
+        host_cpu_idle();
+    }
+    i2s_multiline_stream_stop(&wrap_stream);
+
+    i2s_multiline_stream_get_stats(&wrap_stream, &result->stats);
+    result->read_pos = wrap_stream.read_pos;
+    result->slot_base = wrap_stream.slot_base;
+    return status_success;
+}
+
+static int wrap_main(void)
+{
+    hpm_stat_t stat;
+
+    for (uint32_t ch = 0; ch < WRAP_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < WRAP_PLANAR_FRAMES; i++) {
+            planar[ch][i] = (int32_t)(((ch + 1U) << 28) | (i << 16));
+        }
+    }
+
+    board_config_i2s_clock(HPM_I2S0, WRAP_SAMPLE_RATE);
+    wrap_cfg_config_i2s(HPM_I2S0, clock_get_frequency(clock_i2s0), wrap_cfg_fifo_threshold);
+
+    stat = i2s_multiline_dma_mgr_add_controller(HPM_XDMA, HPM_DMAMUX, 0x000000FFUL);
+    if (stat == status_success) {
+        stat = i2s_multiline_dma_mgr_request(HPM_XDMA, HPM_DMA_SRC_I2S0_TX, &wrap_dma_channel);
+    }
+    if (stat == status_success) {
+        stat = i2s_multiline_dma_mgr_set_callback(HPM_XDMA, wrap_dma_channel, i2s_multiline_stream_dma_callback,
+                                                  &wrap_stream);
+    }
+    if (stat != status_success) {
+        return 1;
+    }
+    intc_m_enable_irq_with_priority(IRQn_XDMA, 1);
+
+    for (uint8_t i = 0; i < 2U; i++) {
+        if (wrap_run(i != 0U, &wrap_result[i]) != status_success) {
+            return 1;
+        }
+    }
+    i2s_multiline_dma_mgr_release(HPM_XDMA, wrap_dma_channel);
+    return 0;
+}
+
+static bool planar_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == (uint32_t)line * 2U + slot + 1U) && ((word & 0x0F00FFFFUL) == 0U);
+}
+
+static bool planar_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 16) + 1U) & 0xFFU) == ((word >> 16) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = planar_valid,
+    .follows = planar_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static int check(FILE *fp)
+{
+    static const char *const fill_name[] = {"silence", "repeat last frame"};
+    const wrap_result_t *r;
+
+    for (uint8_t i = 0; i < 2U; i++) {
+        r = &wrap_result[i];
+        fprintf(fp, "run %s: read_pos %08x, slot_base %08x, %u underruns (%u frames filled), %u recoveries\n",
+                fill_name[i], r->read_pos, r->slot_base, r->stats.underrun_count, r->stats.silence_frames,
+                r->stats.recovery_count);
+    }
+    return host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_stream_wrap",
+        .entry = wrap_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
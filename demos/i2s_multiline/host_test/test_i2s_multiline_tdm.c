@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * TDM时隙布局：4条数据线，16位音频，burst引擎，按i2s_multiline_tdm计算的布局配置I2S和流后各播放50ms。
+ * 覆盖2/4/8/16个时隙、全部使能和各数据线位置不同的稀疏掩码(burst引擎的FIFO深度在各数据线间相差2或4个采样)、
+ * 主时钟不足时退回16位时隙、较高速率下的阈值。
+ * 每个使能的时隙须依次输出声道 line * channel_per_line + (该时隙在掩码中的序号) 的连续数据，
+ * 被屏蔽的时隙不输出，无欠载和FIFO下溢。另检查无效配置被拒绝。
+ */
+
+#include "board.h"
+#include "hpm_interrupt.h"
+#include "host_model.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_tdm.h"
+
+#define TDM_LINE_NUM          (4U)
+#define TDM_MAX_CHANNEL       (TDM_LINE_NUM * I2S_MULTILINE_TDM_MAX_SLOT)
+#define TDM_AUDIO_DEPTH       (16U)
+#define TDM_PERIOD_NUM        (4U)
+#define TDM_RING_BYTES        (32U * 1024U)
+#define TDM_PLANAR_FRAMES     (64U)
+#define TDM_RUN_MS            (50U)
+#define TDM_DMA_CHANNEL       (0U)
+
+typedef struct {
+    const char *name;
+    uint32_t sample_rate;
+    uint32_t mclk_fs;               /* 主时钟 = mclk_fs * 采样率 */
+    uint8_t slot_num;
+    uint32_t tx_slot_mask[TDM_LINE_NUM];
+} tdm_case_t;
+
+typedef struct {
+    hpm_stat_t stat;
+    i2s_multiline_tdm_layout_t layout;
+    uint32_t period_frames;
+    i2s_multiline_stream_stats_t stats;
+    uint32_t seen_mask[TDM_LINE_NUM];   /* 输出过字的时隙 */
+    uint64_t words;
+    uint64_t silent;
+    uint64_t invalid;
+    uint64_t breaks;
+} tdm_result_t;
+
+static const tdm_case_t tdm_case[] = {
+    {"tdm2 all", 48000, 512, 2, {0}},
+    {"tdm4 all", 48000, 512, 4, {0}},
+    {"tdm8 0xa5", 48000, 512, 8, {0xA5, 0xA5, 0xA5, 0xA5}},
+    {"tdm16 all", 48000, 512, 16, {0}},
+    {"tdm16 skewed 16-bit", 48000, 256, 16, {0x3C3C, 0x0F0F, 0xF0F0, 0x5A5A}},
+    {"tdm16 skewed by 4", 48000, 512, 16, {0x0F0F, 0xF0F0, 0x0F0F, 0xF0F0}},
+    {"tdm16 all 96k", 96000, 512, 16, {0}},
+};
+
+static int16_t planar[TDM_MAX_CHANNEL][TDM_PLANAR_FRAMES];
+static uint32_t tdm_buffer[TDM_RING_BYTES / sizeof(uint32_t)];
+static i2s_multiline_stream_t tdm_stream;
+static tdm_result_t tdm_result[ARRAY_SIZE(tdm_case)];
+static const tdm_case_t *tdm_cur_case;
+static tdm_result_t *tdm_cur;
+static uint32_t tdm_prev[TDM_LINE_NUM][I2S_MULTILINE_TDM_MAX_SLOT];
+
+SDK_DECLARE_EXT_ISR_M(IRQn_XDMA, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&tdm_stream);
+}
+
+static uint32_t tdm_case_mask(const tdm_case_t *tc, uint8_t line)
+{
+    uint32_t all = (1UL << tc->slot_num) - 1U;
+
+    return (tc->tx_slot_mask[line] == 0U) ? all : (tc->tx_slot_mask[line] & all);
+}
+
+/* 时隙slot在数据线line的掩码中的序号，即该数据线上的声道序号 */
+static uint32_t tdm_slot_rank(const tdm_case_t *tc, uint8_t line, uint8_t slot)
+{
+    uint32_t below = tdm_case_mask(tc, line) & ((1UL << slot) - 1U);
+    uint32_t rank = 0;
+
+    while (below != 0U) {
+        below &= below - 1U;
+        rank++;
+    }
+    return rank;
+}
+
+/* 平面数据：采样的高8位为声道号+1，低8位为帧序号；打包后左对齐到32位 */
+static void tdm_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data)
+{
+    uint32_t ch;
+
+    (void)i2s;
+    (void)user_data;
+    if (tdm_cur == NULL) {
+        return;
+    }
+    tdm_cur->seen_mask[line] |= 1UL << slot;
+    tdm_cur->words++;
+    if (word == 0U) {
+        tdm_cur->silent++;
+        return;
+    }
+    ch = line * tdm_cur->layout.tx_channel_per_line + tdm_slot_rank(tdm_cur_case, line, slot);
+    if (((word >> 24) != ch + 1U) || ((word & 0xFFFFU) != 0U)) {
+        tdm_cur->invalid++;
+    } else if ((tdm_prev[line][slot] != 0U) &&
+               ((((tdm_prev[line][slot] >> 16) + 1U) % TDM_PLANAR_FRAMES) != ((word >> 16) & 0xFFU))) {
+        tdm_cur->breaks++;
+    }
+    tdm_prev[line][slot] = word;
+}
+
+static hpm_stat_t tdm_run(const tdm_case_t *tc, tdm_result_t *res)
+{
+    i2s_multiline_tdm_config_t tdm_config = {0};
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_pack_config_t pack_config = {0};
+    i2s_multiline_pack_t pack;
+    const void *src[TDM_MAX_CHANNEL];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t total_frames = tc->sample_rate / 1000U * TDM_RUN_MS;
+    uint32_t written = 0;
+    uint32_t src_frame = 0;
+    uint32_t n;
+    hpm_stat_t stat;
+
+    board_config_i2s_clock(HPM_I2S0, tc->sample_rate);
+    tdm_config.mclk_hz = tc->sample_rate * tc->mclk_fs;
+    tdm_config.sample_rate = tc->sample_rate;
+    tdm_config.line_num = TDM_LINE_NUM;
+    tdm_config.slot_num = tc->slot_num;
+    tdm_config.audio_depth = TDM_AUDIO_DEPTH;
+    tdm_config.master_mode = true;
+    tdm_config.tx_enable = true;
+    for (uint8_t line = 0; line < TDM_LINE_NUM; line++) {
+        tdm_config.tx_slot_mask[line] = tc->tx_slot_mask[line];
+    }
+    stat = i2s_multiline_tdm_get_layout(&tdm_config, &res->layout);
+    if (stat == status_success) {
+        stat = i2s_multiline_tdm_init(HPM_I2S0, &tdm_config, &res->layout);
+    }
+    if (stat != status_success) {
+        return stat;
+    }
+
+    pack_config.format = i2s_multiline_pack_s16;
+    pack_config.line_num = TDM_LINE_NUM;
+    pack_config.channel_per_line = res->layout.tx_channel_per_line;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < TDM_LINE_NUM * (uint32_t)res->layout.tx_channel_per_line; ch++) {
+        src[ch] = planar[ch];
+    }
+
+    res->period_frames = i2s_multiline_tdm_period_frames(TDM_LINE_NUM, res->layout.tx_channel_per_line,
+                                                         sizeof(tdm_buffer), TDM_PERIOD_NUM);
+    config.i2s = HPM_I2S0;
+    config.dma = HPM_XDMA;
+    config.dmamux = HPM_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TDM_LINE_NUM;
+    config.dma_channel[0] = TDM_DMA_CHANNEL;
+    config.dma_req[0] = HPM_DMA_SRC_I2S0_TX;
+    config.channel_per_line = res->layout.tx_channel_per_line;
+    config.audio_depth = TDM_AUDIO_DEPTH;
+    config.period_num = TDM_PERIOD_NUM;
+    config.period_frames = res->period_frames;
+    config.buffer[0] = tdm_buffer;
+    stat = i2s_multiline_stream_init(&tdm_stream, &config);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    memset(tdm_prev, 0, sizeof(tdm_prev));
+    tdm_cur_case = tc;
+    tdm_cur = res;
+    while (written < total_frames) {
+        i2s_multiline_stream_task(&tdm_stream);
+        n = i2s_multiline_stream_get_write_ptr(&tdm_stream, ring_ptr);
+        if (n > TDM_PLANAR_FRAMES - src_frame) {
+            n = TDM_PLANAR_FRAMES - src_frame;
+        }
+        if (n > 0U) {
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], src, src_frame, n);
+            i2s_multiline_stream_commit(&tdm_stream, n);
+            src_frame = (src_frame + n) % TDM_PLANAR_FRAMES;
+            written += n;
+        }
+        if ((!tdm_stream.running) &&
+            ((i2s_multiline_stream_get_free_frames(&tdm_stream) == 0U) || (written >= total_frames))) {
+            stat = i2s_multiline_stream_start(&tdm_stream);
+            if (stat != status_success) {
+                return stat;
+            }
+        } else if (n == 0U) {
+            host_cpu_idle();
+        }
+    }
+    i2s_multiline_stream_drain(&tdm_stream);
+    while (i2s_multiline_stream_get_queued_frames(&tdm_stream) > 0U) {
+        i2s_multiline_stream_task(&tdm_stream);
+        host_cpu_idle();
+    }
+    i2s_multiline_stream_stop(&tdm_stream);
+    tdm_cur = NULL;
+    i2s_multiline_stream_get_stats(&tdm_stream, &res->stats);
+    return status_success;
+}
+
+static int tdm_main(void)
+{
+    for (uint32_t ch = 0; ch < TDM_MAX_CHANNEL; ch++) {
+        for (uint32_t i = 0; i < TDM_PLANAR_FRAMES; i++) {
+            planar[ch][i] = (int16_t)(((ch + 1U) << 8) | i);
+        }
+    }
+    intc_m_enable_irq_with_priority(IRQn_XDMA, 1);
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(tdm_case); i++) {
+        tdm_result[i].stat = tdm_run(&tdm_case[i], &tdm_result[i]);
+    }
+    return 0;
+}
+
+/* 无效配置：各数据线使能的时隙数不同或位置相差过大、BCLK无法由主时钟分频、时隙数不是2的幂 */
+static int tdm_check_invalid(FILE *fp)
+{
+    i2s_multiline_tdm_config_t config = {0};
+    i2s_multiline_tdm_layout_t layout;
+    int fails = 0;
+
+    config.mclk_hz = 48000U * 512U;
+    config.sample_rate = 48000;
+    config.line_num = TDM_LINE_NUM;
+    config.slot_num = 8;
+    config.audio_depth = 16;
+    config.tx_enable = true;
+    config.tx_slot_mask[0] = 0x0F;
+    config.tx_slot_mask[1] = 0x07;
+    if (i2s_multiline_tdm_get_layout(&config, &layout) != status_invalid_argument) {
+        fprintf(fp, "FAIL: unequal slot counts accepted\n");
+        fails++;
+    }
+    /* 第1条数据线在第0条移出8个采样后才开始移出，FIFO无法同时容纳 */
+    config.tx_slot_mask[0] = 0x0F;
+    config.tx_slot_mask[1] = 0xF0;
+    if (i2s_multiline_tdm_get_layout(&config, &layout) != status_invalid_argument) {
+        fprintf(fp, "FAIL: slot skew beyond the FIFO accepted\n");
+        fails++;
+    }
+    config.tx_slot_mask[1] = 0;
+    config.tx_slot_mask[0] = 0;
+    config.mclk_hz = 48000U * 500U;
+    if (i2s_multiline_tdm_get_layout(&config, &layout) != status_invalid_argument) {
+        fprintf(fp, "FAIL: unreachable bclk accepted\n");
+        fails++;
+    }
+    config.mclk_hz = 48000U * 512U;
+    config.slot_num = 6;
+    if (i2s_multiline_tdm_get_layout(&config, &layout) != status_invalid_argument) {
+        fprintf(fp, "FAIL: 6 slots accepted\n");
+        fails++;
+    }
+    /* 16位时隙只用于16位音频 */
+    config.slot_num = 16;
+    config.mclk_hz = 48000U * 256U;
+    config.audio_depth = 24;
+    if (i2s_multiline_tdm_get_layout(&config, &layout) != status_invalid_argument) {
+        fprintf(fp, "FAIL: 24-bit audio in 16-bit slots accepted\n");
+        fails++;
+    }
+    return fails;
+}
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, tdm_sink, NULL);
+}
+
+static int check(FILE *fp)
+{
+    const tdm_case_t *tc;
+    const tdm_result_t *r;
+    bool mask_ok;
+    int fails = 0;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(tdm_case); i++) {
+        tc = &tdm_case[i];
+        r = &tdm_result[i];
+        mask_ok = true;
+        for (uint8_t line = 0; line < TDM_LINE_NUM; line++) {
+            mask_ok = mask_ok && (r->seen_mask[line] == tdm_case_mask(tc, line));
+        }
+        fprintf(fp, "%s: %u-bit slots, %u ch/line, bclk %u Hz, fifo threshold %u (%u ns), %u frames/period\n",
+                tc->name, (r->layout.channel_length == i2s_channel_length_32_bits) ? 32U : 16U,
+                r->layout.tx_channel_per_line, r->layout.bclk_hz, r->layout.tx_fifo_threshold,
+                r->layout.tx_headroom_ns, r->period_frames);
+        fprintf(fp, "  %llu words, %llu silent, %llu invalid, %llu discontinuities, slot masks %s, "
+                "%u underruns, %u fifo underflows\n", (unsigned long long)r->words, (unsigned long long)r->silent,
+                (unsigned long long)r->invalid, (unsigned long long)r->breaks, mask_ok ? "match" : "DIFFER",
+                r->stats.underrun_count, r->stats.fifo_underflow_count);
+        if (r->stat != status_success) {
+            fprintf(fp, "  FAIL: status %d\n", r->stat);
+            fails++;
+        } else if ((r->invalid != 0U) || (r->breaks != 0U) || !mask_ok || (r->stats.underrun_count != 0U) ||
+                   (r->stats.fifo_underflow_count != 0U)) {
+            fprintf(fp, "  FAIL\n");
+            fails++;
+        }
+    }
+    return fails + tdm_check_invalid(fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_tdm",
+        .entry = tdm_main,
+        .timeout_ms = 1000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
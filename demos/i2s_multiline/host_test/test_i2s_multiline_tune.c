@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 自动整定的FIFO阈值退让：中断引擎，48kHz，4条数据线，每条2个时隙。
+ * 应用大约每1ms在随机时刻关中断50us，超过默认响应延迟(2us)对应的阈值余量，FIFO下溢。
+ * 每20ms把累计下溢次数交给i2s_multiline_tune_update，工作点改变时按新的阈值重新启动引擎。
+ * 阈值须逐步升高到余量覆盖关中断时间，之后不再下溢、不再退让。引擎重新启动和下溢时的静音写入报告
+ */
+
+#include "host_line_check.h"
+#include "hpm_interrupt.h"
+#include "i2s_multiline_cfg.h"
+#include "i2s_multiline_irq.h"
+#include "i2s_multiline_tune.h"
+
+#define TUNE_SAMPLE_RATE      (48000U)
+#define TUNE_LINE_NUM         (4U)
+#define TUNE_CHANNEL_PER_LINE (2U)
+#define TUNE_FRAMES           (256U)
+#define TUNE_BLOCK_US         (50U)     /* 每次关中断的时间 */
+#define TUNE_BLOCK_PERIOD_US  (1000U)
+#define TUNE_BLOCK_JITTER_US  (100U)    /* 关中断时刻的随机偏移，与FIFO的填充相位无关 */
+#define TUNE_CHECK_MS         (20U)     /* 自动整定检查下溢的间隔 */
+#define TUNE_RUN_MS           (400U)
+#define TUNE_QUIET_MS         (200U)    /* 运行结束前须无退让的时间 */
+#define TUNE_MAX_POINT        (8U)
+
+#define TUNE_US_CYCLES(us)    ((uint64_t)(us) * (HOST_CPU_HZ / 1000000U))
+
+I2S_MULTILINE_CFG_DEFINE(tune_cfg, TUNE_LINE_NUM, 32, TUNE_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_IRQ,
+                         TUNE_SAMPLE_RATE)
+
+typedef struct {
+    uint32_t at_ms;                 /* 工作点生效的时间 */
+    i2s_multiline_tune_point_t point;
+    uint32_t underflows;            /* 该工作点运行期间的下溢次数 */
+} tune_record_t;
+
+static uint32_t test_data[TUNE_LINE_NUM][TUNE_FRAMES * TUNE_CHANNEL_PER_LINE];
+static i2s_multiline_irq_t tune_engine;
+static i2s_multiline_tune_t tune;
+static tune_record_t tune_record[TUNE_MAX_POINT];
+static uint32_t tune_record_num;
+static uint32_t rand_state = 1;
+
+SDK_DECLARE_EXT_ISR_M(IRQn_I2S0, isr_i2s)
+void isr_i2s(void)
+{
+    i2s_multiline_irq_handler(&tune_engine);
+}
+
+static hpm_stat_t tune_start(const i2s_multiline_tune_point_t *point)
+{
+    i2s_multiline_irq_config_t config = {0};
+    hpm_stat_t stat;
+
+    stat = tune_cfg_config_i2s(HPM_I2S0, clock_get_frequency(clock_i2s0), point->fifo_threshold);
+    if (stat != status_success) {
+        return stat;
+    }
+    config.i2s = HPM_I2S0;
+    config.line_num = TUNE_LINE_NUM;
+    config.channel_per_line = TUNE_CHANNEL_PER_LINE;
+    config.audio_depth = 32;
+    config.fifo_threshold = point->fifo_threshold;
+    config.frames = TUNE_FRAMES;
+    config.loop_count = 0;
+    for (uint8_t line = 0; line < TUNE_LINE_NUM; line++) {
+        config.line_data[line] = test_data[line];
+    }
+    stat = i2s_multiline_irq_init(&tune_engine, &config);
+    if (stat != status_success) {
+        return stat;
+    }
+    i2s_multiline_irq_start(&tune_engine);
+    return status_success;
+}
+
+static void tune_add_record(uint64_t start)
+{
+    if (tune_record_num < TUNE_MAX_POINT) {
+        tune_record[tune_record_num].at_ms = (uint32_t)((host_cycles() - start) / (HOST_CPU_HZ / 1000U));
+        tune_record[tune_record_num].point = *i2s_multiline_tune_get_point(&tune);
+        tune_record_num++;
+    }
+}
+
+static int tune_main(void)
+{
+    i2s_multiline_tune_config_t tune_config = {0};
+    i2s_multiline_irq_stats_t stats;
+    uint32_t underflow_base = 0;
+    uint64_t start;
+    uint64_t check;
+    uint64_t block;
+    uint64_t now;
+    uint32_t level;
+
+    for (uint32_t line = 0; line < TUNE_LINE_NUM; line++) {
+        for (uint32_t i = 0; i < TUNE_FRAMES * TUNE_CHANNEL_PER_LINE; i++) {
+            test_data[line][i] = ((line + 1U) << 28) | ((i & 1U) << 24) | ((i / 2U) << 12);
+        }
+    }
+    board_config_i2s_clock(HPM_I2S0, TUNE_SAMPLE_RATE);
+
+    tune_config.engine = i2s_multiline_tune_irq;
+    tune_config.cpu_hz = clock_get_frequency(clock_cpu0);
+    tune_config.sample_rate = TUNE_SAMPLE_RATE;
+    tune_config.line_num = TUNE_LINE_NUM;
+    tune_config.channel_per_line = TUNE_CHANNEL_PER_LINE;
+    if (i2s_multiline_tune_init(&tune, &tune_config) != status_success) {
+        return 1;
+    }
+
+    intc_m_enable_irq_with_priority(IRQn_I2S0, 1);
+    if (tune_start(i2s_multiline_tune_get_point(&tune)) != status_success) {
+        return 1;
+    }
+    start = host_cycles();
+    check = start;
+    block = start;
+    tune_add_record(start);
+
+    do {
+        now = host_cycles();
+        /* 应用的临界区 */
+        if (now - block >= TUNE_US_CYCLES(TUNE_BLOCK_PERIOD_US)) {
+            block = now;
+            rand_state = rand_state * 1664525UL + 1013904223UL;
+            host_cpu_wait(TUNE_US_CYCLES(TUNE_BLOCK_JITTER_US) * (rand_state >> 16) / 65536U);
+            level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+            host_cpu_wait(TUNE_US_CYCLES(TUNE_BLOCK_US));
+            restore_global_irq(level);
+        }
+        if (now - check >= TUNE_US_CYCLES(TUNE_CHECK_MS * 1000U)) {
+            check = now;
+            i2s_multiline_irq_get_stats(&tune_engine, &stats);
+            if (i2s_multiline_tune_update(&tune, underflow_base + stats.underflow_count, 0)) {
+                i2s_multiline_irq_stop(&tune_engine);
+                i2s_multiline_irq_get_stats(&tune_engine, &stats);
+                underflow_base += stats.underflow_count;
+                if (tune_record_num > 0U) {
+                    tune_record[tune_record_num - 1U].underflows = stats.underflow_count;
+                }
+                tune_add_record(start);
+                if (tune_start(i2s_multiline_tune_get_point(&tune)) != status_success) {
+                    return 1;
+                }
+            }
+        }
+        host_cpu_idle();
+    } while (now - start < TUNE_US_CYCLES(TUNE_RUN_MS * 1000U));
+
+    i2s_multiline_irq_stop(&tune_engine);
+    i2s_multiline_irq_get_stats(&tune_engine, &stats);
+    tune_record[tune_record_num - 1U].underflows = stats.underflow_count;
+    return 0;
+}
+
+static bool tune_valid(uint8_t line, uint8_t slot, uint32_t word)
+{
+    return ((word >> 28) == line + 1U) && (((word >> 24) & 0xFU) == slot) && ((word & 0xFFFU) == 0U);
+}
+
+static bool tune_follows(uint32_t prev, uint32_t word)
+{
+    return (((prev >> 12) + 1U) & 0xFFU) == ((word >> 12) & 0xFFU);
+}
+
+static host_line_check_t line_check = {
+    .valid = tune_valid,
+    .follows = tune_follows,
+};
+
+static void setup(void)
+{
+    host_i2s_set_tx_sink(HPM_I2S0, host_line_check_sink, &line_check);
+}
+
+static int check(FILE *fp)
+{
+    const tune_record_t *last = &tune_record[tune_record_num - 1U];
+    int fails = 0;
+
+    for (uint32_t i = 0; i < tune_record_num; i++) {
+        fprintf(fp, "%3u ms: fifo threshold %u, batch %u, headroom %u ns, %u underflows\n", tune_record[i].at_ms,
+                tune_record[i].point.fifo_threshold, tune_record[i].point.batch, tune_record[i].point.headroom_ns,
+                tune_record[i].underflows);
+    }
+    fprintf(fp, "%u back-offs, latency estimate %u ns\n", tune.backoff_count, tune.latency_ns);
+
+    /* 须至少退让一次，最后的工作点覆盖关中断时间，且在结束前稳定运行 */
+    if ((tune.backoff_count == 0U) || (last->point.headroom_ns < TUNE_BLOCK_US * 1000U) || (last->underflows != 0U) ||
+        (last->at_ms > TUNE_RUN_MS - TUNE_QUIET_MS)) {
+        fprintf(fp, "FAIL: back-off did not settle\n");
+        fails++;
+    }
+    return fails + host_line_check_report(&line_check, fp);
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_multiline_tune",
+        .entry = tune_main,
+        .timeout_ms = 1000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 跨核周期环：生产者和消费者各一个线程。以可缓存方式访问的一端模拟不一致的写回cache：
+ * 它通过控制块和周期缓冲区的私有副本访问环，l1c_dc_writeback把整条line从副本复制到共享存储器，
+ * l1c_dc_invalidate把整条line从共享存储器复制到副本(丢弃副本中未回写的修改)。
+ * 缺少或错放的cache维护会表现为消费者读到旧数据、生产者覆盖未释放的槽或索引停滞。
+ * 覆盖生产者可缓存、消费者可缓存和两端都可缓存三种组合，每个周期的内容都经过校验，
+ * 同时检查参数校验、attach顺序和处理耗时的发布。
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include "i2s_multiline_xcore.h"
+
+#define TEST_SLOT_NUM       (4U)
+#define TEST_SLOT_BYTES     (256U)
+#define TEST_PERIODS        (200000U)
+#define TEST_LINE           (I2S_MULTILINE_XCORE_LINE_SIZE)
+
+/* 共享存储器 */
+static i2s_multiline_xcore_ring_t ring;
+static uint8_t buffer[TEST_SLOT_NUM * TEST_SLOT_BYTES] ATTR_ALIGN(TEST_LINE);
+
+/* 生产者和消费者核的cache中的副本 */
+typedef struct {
+    i2s_multiline_xcore_ring_t ring;
+    uint8_t buffer[TEST_SLOT_NUM * TEST_SLOT_BYTES] ATTR_ALIGN(TEST_LINE);
+} test_view_t;
+
+static test_view_t view[2] ATTR_ALIGN(TEST_LINE);
+
+static volatile uint32_t l1c_ops;
+static volatile uint32_t l1c_unaligned;
+static volatile uint32_t l1c_outside;
+
+typedef struct {
+    i2s_multiline_xcore_end_t end;
+    bool cached;
+    uint32_t errors;
+    uint32_t periods;
+} test_side_t;
+
+static test_side_t producer;
+static test_side_t consumer;
+
+/* 副本中的地址对应的共享存储器地址 */
+static uint8_t *shared_addr(uintptr_t addr)
+{
+    for (uint8_t v = 0; v < 2U; v++) {
+        uintptr_t base = (uintptr_t)&view[v];
+
+        if ((addr >= base) && (addr < base + sizeof(ring))) {
+            return (uint8_t *)&ring + (addr - base);
+        }
+        base = (uintptr_t)view[v].buffer;
+        if ((addr >= base) && (addr < base + sizeof(buffer))) {
+            return buffer + (addr - base);
+        }
+    }
+    return NULL;
+}
+
+static void test_l1c_copy(uint32_t address, uint32_t size, bool writeback)
+{
+    uint8_t *shared = shared_addr(address);
+
+    l1c_ops++;
+    if (((address % TEST_LINE) != 0U) || ((size % TEST_LINE) != 0U)) {
+        l1c_unaligned++;
+    }
+    if ((shared == NULL) || (shared_addr(address + size - 1U) != shared + size - 1U)) {
+        l1c_outside++;
+        return;
+    }
+    __sync_synchronize();
+    if (writeback) {
+        memcpy(shared, (void *)(uintptr_t)address, size);
+    } else {
+        memcpy((void *)(uintptr_t)address, shared, size);
+    }
+    __sync_synchronize();
+}
+
+void l1c_dc_writeback(uint32_t address, uint32_t size)
+{
+    test_l1c_copy(address, size, true);
+}
+
+void l1c_dc_invalidate(uint32_t address, uint32_t size)
+{
+    test_l1c_copy(address, size, false);
+}
+
+static uint32_t pattern(uint32_t period, uint32_t i)
+{
+    return period * 0x9E3779B1UL + i;
+}
+
+static hpm_stat_t attach(test_side_t *side, bool is_producer, uint8_t v)
+{
+    i2s_multiline_xcore_ring_t *r = side->cached ? &view[v].ring : &ring;
+    void *buf = side->cached ? view[v].buffer : NULL;
+
+    return is_producer ? i2s_multiline_xcore_attach_producer(&side->end, r, buf, side->cached)
+                       : i2s_multiline_xcore_attach_consumer(&side->end, r, buf, side->cached);
+}
+
+static void *producer_thread(void *arg)
+{
+    uint32_t *slot;
+
+    (void)arg;
+    while (producer.periods < TEST_PERIODS) {
+        slot = (uint32_t *)i2s_multiline_xcore_acquire(&producer.end);
+        if (slot == NULL) {
+            sched_yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < TEST_SLOT_BYTES / 4U; i++) {
+            slot[i] = pattern(producer.periods, i);
+        }
+        i2s_multiline_xcore_set_work_cycles(&producer.end, producer.periods + 1U);
+        i2s_multiline_xcore_publish(&producer.end);
+        producer.periods++;
+    }
+    return NULL;
+}
+
+static void *consumer_thread(void *arg)
+{
+    const uint32_t *slot;
+    uint32_t last;
+    uint32_t max;
+    uint32_t prev_max = 0;
+
+    (void)arg;
+    while (consumer.periods < TEST_PERIODS) {
+        slot = (const uint32_t *)i2s_multiline_xcore_peek(&consumer.end);
+        if (slot == NULL) {
+            sched_yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < TEST_SLOT_BYTES / 4U; i++) {
+            if (slot[i] != pattern(consumer.periods, i)) {
+                consumer.errors++;
+                break;
+            }
+        }
+        i2s_multiline_xcore_release(&consumer.end);
+        consumer.periods++;
+
+        /* 处理耗时随周期号增加，最大值不回退 */
+        if ((consumer.periods % 64U) == 0U) {
+            i2s_multiline_xcore_get_work_cycles(&consumer.end, &last, &max);
+            if ((last > max) || (max < prev_max)) {
+                consumer.errors++;
+            }
+            prev_max = max;
+        }
+    }
+    return NULL;
+}
+
+static int run_pair(bool producer_cached, bool consumer_cached)
+{
+    pthread_t threads[2];
+    uint32_t ops = l1c_ops;
+    uint32_t last;
+    uint32_t max;
+    int fails = 0;
+
+    memset(&ring, 0xEE, sizeof(ring));
+    memset(buffer, 0xEE, sizeof(buffer));
+    memset(view, 0xEE, sizeof(view));
+    memset(&producer, 0, sizeof(producer));
+    memset(&consumer, 0, sizeof(consumer));
+    producer.cached = producer_cached;
+    consumer.cached = consumer_cached;
+
+    /* 控制块未初始化时不能attach */
+    if (attach(&consumer, false, 1) != status_fail) {
+        fails++;
+    }
+    i2s_multiline_xcore_ring_init(&ring, (uint32_t)(uintptr_t)buffer, TEST_SLOT_NUM, TEST_SLOT_BYTES);
+    if ((attach(&consumer, false, 1) != status_success) ||
+        i2s_multiline_xcore_producer_attached(&consumer.end) ||
+        (attach(&producer, true, 0) != status_success) ||
+        !i2s_multiline_xcore_producer_attached(&consumer.end)) {
+        printf("  FAIL: attach\n");
+        fails++;
+    }
+
+    pthread_create(&threads[0], NULL, producer_thread, NULL);
+    pthread_create(&threads[1], NULL, consumer_thread, NULL);
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+
+    i2s_multiline_xcore_get_work_cycles(&consumer.end, &last, &max);
+    printf("producer %s, consumer %s: %lu periods, %lu corrupt, producer stalls %lu, consumer stalls %lu, "
+           "%lu cache operations\n", producer_cached ? "cached" : "noncached",
+           consumer_cached ? "cached" : "noncached", (unsigned long)consumer.periods,
+           (unsigned long)consumer.errors, (unsigned long)producer.end.stall_count,
+           (unsigned long)consumer.end.stall_count, (unsigned long)(l1c_ops - ops));
+    if ((consumer.errors != 0U) || (last != TEST_PERIODS) || (max != TEST_PERIODS) ||
+        (i2s_multiline_xcore_get_filled(&consumer.end) != 0U) ||
+        (i2s_multiline_xcore_get_filled(&producer.end) != 0U)) {
+        fails++;
+    }
+    return fails;
+}
+
+int main(void)
+{
+    i2s_multiline_xcore_ring_t r;
+    int fails = 0;
+
+    /* 参数校验 */
+    if ((i2s_multiline_xcore_ring_init(&r, (uint32_t)(uintptr_t)buffer, 1, TEST_SLOT_BYTES) == status_success) ||
+        (i2s_multiline_xcore_ring_init(&r, (uint32_t)(uintptr_t)buffer, I2S_MULTILINE_XCORE_MAX_SLOT + 1U,
+                                       TEST_SLOT_BYTES) == status_success) ||
+        (i2s_multiline_xcore_ring_init(&r, (uint32_t)(uintptr_t)buffer, 4, TEST_SLOT_BYTES + 4U) == status_success) ||
+        (i2s_multiline_xcore_ring_init(&r, (uint32_t)(uintptr_t)buffer + 4U, 4, TEST_SLOT_BYTES) == status_success)) {
+        printf("FAIL: invalid layout accepted\n");
+        fails++;
+    }
+
+    fails += run_pair(true, false);
+    fails += run_pair(false, true);
+    fails += run_pair(true, true);
+
+    printf("cache maintenance: %lu operations, %lu not line aligned, %lu outside the ring\n",
+           (unsigned long)l1c_ops, (unsigned long)l1c_unaligned, (unsigned long)l1c_outside);
+    if ((l1c_unaligned != 0U) || (l1c_outside != 0U)) {
+        fails++;
+    }
+    printf("%s\n", (fails == 0) ? "PASS" : "FAIL");
+    return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * i2s_nor_flash_stream：SPI NOR Flash到I2S 4数据线的流式播放，测试片段播放1遍。
+ * 示例以默认配置编译，不写Flash，片段由Flash模型预先写入。示例的锯齿波每个周期内容相同，
+ * 无法发现周期顺序错误，因此片段改为计数：数据线l的第n个字为((l + 1) << 28) | n。
+ * 读取按SPI速率阻塞CPU，期间I2S和DMA照常运行并响应中断。
+ * 每条数据线的输出须逐字连续(片段结束后从0重新计数)，零为启动和结束时的静音。
+ */
+
+#include "board.h"
+#include "host_model.h"
+#include "hpm_serial_nor.h"
+#include "hpm_serial_nor_host_port.h"
+
+int demo_main(void);
+
+/* 与示例相同的片段位置和长度 */
+#define TEST_FLASH_SIZE         (4U * 1024U * 1024U)
+#define TEST_CLIP_OFFSET        (0x100000U)
+#define TEST_CLIP_BYTES         (188U * 256U * 32U)
+#define TEST_LINE_NUM           (4U)
+#define TEST_CLIP_LINE_WORDS    (TEST_CLIP_BYTES / sizeof(uint32_t) / TEST_LINE_NUM)
+
+/* 双线50MHz约12.5MB/s，每次读取另有命令和地址的开销 */
+#define TEST_SPI_CYCLES_PER_BYTE    (HOST_CPU_HZ / 12500000UL)
+#define TEST_SPI_CYCLES_PER_READ    (HOST_CPU_HZ / 1000000UL)
+
+typedef struct {
+    uint32_t prev[TEST_LINE_NUM];
+    uint64_t words[TEST_LINE_NUM];
+    uint64_t silent[TEST_LINE_NUM];
+    uint64_t breaks[TEST_LINE_NUM];
+} test_count_check_t;
+
+extern hpm_serial_nor_t nor_flash_dev;
+extern uint8_t i2s_tx_dma_channel;
+
+static uint8_t nor_mem[TEST_FLASH_SIZE];
+static uint32_t nor_reads;
+static uint64_t nor_read_bytes;
+static test_count_check_t count_check;
+
+/* Flash模型 */
+hpm_stat_t hpm_serial_nor_init(hpm_serial_nor_t *flash, hpm_serial_nor_info_t *info)
+{
+    if (flash->host.host_param.param.host_base == NULL) {
+        return status_invalid_argument;
+    }
+    info->size_in_kbytes = TEST_FLASH_SIZE / 1024U;
+    info->sector_size_kbytes = 4U;
+    info->block_size_kbytes = 64U;
+    info->page_size = 256U;
+    flash->flash_info = *info;
+    return status_success;
+}
+
+hpm_stat_t hpm_serial_nor_read(hpm_serial_nor_t *flash, uint8_t *buf, uint32_t data_len, uint32_t address)
+{
+    (void)flash;
+    if ((address > TEST_FLASH_SIZE) || (data_len > TEST_FLASH_SIZE - address)) {
+        return status_invalid_argument;
+    }
+    host_cpu_wait(TEST_SPI_CYCLES_PER_READ + (uint64_t)data_len * TEST_SPI_CYCLES_PER_BYTE);
+    memcpy(buf, &nor_mem[address], data_len);
+    nor_reads++;
+    nor_read_bytes += data_len;
+    return status_success;
+}
+
+/* 移植层：与spi_nor_flash/common/port相同，SPI NOR使用HDMA，通道由示例重新实现的函数分配 */
+hpm_stat_t serial_nor_get_board_host(hpm_serial_nor_host_t *host)
+{
+    hpm_nor_host_dma_control_t *dma = &host->host_param.param.dma_control;
+    hpm_stat_t stat;
+
+    stat = serial_nor_get_board_dma_channel((void *)HPM_HDMA, &dma->rx_dma_ch, &dma->tx_dma_ch);
+    if (stat != status_success) {
+        return stat;
+    }
+    host->host_param.param.host_base = BOARD_APP_SPI_BASE;
+    host->host_param.param.frequency = 50000000UL;
+    dma->dma_base = HPM_HDMA;
+    dma->dmamux_base = HPM_DMAMUX;
+    dma->rx_dma_req = BOARD_APP_SPI_RX_DMA;
+    dma->tx_dma_req = BOARD_APP_SPI_TX_DMA;
+    return status_success;
+}
+
+void serial_nor_spi_pins_init(SPI_Type *spi)
+{
+    (void)spi;
+}
+
+static uint32_t clip_word(uint32_t line, uint32_t n)
+{
+    return ((line + 1U) << 28) | (n % TEST_CLIP_LINE_WORDS);
+}
+
+static void count_sink(I2S_Type *i2s, uint8_t line, uint8_t slot, uint32_t word, void *user_data)
+{
+    test_count_check_t *check = (test_count_check_t *)user_data;
+    uint32_t prev = check->prev[line];
+
+    (void)i2s;
+    (void)slot;
+    check->words[line]++;
+    if (word == 0U) {
+        check->silent[line]++;
+        return;
+    }
+    if ((word != clip_word(line, (prev == 0U) ? 0U : (prev & 0x0FFFFFFFUL) + 1U))) {
+        check->breaks[line]++;
+    }
+    check->prev[line] = word;
+}
+
+static void setup(void)
+{
+    uint32_t *words = (uint32_t *)&nor_mem[TEST_CLIP_OFFSET];
+
+    memset(nor_mem, 0xFF, sizeof(nor_mem));
+    for (uint32_t n = 0; n < TEST_CLIP_LINE_WORDS; n++) {
+        for (uint32_t line = 0; line < TEST_LINE_NUM; line++) {
+            words[n * TEST_LINE_NUM + line] = clip_word(line, n);
+        }
+    }
+    host_i2s_set_tx_sink(HPM_I2S0, count_sink, &count_check);
+}
+
+static int check(FILE *fp)
+{
+    const hpm_nor_host_dma_control_t *dma = &nor_flash_dev.host.host_param.param.dma_control;
+    int fails = 0;
+
+    fprintf(fp, "dma channels: i2s tx xdma ch%u, spi nor rx hdma ch%u tx hdma ch%u\n", i2s_tx_dma_channel,
+            dma->rx_dma_ch, dma->tx_dma_ch);
+    fprintf(fp, "nor: %lu reads, %llu bytes\n", (unsigned long)nor_reads, (unsigned long long)nor_read_bytes);
+    for (uint8_t line = 0; line < TEST_LINE_NUM; line++) {
+        fprintf(fp, "check line%u: %llu words, %llu silent, %llu discontinuities\n", line,
+                (unsigned long long)count_check.words[line], (unsigned long long)count_check.silent[line],
+                (unsigned long long)count_check.breaks[line]);
+        if ((count_check.breaks[line] != 0U) || (count_check.silent[line] == count_check.words[line])) {
+            fails++;
+        }
+    }
+    return fails;
+}
+
+int main(void)
+{
+    const host_demo_t demo = {
+        .name = "i2s_nor_flash_stream",
+        .entry = demo_main,
+        .timeout_ms = 3000,
+        .setup = setup,
+        .check = check,
+    };
+
+    return host_model_run(&demo);
+}
@@ -14,24 +14,45 @@
 #include "hpm_i2s_drv.h"
 #include "hpm_dmav2_drv.h"
 #include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_tune.h"
+#include "i2s_multiline_cfg.h"
 
 /* DMA配置相关定义 */
 #define TEST_I2S_DMA              HPM_XDMA
 #define TEST_I2S_DMA_IRQ          IRQn_XDMA
 
-/* DMA通道和请求源配置 */
-uint32_t i2s_dma_channel[4] = {0, 1, 2, 3};  /* 使用DMA通道0-3 */
+/* DMA请求源配置，通道由资源管理器在运行时分配 */
+uint8_t i2s_dma_channel[4];
 uint32_t i2s_dma_req[4] = {HPM_DMA_SRC_I2S0_TX_0, HPM_DMA_SRC_I2S0_TX_1, HPM_DMA_SRC_I2S0_TX_2, HPM_DMA_SRC_I2S0_TX_3};
-
-/* DMA传输状态标志 */
-volatile bool dma_transfer_done[4];    /* DMA传输完成标志 */
-volatile bool dma_transfer_error[4];   /* DMA传输错误标志 */
+#define APP_DMA_CHANNEL_MASK     (0x000000FFUL)  /* 可分配的DMA通道 */
 
 /* I2S主设备配置 */
 #define I2S_MASTER               HPM_I2S0
 #define I2S_MASTER_CLOCK_NAME    clock_i2s0
 
-#define I2S_TX_FIFO_THRESHOLD    (4)  /* I2S发送FIFO阈值设置 */
+/* 采样率，FIFO阈值、DMA burst长度和周期帧数由整定接口按采样率计算 */
+#ifndef TEST_SAMPLE_RATE
+#define TEST_SAMPLE_RATE         (48000U)
+#endif
+
+/* 流式发送配置：4个周期，每周期最多256帧(决定环形缓冲区大小)，目标延迟22ms */
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#define STREAM_TARGET_LATENCY_US (22000U)
+#ifndef STREAM_PLAY_SECONDS
+#define STREAM_PLAY_SECONDS      (10U)
+#endif
+
+/* 中断开销对比：额外分配的空闲通道模拟共用DMA控制器的其他模块(SPI NOR、内存拷贝等) */
+#define BENCH_EXTRA_CHANNEL_MAX  (4U)
+#define BENCH_PLAY_SECONDS       (1U)
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，per_line引擎；无效组合在编译时报错 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, 4, 32, 2, I2S_MULTILINE_CFG_ENGINE_PER_LINE, TEST_SAMPLE_RATE)
 
 /* 音频数据配置结构体 */
 typedef struct {
@@ -49,179 +70,325 @@ uint32_t test_data[] = {
   0x99999999, 0xAAAAAAAA, 0xBBBBBBBB, 0xCCCCCCCC, 0xDDDDDDDD, 0xEEEEEEEE, 0xFFFFFFFF, 0x5A5A5A5A,
 };
 
+/*
+ * 流实例及环形缓冲区，DMA直接访问，放置在非缓存区
+ * 4条数据线发送相同的数据，使用广播模式，4个DMA通道共用一个环
+ */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[STREAM_PERIOD_NUM * STREAM_PERIOD_FRAMES * 2];
+
+volatile uint32_t stream_period_count;  /* 已播放的周期数 */
+
+i2s_multiline_tune_t i2s_tune;
+
+uint8_t bench_extra_channel[BENCH_EXTRA_CHANNEL_MAX];
+
+/* 同步启动自检：播放第2个周期后测得的各数据线相对数据线0的偏移(采样数) */
+int32_t stream_skew[4];
+hpm_stat_t stream_skew_stat;
+
+/* 中断分发方式：true为读取一次挂起状态后按通道分发，false为逐通道轮询 */
+volatile bool isr_use_dispatch = true;
+volatile uint8_t isr_poll_extra_num;    /* 轮询方式下额外查询的通道数 */
+
+/* 中断耗时统计(CPU周期) */
+volatile uint32_t isr_count;
+volatile uint64_t isr_cycles_sum;
+volatile uint32_t isr_cycles_max;
+
 /*
  * DMA中断处理函数
- * 处理DMA传输完成和错误事件
+ * 分发方式由资源管理器调用流的通道回调；轮询方式由流式发送接口逐通道查询，
+ * 额外分配的通道也要逐个查询
  */
 SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
 void isr_dma(void)
 {
-    uint32_t stat;
-
-    for (uint8_t i = 0; i < 4; i++) {
-        /* 检查并清除DMA传输状态 */
-        stat = dma_check_transfer_status(TEST_I2S_DMA, i2s_dma_channel[i]);
+    uint64_t start = hpm_csr_get_core_cycle();
+    uint32_t cycles;
 
-        if (stat & DMA_CHANNEL_STATUS_TC) {
-            dma_transfer_done[i] = true;  /* 传输完成 */
-        } else if (stat & DMA_CHANNEL_STATUS_ERROR) {
-            dma_transfer_error[i] = true; /* 传输错误 */
+    if (isr_use_dispatch) {
+        i2s_multiline_dma_mgr_irq_handler(TEST_I2S_DMA);
+    } else {
+        i2s_multiline_stream_irq_handler(&i2s_stream);
+        for (uint8_t i = 0; i < isr_poll_extra_num; i++) {
+            (void)dma_check_transfer_status(TEST_I2S_DMA, bench_extra_channel[i]);
         }
     }
+
+    cycles = (uint32_t)(hpm_csr_get_core_cycle() - start);
+    isr_count++;
+    isr_cycles_sum += cycles;
+    if (cycles > isr_cycles_max) {
+        isr_cycles_max = cycles;
+    }
+}
+
+/* 额外通道的回调：通道从未使能，不会被调用，只使分发方式登记与轮询方式相同数量的通道 */
+static void bench_idle_callback(uint8_t channel, uint32_t status, void *user_data)
+{
+    (void)channel;
+    (void)status;
+    (void)user_data;
 }
 
 /*
- * I2S DMA传输配置函数
- * 配置单个DMA通道的传输参数
+ * 周期回调函数
+ * 在DMA中断上下文中调用
  */
-hpm_stat_t i2s_dma_transfer_config(DMAV2_Type *dma_ptr, uint8_t dma_channel, uint8_t i2s_line, audio_data_t *audio_data)
+void stream_period_callback(i2s_multiline_stream_t *stream, uint32_t period, void *user_data)
 {
-    hpm_stat_t stat;
-    dma_channel_config_t ch_config;
-    uint8_t data_width;
-    uint8_t data_shift_byte;
-
-    /* 验证音频位深是16位或32位 */
-    assert((audio_data->audio_depth == 16U) || (audio_data->audio_depth == 32U));
-
-    /* 根据音频位深配置DMA传输宽度 */
-    if (audio_data->audio_depth == 16U) {
-        data_width = DMA_TRANSFER_WIDTH_HALF_WORD;
-        data_shift_byte = 2U;
-    } else {
-        data_width = DMA_TRANSFER_WIDTH_WORD;
-        data_shift_byte = 0U;
-    }
-
-    /* 配置DMA通道参数 */
-    dma_default_channel_config(dma_ptr, &ch_config);
-    ch_config.src_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)audio_data->data); /* 源地址 */
-    ch_config.dst_addr = (uint32_t)&I2S_MASTER->TXD[i2s_line] + data_shift_byte; /* 目标地址，有效数据位于TXD的高位 */
-    ch_config.src_width = data_width;                         /* 数据位宽 */
-    ch_config.dst_width = data_width;                         /* 数据位宽 */
-    ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;  /* 源地址递增 */
-    ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_FIXED;      /* 目标地址固定 */
-    ch_config.size_in_byte = audio_data->length;              /* 传输数据长度（Bytes） */
-    ch_config.dst_mode = DMA_HANDSHAKE_MODE_HANDSHAKE;        /* 硬件握手模式 */
-
-    /* 设置DMA通道 */
-    stat = dma_setup_channel(dma_ptr, dma_channel, &ch_config, false);
-
-    /* 配置DMAMUX */
-    uint8_t dmamux_channel = DMA_SOC_CHN_TO_DMAMUX_CHN(dma_ptr, dma_channel);
-    dmamux_config(BOARD_APP_DMAMUX, dmamux_channel, i2s_dma_req[i2s_line], true);
-
-    return stat;
+    (void)stream;
+    (void)user_data;
+    stream_period_count = period + 1U;
 }
 
 /*
  * I2S主模式多通道配置函数
  * 配置I2S接口和传输参数
  */
-void i2s_master_multiline_config(void)
+void i2s_master_multiline_config(uint8_t fifo_threshold)
 {
-    i2s_config_t i2s_config;
-    i2s_multiline_transfer_config_t transfer;
-    uint32_t i2s_mclk_hz;
-
-    /* 配置I2S接口 */
-    i2s_get_default_config(I2S_MASTER, &i2s_config);
-    i2s_config.tx_fifo_threshold = I2S_TX_FIFO_THRESHOLD;  /* 设置发送FIFO阈值 */
-    i2s_config.enable_mclk_out = true;                     /* 使能主时钟输出 */
-    i2s_init(I2S_MASTER, &i2s_config);
-
-    /* 配置I2S传输参数 */
-    i2s_get_default_multiline_transfer_config(&transfer);
-    transfer.sample_rate = audio_data.sample_rate;         /* 设置采样率 */
-    transfer.channel_num_per_frame = 2;                    /* 每帧通道数 */
-    transfer.audio_depth = audio_data.audio_depth;         /* 设置位深 */
-    transfer.channel_length = i2s_channel_length_32_bits;  /* 通道长度 */
-    transfer.master_mode = true;                           /* 主模式 */
-    transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;        /* MSB对齐协议 */
-    
-    /* 使能4个发送数据线 */
-    transfer.tx_data_line_en[0] = true; 
-    transfer.tx_data_line_en[1] = true;
-    transfer.tx_data_line_en[2] = true;
-    transfer.tx_data_line_en[3] = true;
-    
-    /* 配置通道槽掩码 */
-    transfer.tx_channel_slot_mask[0] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[1] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[2] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[3] = (1 << audio_data.channel_num) - 1;
-
-    /* 配置I2S数据格式 */
-    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
-    if (status_success != i2s_config_multiline_transfer(I2S_MASTER, i2s_mclk_hz, &transfer)) {
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线和时隙掩码均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, fifo_threshold)) {
         printf("I2S config failed!\n");
     }
 }
 
 /*
- * I2S主模式多通道DMA传输测试函数
+ * 从资源管理器分配4条数据线的DMA通道，以及只分配、不使能的额外通道
  */
-void test_i2s_master_multiline_dma(void)
+hpm_stat_t request_dma_channels(void)
 {
     hpm_stat_t stat;
 
-    i2s_master_multiline_config();
+    stat = i2s_multiline_dma_mgr_add_controller(TEST_I2S_DMA, BOARD_APP_DMAMUX, APP_DMA_CHANNEL_MASK);
+    if (status_success != stat) {
+        return stat;
+    }
+    for (uint8_t line = 0; line < 4; line++) {
+        stat = i2s_multiline_dma_mgr_request(TEST_I2S_DMA, i2s_dma_req[line], &i2s_dma_channel[line]);
+        if (status_success != stat) {
+            return stat;
+        }
+        stat = i2s_multiline_dma_mgr_set_callback(TEST_I2S_DMA, i2s_dma_channel[line],
+                                                  i2s_multiline_stream_dma_callback, &i2s_stream);
+        if (status_success != stat) {
+            return stat;
+        }
+    }
+    for (uint8_t i = 0; i < BENCH_EXTRA_CHANNEL_MAX; i++) {
+        stat = i2s_multiline_dma_mgr_request(TEST_I2S_DMA, I2S_MULTILINE_DMA_MGR_NO_REQ, &bench_extra_channel[i]);
+        if (status_success != stat) {
+            return stat;
+        }
+    }
+    printf("DMA channels: lines %d %d %d %d, extra %d %d %d %d\n",
+           i2s_dma_channel[0], i2s_dma_channel[1], i2s_dma_channel[2], i2s_dma_channel[3],
+           bench_extra_channel[0], bench_extra_channel[1], bench_extra_channel[2], bench_extra_channel[3]);
+    return status_success;
+}
+
+/*
+ * 初始化流并连续播放指定时长，测试数据作为任意长度的音频源被连续写入流，播放期间不重新配置DMA
+ */
+hpm_stat_t stream_play(uint32_t seconds, uint32_t *written)
+{
+    hpm_stat_t stat;
+    i2s_multiline_stream_config_t config = {0};
+    const void *line_data[1];
+    uint32_t frames_per_chunk = audio_data.length / (audio_data.channel_num * audio_data.audio_depth / 8U);
+    uint32_t total_frames = audio_data.sample_rate * seconds;
+    uint32_t written_frames = 0;
+    uint32_t chunk_offset = 0;
+    uint32_t n;
+    bool skew_checked = false;
+
+    /* 配置流式发送接口 */
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.line_num = 4;
+    config.channel_per_line = audio_data.channel_num;
+    config.audio_depth = audio_data.audio_depth;
+    config.period_num = i2s_tune.point.period_num;
+    config.period_frames = i2s_tune.point.period_frames;
+    config.dma_burst = i2s_tune.point.batch;
+    config.period_cb = stream_period_callback;
+    config.broadcast = true;
+    config.buffer[0] = stream_buffer;
+    for (uint8_t line = 0; line < 4; line++) {
+        config.dma_channel[line] = i2s_dma_channel[line];
+        config.dma_req[line] = i2s_dma_req[line];
+    }
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return stat;
+    }
 
-    /* 使能DMA中断 */
+    /* 启动前预填充整个环 */
+    while (i2s_multiline_stream_get_free_frames(&i2s_stream) >= frames_per_chunk) {
+        line_data[0] = audio_data.data;
+        written_frames += i2s_multiline_stream_write(&i2s_stream, line_data, frames_per_chunk);
+    }
+
+    /* 使能DMA中断，4个通道预填充各自的FIFO后同时启动 */
+    stream_period_count = 0;
+    stream_skew_stat = status_fail;
     intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+    stat = i2s_multiline_stream_start(&i2s_stream);
+    if (status_success != stat) {
+        printf("I2S stream start failed!\n");
+        return stat;
+    }
 
-    /* 使能I2S DMA请求 */
-    i2s_enable_tx_dma_request(I2S_MASTER);
-
-    /* 执行10次DMA传输测试 */
-    for (int i = 0; i < 10; i++) {
-        memset(dma_transfer_done, 0x00, sizeof(dma_transfer_done));
-        memset(dma_transfer_error, 0x00, sizeof(dma_transfer_error));
-
-        /* 配置4个DMA通道 */
-        bool dma_config_failed = false;
-        for (uint8_t line = 0; line < 4; line++) {
-            stat = i2s_dma_transfer_config(TEST_I2S_DMA, i2s_dma_channel[line], line, &audio_data);
-            if (status_success != stat) {
-                dma_config_failed = true;
-                printf("I2S line %d DMA transfer config failed!\n", line);
-                break;
-            }
+    /* 生产者：有空间时继续写入，只需写入一份数据 */
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        line_data[0] = audio_data.data + chunk_offset * audio_data.channel_num * audio_data.audio_depth / 8U;
+        n = i2s_multiline_stream_write(&i2s_stream, line_data, frames_per_chunk - chunk_offset);
+        chunk_offset = (chunk_offset + n) % frames_per_chunk;
+        written_frames += n;
+        if ((!skew_checked) && (stream_period_count >= 2U)) {
+            stream_skew_stat = i2s_multiline_stream_measure_skew(&i2s_stream, stream_skew);
+            skew_checked = true;
         }
+    }
 
-        if (dma_config_failed) {
-            break;
-        }
+    /* 等待环中的数据播放完毕，其后插入的静音不计为欠载 */
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
 
-        /* 使能所有DMA通道 */
-        dma_enable_channel(TEST_I2S_DMA, i2s_dma_channel[0]);
-        dma_enable_channel(TEST_I2S_DMA, i2s_dma_channel[1]);
-        dma_enable_channel(TEST_I2S_DMA, i2s_dma_channel[2]);
-        dma_enable_channel(TEST_I2S_DMA, i2s_dma_channel[3]);
+    /* 此时尚有数据在FIFO中未完全发出，可以等待一段时间 */
 
-        /* 首次传输时启动I2S */
-        if (i == 0) {
-            i2s_start(I2S_MASTER);
-        }
+    /* 停止I2S传输 */
+    i2s_multiline_stream_stop(&i2s_stream);
+    *written = written_frames;
+    return status_success;
+}
 
-        /* 等待传输完成 */
-        bool dma_4ch_done = false;
-        bool dma_4ch_error = false;
-        do {
-            dma_4ch_done = dma_transfer_done[0] && dma_transfer_done[1] && dma_transfer_done[2] && dma_transfer_done[3];
-            dma_4ch_error = dma_transfer_error[0] || dma_transfer_error[1] || dma_transfer_error[2] || dma_transfer_error[3];
-        } while ((!dma_4ch_done) && (!dma_4ch_error));
-
-        if (dma_4ch_error) {
-            printf("dma transfer i2s data failed\n");
-            break;
+/*
+ * 中断开销对比：中断需要检查的通道数为4条数据线加上额外通道，
+ * 分别用逐通道轮询和读取一次挂起状态后分发两种方式各播放1秒，统计中断耗时。
+ * 额外通道从未使能，不产生中断，只测量轮询方式每多检查一个通道的开销；
+ * 其他模块的通道同时产生中断时的回调开销不在测量范围内
+ */
+void benchmark_dma_isr(void)
+{
+    uint32_t written;
+    uint32_t count;
+
+    printf("DMA ISR cycles (avg/max) by checked channels:\n");
+    for (uint8_t extra = 0; extra <= BENCH_EXTRA_CHANNEL_MAX; extra += 2U) {
+        for (uint8_t i = 0; i < BENCH_EXTRA_CHANNEL_MAX; i++) {
+            i2s_multiline_dma_mgr_set_callback(TEST_I2S_DMA, bench_extra_channel[i],
+                                               (i < extra) ? bench_idle_callback : NULL, NULL);
+        }
+        isr_poll_extra_num = extra;
+        printf("  %d channels:", 4 + extra);
+        for (uint8_t mode = 0; mode < 2; mode++) {
+            isr_use_dispatch = (mode == 1U);
+            isr_count = 0;
+            isr_cycles_sum = 0;
+            isr_cycles_max = 0;
+            if (status_success != stream_play(BENCH_PLAY_SECONDS, &written)) {
+                return;
+            }
+            count = (isr_count == 0U) ? 1U : isr_count;
+            printf(" %s %lu/%lu", isr_use_dispatch ? "dispatch" : "poll",
+                   (uint32_t)(isr_cycles_sum / count), isr_cycles_max);
         }
+        printf("\n");
     }
 
-    /* 此时尚有数据在FIFO中未完全发出，可以等待一段时间 */
+    /* 之后的播放使用分发方式，额外通道不再参与 */
+    for (uint8_t i = 0; i < BENCH_EXTRA_CHANNEL_MAX; i++) {
+        i2s_multiline_dma_mgr_release(TEST_I2S_DMA, bench_extra_channel[i]);
+    }
+    isr_use_dispatch = true;
+}
 
-    /* 停止I2S传输 */
-    i2s_stop(I2S_MASTER);
+/*
+ * 打印整定得到的工作点
+ */
+void print_tune_point(const i2s_multiline_tune_point_t *point)
+{
+    printf("operating point: fifo threshold %d, dma burst %d, %d periods x %lu frames (%lu us), %lu irqs/s, "
+           "est. cpu load %lu.%lu%%, headroom %lu ns%s\n",
+           point->fifo_threshold, point->batch, point->period_num, point->period_frames, point->latency_us,
+           point->irq_per_second, point->cpu_load_permille / 10U, point->cpu_load_permille % 10U, point->headroom_ns,
+           point->budget_met ? "" : " (over budget)");
+}
+
+/*
+ * I2S主模式多通道DMA流式传输测试函数
+ */
+void test_i2s_master_multiline_dma(void)
+{
+    i2s_multiline_stream_stats_t stats;
+    i2s_multiline_tune_config_t tune_config = {0};
+    const i2s_multiline_tune_point_t *point;
+    uint32_t written_frames;
+
+    /* 按采样率、时隙数和目标延迟计算FIFO阈值和周期，周期不超过环形缓冲区的容量 */
+    tune_config.engine = i2s_multiline_tune_per_line_dma;
+    tune_config.cpu_hz = clock_get_frequency(clock_cpu0);
+    tune_config.sample_rate = audio_data.sample_rate;
+    tune_config.line_num = 4;
+    tune_config.channel_per_line = audio_data.channel_num;
+    tune_config.period_num = STREAM_PERIOD_NUM;
+    tune_config.target_latency_us = STREAM_TARGET_LATENCY_US;
+    tune_config.max_ring_frames = STREAM_PERIOD_NUM * STREAM_PERIOD_FRAMES;
+    if (status_success != i2s_multiline_tune_init(&i2s_tune, &tune_config)) {
+        printf("I2S tune init failed!\n");
+        return;
+    }
+    point = i2s_multiline_tune_get_point(&i2s_tune);
+    print_tune_point(point);
+
+    i2s_master_multiline_config(point->fifo_threshold);
+
+    if (status_success != request_dma_channels()) {
+        printf("DMA channel request failed!\n");
+        return;
+    }
+
+    benchmark_dma_isr();
+
+    if (status_success != stream_play(STREAM_PLAY_SECONDS, &written_frames)) {
+        return;
+    }
+
+    /* 欠载和错误不会终止播放，只计入统计 */
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S stream done: %d periods, %d underruns (%d frames filled)\n",
+           stream_period_count, stats.underrun_count, stats.silence_frames);
+    printf("dma errors %d, fifo underflows %d, recoveries %d (last %d cycles, max %d cycles)\n",
+           stats.dma_error_count, stats.fifo_underflow_count, stats.recovery_count,
+           stats.recovery_cycles_last, stats.recovery_cycles_max);
+
+    /* 同步启动自检，广播模式下各数据线数据相同，偏移只能由DMA和FIFO位置得到 */
+    if (status_success == stream_skew_stat) {
+        printf("sync start: FIFO prefill %d samples/line (%d timeouts), skew line1 %ld line2 %ld line3 %ld frames (%ld %ld %ld samples)\n",
+               stats.prefill_level, stats.prefill_timeout_count,
+               stream_skew[1] / audio_data.channel_num, stream_skew[2] / audio_data.channel_num,
+               stream_skew[3] / audio_data.channel_num, stream_skew[1], stream_skew[2], stream_skew[3]);
+    } else {
+        printf("sync start: skew measurement failed\n");
+    }
+
+    /* 广播模式下环和CPU写入量为按数据线复制时的1/4，DMA仍由4个通道各自读取 */
+    printf("broadcast: ring %lu bytes (%lu bytes per-line), CPU wrote %lu KB (%lu KB per-line), DMA read %lu KB\n",
+           (uint32_t)sizeof(stream_buffer), (uint32_t)sizeof(stream_buffer) * 4U,
+           written_frames * i2s_stream.frame_bytes / 1024U, written_frames * i2s_stream.frame_bytes * 4U / 1024U,
+           written_frames * i2s_stream.frame_bytes * 4U / 1024U);
 }
 
 /*
@@ -230,14 +397,8 @@ void test_i2s_master_multiline_dma(void)
  */
 void init_i2s_multiline_pin(void)
 {
-    /* 配置I2S引脚功能 */
-    HPM_IOC->PAD[IOC_PAD_PD01].FUNC_CTL = IOC_PD01_FUNC_CTL_I2S0_MCLK;  /* 主时钟 */
-    HPM_IOC->PAD[IOC_PAD_PD02].FUNC_CTL = IOC_PD02_FUNC_CTL_I2S0_BCLK;  /* 位时钟 */
-    HPM_IOC->PAD[IOC_PAD_PD03].FUNC_CTL = IOC_PD03_FUNC_CTL_I2S0_FCLK;  /* 帧时钟 */
-    HPM_IOC->PAD[IOC_PAD_PD18].FUNC_CTL = IOC_PD18_FUNC_CTL_I2S0_TXD_0; /* 数据线0 */
-    HPM_IOC->PAD[IOC_PAD_PD19].FUNC_CTL = IOC_PD19_FUNC_CTL_I2S0_TXD_1; /* 数据线1 */
-    HPM_IOC->PAD[IOC_PAD_PD20].FUNC_CTL = IOC_PD20_FUNC_CTL_I2S0_TXD_2; /* 数据线2 */
-    HPM_IOC->PAD[IOC_PAD_PD21].FUNC_CTL = IOC_PD21_FUNC_CTL_I2S0_TXD_3; /* 数据线3 */
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
 }
 
 /*
@@ -250,9 +411,9 @@ int main(void)
     printf("I2S Master multiline DMA example\n");
 
     /* 配置音频参数 */
-    audio_data.sample_rate = 48000;    /* 采样率48kHz */
-    audio_data.channel_num = 2;        /* 双声道 */
-    audio_data.audio_depth = 32;       /* 32位数据宽度 */
+    audio_data.sample_rate = TEST_SAMPLE_RATE;  /* 采样率 */
+    audio_data.channel_num = test_cfg_channel_per_line;  /* 双声道 */
+    audio_data.audio_depth = test_cfg_audio_depth;      /* 32位数据宽度 */
     audio_data.data = (uint8_t *)test_data;
     audio_data.length = sizeof(test_data);
 
@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * I2S多数据线发送方式的性能对比程序
+ * 中断、每条数据线一个DMA请求、DMAv2 burst三种引擎在采样率、位深、数据线数和FIFO阈值组成的矩阵上
+ * 依次运行，以CSV格式输出CPU占用率、中断频率、总线传输次数、下溢次数以及每种方式的最高可持续采样率
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_irq.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_cfg.h"
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+#define I2S_MASTER_IRQ           IRQn_I2S0
+
+/* DMA配置，通道由资源管理器在每次运行时分配 */
+#define BENCH_DMA                HPM_XDMA
+#define BENCH_DMA_IRQ            IRQn_XDMA
+#define BENCH_DMA_CHANNEL_MASK   (0x000000FFUL)
+
+/* 每个测试点的运行时长 */
+#ifndef BENCH_RUN_MS
+#define BENCH_RUN_MS             (200U)
+#endif
+
+#define BENCH_CHANNEL_PER_LINE   (2U)
+#define BENCH_SOURCE_FRAMES      (64U)    /* 中断引擎每条数据线源数据的帧数，循环播放 */
+
+/* DMA引擎：4个周期，每周期256帧 */
+#define BENCH_PERIOD_NUM         (4U)
+#define BENCH_PERIOD_FRAMES      (256U)
+
+/* DMAv2链表描述符占用的字数，每个周期每个通道加载一次 */
+#define BENCH_DESC_WORDS         (sizeof(dma_linked_descriptor_t) / sizeof(uint32_t))
+
+typedef enum {
+    bench_mode_irq = 0,
+    bench_mode_per_line_dma,
+    bench_mode_burst_dma,
+    bench_mode_num,
+} bench_mode_t;
+
+static const char *const bench_mode_name[bench_mode_num] = {"irq", "per_line_dma", "burst_dma"};
+
+/* 测试矩阵，采样率从低到高排列，用于判断最高可持续采样率 */
+static const uint32_t bench_rate[] = {48000, 96000, 192000, 384000, 768000};
+static const uint8_t bench_depth[] = {16, 24, 32};
+static const uint8_t bench_line[] = {1, 2, 4};
+static const uint8_t bench_threshold[] = {2, 4, 6};
+
+#define BENCH_RATE_NUM           ARRAY_SIZE(bench_rate)
+#define BENCH_DEPTH_NUM          ARRAY_SIZE(bench_depth)
+#define BENCH_LINE_NUM           ARRAY_SIZE(bench_line)
+#define BENCH_THRESHOLD_NUM      ARRAY_SIZE(bench_threshold)
+
+/*
+ * 编译期配置只描述最宽的测试点(4条数据线，32位，每条数据线2个时隙)，用于引脚配置。
+ * 中断引擎在所有芯片上可用，DMA引擎是否可用在运行时按I2S_MULTILINE_CFG_HAS_*跳过；
+ * 采样率、位深、数据线数和FIFO阈值在运行时逐点变化，I2S由bench_config_i2s按测试点配置
+ */
+I2S_MULTILINE_CFG_DEFINE(bench_cfg, 4, 32, BENCH_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_IRQ, 768000)
+
+typedef enum {
+    bench_result_ok = 0,
+    bench_result_unsupported,       /* 芯片或引擎不支持该组合 */
+    bench_result_config_fail,       /* I2S时钟无法分频到该采样率或初始化失败 */
+} bench_result_t;
+
+static const char *const bench_result_name[] = {"ok", "unsupported", "config_fail"};
+
+typedef struct {
+    bench_result_t result;
+    uint64_t elapsed_cycles;
+    uint64_t isr_cycles;
+    uint32_t irq_count;
+    uint32_t desc_loads;            /* 运行期间加载的链表描述符数 */
+    uint32_t underflows;            /* I2S发送FIFO下溢 */
+    uint32_t dma_errors;
+    uint32_t underruns;             /* 流生产者欠载，说明中断占满CPU */
+} bench_sample_t;
+
+/* 中断引擎的源数据，16位为int16_t，24/32位为右对齐的int32_t */
+int16_t bench_data16[I2S_MULTILINE_IRQ_MAX_LINE][BENCH_SOURCE_FRAMES * BENCH_CHANNEL_PER_LINE];
+int32_t bench_data32[I2S_MULTILINE_IRQ_MAX_LINE][BENCH_SOURCE_FRAMES * BENCH_CHANNEL_PER_LINE];
+
+i2s_multiline_irq_t irq_engine;
+
+/*
+ * 流实例及环形缓冲区，DMA直接访问，放置在非缓存区
+ * per_line引擎使用广播模式共用一个环，burst引擎为交织环，按最大的burst环分配
+ */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t bench_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t bench_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(BENCH_PERIOD_NUM, BENCH_PERIOD_FRAMES,
+                                                          I2S_MULTILINE_MAX_LINE, BENCH_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+uint8_t bench_dma_channel[I2S_MULTILINE_MAX_LINE];
+uint8_t bench_dma_channel_num;
+
+/* 每种方式在各位深、数据线数和阈值组合下的最高可持续采样率，0表示没有可持续的采样率 */
+uint32_t bench_max_rate[bench_mode_num][BENCH_DEPTH_NUM][BENCH_LINE_NUM][BENCH_THRESHOLD_NUM];
+
+/* DMA中断耗时统计(CPU周期)，中断引擎的统计由引擎自身完成 */
+volatile uint32_t dma_isr_count;
+volatile uint64_t dma_isr_cycles;
+
+uint32_t cpu_hz;
+
+/*
+ * I2S中断处理函数
+ */
+SDK_DECLARE_EXT_ISR_M(I2S_MASTER_IRQ, isr_i2s)
+void isr_i2s(void)
+{
+    i2s_multiline_irq_handler(&irq_engine);
+}
+
+/*
+ * DMA中断处理函数
+ * 由资源管理器调用流的通道回调，耗时包含分发本身
+ */
+SDK_DECLARE_EXT_ISR_M(BENCH_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    uint64_t start = hpm_csr_get_core_cycle();
+
+    i2s_multiline_dma_mgr_irq_handler(BENCH_DMA);
+
+    dma_isr_cycles += hpm_csr_get_core_cycle() - start;
+    dma_isr_count++;
+}
+
+/*
+ * 生成中断引擎的源数据
+ * 高4位为数据线号+1，次4位为通道号
+ */
+void init_bench_data(uint8_t audio_depth)
+{
+    uint32_t value;
+
+    for (uint32_t line = 0; line < I2S_MULTILINE_IRQ_MAX_LINE; line++) {
+        for (uint32_t i = 0; i < BENCH_SOURCE_FRAMES * BENCH_CHANNEL_PER_LINE; i++) {
+            value = ((line + 1U) << 12) | ((i % BENCH_CHANNEL_PER_LINE) << 8) | (i / BENCH_CHANNEL_PER_LINE);
+            bench_data16[line][i] = (int16_t)value;
+            bench_data32[line][i] = (int32_t)(value << (audio_depth - 16U));
+        }
+    }
+}
+
+/*
+ * 按测试点配置I2S：采样率、位深、使能的数据线及FIFO阈值
+ */
+hpm_stat_t bench_config_i2s(uint32_t sample_rate, uint8_t audio_depth, uint8_t line_num, uint8_t threshold)
+{
+    i2s_config_t i2s_config;
+    i2s_multiline_transfer_config_t transfer;
+    uint32_t i2s_mclk_hz;
+
+    if (board_config_i2s_clock(I2S_MASTER, sample_rate) == 0U) {
+        return status_fail;
+    }
+
+    /* 配置I2S接口 */
+    i2s_get_default_config(I2S_MASTER, &i2s_config);
+    i2s_config.tx_fifo_threshold = threshold;
+    i2s_config.enable_mclk_out = true;
+    i2s_init(I2S_MASTER, &i2s_config);
+
+    /* 配置I2S传输参数 */
+    i2s_get_default_multiline_transfer_config(&transfer);
+    transfer.sample_rate = sample_rate;
+    transfer.channel_num_per_frame = BENCH_CHANNEL_PER_LINE;
+    transfer.audio_depth = audio_depth;
+    transfer.channel_length = i2s_channel_length_32_bits;
+    transfer.master_mode = true;
+    transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;
+    for (uint8_t line = 0; line < line_num; line++) {
+        transfer.tx_data_line_en[line] = true;
+        transfer.tx_channel_slot_mask[line] = (1U << BENCH_CHANNEL_PER_LINE) - 1U;
+    }
+
+    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+    return i2s_config_multiline_transfer(I2S_MASTER, i2s_mclk_hz, &transfer);
+}
+
+/*
+ * 中断引擎：源数据循环播放，运行BENCH_RUN_MS后停止
+ */
+void bench_run_irq(uint8_t audio_depth, uint8_t line_num, uint8_t threshold, bench_sample_t *sample)
+{
+    i2s_multiline_irq_config_t config = {0};
+    i2s_multiline_irq_stats_t stats;
+    uint64_t run_cycles = (uint64_t)cpu_hz * BENCH_RUN_MS / 1000U;
+    uint64_t start;
+
+    config.i2s = I2S_MASTER;
+    config.line_num = line_num;
+    config.channel_per_line = BENCH_CHANNEL_PER_LINE;
+    config.audio_depth = audio_depth;
+    config.fifo_threshold = threshold;
+    config.frames = BENCH_SOURCE_FRAMES;
+    config.loop_count = 0;
+    for (uint8_t line = 0; line < line_num; line++) {
+        config.line_data[line] = (audio_depth == 16U) ? (const void *)bench_data16[line] : (const void *)bench_data32[line];
+    }
+    if (status_success != i2s_multiline_irq_init(&irq_engine, &config)) {
+        sample->result = bench_result_unsupported;
+        return;
+    }
+
+    start = hpm_csr_get_core_cycle();
+    i2s_multiline_irq_start(&irq_engine);
+    while (hpm_csr_get_core_cycle() - start < run_cycles) {
+        __asm("nop");
+    }
+    sample->elapsed_cycles = hpm_csr_get_core_cycle() - start;
+    i2s_multiline_irq_stop(&irq_engine);
+
+    i2s_multiline_irq_get_stats(&irq_engine, &stats);
+    sample->isr_cycles = stats.total_cycles;
+    sample->irq_count = stats.irq_count;
+    sample->underflows = stats.underflow_count;
+}
+
+/*
+ * 从资源管理器分配引擎所需的DMA通道
+ */
+hpm_stat_t bench_request_dma(i2s_multiline_stream_config_t *config)
+{
+    hpm_stat_t stat;
+    uint8_t num = (config->engine == i2s_multiline_engine_burst_dma) ? 1U : config->line_num;
+
+    bench_dma_channel_num = 0;
+    for (uint8_t i = 0; i < num; i++) {
+        stat = i2s_multiline_dma_mgr_request(BENCH_DMA, config->dma_req[i], &bench_dma_channel[i]);
+        if (status_success != stat) {
+            return stat;
+        }
+        bench_dma_channel_num++;
+        config->dma_channel[i] = bench_dma_channel[i];
+        stat = i2s_multiline_dma_mgr_set_callback(BENCH_DMA, bench_dma_channel[i],
+                                                  i2s_multiline_stream_dma_callback, &bench_stream);
+        if (status_success != stat) {
+            return stat;
+        }
+    }
+    return status_success;
+}
+
+void bench_release_dma(void)
+{
+    for (uint8_t i = 0; i < bench_dma_channel_num; i++) {
+        i2s_multiline_dma_mgr_release(BENCH_DMA, bench_dma_channel[i]);
+    }
+    bench_dma_channel_num = 0;
+}
+
+/*
+ * DMA引擎：环中预先写入测试数据，生产者只提交不拷贝，
+ * 使统计只包含DMA中断本身的开销，运行BENCH_RUN_MS后停止
+ */
+void bench_run_stream(i2s_multiline_engine_t engine, uint8_t audio_depth, uint8_t line_num, bench_sample_t *sample)
+{
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    void *ptr[I2S_MULTILINE_MAX_LINE];
+    uint64_t run_cycles = (uint64_t)cpu_hz * BENCH_RUN_MS / 1000U;
+    uint64_t start;
+    uint32_t n;
+
+    config.i2s = I2S_MASTER;
+    config.dma = BENCH_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = engine;
+    config.line_num = line_num;
+    config.channel_per_line = BENCH_CHANNEL_PER_LINE;
+    config.audio_depth = audio_depth;
+    config.period_num = BENCH_PERIOD_NUM;
+    config.period_frames = BENCH_PERIOD_FRAMES;
+    config.buffer[0] = bench_buffer;
+    if (engine == i2s_multiline_engine_burst_dma) {
+        config.dma_req[0] = HPM_DMA_SRC_I2S0_TX;
+    } else {
+#if I2S_MULTILINE_CFG_HAS_PER_LINE_DMA
+        static const uint8_t line_req[I2S_MULTILINE_MAX_LINE] = {
+            HPM_DMA_SRC_I2S0_TX_0, HPM_DMA_SRC_I2S0_TX_1, HPM_DMA_SRC_I2S0_TX_2, HPM_DMA_SRC_I2S0_TX_3
+        };
+        memcpy(config.dma_req, line_req, sizeof(line_req));
+#endif
+        config.broadcast = true;
+    }
+
+    if (status_success != bench_request_dma(&config)) {
+        bench_release_dma();
+        sample->result = bench_result_config_fail;
+        return;
+    }
+    if (status_success != i2s_multiline_stream_init(&bench_stream, &config)) {
+        bench_release_dma();
+        sample->result = bench_result_unsupported;
+        return;
+    }
+
+    /* 启动前写满整个环，之后的数据保持不变 */
+    while ((n = i2s_multiline_stream_get_write_ptr(&bench_stream, ptr)) > 0U) {
+        memset(ptr[0], 0x5A, n * bench_stream.frame_bytes);
+        i2s_multiline_stream_commit(&bench_stream, n);
+    }
+
+    dma_isr_count = 0;
+    dma_isr_cycles = 0;
+    start = hpm_csr_get_core_cycle();
+    if (status_success != i2s_multiline_stream_start(&bench_stream)) {
+        bench_release_dma();
+        sample->result = bench_result_config_fail;
+        return;
+    }
+    while (hpm_csr_get_core_cycle() - start < run_cycles) {
+        i2s_multiline_stream_task(&bench_stream);
+        n = i2s_multiline_stream_get_write_ptr(&bench_stream, ptr);
+        if (n > 0U) {
+            i2s_multiline_stream_commit(&bench_stream, n);
+        }
+    }
+    sample->elapsed_cycles = hpm_csr_get_core_cycle() - start;
+    i2s_multiline_stream_stop(&bench_stream);
+    bench_release_dma();
+
+    i2s_multiline_stream_get_stats(&bench_stream, &stats);
+    sample->isr_cycles = dma_isr_cycles;
+    sample->irq_count = dma_isr_count;
+    sample->desc_loads = bench_stream.read_pos / BENCH_PERIOD_FRAMES * bench_stream.dma_num;
+    sample->underflows = stats.fifo_underflow_count;
+    sample->dma_errors = stats.dma_error_count;
+    sample->underruns = stats.underrun_count;
+}
+
+/*
+ * 运行一个测试点并输出一行CSV
+ * 返回该测试点是否可持续：配置成功且没有下溢、DMA错误和欠载
+ */
+bool bench_run(bench_mode_t mode, uint32_t sample_rate, uint8_t audio_depth, uint8_t line_num, uint8_t threshold)
+{
+    bench_sample_t sample = {0};
+    uint64_t elapsed;
+    uint32_t load;
+    uint32_t samples_per_s = sample_rate * BENCH_CHANNEL_PER_LINE * line_num;
+
+    if (((mode == bench_mode_per_line_dma) && ((I2S_MULTILINE_CFG_HAS_PER_LINE_DMA == 0) || (audio_depth == 24U))) ||
+        ((mode == bench_mode_burst_dma) && (I2S_MULTILINE_CFG_HAS_BURST_DMA == 0)) ||
+        (threshold >= I2S_SOC_MAX_TX_FIFO_DEPTH)) {
+        sample.result = bench_result_unsupported;
+    } else if (status_success != bench_config_i2s(sample_rate, audio_depth, line_num, threshold)) {
+        sample.result = bench_result_config_fail;
+    } else if (mode == bench_mode_irq) {
+        bench_run_irq(audio_depth, line_num, threshold, &sample);
+    } else {
+        bench_run_stream((mode == bench_mode_burst_dma) ? i2s_multiline_engine_burst_dma : i2s_multiline_engine_per_line_dma,
+                         audio_depth, line_num, &sample);
+    }
+
+    if (sample.result != bench_result_ok) {
+        printf("%s,%lu,%d,%d,%d,%s,,,,,,,\n", bench_mode_name[mode], sample_rate, audio_depth, line_num, threshold,
+               bench_result_name[sample.result]);
+        return false;
+    }
+
+    /*
+     * 总线传输：每个采样一次TXD写入(中断方式由CPU、DMA方式由DMA完成)，
+     * DMA方式每个周期每个通道另外加载一个链表描述符
+     */
+    elapsed = (sample.elapsed_cycles == 0U) ? 1U : sample.elapsed_cycles;
+    load = (uint32_t)(sample.isr_cycles * 10000U / elapsed);
+    printf("%s,%lu,%d,%d,%d,%s,%lu.%02lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+           bench_mode_name[mode], sample_rate, audio_depth, line_num, threshold, bench_result_name[sample.result],
+           load / 100U, load % 100U,
+           (uint32_t)((uint64_t)sample.irq_count * cpu_hz / elapsed),
+           samples_per_s,
+           (uint32_t)((uint64_t)sample.desc_loads * BENCH_DESC_WORDS * cpu_hz / elapsed),
+           sample.underflows, sample.dma_errors, sample.underruns);
+
+    return (sample.underflows == 0U) && (sample.dma_errors == 0U) && (sample.underruns == 0U);
+}
+
+/*
+ * 依次运行整个矩阵，采样率从低到高，某个采样率不可持续后跳过更高的采样率
+ */
+void bench_run_matrix(void)
+{
+    bool sustained;
+
+    printf("mode,sample_rate,bits,lines,fifo_threshold,result,cpu_load_pct,irq_per_s,txd_writes_per_s,"
+           "desc_words_per_s,underflows,dma_errors,underruns\n");
+    for (uint8_t mode = 0; mode < bench_mode_num; mode++) {
+        for (uint8_t d = 0; d < BENCH_DEPTH_NUM; d++) {
+            init_bench_data(bench_depth[d]);
+            for (uint8_t l = 0; l < BENCH_LINE_NUM; l++) {
+                for (uint8_t t = 0; t < BENCH_THRESHOLD_NUM; t++) {
+                    sustained = true;
+                    for (uint8_t r = 0; (r < BENCH_RATE_NUM) && sustained; r++) {
+                        sustained = bench_run((bench_mode_t)mode, bench_rate[r], bench_depth[d], bench_line[l],
+                                              bench_threshold[t]);
+                        if (sustained) {
+                            bench_max_rate[mode][d][l][t] = bench_rate[r];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * 输出每种方式的最高可持续采样率：各组合下的值以及所有组合中的最大值
+ */
+void bench_print_max_rate(void)
+{
+    uint32_t best;
+
+    printf("\nmode,bits,lines,fifo_threshold,max_sample_rate\n");
+    for (uint8_t mode = 0; mode < bench_mode_num; mode++) {
+        best = 0;
+        for (uint8_t d = 0; d < BENCH_DEPTH_NUM; d++) {
+            for (uint8_t l = 0; l < BENCH_LINE_NUM; l++) {
+                for (uint8_t t = 0; t < BENCH_THRESHOLD_NUM; t++) {
+                    printf("%s,%d,%d,%d,%lu\n", bench_mode_name[mode], bench_depth[d], bench_line[l], bench_threshold[t],
+                           bench_max_rate[mode][d][l][t]);
+                    if (bench_max_rate[mode][d][l][t] > best) {
+                        best = bench_max_rate[mode][d][l][t];
+                    }
+                }
+            }
+        }
+        printf("%s,all,all,all,%lu\n", bench_mode_name[mode], best);
+    }
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能，需根据实际硬件修改
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    bench_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline benchmark\n");
+
+    cpu_hz = clock_get_frequency(clock_cpu0);
+    init_i2s_multiline_pin();
+
+    if (status_success != i2s_multiline_dma_mgr_add_controller(BENCH_DMA, BOARD_APP_DMAMUX, BENCH_DMA_CHANNEL_MASK)) {
+        printf("DMA controller register failed!\n");
+    }
+    intc_m_enable_irq_with_priority(I2S_MASTER_IRQ, 1);
+    intc_m_enable_irq_with_priority(BENCH_DMA_IRQ, 1);
+
+    bench_run_matrix();
+    bench_print_max_rate();
+    printf("benchmark done\n");
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多通道DMA接收的示例程序
+ * 该示例演示了如何使用DMA实现I2S的4通道并行数据接收，并将接收数据拆分为8个平面声道
+ * 发送和接收共用I2S0，各使用一个DMA通道的burst模式，4条TXD外部连接到对应的RXD形成回环，
+ * 由接收数据校验各数据线和通道的顺序并统计吞吐量
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_capture.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+#define TEST_I2S_DMA_RX_REQ       HPM_DMA_SRC_I2S0_RX
+
+#define TEST_I2S_TX_DMA_CHANNEL     0   /* 发送DMA通道号 */
+#define TEST_I2S_RX_DMA_CHANNEL     1   /* 接收DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define I2S_RX_FIFO_THRESHOLD    (4)  /* I2S接收FIFO阈值设置 */
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_CHANNEL_NUM         (TEST_LINE_NUM * TEST_CHANNEL_PER_LINE)
+#define TEST_SAMPLE_RATE         (48000U)
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，burst引擎，接收使用相同的格式 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, 32, TEST_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST, TEST_SAMPLE_RATE)
+
+/* 收发各4个周期，每周期256帧 */
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#ifndef TEST_SECONDS
+#define TEST_SECONDS             (10U)
+#endif
+
+/* 平面测试数据的帧数，循环播放 */
+#define PLANAR_FRAMES            (STREAM_PERIOD_FRAMES)
+
+/* 音频数据配置结构体 */
+typedef struct {
+    uint32_t sample_rate;    /* 采样率(Hz) */
+    uint8_t channel_num;     /* 通道数 (1: 单声道, 2: 立体声) */
+    uint8_t audio_depth;     /* 音频位深 (32 bits) */
+} audio_data_t;
+audio_data_t audio_data;     /* 全局音频数据实例 */
+
+/*
+ * 平面测试数据：每个声道一个独立缓冲区，声道编号为 line * 2 + slot
+ * 高4位为声道号+1，接收端据此校验各数据线和通道的顺序
+ */
+int32_t planar_tx[TEST_CHANNEL_NUM][PLANAR_FRAMES];
+/* 接收拆分后的平面数据 */
+int32_t planar_rx[TEST_CHANNEL_NUM][STREAM_PERIOD_FRAMES];
+
+/* 收发实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_capture_t i2s_capture;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t tx_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                       TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t rx_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                       TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+volatile uint32_t capture_period_count;  /* 已接收的周期数 */
+
+/*
+ * DMA中断处理函数
+ * 发送和接收使用同一个DMA控制器，各自只处理自己的通道
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+    i2s_multiline_capture_irq_handler(&i2s_capture);
+}
+
+/*
+ * 接收周期回调函数
+ * 在DMA中断上下文中调用
+ */
+void capture_period_callback(i2s_multiline_capture_t *capture, uint32_t period, void *user_data)
+{
+    (void)capture;
+    (void)user_data;
+    capture_period_count = period + 1U;
+}
+
+/*
+ * 生成平面测试数据
+ */
+void init_planar_data(void)
+{
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < PLANAR_FRAMES; i++) {
+            planar_tx[ch][i] = (int32_t)(((ch + 1U) << 28) | (i << 16));
+        }
+    }
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4条数据线同时发送和接收
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线和时隙掩码均来自编译期配置，收发使能相同的数据线和时隙 */
+    if (status_success != test_cfg_config_i2s_duplex(I2S_MASTER, i2s_mclk_hz, test_cfg_fifo_threshold,
+                                                     I2S_RX_FIFO_THRESHOLD)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 发送：将平面测试数据循环打包到发送环中，返回写入的帧数
+ */
+uint32_t feed_tx(i2s_multiline_pack_t *pack, const void *const src[], uint32_t *src_frame)
+{
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+
+    if (n > PLANAR_FRAMES - *src_frame) {
+        n = PLANAR_FRAMES - *src_frame;
+    }
+    if (n > 0U) {
+        i2s_multiline_pack(pack, (uint32_t *)ring_ptr[0], src, *src_frame, n);
+        i2s_multiline_stream_commit(&i2s_stream, n);
+        *src_frame = (*src_frame + n) % PLANAR_FRAMES;
+    }
+    return n;
+}
+
+/*
+ * I2S主模式多通道DMA收发回环测试函数
+ * 接收数据直接从环中拆分为平面声道，并按高4位校验声道顺序
+ */
+void test_i2s_master_multiline_capture(void)
+{
+    hpm_stat_t stat;
+    i2s_multiline_stream_config_t tx_config = {0};
+    i2s_multiline_capture_config_t rx_config = {0};
+    i2s_multiline_stream_stats_t tx_stats;
+    i2s_multiline_capture_stats_t rx_stats;
+    i2s_multiline_pack_config_t pack_config;
+    i2s_multiline_pack_t pack;
+    const void *tx_src[TEST_CHANNEL_NUM];
+    void *rx_dst[TEST_CHANNEL_NUM];
+    const void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t total_frames = audio_data.sample_rate * TEST_SECONDS;
+    uint32_t captured_frames = 0;
+    uint32_t checked_samples = 0;
+    uint32_t silent_samples = 0;
+    uint32_t order_errors = 0;
+    uint32_t src_frame = 0;
+    uint32_t unpack_cycles = 0;
+    uint32_t start_cycle;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t n;
+    int32_t v;
+
+    i2s_master_multiline_config();
+
+    /* 打包和解包使用相同的布局 */
+    pack_config.format = i2s_multiline_pack_s32;
+    pack_config.line_num = TEST_LINE_NUM;
+    pack_config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    pack_config.valid_bits = 0;
+    pack_config.broadcast = false;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        tx_src[ch] = planar_tx[ch];
+        rx_dst[ch] = planar_rx[ch];
+    }
+
+    /* 发送：一个DMA通道，burst模式写入4条数据线 */
+    tx_config.i2s = I2S_MASTER;
+    tx_config.dma = TEST_I2S_DMA;
+    tx_config.dmamux = BOARD_APP_DMAMUX;
+    tx_config.engine = i2s_multiline_engine_burst_dma;
+    tx_config.line_num = TEST_LINE_NUM;
+    tx_config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    tx_config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    tx_config.channel_per_line = audio_data.channel_num;
+    tx_config.audio_depth = audio_data.audio_depth;
+    tx_config.period_num = STREAM_PERIOD_NUM;
+    tx_config.period_frames = STREAM_PERIOD_FRAMES;
+    tx_config.buffer[0] = tx_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &tx_config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+
+    /* 接收：一个DMA通道，burst模式依次读取4条数据线 */
+    rx_config.i2s = I2S_MASTER;
+    rx_config.dma = TEST_I2S_DMA;
+    rx_config.dmamux = BOARD_APP_DMAMUX;
+    rx_config.engine = i2s_multiline_engine_burst_dma;
+    rx_config.line_num = TEST_LINE_NUM;
+    rx_config.dma_channel[0] = TEST_I2S_RX_DMA_CHANNEL;
+    rx_config.dma_req[0] = TEST_I2S_DMA_RX_REQ;
+    rx_config.channel_per_line = audio_data.channel_num;
+    rx_config.audio_depth = audio_data.audio_depth;
+    rx_config.period_num = STREAM_PERIOD_NUM;
+    rx_config.period_frames = STREAM_PERIOD_FRAMES;
+    rx_config.buffer[0] = rx_buffer;
+    rx_config.period_cb = capture_period_callback;
+    stat = i2s_multiline_capture_init(&i2s_capture, &rx_config);
+    if (status_success != stat) {
+        printf("I2S capture init failed!\n");
+        return;
+    }
+
+    /* 使能DMA中断 */
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    /* 预填充整个发送环，收发DMA均就绪后由一次i2s_start同时启动 */
+    while (feed_tx(&pack, tx_src, &src_frame) > 0U) {
+    }
+    if ((status_success != i2s_multiline_stream_prepare(&i2s_stream)) ||
+        (status_success != i2s_multiline_capture_prepare(&i2s_capture))) {
+        printf("I2S DMA prepare failed!\n");
+        return;
+    }
+    start = hpm_csr_get_core_cycle();
+    i2s_start(I2S_MASTER);
+
+    while (captured_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        i2s_multiline_capture_task(&i2s_capture);
+        feed_tx(&pack, tx_src, &src_frame);
+
+        /* 接收：直接从环中拆分为平面声道，不经过中间拷贝 */
+        n = i2s_multiline_capture_get_read_ptr(&i2s_capture, ring_ptr);
+        if (n == 0U) {
+            continue;
+        }
+        if (n > STREAM_PERIOD_FRAMES) {
+            n = STREAM_PERIOD_FRAMES;
+        }
+        start_cycle = read_csr(CSR_MCYCLE);
+        i2s_multiline_unpack(&pack, rx_dst, 0, (const uint32_t *)ring_ptr[0], n);
+        unpack_cycles += read_csr(CSR_MCYCLE) - start_cycle;
+        i2s_multiline_capture_release(&i2s_capture, n);
+        captured_frames += n;
+
+        /* 回环开始前及恢复时接收到的是静音，其余采样的高4位应为声道号+1 */
+        for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+            for (uint32_t i = 0; i < n; i++) {
+                v = planar_rx[ch][i];
+                if (v == 0) {
+                    silent_samples++;
+                } else if (((uint32_t)v >> 28) != ch + 1U) {
+                    order_errors++;
+                }
+                checked_samples++;
+            }
+        }
+    }
+    elapsed = hpm_csr_get_core_cycle() - start;
+
+    /* 停止I2S收发 */
+    i2s_multiline_capture_stop(&i2s_capture);
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_capture_get_stats(&i2s_capture, &rx_stats);
+    i2s_multiline_stream_get_stats(&i2s_stream, &tx_stats);
+    printf("I2S capture done: %d periods, %d samples checked, %d silent, %d channel order errors\n",
+           capture_period_count, checked_samples, silent_samples, order_errors);
+    printf("rx overruns %d (%d frames dropped), dma errors %d, fifo overflows %d, recoveries %d\n",
+           rx_stats.overrun_count, rx_stats.dropped_frames, rx_stats.dma_error_count,
+           rx_stats.fifo_overflow_count, rx_stats.recovery_count);
+    printf("tx underruns %d, fifo underflows %d, recoveries %d\n",
+           tx_stats.underrun_count, tx_stats.fifo_underflow_count, tx_stats.recovery_count);
+
+    /* 吞吐量：每秒接收的帧数和字节数，以及解包每个采样消耗的CPU周期数 */
+    printf("throughput %lu frames/s, %lu KB/s, unpack %lu.%02lu cycles/sample\n",
+           (uint32_t)((uint64_t)captured_frames * clock_get_frequency(clock_cpu0) / elapsed),
+           (uint32_t)((uint64_t)captured_frames * TEST_CHANNEL_NUM * sizeof(uint32_t) *
+                      clock_get_frequency(clock_cpu0) / elapsed / 1024U),
+           unpack_cycles / checked_samples, (unpack_cycles % checked_samples) * 100U / checked_samples);
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能，RXD引脚需根据实际硬件调整，并与对应的TXD引脚相连
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 时钟和发送数据线引脚见i2s_multiline_cfg.h的引脚表，接收数据线引脚需与回环接线一致 */
+    test_cfg_init_pins();
+    HPM_IOC->PAD[IOC_PAD_PB06].FUNC_CTL = IOC_PB06_FUNC_CTL_I2S0_RXD_0; /* 接收数据线0 */
+    HPM_IOC->PAD[IOC_PAD_PB07].FUNC_CTL = IOC_PB07_FUNC_CTL_I2S0_RXD_1; /* 接收数据线1 */
+    HPM_IOC->PAD[IOC_PAD_PB08].FUNC_CTL = IOC_PB08_FUNC_CTL_I2S0_RXD_2; /* 接收数据线2 */
+    HPM_IOC->PAD[IOC_PAD_PB09].FUNC_CTL = IOC_PB09_FUNC_CTL_I2S0_RXD_3; /* 接收数据线3 */
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline DMA capture example\n");
+
+    /* 配置音频参数 */
+    audio_data.sample_rate = test_cfg_sample_rate;       /* 采样率48kHz */
+    audio_data.channel_num = test_cfg_channel_per_line;  /* 双声道 */
+    audio_data.audio_depth = test_cfg_audio_depth;       /* 32位数据宽度 */
+    init_planar_data();
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, audio_data.sample_rate);
+    init_i2s_multiline_pin();
+
+    /* 执行I2S多通道DMA收发回环测试 */
+    test_i2s_master_multiline_capture();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
@@ -8,203 +8,371 @@
 /*
  * 这是一个I2S多通道DMA传输的示例程序
  * 该示例演示了如何使用DMA来实现I2S的4通道并行数据传输
- * 本示例使用DMAmux将一个DMA通道复用到4个I2S发送通道
+ * 本示例使用一个DMA通道的burst模式依次写入4个I2S发送数据线，
+ * 8个平面声道的数据由打包接口直接打包到DMA环形缓冲区中
  */
 
 #include "board.h"
 #include "hpm_i2s_drv.h"
 #include "hpm_dmav2_drv.h"
 #include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_tune.h"
+#include "i2s_multiline_cfg.h"
 
 /* DMA配置相关定义 */
 #define TEST_I2S_DMA              HPM_XDMA
 #define TEST_I2S_DMA_IRQ          IRQn_XDMA
 #define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
 
-#define TEST_I2S_TX_DMA_CHANNEL     0   /* DMA通道号 */
-#define TEST_I2S_TX_DMAMUX_CHANNEL  DMA_SOC_CHN_TO_DMAMUX_CHN(TEST_I2S_DMA, TEST_I2S_TX_DMA_CHANNEL)
-
+#define TEST_I2S_DMA_CHANNEL_MASK (0x000000FFUL)    /* 允许资源管理器分配的DMA通道 */
 
 /* I2S主设备配置 */
 #define I2S_MASTER               HPM_I2S0
 #define I2S_MASTER_CLOCK_NAME    clock_i2s0
 
-#define I2S_TX_FIFO_THRESHOLD    (4)  /* I2S发送FIFO阈值设置 */
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_CHANNEL_NUM         (TEST_LINE_NUM * TEST_CHANNEL_PER_LINE)
+
+/* 采样率，FIFO阈值和周期帧数由整定接口按采样率计算 */
+#ifndef TEST_SAMPLE_RATE
+#define TEST_SAMPLE_RATE         (48000U)
+#endif
+
+/* 流式发送配置：4个周期，每周期最多256帧(决定环形缓冲区大小)，目标延迟22ms */
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#define STREAM_TARGET_LATENCY_US (22000U)
+#ifndef STREAM_PLAY_SECONDS
+#define STREAM_PLAY_SECONDS      (10U)
+#endif
+
+/* 播放的音频位深：16、24或32，源数据以对应的紧凑格式存放 */
+#ifndef TEST_AUDIO_DEPTH
+#define TEST_AUDIO_DEPTH         (16U)
+#endif
+
+/* 广播模式：只使用2个平面声道，4条数据线发送相同的数据 */
+#ifndef TEST_BROADCAST
+#define TEST_BROADCAST           (0)
+#endif
+
+/* 编译期配置：4条数据线，位深TEST_AUDIO_DEPTH，每条数据线2个时隙，burst引擎；无效组合在编译时报错 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, TEST_AUDIO_DEPTH, 2, I2S_MULTILINE_CFG_ENGINE_BURST, TEST_SAMPLE_RATE)
+
+/* 平面测试数据的帧数，循环播放 */
+#define PLANAR_FRAMES            (STREAM_PERIOD_FRAMES)
 
 /* 音频数据配置结构体 */
 typedef struct {
     uint32_t sample_rate;    /* 采样率(Hz) */
     uint8_t channel_num;     /* 通道数 (1: 单声道, 2: 立体声) */
-    uint8_t audio_depth;     /* 音频位深 (32 bits) */
-    const uint8_t *data;     /* 音频数据缓冲区指针 */
-    uint32_t length;         /* 音频数据长度(字节) */
+    uint8_t audio_depth;     /* 音频位深 (16/24/32 bits) */
 } audio_data_t;
 audio_data_t audio_data;     /* 全局音频数据实例 */
 
-/* 测试数据：每个数据重复4次，用于4个通道同步发送 */
-uint32_t test_data[] = {
-  0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x22222222, 0x22222222, 0x22222222, 0x22222222,
-  0x33333333, 0x33333333, 0x33333333, 0x33333333, 0x44444444, 0x44444444, 0x44444444, 0x44444444,
-  0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x66666666, 0x66666666, 0x66666666, 0x66666666,
-  0x77777777, 0x77777777, 0x77777777, 0x77777777, 0x88888888, 0x88888888, 0x88888888, 0x88888888,
-  0x99999999, 0x99999999, 0x99999999, 0x99999999, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA,
-  0xBBBBBBBB, 0xBBBBBBBB, 0xBBBBBBBB, 0xBBBBBBBB, 0xCCCCCCCC, 0xCCCCCCCC, 0xCCCCCCCC, 0xCCCCCCCC,
-  0xDDDDDDDD, 0xDDDDDDDD, 0xDDDDDDDD, 0xDDDDDDDD, 0xEEEEEEEE, 0xEEEEEEEE, 0xEEEEEEEE, 0xEEEEEEEE,
-  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A5A5A5A, 0x5A5A5A5A, 0x5A5A5A5A, 0x5A5A5A5A,
-};
-
-/* DMA传输状态标志 */
-volatile bool dma_transfer_done;    /* DMA传输完成标志 */
-volatile bool dma_transfer_error;   /* DMA传输错误标志 */
+/*
+ * 平面测试数据：每个声道一个独立缓冲区，声道编号为 line * 2 + slot
+ * 高4位为声道号+1，便于在波形上区分各数据线和通道
+ */
+int32_t planar_s32[TEST_CHANNEL_NUM][PLANAR_FRAMES];
+int16_t planar_s16[TEST_CHANNEL_NUM][PLANAR_FRAMES];
+ATTR_ALIGN(4) uint8_t planar_s24[TEST_CHANNEL_NUM][PLANAR_FRAMES * 3];
+
+/* 打包基准测试的目标缓冲区(可缓存) */
+uint32_t bench_buffer[PLANAR_FRAMES * TEST_CHANNEL_NUM];
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                           TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+volatile uint32_t stream_period_count;  /* 已播放的周期数 */
+uint8_t i2s_tx_dma_channel;             /* 运行时分配的I2S发送DMA通道 */
+
+i2s_multiline_tune_t i2s_tune;
 
 /*
  * DMA中断处理函数
- * 处理DMA传输完成和错误事件
+ * 由资源管理器分发到流式发送接口，处理周期推进和错误统计
  */
 SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
 void isr_dma(void)
 {
-    uint32_t stat;
+    i2s_multiline_dma_mgr_irq_handler(TEST_I2S_DMA);
+}
 
-    /* 检查并清除DMA传输状态 */
-    stat = dma_check_transfer_status(TEST_I2S_DMA, TEST_I2S_TX_DMA_CHANNEL);
+/*
+ * 周期回调函数
+ * 在DMA中断上下文中调用
+ */
+void stream_period_callback(i2s_multiline_stream_t *stream, uint32_t period, void *user_data)
+{
+    (void)stream;
+    (void)user_data;
+    stream_period_count = period + 1U;
+}
 
-    if (stat & DMA_CHANNEL_STATUS_TC) {
-        dma_transfer_done = true;  /* 传输完成 */
-    } else if (stat & DMA_CHANNEL_STATUS_ERROR) {
-        dma_transfer_error = true; /* 传输错误 */
+/*
+ * 生成平面测试数据，三种格式的数据对应相同的波形
+ */
+void init_planar_data(void)
+{
+    uint32_t v;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < PLANAR_FRAMES; i++) {
+            v = ((ch + 1U) << 28) | (i << 16);
+            planar_s32[ch][i] = (int32_t)v;
+            planar_s16[ch][i] = (int16_t)(v >> 16);
+            planar_s24[ch][i * 3] = (uint8_t)(v >> 8);
+            planar_s24[ch][i * 3 + 1] = (uint8_t)(v >> 16);
+            planar_s24[ch][i * 3 + 2] = (uint8_t)(v >> 24);
+        }
     }
 }
 
 /*
- * I2S DMA传输配置函数
- * 配置DMA通道参数，使用burst模式， 一个dma通道完成4个数据线的发送
+ * 打包性能测试：分别打包到可缓存缓冲区和非缓存的DMA环形缓冲区，打印每个采样消耗的CPU周期数
  */
-hpm_stat_t i2s_dma_transfer_config(DMAV2_Type *dma_ptr, uint8_t dma_channel, audio_data_t *audio_data)
+void benchmark_pack(void)
 {
-    hpm_stat_t stat;
-    dma_channel_config_t ch_config;
-
-    /* 验证音频位深为32位 */
-    assert(audio_data->audio_depth == 32U);
-
-    /* 配置DMA通道参数 */
-    dma_default_channel_config(dma_ptr, &ch_config);
-    ch_config.src_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)audio_data->data); /* 源地址 */
-    ch_config.dst_addr = (uint32_t)&I2S_MASTER->TXD[0];                                       /* 目标地址 */
-    ch_config.src_width = DMA_TRANSFER_WIDTH_WORD;                                            /* 源数据宽度：32位 */
-    ch_config.dst_width = DMA_TRANSFER_WIDTH_WORD;                                            /* 目标数据宽度：32位 */
-    ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;                                  /* 源地址递增 */
-    ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;                                  /* 目标地址递增 */
-    ch_config.size_in_byte = audio_data->length;                                             /* 传输数据长度 */
-    ch_config.dst_mode = DMA_HANDSHAKE_MODE_HANDSHAKE;                                       /* 硬件握手模式 */
-    ch_config.en_dst_burst_in_fixed_trans = true;                                            /* 使能burst传输 */
-    ch_config.src_burst_size = DMA_NUM_TRANSFER_PER_BURST_4T;                               /* burst大小：4次传输 */
-
-    /* 设置DMA通道 */
-    stat = dma_setup_channel(dma_ptr, dma_channel, &ch_config, false);
-
-    /* 配置DMAMUX，将DMA通道连接到I2S发送请求 */
-    uint8_t dmamux_channel = DMA_SOC_CHN_TO_DMAMUX_CHN(dma_ptr, dma_channel);
-    dmamux_config(BOARD_APP_DMAMUX, dmamux_channel, TEST_I2S_DMA_TX_REQ, true);
-
-    return stat;
+    static const char *const format_name[] = {"s16", "s24", "s32"};
+    const void *src[3][TEST_CHANNEL_NUM];
+    i2s_multiline_pack_config_t config;
+    i2s_multiline_pack_t pack;
+    uint32_t *dst[2] = {bench_buffer, stream_buffer};
+    uint64_t start;
+    uint32_t cycles[2];
+    uint32_t samples = PLANAR_FRAMES * TEST_CHANNEL_NUM;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        src[i2s_multiline_pack_s16][ch] = planar_s16[ch];
+        src[i2s_multiline_pack_s24][ch] = planar_s24[ch];
+        src[i2s_multiline_pack_s32][ch] = planar_s32[ch];
+    }
+
+    config.line_num = TEST_LINE_NUM;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    config.valid_bits = 0;
+    config.broadcast = false;
+    for (uint8_t fmt = i2s_multiline_pack_s16; fmt <= i2s_multiline_pack_s32; fmt++) {
+        config.format = (i2s_multiline_pack_format_t)fmt;
+        i2s_multiline_pack_init(&pack, &config);
+        for (uint8_t i = 0; i < 2; i++) {
+            /* 先执行一次预热指令和数据缓存 */
+            i2s_multiline_pack(&pack, dst[i], src[fmt], 0, PLANAR_FRAMES);
+            start = hpm_csr_get_core_cycle();
+            i2s_multiline_pack(&pack, dst[i], src[fmt], 0, PLANAR_FRAMES);
+            cycles[i] = (uint32_t)(hpm_csr_get_core_cycle() - start);
+        }
+        printf("pack %s: %lu.%02lu cycles/sample (cacheable), %lu.%02lu cycles/sample (noncacheable)\n",
+               format_name[fmt],
+               cycles[0] / samples, (cycles[0] % samples) * 100U / samples,
+               cycles[1] / samples, (cycles[1] % samples) * 100U / samples);
+    }
 }
 
 /*
  * I2S主模式多通道配置函数
  * 配置I2S 4通道进行发送
  */
-void i2s_master_multiline_config(void)
+void i2s_master_multiline_config(uint8_t fifo_threshold)
 {
-    i2s_config_t i2s_config;
-    i2s_multiline_transfer_config_t transfer;
-    uint32_t i2s_mclk_hz;
-
-    /* 配置I2S接口 */
-    i2s_get_default_config(I2S_MASTER, &i2s_config);
-    i2s_config.tx_fifo_threshold = I2S_TX_FIFO_THRESHOLD;  /* 设置发送FIFO阈值 */
-    i2s_config.enable_mclk_out = true;                     /* 使能主时钟输出 */
-    i2s_init(I2S_MASTER, &i2s_config);
-
-    /* 配置I2S传输参数 */
-    i2s_get_default_multiline_transfer_config(&transfer);
-    transfer.sample_rate = audio_data.sample_rate;         /* 设置采样率 */
-    transfer.channel_num_per_frame = 2;                    /* 每帧通道数 */
-    transfer.audio_depth = audio_data.audio_depth;         /* 设置位深 */
-    transfer.channel_length = i2s_channel_length_32_bits;  /* 通道长度 */
-    transfer.master_mode = true;                           /* 主模式 */
-    transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;        /* MSB对齐协议 */
-    
-    /* 使能4个发送数据线 */
-    transfer.tx_data_line_en[0] = true;
-    transfer.tx_data_line_en[1] = true;
-    transfer.tx_data_line_en[2] = true;
-    transfer.tx_data_line_en[3] = true;
-    
-    /* 配置通道槽掩码 */
-    transfer.tx_channel_slot_mask[0] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[1] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[2] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[3] = (1 << audio_data.channel_num) - 1;
-
-    /* 配置I2S数据格式 */
-    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
-    if (status_success != i2s_config_multiline_transfer(I2S_MASTER, i2s_mclk_hz, &transfer)) {
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线和时隙掩码均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, fifo_threshold)) {
         printf("I2S config failed!\n");
     }
 }
 
 /*
- * I2S主模式多通道DMA传输测试函数
+ * 打印整定得到的工作点
+ */
+void print_tune_point(const i2s_multiline_tune_point_t *point)
+{
+    printf("operating point: fifo threshold %d, dma burst %d, %d periods x %lu frames (%lu us), %lu irqs/s, "
+           "est. cpu load %lu.%lu%%, headroom %lu ns%s\n",
+           point->fifo_threshold, point->batch, point->period_num, point->period_frames, point->latency_us,
+           point->irq_per_second, point->cpu_load_permille / 10U, point->cpu_load_permille % 10U, point->headroom_ns,
+           point->budget_met ? "" : " (over budget)");
+}
+
+/*
+ * I2S主模式多通道DMA流式传输测试函数
+ * 平面测试数据循环打包到环形缓冲区，播放期间不重新配置DMA
  */
 void test_i2s_master_multiline_dma(void)
 {
     hpm_stat_t stat;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    i2s_multiline_tune_config_t tune_config = {0};
+    const i2s_multiline_tune_point_t *point;
+    i2s_multiline_pack_config_t pack_config;
+    i2s_multiline_pack_t pack;
+    const void *src[TEST_CHANNEL_NUM];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t src_sample_bytes;
+    uint32_t src_channel_num = TEST_BROADCAST ? TEST_CHANNEL_PER_LINE : TEST_CHANNEL_NUM;
+    uint64_t src_bytes;
+    uint64_t dma_bytes;
+    uint32_t total_frames = audio_data.sample_rate * STREAM_PLAY_SECONDS;
+    uint32_t written_frames = 0;
+    uint32_t src_frame = 0;
+    uint32_t n;
+
+    /* 按采样率、时隙数和目标延迟计算FIFO阈值和周期，周期不超过环形缓冲区的容量 */
+    tune_config.engine = i2s_multiline_tune_burst_dma;
+    tune_config.cpu_hz = clock_get_frequency(clock_cpu0);
+    tune_config.sample_rate = audio_data.sample_rate;
+    tune_config.line_num = TEST_LINE_NUM;
+    tune_config.channel_per_line = audio_data.channel_num;
+    tune_config.period_num = STREAM_PERIOD_NUM;
+    tune_config.target_latency_us = STREAM_TARGET_LATENCY_US;
+    tune_config.max_ring_frames = STREAM_PERIOD_NUM * STREAM_PERIOD_FRAMES;
+    if (status_success != i2s_multiline_tune_init(&i2s_tune, &tune_config)) {
+        printf("I2S tune init failed!\n");
+        return;
+    }
+    point = i2s_multiline_tune_get_point(&i2s_tune);
+    print_tune_point(point);
+
+    i2s_master_multiline_config(point->fifo_threshold);
+
+    /* 配置打包接口：按位深选择紧凑的平面数据格式 */
+    switch (audio_data.audio_depth) {
+    case 16:
+        pack_config.format = i2s_multiline_pack_s16;
+        src_sample_bytes = 2U;
+        break;
+    case 24:
+        pack_config.format = i2s_multiline_pack_s24;
+        src_sample_bytes = 3U;
+        break;
+    default:
+        pack_config.format = i2s_multiline_pack_s32;
+        src_sample_bytes = 4U;
+        break;
+    }
+    pack_config.line_num = TEST_LINE_NUM;
+    pack_config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    pack_config.valid_bits = 0;
+    pack_config.broadcast = TEST_BROADCAST;
+    stat = i2s_multiline_pack_init(&pack, &pack_config);
+    if (status_success != stat) {
+        printf("I2S pack init failed!\n");
+        return;
+    }
+    for (uint32_t ch = 0; ch < src_channel_num; ch++) {
+        if (pack_config.format == i2s_multiline_pack_s16) {
+            src[ch] = planar_s16[ch];
+        } else if (pack_config.format == i2s_multiline_pack_s24) {
+            src[ch] = planar_s24[ch];
+        } else {
+            src[ch] = planar_s32[ch];
+        }
+    }
+
+    /* 从资源管理器分配DMA通道，中断由管理器分发给流 */
+    stat = i2s_multiline_dma_mgr_add_controller(TEST_I2S_DMA, BOARD_APP_DMAMUX, TEST_I2S_DMA_CHANNEL_MASK);
+    if (status_success == stat) {
+        stat = i2s_multiline_dma_mgr_request(TEST_I2S_DMA, TEST_I2S_DMA_TX_REQ, &i2s_tx_dma_channel);
+    }
+    if (status_success == stat) {
+        stat = i2s_multiline_dma_mgr_set_callback(TEST_I2S_DMA, i2s_tx_dma_channel,
+                                                  i2s_multiline_stream_dma_callback, &i2s_stream);
+    }
+    if (status_success != stat) {
+        printf("I2S DMA channel request failed!\n");
+        return;
+    }
 
-    i2s_master_multiline_config();
+    /* 配置流式发送接口：一个DMA通道，burst模式写入4条数据线 */
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = i2s_tx_dma_channel;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = audio_data.channel_num;
+    config.audio_depth = audio_data.audio_depth;
+    config.period_num = point->period_num;
+    config.period_frames = point->period_frames;
+    config.buffer[0] = stream_buffer;
+    config.period_cb = stream_period_callback;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
 
     /* 使能DMA中断 */
     intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
 
-    /* 使能I2S DMA请求 */
-    i2s_enable_tx_dma_request(I2S_MASTER);
-
-    /* 执行10次DMA传输测试 */
-    for (int i = 0; i < 10; i++) {
-        dma_transfer_error = false;
-        dma_transfer_done = false;
-
-        /* 配置DMA传输 */
-        stat = i2s_dma_transfer_config(TEST_I2S_DMA, TEST_I2S_TX_DMA_CHANNEL, &audio_data);
-        if (status_success != stat) {
-            printf("I2S DMA transfer config failed!\n");
-            break;
+    /* 生产者：直接打包到环中的写地址，启动前先预填充整个环 */
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n > PLANAR_FRAMES - src_frame) {
+            n = PLANAR_FRAMES - src_frame;
         }
-
-        /* 使能DMA通道 */
-        dma_enable_channel(TEST_I2S_DMA, TEST_I2S_TX_DMA_CHANNEL);
-
-        /* 首次传输时启动I2S */
-        if (i == 0) {
-            i2s_start(I2S_MASTER);
+        if (n > 0U) {
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], src, src_frame, n);
+            i2s_multiline_stream_commit(&i2s_stream, n);
+            src_frame = (src_frame + n) % PLANAR_FRAMES;
+            written_frames += n;
         }
-
-        /* 等待传输完成或出错 */
-        while ((!dma_transfer_error) && (!dma_transfer_done)) {
-            __asm("nop");
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&i2s_stream);
+            if (status_success != stat) {
+                printf("I2S stream start failed!\n");
+                return;
+            }
         }
+    }
 
-        if (dma_transfer_error) {
-            printf("dma transfer i2s data failed\n");
-            break;
-        }
+    /* 等待环中的数据播放完毕，其后插入的静音不计为欠载 */
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
     }
 
     /* 此时尚有数据在FIFO中未完全发出，可以等待一段时间 */
 
-    /* 停止I2S传输 */
-    i2s_stop(I2S_MASTER);
+    /* 停止I2S传输并释放DMA通道 */
+    i2s_multiline_stream_stop(&i2s_stream);
+    i2s_multiline_dma_mgr_release(TEST_I2S_DMA, i2s_tx_dma_channel);
+
+    /* 欠载和错误不会终止播放，只计入统计 */
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S stream done: %d periods, %d underruns (%d frames filled)\n",
+           stream_period_count, stats.underrun_count, stats.silence_frames);
+    printf("dma errors %d, fifo underflows %d, recoveries %d (last %d cycles, max %d cycles)\n",
+           stats.dma_error_count, stats.fifo_underflow_count, stats.recovery_count,
+           stats.recovery_cycles_last, stats.recovery_cycles_max);
+
+    /*
+     * 源数据按紧凑格式存放并由CPU读取，只有周期环以32位展开由DMA读取；
+     * 与预先展开为32位的源数据相比，源数据的存储和读取流量按位深比例减少，
+     * 广播模式下源数据只有一份，再减少为1/4
+     */
+    src_bytes = (uint64_t)written_frames * src_channel_num * src_sample_bytes;
+    dma_bytes = (uint64_t)written_frames * TEST_CHANNEL_NUM * sizeof(uint32_t);
+    printf("%d-bit source%s: %lu KB read (%lu KB if pre-expanded to 32 bit per line), source data %lu bytes per frame, "
+           "DMA ring %lu bytes\n",
+           audio_data.audio_depth, TEST_BROADCAST ? " (broadcast)" : "",
+           (uint32_t)(src_bytes / 1024U), (uint32_t)(dma_bytes / 1024U),
+           src_channel_num * src_sample_bytes, (uint32_t)sizeof(stream_buffer));
 }
 
 /*
@@ -213,14 +381,8 @@ void test_i2s_master_multiline_dma(void)
  */
 void init_i2s_multiline_pin(void)
 {
-    /* 配置I2S引脚功能 */
-    HPM_IOC->PAD[IOC_PAD_PB11].FUNC_CTL = IOC_PB11_FUNC_CTL_I2S0_MCLK;  /* 主时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB01].FUNC_CTL = IOC_PB01_FUNC_CTL_I2S0_BCLK;  /* 位时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB10].FUNC_CTL = IOC_PB10_FUNC_CTL_I2S0_FCLK;  /* 帧时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB00].FUNC_CTL = IOC_PB00_FUNC_CTL_I2S0_TXD_0; /* 数据线0 */
-    HPM_IOC->PAD[IOC_PAD_PB03].FUNC_CTL = IOC_PB03_FUNC_CTL_I2S0_TXD_1; /* 数据线1 */
-    HPM_IOC->PAD[IOC_PAD_PB05].FUNC_CTL = IOC_PB05_FUNC_CTL_I2S0_TXD_2; /* 数据线2 */
-    HPM_IOC->PAD[IOC_PAD_PB02].FUNC_CTL = IOC_PB02_FUNC_CTL_I2S0_TXD_3; /* 数据线3 */
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
 }
 
 /*
@@ -233,11 +395,13 @@ int main(void)
     printf("I2S Master multiline DMA example\n");
 
     /* 配置音频参数 */
-    audio_data.sample_rate = 48000;    /* 采样率48kHz */
-    audio_data.channel_num = 2;        /* 双声道 */
-    audio_data.audio_depth = 32;       /* 32位数据宽度 */
-    audio_data.data = (uint8_t *)test_data;
-    audio_data.length = sizeof(test_data);
+    audio_data.sample_rate = TEST_SAMPLE_RATE;  /* 采样率 */
+    audio_data.channel_num = test_cfg_channel_per_line;  /* 双声道 */
+    audio_data.audio_depth = test_cfg_audio_depth;  /* 音频位深 */
+    init_planar_data();
+
+    /* 打包性能测试，此时DMA尚未启动，可借用环形缓冲区 */
+    benchmark_pack();
 
     /* 配置I2S时钟和引脚 */
     board_config_i2s_clock(I2S_MASTER, audio_data.sample_rate);
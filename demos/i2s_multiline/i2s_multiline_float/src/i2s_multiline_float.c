@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多通道浮点数据播放的示例程序
+ * 该示例演示了把上游DSP输出的float32平面数据限幅、加TPDF抖动后直接转换到burst DMA环中，
+ * 不经过中间缓冲区，并测试各输出位数下每个采样消耗的CPU周期数
+ */
+
+#include <math.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_float.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define TEST_I2S_TX_DMA_CHANNEL     0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_CHANNEL_NUM         (TEST_LINE_NUM * TEST_CHANNEL_PER_LINE)
+#define TEST_SAMPLE_RATE         (48000U)
+
+/* 编译期配置：4条数据线，32位时隙(16/24位输出左对齐)，每条数据线2个时隙，burst引擎 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, 32, TEST_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST, TEST_SAMPLE_RATE)
+
+/* 播放的输出位数 */
+#ifndef TEST_OUT_BITS
+#define TEST_OUT_BITS            (24U)
+#endif
+
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#define STREAM_PLAY_SECONDS      (10U)
+
+/* 浮点源数据为10ms，声道ch为(ch + 1) * 100Hz的正弦波，循环播放 */
+#define SOURCE_FRAMES            (TEST_SAMPLE_RATE / 100U)
+/* 性能测试每次转换的帧数 */
+#define BENCH_FRAMES             (256U)
+
+/* 平面浮点源数据 */
+float source[TEST_CHANNEL_NUM][SOURCE_FRAMES];
+/* 性能测试的输出，与环的burst布局相同 */
+uint32_t bench_out[BENCH_FRAMES * TEST_CHANNEL_NUM];
+
+i2s_multiline_float_t conv;
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                           TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进和错误统计
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+}
+
+/*
+ * 生成浮点源数据，幅度0.5
+ */
+void init_source(void)
+{
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < SOURCE_FRAMES; i++) {
+            source[ch][i] = 0.5f * sinf(2.0f * (float)M_PI * (ch + 1U) * 100.0f * i / TEST_SAMPLE_RATE);
+        }
+    }
+}
+
+/*
+ * 转换性能测试：各输出位数、是否抖动下每个采样消耗的CPU周期数
+ */
+void benchmark_float(void)
+{
+    static const uint8_t out_bits[] = {16, 24, 32};
+    i2s_multiline_float_config_t config = {0};
+    const float *src[TEST_CHANNEL_NUM];
+    void *dst[1] = {bench_out};
+    uint64_t start;
+    uint32_t cycles;
+    uint32_t samples = BENCH_FRAMES * TEST_CHANNEL_NUM;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        src[ch] = source[ch];
+    }
+
+    config.layout = i2s_multiline_float_burst;
+    config.line_num = TEST_LINE_NUM;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    for (uint8_t b = 0; b < ARRAY_SIZE(out_bits); b++) {
+        for (uint8_t d = 0; d < 2U; d++) {
+            /* 32位输出不加抖动 */
+            if ((out_bits[b] == 32U) && (d != 0U)) {
+                continue;
+            }
+            config.out_bits = out_bits[b];
+            config.dither = (d != 0U);
+            i2s_multiline_float_init(&conv, &config);
+            /* 先运行一次预热缓存，再计时 */
+            i2s_multiline_float_convert(&conv, dst, src, 0, BENCH_FRAMES);
+            start = hpm_csr_get_core_cycle();
+            i2s_multiline_float_convert(&conv, dst, src, 0, BENCH_FRAMES);
+            cycles = (uint32_t)(hpm_csr_get_core_cycle() - start);
+            printf("float -> s%u %-9s: %lu.%02lu cycles/sample\n", out_bits[b], config.dither ? "dither" : "no dither",
+                   cycles / samples, (cycles % samples) * 100U / samples);
+        }
+    }
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线、时隙掩码和FIFO阈值均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, test_cfg_fifo_threshold)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 播放：浮点源数据直接转换到环的写地址
+ */
+void test_i2s_master_multiline_float(void)
+{
+    hpm_stat_t stat;
+    i2s_multiline_float_config_t float_config = {0};
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    const float *src[TEST_CHANNEL_NUM];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t source_pos = 0;
+    uint32_t total_frames = TEST_SAMPLE_RATE * STREAM_PLAY_SECONDS;
+    uint32_t written_frames = 0;
+    uint32_t n;
+
+    i2s_master_multiline_config();
+
+    float_config.layout = i2s_multiline_float_burst;
+    float_config.line_num = TEST_LINE_NUM;
+    float_config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    float_config.out_bits = TEST_OUT_BITS;
+    float_config.dither = true;
+    stat = i2s_multiline_float_init(&conv, &float_config);
+    if (status_success != stat) {
+        printf("float conversion init failed!\n");
+        return;
+    }
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        src[ch] = source[ch];
+    }
+
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    config.audio_depth = test_cfg_audio_depth;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = STREAM_PERIOD_FRAMES;
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n > SOURCE_FRAMES - source_pos) {
+            n = SOURCE_FRAMES - source_pos;
+        }
+        if (n > 0U) {
+            i2s_multiline_float_convert(&conv, ring_ptr, src, source_pos, n);
+            i2s_multiline_stream_commit(&i2s_stream, n);
+            source_pos = (source_pos + n) % SOURCE_FRAMES;
+            written_frames += n;
+        }
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&i2s_stream);
+            if (status_success != stat) {
+                printf("I2S stream start failed!\n");
+                return;
+            }
+        }
+    }
+
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S play done: float -> s%u with dither, %lu frames, %lu underruns\n",
+           TEST_OUT_BITS, written_frames, stats.underrun_count);
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline float example\n");
+
+    init_source();
+
+    /* 转换性能测试 */
+    benchmark_float();
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, TEST_SAMPLE_RATE);
+    init_i2s_multiline_pin();
+
+    /* 执行浮点数据的I2S多通道播放 */
+    test_i2s_master_multiline_float();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
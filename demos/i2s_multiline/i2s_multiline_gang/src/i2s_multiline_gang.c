@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 多个I2S实例联动输出最多16条同步数据线
+ * I2S0为时钟主设备，其余实例为从设备，共用主设备的BCLK/FCLK并在主设备启动时同时开始发送。
+ * 依次使用1~N个实例运行吞吐测试，输出CPU占用率、数据吞吐量和实例间偏移，最后全部实例持续播放
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_gang.h"
+
+/* I2S主设备时钟 */
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+/* 参与联动的实例数 */
+#ifndef GANG_INSTANCE_NUM
+#if defined(HPM_I2S3)
+#define GANG_INSTANCE_NUM        (4U)
+#elif defined(HPM_I2S2)
+#define GANG_INSTANCE_NUM        (3U)
+#elif defined(HPM_I2S1)
+#define GANG_INSTANCE_NUM        (2U)
+#else
+#define GANG_INSTANCE_NUM        (1U)
+#endif
+#endif
+
+/* DMA控制器，XDMA的通道不足时使用HDMA */
+#define GANG_XDMA                HPM_XDMA
+#define GANG_XDMA_IRQ            IRQn_XDMA
+#ifdef HPM_HDMA
+#define GANG_HDMA                HPM_HDMA
+#define GANG_HDMA_IRQ            IRQn_HDMA
+#define GANG_DMA_NUM             (2U)
+#else
+#define GANG_DMA_NUM             (1U)
+#endif
+#define GANG_DMA_CHANNEL_MASK    (0x000000FFUL)
+
+/* 每条line独立的DMA请求(如HPM6P00)使用per_line引擎，否则使用burst引擎(如HPM6E00) */
+#ifdef HPM_DMA_SRC_I2S0_TX_0
+#define GANG_ENGINE              i2s_multiline_engine_per_line_dma
+#define GANG_DMA_REQ(n)          {HPM_DMA_SRC_I2S##n##_TX_0, HPM_DMA_SRC_I2S##n##_TX_1, \
+                                  HPM_DMA_SRC_I2S##n##_TX_2, HPM_DMA_SRC_I2S##n##_TX_3}
+#else
+#define GANG_ENGINE              i2s_multiline_engine_burst_dma
+#define GANG_DMA_REQ(n)          {HPM_DMA_SRC_I2S##n##_TX}
+#endif
+
+/* 音频参数：每个实例4条数据线，每条数据线2个时隙，32位 */
+#define TEST_SAMPLE_RATE         (48000U)
+#define GANG_LINE_PER_INSTANCE   (4U)
+#define GANG_CHANNEL_PER_LINE    (2U)
+#define GANG_AUDIO_DEPTH         (32U)
+#define GANG_FIFO_THRESHOLD      (4U)
+#define GANG_DMA_BURST           (2U)
+
+/* 4个周期，每周期128帧 */
+#define GANG_PERIOD_NUM          (4U)
+#define GANG_PERIOD_FRAMES       (128U)
+
+#define GANG_LINE_BUF_SIZE       I2S_MULTILINE_STREAM_LINE_BUF_SIZE(GANG_PERIOD_NUM, GANG_PERIOD_FRAMES, \
+                                                                    GANG_CHANNEL_PER_LINE, GANG_AUDIO_DEPTH)
+#define GANG_INSTANCE_BUF_SIZE   (GANG_LINE_BUF_SIZE * GANG_LINE_PER_INSTANCE)
+
+/* 吞吐测试每一步的运行时长及最后持续播放的时长 */
+#define GANG_BENCH_MS            (1000U)
+#define GANG_PLAY_MS             (10000U)
+
+/* 联动设备及环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_gang_t gang;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t gang_buffer[GANG_INSTANCE_NUM][GANG_INSTANCE_BUF_SIZE / sizeof(uint32_t)];
+
+static I2S_Type *const gang_i2s[] = {
+    HPM_I2S0,
+#if GANG_INSTANCE_NUM > 1
+    HPM_I2S1,
+#endif
+#if GANG_INSTANCE_NUM > 2
+    HPM_I2S2,
+#endif
+#if GANG_INSTANCE_NUM > 3
+    HPM_I2S3,
+#endif
+};
+
+static const uint8_t gang_dma_req[][I2S_MULTILINE_MAX_LINE] = {
+    GANG_DMA_REQ(0),
+#if GANG_INSTANCE_NUM > 1
+    GANG_DMA_REQ(1),
+#endif
+#if GANG_INSTANCE_NUM > 2
+    GANG_DMA_REQ(2),
+#endif
+#if GANG_INSTANCE_NUM > 3
+    GANG_DMA_REQ(3),
+#endif
+};
+
+/* 已写入的帧数，用于生成测试数据 */
+uint32_t write_frames;
+
+/* DMA中断耗时统计(CPU周期) */
+volatile uint32_t dma_isr_count;
+volatile uint64_t dma_isr_cycles;
+
+uint32_t cpu_hz;
+
+/*
+ * DMA中断处理函数
+ * 由资源管理器调用各实例流的通道回调，耗时包含分发本身
+ */
+SDK_DECLARE_EXT_ISR_M(GANG_XDMA_IRQ, isr_xdma)
+void isr_xdma(void)
+{
+    uint64_t start = hpm_csr_get_core_cycle();
+
+    i2s_multiline_dma_mgr_irq_handler(GANG_XDMA);
+
+    dma_isr_cycles += hpm_csr_get_core_cycle() - start;
+    dma_isr_count++;
+}
+
+#ifdef GANG_HDMA
+SDK_DECLARE_EXT_ISR_M(GANG_HDMA_IRQ, isr_hdma)
+void isr_hdma(void)
+{
+    uint64_t start = hpm_csr_get_core_cycle();
+
+    i2s_multiline_dma_mgr_irq_handler(GANG_HDMA);
+
+    dma_isr_cycles += hpm_csr_get_core_cycle() - start;
+    dma_isr_count++;
+}
+#endif
+
+/*
+ * 测试数据：高8位为全局数据线号+1，次4位为时隙号，低20位为帧序号，
+ * 在示波器或逻辑分析仪上可直接比较各数据线的帧对齐
+ */
+static inline uint32_t gang_sample(uint32_t line, uint32_t slot, uint32_t frame)
+{
+    return ((line + 1U) << 24) | (slot << 20) | (frame & 0xFFFFFU);
+}
+
+/*
+ * 通过零拷贝写指针向所有实例写入测试数据，返回写入的帧数
+ */
+uint32_t gang_produce(uint8_t instance_num)
+{
+    void *ptr[I2S_MULTILINE_GANG_MAX_LINE];
+    uint32_t frames = i2s_multiline_gang_get_write_ptr(&gang, ptr);
+    uint32_t *ring;
+    uint32_t line;
+
+    for (uint8_t i = 0; i < instance_num; i++) {
+        for (uint32_t f = 0; f < frames; f++) {
+            for (uint32_t s = 0; s < GANG_CHANNEL_PER_LINE; s++) {
+                for (uint32_t l = 0; l < GANG_LINE_PER_INSTANCE; l++) {
+                    line = i * GANG_LINE_PER_INSTANCE + l;
+#if defined(HPM_DMA_SRC_I2S0_TX_0)
+                    /* per_line引擎：每条数据线一个环 */
+                    ring = (uint32_t *)ptr[line];
+                    ring[f * GANG_CHANNEL_PER_LINE + s] = gang_sample(line, s, write_frames + f);
+#else
+                    /* burst引擎：每个实例一个环，按line0..line3的顺序交织 */
+                    ring = (uint32_t *)ptr[i];
+                    ring[(f * GANG_CHANNEL_PER_LINE + s) * GANG_LINE_PER_INSTANCE + l] = gang_sample(line, s, write_frames + f);
+#endif
+                }
+            }
+        }
+    }
+    if (frames > 0U) {
+        i2s_multiline_gang_commit(&gang, frames);
+        write_frames += frames;
+    }
+    return frames;
+}
+
+/*
+ * 使用前instance_num个实例初始化联动设备并启动
+ */
+hpm_stat_t gang_open(uint8_t instance_num)
+{
+    i2s_multiline_gang_config_t config = {0};
+    uint32_t i2s_mclk_hz;
+    hpm_stat_t stat;
+
+    config.instance_num = instance_num;
+    for (uint8_t i = 0; i < instance_num; i++) {
+        config.instance[i].i2s = gang_i2s[i];
+        memcpy(config.instance[i].dma_req, gang_dma_req[i], sizeof(config.instance[i].dma_req));
+        for (uint8_t l = 0; l < GANG_LINE_PER_INSTANCE; l++) {
+            config.instance[i].buffer[l] = (uint8_t *)gang_buffer[i] + l * GANG_LINE_BUF_SIZE;
+        }
+    }
+    config.dma_num = GANG_DMA_NUM;
+    config.dma[0] = GANG_XDMA;
+#ifdef GANG_HDMA
+    config.dma[1] = GANG_HDMA;
+#endif
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = GANG_ENGINE;
+    config.line_per_instance = GANG_LINE_PER_INSTANCE;
+    config.channel_per_line = GANG_CHANNEL_PER_LINE;
+    config.audio_depth = GANG_AUDIO_DEPTH;
+    config.period_num = GANG_PERIOD_NUM;
+    config.period_frames = GANG_PERIOD_FRAMES;
+    config.dma_burst = GANG_DMA_BURST;
+
+    stat = i2s_multiline_gang_init(&gang, &config);
+    if (stat != status_success) {
+        return stat;
+    }
+    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+    stat = i2s_multiline_gang_config_i2s(&gang, TEST_SAMPLE_RATE, i2s_mclk_hz, GANG_FIFO_THRESHOLD);
+    if (stat != status_success) {
+        i2s_multiline_gang_deinit(&gang);
+        return stat;
+    }
+
+    /* 启动前写满所有环 */
+    write_frames = 0;
+    while (gang_produce(instance_num) > 0U) {
+    }
+    stat = i2s_multiline_gang_start(&gang);
+    if (stat != status_success) {
+        i2s_multiline_gang_deinit(&gang);
+    }
+    return stat;
+}
+
+/*
+ * 测量并输出各数据线相对全局数据线0的偏移，返回最大偏移的绝对值
+ */
+uint32_t gang_check_skew(uint8_t instance_num, bool verbose)
+{
+    int32_t skew[I2S_MULTILINE_GANG_MAX_LINE];
+    uint32_t max_skew = 0;
+    uint32_t abs_skew;
+    hpm_stat_t stat;
+
+    stat = i2s_multiline_gang_measure_skew(&gang, skew);
+    if (stat != status_success) {
+        printf("skew measure failed: %d\n", stat);
+        return UINT32_MAX;
+    }
+    for (uint32_t line = 0; line < instance_num * GANG_LINE_PER_INSTANCE; line++) {
+        abs_skew = (uint32_t)((skew[line] < 0) ? -skew[line] : skew[line]);
+        if (abs_skew > max_skew) {
+            max_skew = abs_skew;
+        }
+        if (verbose) {
+            printf("  I2S%d line%lu: %ld samples\n", line / GANG_LINE_PER_INSTANCE, line % GANG_LINE_PER_INSTANCE,
+                   skew[line]);
+        }
+    }
+    return max_skew;
+}
+
+/*
+ * 吞吐测试：实例数从1增加到GANG_INSTANCE_NUM，每一步运行GANG_BENCH_MS，
+ * CPU占用率包含DMA中断和生产者写入测试数据的耗时
+ */
+void gang_run_bench(void)
+{
+    i2s_multiline_gang_stats_t stats;
+    uint64_t run_cycles = (uint64_t)cpu_hz * GANG_BENCH_MS / 1000U;
+    uint64_t produce_cycles;
+    uint64_t elapsed;
+    uint64_t start;
+    uint64_t t;
+    uint32_t bytes_per_s;
+    uint32_t load;
+    uint32_t skew;
+    bool skew_done;
+    uint8_t dma_channels;
+
+    printf("instances,lines,dma_channels,irq_per_s,cpu_load_pct,kbytes_per_s,underruns,fifo_underflows,resyncs,max_skew\n");
+    for (uint8_t n = 1; n <= GANG_INSTANCE_NUM; n++) {
+        if (status_success != gang_open(n)) {
+            printf("%d,%d,,,,,,,,open_failed\n", n, n * GANG_LINE_PER_INSTANCE);
+            continue;
+        }
+        dma_isr_count = 0;
+        dma_isr_cycles = 0;
+        produce_cycles = 0;
+        skew = UINT32_MAX;
+        skew_done = false;
+        start = hpm_csr_get_core_cycle();
+        while (hpm_csr_get_core_cycle() - start < run_cycles) {
+            t = hpm_csr_get_core_cycle();
+            gang_produce(n);
+            produce_cycles += hpm_csr_get_core_cycle() - t;
+            i2s_multiline_gang_task(&gang);
+            /* 运行到一半时测量一次偏移 */
+            if ((!skew_done) && (hpm_csr_get_core_cycle() - start > run_cycles / 2U)) {
+                skew = gang_check_skew(n, false);
+                skew_done = true;
+            }
+        }
+        elapsed = hpm_csr_get_core_cycle() - start;
+        i2s_multiline_gang_get_stats(&gang, &stats);
+        dma_channels = 0;
+        for (uint8_t i = 0; i < n; i++) {
+            dma_channels += gang.plan[i].channel_num;
+        }
+        i2s_multiline_gang_deinit(&gang);
+
+        load = (uint32_t)((dma_isr_cycles + produce_cycles) * 10000U / elapsed);
+        bytes_per_s = TEST_SAMPLE_RATE * GANG_CHANNEL_PER_LINE * (GANG_AUDIO_DEPTH / 8U) * GANG_LINE_PER_INSTANCE * n;
+        printf("%d,%d,%d,%lu,%lu.%02lu,%lu,%lu,%lu,%lu,%lu\n", n, n * GANG_LINE_PER_INSTANCE, dma_channels,
+               (uint32_t)((uint64_t)dma_isr_count * cpu_hz / elapsed), load / 100U, load % 100U, bytes_per_s / 1000U,
+               stats.underrun_count, stats.fifo_underflow_count, stats.resync_count, skew);
+    }
+}
+
+/*
+ * 所有实例持续播放GANG_PLAY_MS，结束时输出统计和各数据线的偏移
+ */
+void gang_run_play(void)
+{
+    i2s_multiline_gang_stats_t stats;
+    uint64_t run_cycles = (uint64_t)cpu_hz * GANG_PLAY_MS / 1000U;
+    uint64_t start;
+
+    if (status_success != gang_open(GANG_INSTANCE_NUM)) {
+        printf("gang open failed!\n");
+        return;
+    }
+    printf("playing %d lines on %d instances...\n", GANG_INSTANCE_NUM * GANG_LINE_PER_INSTANCE, GANG_INSTANCE_NUM);
+    start = hpm_csr_get_core_cycle();
+    while (hpm_csr_get_core_cycle() - start < run_cycles) {
+        gang_produce(GANG_INSTANCE_NUM);
+        if (i2s_multiline_gang_task(&gang)) {
+            printf("instance recovered, resync all instances\n");
+        }
+    }
+    printf("skew to line0:\n");
+    gang_check_skew(GANG_INSTANCE_NUM, true);
+    i2s_multiline_gang_get_stats(&gang, &stats);
+    printf("underrun: %lu, dma error: %lu, fifo underflow: %lu, recovery: %lu, resync: %lu\n",
+           stats.underrun_count, stats.dma_error_count, stats.fifo_underflow_count, stats.recovery_count,
+           stats.resync_count);
+    i2s_multiline_gang_deinit(&gang);
+}
+
+/*
+ * I2S引脚初始化函数
+ * 主设备输出MCLK/BCLK/FCLK，从设备的BCLK/FCLK需在板上连接到主设备的BCLK/FCLK，需根据实际硬件修改
+ */
+void init_i2s_gang_pin(void)
+{
+#if defined(HPM_DMA_SRC_I2S0_TX_0)
+    HPM_IOC->PAD[IOC_PAD_PD01].FUNC_CTL = IOC_PD01_FUNC_CTL_I2S0_MCLK;  /* 主时钟 */
+    HPM_IOC->PAD[IOC_PAD_PD02].FUNC_CTL = IOC_PD02_FUNC_CTL_I2S0_BCLK;  /* 位时钟 */
+    HPM_IOC->PAD[IOC_PAD_PD03].FUNC_CTL = IOC_PD03_FUNC_CTL_I2S0_FCLK;  /* 帧时钟 */
+    HPM_IOC->PAD[IOC_PAD_PD18].FUNC_CTL = IOC_PD18_FUNC_CTL_I2S0_TXD_0; /* 数据线0 */
+    HPM_IOC->PAD[IOC_PAD_PD19].FUNC_CTL = IOC_PD19_FUNC_CTL_I2S0_TXD_1; /* 数据线1 */
+    HPM_IOC->PAD[IOC_PAD_PD20].FUNC_CTL = IOC_PD20_FUNC_CTL_I2S0_TXD_2; /* 数据线2 */
+    HPM_IOC->PAD[IOC_PAD_PD21].FUNC_CTL = IOC_PD21_FUNC_CTL_I2S0_TXD_3; /* 数据线3 */
+#else
+    HPM_IOC->PAD[IOC_PAD_PB11].FUNC_CTL = IOC_PB11_FUNC_CTL_I2S0_MCLK;  /* 主时钟 */
+    HPM_IOC->PAD[IOC_PAD_PB01].FUNC_CTL = IOC_PB01_FUNC_CTL_I2S0_BCLK;  /* 位时钟 */
+    HPM_IOC->PAD[IOC_PAD_PB10].FUNC_CTL = IOC_PB10_FUNC_CTL_I2S0_FCLK;  /* 帧时钟 */
+    HPM_IOC->PAD[IOC_PAD_PB00].FUNC_CTL = IOC_PB00_FUNC_CTL_I2S0_TXD_0; /* 数据线0 */
+    HPM_IOC->PAD[IOC_PAD_PB03].FUNC_CTL = IOC_PB03_FUNC_CTL_I2S0_TXD_1; /* 数据线1 */
+    HPM_IOC->PAD[IOC_PAD_PB05].FUNC_CTL = IOC_PB05_FUNC_CTL_I2S0_TXD_2; /* 数据线2 */
+    HPM_IOC->PAD[IOC_PAD_PB02].FUNC_CTL = IOC_PB02_FUNC_CTL_I2S0_TXD_3; /* 数据线3 */
+#endif
+    /* 从设备使用板级引脚配置 */
+    for (uint8_t i = 1; i < GANG_INSTANCE_NUM; i++) {
+        board_init_i2s_pins(gang_i2s[i]);
+    }
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S multiline gang: %d instances, %d lines\n", GANG_INSTANCE_NUM, GANG_INSTANCE_NUM * GANG_LINE_PER_INSTANCE);
+
+    cpu_hz = clock_get_frequency(clock_cpu0);
+    init_i2s_gang_pin();
+
+    /* 从设备的I2S时钟同样需要配置，BCLK/FCLK来自主设备 */
+    for (uint8_t i = 0; i < GANG_INSTANCE_NUM; i++) {
+        if (board_config_i2s_clock(gang_i2s[i], TEST_SAMPLE_RATE) == 0U) {
+            printf("I2S%d clock config failed!\n", i);
+        }
+    }
+
+    if (status_success != i2s_multiline_dma_mgr_add_controller(GANG_XDMA, BOARD_APP_DMAMUX, GANG_DMA_CHANNEL_MASK)) {
+        printf("DMA controller register failed!\n");
+    }
+    intc_m_enable_irq_with_priority(GANG_XDMA_IRQ, 1);
+#ifdef GANG_HDMA
+    if (status_success != i2s_multiline_dma_mgr_add_controller(GANG_HDMA, BOARD_APP_DMAMUX, GANG_DMA_CHANNEL_MASK)) {
+        printf("DMA controller register failed!\n");
+    }
+    intc_m_enable_irq_with_priority(GANG_HDMA_IRQ, 1);
+#endif
+
+    gang_run_bench();
+    gang_run_play();
+    printf("gang demo done\n");
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
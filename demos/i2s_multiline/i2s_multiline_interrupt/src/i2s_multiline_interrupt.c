@@ -12,164 +12,204 @@
 
 #include "board.h"
 #include "hpm_i2s_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_irq.h"
+#include "i2s_multiline_tune.h"
+#include "i2s_multiline_cfg.h"
 
 /* I2S主设备配置 */
 #define I2S_MASTER               HPM_I2S0
 #define I2S_MASTER_CLOCK_NAME    clock_i2s0
 #define I2S_MASTER_IRQ           IRQn_I2S0
-#define I2S_TX_FIFO_THRESHOLD    (4)  /* I2S发送FIFO阈值设置 */
+
+/* 采样率，可设置为48000、96000、192000、384000或768000 */
+#ifndef TEST_SAMPLE_RATE
+#define TEST_SAMPLE_RATE         (96000U)
+#endif
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_FRAMES              (256U)   /* 每条数据线源数据的帧数，循环播放 */
+#ifndef TEST_PLAY_SECONDS
+#define TEST_PLAY_SECONDS        (10U)
+#endif
+#define TUNE_CHECK_MS            (1000U)  /* 自动整定检查下溢的间隔 */
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，中断引擎；无效组合在编译时报错 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, 32, 2, I2S_MULTILINE_CFG_ENGINE_IRQ, TEST_SAMPLE_RATE)
 
 /* 音频数据配置结构体 */
 typedef struct {
     uint32_t sample_rate;    /* 采样率(Hz) */
     uint8_t channel_num;     /* 通道数 (1: 单声道, 2: 立体声) */
     uint8_t audio_depth;     /* 音频位深 (16/32 bits) */
-    const uint8_t *data;     /* 音频数据缓冲区指针 */
-    uint32_t length;         /* 音频数据长度(字节) */
 } audio_data_t;
 audio_data_t audio_data;     /* 全局音频数据实例 */
 
-/* 测试数据 */
-uint32_t test_data[] = {
-  0x11111111, 0x22222222, 0x33333333, 0x44444444, 0x55555555, 0x66666666, 0x77777777, 0x88888888,
-  0x99999999, 0xAAAAAAAA, 0xBBBBBBBB, 0xCCCCCCCC, 0xDDDDDDDD, 0xEEEEEEEE, 0xFFFFFFFF, 0x5A5A5A5A,
-};
-
-/* 音频播放控制变量 */
-volatile uint32_t audio_data_index;         /* 当前播放数据索引 */
-volatile uint32_t audio_data_play_count;    /* 播放次数计数 */
-volatile bool     audio_data_play_complete; /* 播放完成标志 */
-volatile bool     i2s_tx_undeflow;         /* FIFO下溢标志 */
+/*
+ * 测试数据：每条数据线独立的双声道交织数据
+ * 高4位为数据线号+1，次4位为通道号，便于在波形上区分
+ */
+uint32_t test_data[TEST_LINE_NUM][TEST_FRAMES * 2];
 
+i2s_multiline_irq_t i2s_engine;
+i2s_multiline_tune_t i2s_tune;
 
 /*
  * I2S中断处理函数
- * 处理FIFO阈值中断，管理音频数据传输
+ * 由中断发送引擎按批填充FIFO并统计中断耗时
  */
 SDK_DECLARE_EXT_ISR_M(I2S_MASTER_IRQ, isr_i2s)
 void isr_i2s(void)
 {
-    volatile uint32_t stat = i2s_get_irq_status(I2S_MASTER);
-    int32_t data;
-
-    /* 检查发送FIFO阈值中断 */
-    /* 因为4个data line是同步的， 所以只需要判断其中一个通道的中断标志位即可 */
-    if ((stat & (1 << I2S_STA_TX_DN_SHIFT)) != 0) {
-        /* 填充FIFO直到阈值以上 */
-        for (uint8_t i = 0; i < I2S_SOC_MAX_TX_FIFO_DEPTH - I2S_TX_FIFO_THRESHOLD; i++) {
-            /* 将数据左对齐到32位寄存器 */
-            data = (*((uint32_t *)&audio_data.data[audio_data_index])) << (32 - audio_data.audio_depth);
-            /* 向4个通道发送相同的数据 */
-            i2s_send_data(I2S_MASTER, 0, data);
-            i2s_send_data(I2S_MASTER, 1, data);
-            i2s_send_data(I2S_MASTER, 2, data);
-            i2s_send_data(I2S_MASTER, 3, data);
-            audio_data_index += audio_data.audio_depth / 8;  /* 更新数据索引，按字节计算 */
-        }
-
-        /* 检查是否播放完一轮 */
-        if (audio_data_index >= audio_data.length) {
-            audio_data_index = 0;
-            audio_data_play_count++;
-        }
+    i2s_multiline_irq_handler(&i2s_engine);
+}
 
-        /* 检查是否达到指定播放次数 */
-        if (audio_data_play_count >= 10) {
-            audio_data_play_complete = true;
-            i2s_disable_irq(I2S_MASTER, i2s_tx_fifo_threshold_irq_mask);
+/*
+ * 生成测试数据
+ */
+void init_test_data(void)
+{
+    for (uint32_t line = 0; line < TEST_LINE_NUM; line++) {
+        for (uint32_t i = 0; i < TEST_FRAMES * 2; i++) {
+            test_data[line][i] = ((line + 1U) << 28) | ((i & 1U) << 24) | ((i / 2U) << 12);
         }
     }
-
-    /* 检查FIFO下溢中断 */
-    if ((stat & (I2S_STA_TX_UD_MASK << I2S_STA_TX_UD_SHIFT)) != 0) {
-        i2s_tx_undeflow = true;
-        i2s_disable_irq(I2S_MASTER, i2s_tx_fifo_threshold_irq_mask);
-    }
-
-    /* 清除所有通道的中断标志位 */
-    i2s_clear_irq_status(I2S_MASTER, stat);
 }
 
 /*
  * I2S主模式多通道配置函数
  * 配置I2S接口和传输参数
  */
-void i2s_master_multiline_config(void)
+void i2s_master_multiline_config(uint8_t fifo_threshold)
 {
-    i2s_config_t i2s_config;
-    i2s_multiline_transfer_config_t transfer;
-    uint32_t i2s_mclk_hz;
-
-    /* 配置I2S接口 */
-    i2s_get_default_config(I2S_MASTER, &i2s_config);
-    i2s_config.tx_fifo_threshold = I2S_TX_FIFO_THRESHOLD;  /* 设置发送FIFO阈值 */
-    i2s_config.enable_mclk_out = true;                     /* 使能主时钟输出 */
-    i2s_init(I2S_MASTER, &i2s_config);
-
-    /* 配置I2S传输参数 */
-    i2s_get_default_multiline_transfer_config(&transfer);
-    transfer.sample_rate = audio_data.sample_rate;         /* 设置采样率 */
-    transfer.channel_num_per_frame = 2;                    /* 每帧通道数 */
-    transfer.audio_depth = audio_data.audio_depth;         /* 设置位深 */
-    transfer.channel_length = i2s_channel_length_32_bits;  /* 通道长度 */
-    transfer.master_mode = true;                           /* 主模式 */
-    transfer.protocol = I2S_PROTOCOL_MSB_JUSTIFIED;        /* MSB对齐协议 */
-    
-    /* 使能4个发送数据线 */
-    transfer.tx_data_line_en[0] = true;
-    transfer.tx_data_line_en[1] = true;
-    transfer.tx_data_line_en[2] = true;
-    transfer.tx_data_line_en[3] = true;
-    
-    /* 配置通道槽掩码 */
-    transfer.tx_channel_slot_mask[0] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[1] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[2] = (1 << audio_data.channel_num) - 1;
-    transfer.tx_channel_slot_mask[3] = (1 << audio_data.channel_num) - 1;
-
-    /* 配置I2S数据格式 */
-    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
-    if (status_success != i2s_config_multiline_transfer(I2S_MASTER, i2s_mclk_hz, &transfer)) {
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线和时隙掩码均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, fifo_threshold)) {
         printf("I2S config failed!\n");
     }
 }
 
+/*
+ * 打印整定得到的工作点
+ */
+void print_tune_point(const i2s_multiline_tune_point_t *point)
+{
+    printf("operating point: fifo threshold %d, %d samples/line per irq, %lu irqs/s, est. cpu load %lu.%lu%%, "
+           "headroom %lu ns%s\n",
+           point->fifo_threshold, point->batch, point->irq_per_second,
+           point->cpu_load_permille / 10U, point->cpu_load_permille % 10U, point->headroom_ns,
+           point->budget_met ? "" : " (over budget)");
+}
+
+/*
+ * 按工作点配置I2S和中断发送引擎，源数据一直循环播放
+ */
+hpm_stat_t start_interrupt_engine(const i2s_multiline_tune_point_t *point)
+{
+    i2s_multiline_irq_config_t config = {0};
+    hpm_stat_t stat;
+
+    i2s_master_multiline_config(point->fifo_threshold);
+
+    config.i2s = I2S_MASTER;
+    config.line_num = TEST_LINE_NUM;
+    config.channel_per_line = audio_data.channel_num;
+    config.audio_depth = audio_data.audio_depth;
+    config.fifo_threshold = point->fifo_threshold;
+    config.frames = TEST_FRAMES;
+    config.loop_count = 0;
+    for (uint8_t line = 0; line < TEST_LINE_NUM; line++) {
+        config.line_data[line] = test_data[line];
+    }
+    stat = i2s_multiline_irq_init(&i2s_engine, &config);
+    if (status_success != stat) {
+        return stat;
+    }
+    i2s_multiline_irq_start(&i2s_engine);
+    return status_success;
+}
+
 /*
  * I2S主模式多通道中断传输测试函数
+ * FIFO阈值由整定接口按采样率计算，播放中出现下溢时自动退让到更高的阈值
  */
 void test_i2s_master_multiline_interrupt(void)
 {
-    /* 初始化控制变量 */
-    audio_data_index = 0;
-    audio_data_play_count = 0;
-    audio_data_play_complete = false;
-    i2s_tx_undeflow = false;
-
-    i2s_master_multiline_config();
+    i2s_multiline_tune_config_t tune_config = {0};
+    i2s_multiline_irq_stats_t stats;
+    uint64_t check_cycles;
+    uint64_t start;
+    uint64_t check;
+    uint64_t now;
+    uint64_t elapsed;
+    uint64_t total_cycles = 0;
+    uint32_t irq_count = 0;
+    uint32_t underflow_base = 0;    /* 之前各次启动的下溢次数，引擎重新初始化时清零 */
+
+    /* 按采样率和时隙数计算工作点 */
+    tune_config.engine = i2s_multiline_tune_irq;
+    tune_config.cpu_hz = clock_get_frequency(clock_cpu0);
+    tune_config.sample_rate = audio_data.sample_rate;
+    tune_config.line_num = TEST_LINE_NUM;
+    tune_config.channel_per_line = audio_data.channel_num;
+    if (status_success != i2s_multiline_tune_init(&i2s_tune, &tune_config)) {
+        printf("I2S tune init failed!\n");
+        return;
+    }
+    print_tune_point(i2s_multiline_tune_get_point(&i2s_tune));
 
-    /* 使能I2S中断 */
-    i2s_enable_irq(I2S_MASTER, i2s_tx_fifo_threshold_irq_mask);
+    /* 使能I2S中断并启动I2S传输 */
     intc_m_enable_irq_with_priority(I2S_MASTER_IRQ, 1);
-
-    /* 启动I2S传输 */
-    i2s_start(I2S_MASTER);
-
-    /* 等待传输完成或出错 */
-    while ((!audio_data_play_complete) && (!i2s_tx_undeflow)) {
-        __asm("nop");
+    if (status_success != start_interrupt_engine(i2s_multiline_tune_get_point(&i2s_tune))) {
+        printf("I2S interrupt engine init failed!\n");
+        return;
     }
+    check_cycles = (uint64_t)tune_config.cpu_hz * TUNE_CHECK_MS / 1000U;
+    start = hpm_csr_get_core_cycle();
+    check = start;
+
+    /* 定期检查下溢，工作点改变后按新的阈值重新启动，下溢由引擎自动恢复 */
+    do {
+        now = hpm_csr_get_core_cycle();
+        if (now - check < check_cycles) {
+            continue;
+        }
+        check = now;
+        i2s_multiline_irq_get_stats(&i2s_engine, &stats);
+        if (i2s_multiline_tune_update(&i2s_tune, underflow_base + stats.underflow_count, 0)) {
+            i2s_multiline_irq_stop(&i2s_engine);
+            i2s_multiline_irq_get_stats(&i2s_engine, &stats);
+            total_cycles += stats.total_cycles;
+            irq_count += stats.irq_count;
+            underflow_base += stats.underflow_count;
+            printf("underflow, backing off: ");
+            print_tune_point(i2s_multiline_tune_get_point(&i2s_tune));
+            if (status_success != start_interrupt_engine(i2s_multiline_tune_get_point(&i2s_tune))) {
+                printf("I2S interrupt engine init failed!\n");
+                return;
+            }
+        }
+    } while ((now - start) < (uint64_t)tune_config.cpu_hz * TEST_PLAY_SECONDS);
+    elapsed = hpm_csr_get_core_cycle() - start;
 
     /* 此时尚有数据在FIFO中未完全发出，可以等待一段时间 */
 
     /* 停止I2S传输 */
-    i2s_stop(I2S_MASTER);
-
-    /* 检查传输结果 */
-    if (i2s_tx_undeflow) {
-        printf("ERROR: I2S play undeflow\n");
-    } else {
-        printf("I2S play done\n");
-    }
+    i2s_multiline_irq_stop(&i2s_engine);
+
+    printf("I2S play done\n");
+
+    /* 中断耗时统计及CPU占用率，包含退让前的各次启动 */
+    i2s_multiline_irq_get_stats(&i2s_engine, &stats);
+    total_cycles += stats.total_cycles;
+    irq_count += stats.irq_count;
+    printf("%lu Hz: %lu irqs, isr cycles min %lu avg %lu max %lu, cpu load %lu.%02lu%%\n",
+           audio_data.sample_rate, irq_count, stats.min_cycles, stats.avg_cycles, stats.max_cycles,
+           (uint32_t)(total_cycles * 100U / elapsed), (uint32_t)(total_cycles * 10000U / elapsed % 100U));
+    printf("fifo underflows %lu, recovery cycles last %lu max %lu, %lu back-offs\n",
+           underflow_base + stats.underflow_count, stats.recovery_cycles_last, stats.recovery_cycles_max,
+           i2s_tune.backoff_count);
 }
 
 /*
@@ -178,14 +218,8 @@ void test_i2s_master_multiline_interrupt(void)
  */
 void init_i2s_multiline_pin(void)
 {
-    /* 配置I2S引脚功能 */
-    HPM_IOC->PAD[IOC_PAD_PB11].FUNC_CTL = IOC_PB11_FUNC_CTL_I2S0_MCLK;  /* 主时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB01].FUNC_CTL = IOC_PB01_FUNC_CTL_I2S0_BCLK;  /* 位时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB10].FUNC_CTL = IOC_PB10_FUNC_CTL_I2S0_FCLK;  /* 帧时钟 */
-    HPM_IOC->PAD[IOC_PAD_PB00].FUNC_CTL = IOC_PB00_FUNC_CTL_I2S0_TXD_0; /* 数据线0 */
-    HPM_IOC->PAD[IOC_PAD_PB03].FUNC_CTL = IOC_PB03_FUNC_CTL_I2S0_TXD_1; /* 数据线1 */
-    HPM_IOC->PAD[IOC_PAD_PB05].FUNC_CTL = IOC_PB05_FUNC_CTL_I2S0_TXD_2; /* 数据线2 */
-    HPM_IOC->PAD[IOC_PAD_PB02].FUNC_CTL = IOC_PB02_FUNC_CTL_I2S0_TXD_3; /* 数据线3 */
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
 }
 
 /*
@@ -198,11 +232,10 @@ int main(void)
     printf("I2S Master multiline interrupt example\n");
 
     /* 配置音频参数 */
-    audio_data.sample_rate = 48000;    /* 采样率48kHz */
-    audio_data.channel_num = 2;        /* 双声道 */
-    audio_data.audio_depth = 32;       /* 32位数据宽度 */
-    audio_data.data = (uint8_t *)test_data;
-    audio_data.length = sizeof(test_data);
+    audio_data.sample_rate = TEST_SAMPLE_RATE;  /* 采样率 */
+    audio_data.channel_num = test_cfg_channel_per_line;  /* 双声道 */
+    audio_data.audio_depth = test_cfg_audio_depth;      /* 32位数据宽度 */
+    init_test_data();
 
     /* 配置I2S时钟和引脚 */
     board_config_i2s_clock(I2S_MASTER, audio_data.sample_rate);
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多通道增益/混音矩阵的示例程序
+ * 该示例演示了在打包到DMA环之前用混音矩阵把立体声分配到4条数据线的8个声道，
+ * 每个声道带独立的增益微调，播放中途切换矩阵时增益平滑过渡
+ */
+
+#include <math.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_mix.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define TEST_I2S_TX_DMA_CHANNEL     0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_CHANNEL_NUM         (TEST_LINE_NUM * TEST_CHANNEL_PER_LINE)
+#define TEST_SOURCE_CHANNEL      (2U)
+#define TEST_SAMPLE_RATE         (48000U)
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，burst引擎 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, 32, TEST_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST, TEST_SAMPLE_RATE)
+
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#define STREAM_PLAY_SECONDS      (10U)
+
+/* 切换矩阵时的过渡时间：20ms */
+#define MIX_RAMP_FRAMES          (TEST_SAMPLE_RATE / 50U)
+
+/* 每次混音的帧数，也是性能测试的帧数 */
+#define MIX_BLOCK                (256U)
+/* 立体声源为10ms，左声道500Hz，右声道1kHz，循环播放 */
+#define SOURCE_FRAMES            (TEST_SAMPLE_RATE / 100U)
+
+/* Q31增益常量 */
+#define GAIN_0DB                 I2S_MULTILINE_MIX_UNITY
+#define GAIN_M3DB                (1520301996)   /* 0.708 */
+#define GAIN_M6DB                (1076291388)   /* 0.501 */
+
+/*
+ * 8个输出声道(数据线0~3，每条左右两个声道)的路由和增益：
+ * 前置、侧置、后置按左右分配，最后一对为左右混合的超低音
+ */
+static const int32_t mix_route[TEST_CHANNEL_NUM * TEST_SOURCE_CHANNEL] = {
+    GAIN_0DB, 0,                /* 前左 */
+    0, GAIN_0DB,                /* 前右 */
+    GAIN_M3DB, 0,               /* 侧左 */
+    0, GAIN_M3DB,               /* 侧右 */
+    GAIN_M6DB, 0,               /* 后左 */
+    0, GAIN_M6DB,               /* 后右 */
+    GAIN_M6DB, GAIN_M6DB,       /* 超低音 */
+    GAIN_M6DB, GAIN_M6DB,       /* 超低音 */
+};
+
+/* 左右互换后的矩阵，播放中途切换 */
+static const int32_t mix_swap[TEST_CHANNEL_NUM * TEST_SOURCE_CHANNEL] = {
+    0, GAIN_0DB,
+    GAIN_0DB, 0,
+    0, GAIN_M3DB,
+    GAIN_M3DB, 0,
+    0, GAIN_M6DB,
+    GAIN_M6DB, 0,
+    GAIN_M6DB, GAIN_M6DB,
+    GAIN_M6DB, GAIN_M6DB,
+};
+
+/* 立体声源数据，Q31 */
+int32_t source[TEST_SOURCE_CHANNEL][SOURCE_FRAMES];
+/* 性能测试数据 */
+int16_t bench_in_q15[TEST_CHANNEL_NUM][MIX_BLOCK];
+int16_t bench_out_q15[TEST_CHANNEL_NUM][MIX_BLOCK];
+int32_t bench_in_q31[TEST_CHANNEL_NUM][MIX_BLOCK];
+/* 混音输出，再由打包接口写入环中 */
+int32_t mixed[TEST_CHANNEL_NUM][MIX_BLOCK];
+
+i2s_multiline_mix_t mix;
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                           TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进和错误统计
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+}
+
+/*
+ * 生成源数据和性能测试数据
+ */
+void init_source(void)
+{
+    for (uint32_t i = 0; i < SOURCE_FRAMES; i++) {
+        source[0][i] = (int32_t)(0.5 * 2147483647.0 * sin(2.0 * M_PI * 500.0 * i / TEST_SAMPLE_RATE));
+        source[1][i] = (int32_t)(0.5 * 2147483647.0 * sin(2.0 * M_PI * 1000.0 * i / TEST_SAMPLE_RATE));
+    }
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < MIX_BLOCK; i++) {
+            bench_in_q31[ch][i] = source[ch & 1U][i];
+            bench_in_q15[ch][i] = (int16_t)(source[ch & 1U][i] >> 16);
+        }
+    }
+}
+
+/*
+ * 测量一次混音处理MIX_BLOCK帧的每帧周期数
+ */
+void benchmark_one(const char *name, i2s_multiline_mix_format_t format, uint8_t in_num, const int32_t *matrix)
+{
+    i2s_multiline_mix_config_t config;
+    const void *in[TEST_CHANNEL_NUM];
+    void *out[TEST_CHANNEL_NUM];
+    uint64_t start;
+    uint32_t cycles;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        in[ch] = (format == i2s_multiline_mix_q15) ? (const void *)bench_in_q15[ch] : (const void *)bench_in_q31[ch];
+        out[ch] = (format == i2s_multiline_mix_q15) ? (void *)bench_out_q15[ch] : (void *)mixed[ch];
+    }
+
+    config.format = format;
+    config.in_num = in_num;
+    config.out_num = TEST_CHANNEL_NUM;
+    config.ramp_frames = 0;
+    i2s_multiline_mix_init(&mix, &config);
+    if (matrix != NULL) {
+        i2s_multiline_mix_set_matrix(&mix, matrix);
+    }
+
+    /* 先运行一次预热缓存，再计时 */
+    i2s_multiline_mix_process(&mix, in, out, MIX_BLOCK);
+    start = hpm_csr_get_core_cycle();
+    i2s_multiline_mix_process(&mix, in, out, MIX_BLOCK);
+    cycles = (uint32_t)(hpm_csr_get_core_cycle() - start);
+    printf("mix %s %-14s: %lu.%02lu cycles/frame\n", (format == i2s_multiline_mix_q15) ? "q15" : "q31", name,
+           cycles / MIX_BLOCK, (cycles % MIX_BLOCK) * 100U / MIX_BLOCK);
+}
+
+/*
+ * 混音性能测试：单位阵(零拷贝)、立体声到8声道的路由、8x8满矩阵
+ */
+void benchmark_mix(void)
+{
+    static int32_t dense[TEST_CHANNEL_NUM * TEST_CHANNEL_NUM];
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(dense); i++) {
+        dense[i] = I2S_MULTILINE_MIX_UNITY / TEST_CHANNEL_NUM;
+    }
+    for (uint8_t f = i2s_multiline_mix_q15; f <= i2s_multiline_mix_q31; f++) {
+        benchmark_one("identity 8x8", (i2s_multiline_mix_format_t)f, TEST_CHANNEL_NUM, NULL);
+        benchmark_one("route 2->8", (i2s_multiline_mix_format_t)f, TEST_SOURCE_CHANNEL, mix_route);
+        benchmark_one("dense 8x8", (i2s_multiline_mix_format_t)f, TEST_CHANNEL_NUM, dense);
+    }
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线、时隙掩码和FIFO阈值均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, test_cfg_fifo_threshold)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 播放：立体声源 -> 混音矩阵 -> 打包到环中，播放到一半时左右互换
+ */
+void test_i2s_master_multiline_mix(void)
+{
+    hpm_stat_t stat;
+    i2s_multiline_mix_config_t mix_config;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    i2s_multiline_pack_config_t pack_config;
+    i2s_multiline_pack_t pack;
+    const void *in[TEST_SOURCE_CHANNEL];
+    void *out[TEST_CHANNEL_NUM];
+    const void *const *pack_src;
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t source_pos = 0;
+    uint32_t total_frames = TEST_SAMPLE_RATE * STREAM_PLAY_SECONDS;
+    uint32_t written_frames = 0;
+    bool swapped = false;
+    uint32_t n;
+
+    i2s_master_multiline_config();
+
+    mix_config.format = i2s_multiline_mix_q31;
+    mix_config.in_num = TEST_SOURCE_CHANNEL;
+    mix_config.out_num = TEST_CHANNEL_NUM;
+    mix_config.ramp_frames = MIX_RAMP_FRAMES;
+    stat = i2s_multiline_mix_init(&mix, &mix_config);
+    if (status_success != stat) {
+        printf("mix init failed!\n");
+        return;
+    }
+    i2s_multiline_mix_set_matrix(&mix, mix_route);
+
+    pack_config.format = i2s_multiline_pack_s32;
+    pack_config.line_num = TEST_LINE_NUM;
+    pack_config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    pack_config.valid_bits = 0;
+    pack_config.broadcast = false;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        out[ch] = mixed[ch];
+    }
+
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    config.audio_depth = test_cfg_audio_depth;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = STREAM_PERIOD_FRAMES;
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        if ((!swapped) && (written_frames >= total_frames / 2U)) {
+            /* 切换矩阵，在MIX_RAMP_FRAMES帧内平滑过渡 */
+            i2s_multiline_mix_set_matrix(&mix, mix_swap);
+            swapped = true;
+        }
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n > MIX_BLOCK) {
+            n = MIX_BLOCK;
+        }
+        if (n > SOURCE_FRAMES - source_pos) {
+            n = SOURCE_FRAMES - source_pos;
+        }
+        if (n > 0U) {
+            in[0] = source[0] + source_pos;
+            in[1] = source[1] + source_pos;
+            pack_src = i2s_multiline_mix_process(&mix, in, out, n);
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], pack_src, 0, n);
+            i2s_multiline_stream_commit(&i2s_stream, n);
+            source_pos = (source_pos + n) % SOURCE_FRAMES;
+            written_frames += n;
+        }
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&i2s_stream);
+            if (status_success != stat) {
+                printf("I2S stream start failed!\n");
+                return;
+            }
+        }
+    }
+
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S play done: 2 -> %u channels, %lu frames, %lu underruns\n",
+           TEST_CHANNEL_NUM, written_frames, stats.underrun_count);
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline mix example\n");
+
+    init_source();
+
+    /* 混音性能测试 */
+    benchmark_mix();
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, TEST_SAMPLE_RATE);
+    init_i2s_multiline_pin();
+
+    /* 执行带混音矩阵的I2S多通道播放 */
+    test_i2s_master_multiline_mix();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * I2S多数据线定时播放示例
+ * 在mchtmr的整秒时刻启动4条数据线的同步发送，播放期间输出各周期的呈现时间戳、
+ * I2S帧序号与mchtmr的对应关系和采样时钟漂移，并在预定的mchtmr时刻准确结束
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_mchtmr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_sched.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+#define TEST_I2S_TX_DMA_CHANNEL   0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_SAMPLE_RATE         (48000U)
+#define TEST_AUDIO_DEPTH         (32U)
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，burst引擎 */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, TEST_AUDIO_DEPTH, TEST_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         TEST_SAMPLE_RATE)
+
+/* 流式发送配置：4个周期，每周期256帧 */
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+
+/* 启动时刻：至少SCHED_LEAD_MS之后的mchtmr整秒；播放时长 */
+#define SCHED_LEAD_MS            (500U)
+#define SCHED_PLAY_SECONDS       (10U)
+/* 开头输出呈现时间戳的周期数 */
+#define SCHED_PTS_PRINT_NUM      (4U)
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                           TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+i2s_multiline_sched_t i2s_sched;
+
+/* 开头几个周期的呈现时间戳，由周期回调记录 */
+volatile uint64_t pts_log[SCHED_PTS_PRINT_NUM];
+
+uint32_t write_frames;  /* 已写入的帧数 */
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进，整周期时调度接口给出呈现时间戳
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+}
+
+/*
+ * 呈现时间戳回调函数
+ * 在DMA中断上下文中调用
+ */
+void sched_pts_callback(i2s_multiline_sched_t *sched, uint32_t period, uint64_t pts, void *user_data)
+{
+    (void)sched;
+    (void)user_data;
+    if (period < SCHED_PTS_PRINT_NUM) {
+        pts_log[period] = pts;
+    }
+}
+
+/*
+ * 写入测试数据，最多写到end_frame为止，返回写入的帧数
+ * 高8位为数据线号+1，次4位为时隙号，低20位为帧序号
+ */
+uint32_t produce(uint32_t end_frame)
+{
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t *ring;
+    uint32_t n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+
+    if (n > end_frame - write_frames) {
+        n = end_frame - write_frames;
+    }
+    ring = (uint32_t *)ring_ptr[0];
+    for (uint32_t f = 0; f < n; f++) {
+        for (uint32_t s = 0; s < TEST_CHANNEL_PER_LINE; s++) {
+            for (uint32_t l = 0; l < TEST_LINE_NUM; l++) {
+                *ring++ = ((l + 1U) << 24) | (s << 20) | ((write_frames + f) & 0xFFFFFU);
+            }
+        }
+    }
+    if (n > 0U) {
+        i2s_multiline_stream_commit(&i2s_stream, n);
+        write_frames += n;
+    }
+    return n;
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线、时隙掩码和FIFO阈值均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, test_cfg_fifo_threshold)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 定时播放测试函数
+ */
+void test_i2s_multiline_sched(void)
+{
+    hpm_stat_t stat;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_sched_config_t sched_config = {0};
+    i2s_multiline_sched_point_t point;
+    i2s_multiline_stream_stats_t stats;
+    uint32_t mchtmr_hz = clock_get_frequency(clock_mchtmr0);
+    uint32_t ticks_per_us = mchtmr_hz / 1000000U;
+    uint64_t start_tick;
+    uint64_t stop_tick;
+    uint64_t next_report;
+    uint32_t end_frame;
+
+    /* 配置流式发送接口：一个DMA通道，burst模式写入4条数据线 */
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    config.audio_depth = TEST_AUDIO_DEPTH;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = STREAM_PERIOD_FRAMES;
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+
+    sched_config.mchtmr = HPM_MCHTMR;
+    sched_config.mchtmr_hz = mchtmr_hz;
+    sched_config.sample_rate = TEST_SAMPLE_RATE;
+    sched_config.pts_cb = sched_pts_callback;
+    stat = i2s_multiline_sched_init(&i2s_sched, &i2s_stream, &sched_config);
+    if (status_success != stat) {
+        printf("I2S sched init failed!\n");
+        return;
+    }
+
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    /* 启动前写满整个环 */
+    write_frames = 0;
+    while (produce(UINT32_MAX) > 0U) {
+    }
+
+    /* 多块板的mchtmr同步后，选择同一个整秒时刻即可同时开始播放 */
+    start_tick = i2s_multiline_sched_now(&i2s_sched) + i2s_multiline_sched_us_to_tick(&i2s_sched, SCHED_LEAD_MS * 1000U);
+    start_tick = (start_tick / mchtmr_hz + 1U) * mchtmr_hz;
+    stop_tick = start_tick + (uint64_t)mchtmr_hz * SCHED_PLAY_SECONDS;
+    stat = i2s_multiline_sched_start_at(&i2s_sched, start_tick);
+    if (status_success != stat) {
+        printf("I2S scheduled start failed: %d\n", stat);
+        return;
+    }
+    printf("started at mchtmr %lu s, error %ld ticks (%ld ns)\n", (uint32_t)(start_tick / mchtmr_hz),
+           i2s_sched.start_error, (int32_t)((int64_t)i2s_sched.start_error * 1000 / (int32_t)ticks_per_us));
+
+    /* 结束时刻换算为帧序号，生产者只写到该帧为止 */
+    end_frame = i2s_multiline_sched_tick_to_frame(&i2s_sched, stop_tick);
+    next_report = start_tick + mchtmr_hz;
+    while (i2s_multiline_sched_now(&i2s_sched) < stop_tick) {
+        i2s_multiline_stream_task(&i2s_stream);
+        /* 采样时钟漂移，结束帧随之修正 */
+        end_frame = i2s_multiline_sched_tick_to_frame(&i2s_sched, stop_tick);
+        if (write_frames < end_frame) {
+            produce(end_frame);
+        }
+        if (i2s_multiline_sched_now(&i2s_sched) >= next_report) {
+            next_report += mchtmr_hz;
+            if (status_success == i2s_multiline_sched_correlate(&i2s_sched, &point)) {
+                printf("t=%lu us: frame %lu, drift %ld ppb\n", (uint32_t)((point.tick - start_tick) / ticks_per_us),
+                       (uint32_t)(point.samples / TEST_CHANNEL_PER_LINE), i2s_multiline_sched_get_drift_ppb(&i2s_sched));
+            }
+        }
+    }
+
+    /* 数据在结束时刻前已全部写入，其后插入的静音不计为欠载 */
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    for (uint32_t i = 0; i < SCHED_PTS_PRINT_NUM; i++) {
+        printf("period %lu pts: +%lu us\n", i, (uint32_t)((pts_log[i] - start_tick) / ticks_per_us));
+    }
+    printf("last frame %lu scheduled at +%lu us\n", end_frame - 1U,
+           (uint32_t)((i2s_multiline_sched_frame_to_tick(&i2s_sched, end_frame - 1U) - start_tick) / ticks_per_us));
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S sched done: %lu frames, %lu periods, %lu underruns, %lu recoveries, %lu measure failures\n",
+           write_frames, i2s_sched.period_count, stats.underrun_count, stats.recovery_count,
+           i2s_sched.measure_fail_count);
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline scheduled playback example\n");
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, TEST_SAMPLE_RATE);
+    init_i2s_multiline_pin();
+    i2s_master_multiline_config();
+
+    /* 执行定时播放测试 */
+    test_i2s_multiline_sched();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多通道采样率转换的示例程序
+ * 该示例演示了在多数据线I2S发送之前使用Q31多相采样率转换，
+ * 将44.1k、32k或16k的8声道源转换为48k，再打包到burst DMA环形缓冲区中播放
+ */
+
+#include <math.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_src.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define TEST_I2S_TX_DMA_CHANNEL     0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_CHANNEL_PER_LINE    (2U)
+#define TEST_CHANNEL_NUM         (TEST_LINE_NUM * TEST_CHANNEL_PER_LINE)
+
+/* I2S输出采样率 */
+#define TEST_OUTPUT_RATE         (48000U)
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，burst引擎，按输出采样率配置I2S */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, 32, TEST_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST, TEST_OUTPUT_RATE)
+
+/* 源采样率：44100、32000或16000 */
+#ifndef TEST_SOURCE_RATE
+#define TEST_SOURCE_RATE         (44100U)
+#endif
+
+/* 播放使用的质量档位 */
+#ifndef TEST_SRC_QUALITY
+#define TEST_SRC_QUALITY         i2s_multiline_src_quality_medium
+#endif
+
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_PERIOD_FRAMES     (256U)
+#define STREAM_PLAY_SECONDS      (10U)
+
+/* 源数据为20ms，包含各声道整数个周期，循环播放，最多44100 / 50帧 */
+#define SOURCE_MAX_FRAMES        (882U)
+/* 每次转换输出的帧数 */
+#define SRC_OUT_BLOCK            (128U)
+
+/* 平面源数据，声道ch为(ch + 1) * 200Hz的正弦波 */
+int32_t source[TEST_CHANNEL_NUM][SOURCE_MAX_FRAMES];
+/* 转换输出，再由打包接口写入环中 */
+int32_t converted[TEST_CHANNEL_NUM][SRC_OUT_BLOCK];
+
+i2s_multiline_src_t src;
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, STREAM_PERIOD_FRAMES,
+                                                           TEST_LINE_NUM, TEST_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进和错误统计
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+}
+
+/*
+ * 生成平面源数据，返回帧数
+ */
+uint32_t init_source(uint32_t rate)
+{
+    uint32_t frames = rate / 50U;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        for (uint32_t i = 0; i < frames; i++) {
+            source[ch][i] = (int32_t)(0.5 * 2147483647.0 * sin(2.0 * M_PI * (ch + 1U) * 200U * i / rate));
+        }
+    }
+    return frames;
+}
+
+/*
+ * 采样率转换性能测试：各质量档位和源采样率下，每个输出帧每个声道消耗的CPU周期数
+ */
+void benchmark_src(void)
+{
+    static const uint32_t rates[] = {44100, 32000, 16000};
+    static const char *const quality_name[] = {"low", "medium", "high"};
+    i2s_multiline_src_config_t config;
+    const int32_t *in[TEST_CHANNEL_NUM];
+    int32_t *out[TEST_CHANNEL_NUM];
+    uint32_t in_frames;
+    uint32_t out_frames;
+    uint64_t start;
+    uint32_t cycles;
+
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        in[ch] = source[ch];
+        out[ch] = converted[ch];
+    }
+
+    config.out_rate = TEST_OUTPUT_RATE;
+    config.channel_num = TEST_CHANNEL_NUM;
+    for (uint8_t q = i2s_multiline_src_quality_low; q <= i2s_multiline_src_quality_high; q++) {
+        for (uint8_t r = 0; r < ARRAY_SIZE(rates); r++) {
+            config.in_rate = rates[r];
+            config.quality = (i2s_multiline_src_quality_t)q;
+            init_source(rates[r]);
+            i2s_multiline_src_init(&src, &config);
+            /* 先填满历史缓冲区，再计时 */
+            in_frames = SOURCE_MAX_FRAMES;
+            i2s_multiline_src_process(&src, in, &in_frames, out, SRC_OUT_BLOCK);
+            in_frames = SOURCE_MAX_FRAMES;
+            start = hpm_csr_get_core_cycle();
+            out_frames = i2s_multiline_src_process(&src, in, &in_frames, out, SRC_OUT_BLOCK);
+            cycles = (uint32_t)(hpm_csr_get_core_cycle() - start);
+            printf("src %-6s %5lu -> %lu Hz: %lu.%02lu cycles/frame/channel\n",
+                   quality_name[q], rates[r], TEST_OUTPUT_RATE,
+                   cycles / (out_frames * TEST_CHANNEL_NUM),
+                   (cycles % (out_frames * TEST_CHANNEL_NUM)) * 100U / (out_frames * TEST_CHANNEL_NUM));
+        }
+    }
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线、时隙掩码和FIFO阈值均来自编译期配置 */
+    if (status_success != test_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, test_cfg_fifo_threshold)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 播放：源数据 -> 采样率转换 -> 打包到环中
+ */
+void test_i2s_master_multiline_src(void)
+{
+    hpm_stat_t stat;
+    i2s_multiline_src_config_t src_config;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    i2s_multiline_pack_config_t pack_config;
+    i2s_multiline_pack_t pack;
+    const void *pack_src[TEST_CHANNEL_NUM];
+    const int32_t *in[TEST_CHANNEL_NUM];
+    int32_t *out[TEST_CHANNEL_NUM];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t source_frames = init_source(TEST_SOURCE_RATE);
+    uint32_t source_pos = 0;
+    uint32_t total_frames = TEST_OUTPUT_RATE * STREAM_PLAY_SECONDS;
+    uint32_t written_frames = 0;
+    uint32_t in_frames;
+    uint32_t n;
+
+    i2s_master_multiline_config();
+
+    src_config.in_rate = TEST_SOURCE_RATE;
+    src_config.out_rate = TEST_OUTPUT_RATE;
+    src_config.channel_num = TEST_CHANNEL_NUM;
+    src_config.quality = TEST_SRC_QUALITY;
+    stat = i2s_multiline_src_init(&src, &src_config);
+    if (status_success != stat) {
+        printf("SRC init failed!\n");
+        return;
+    }
+
+    pack_config.format = i2s_multiline_pack_s32;
+    pack_config.line_num = TEST_LINE_NUM;
+    pack_config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    pack_config.valid_bits = 0;
+    pack_config.broadcast = false;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+        pack_src[ch] = converted[ch];
+        out[ch] = converted[ch];
+    }
+
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = TEST_CHANNEL_PER_LINE;
+    config.audio_depth = test_cfg_audio_depth;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = STREAM_PERIOD_FRAMES;
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n > SRC_OUT_BLOCK) {
+            n = SRC_OUT_BLOCK;
+        }
+        if (n > 0U) {
+            /* 转换输出n帧，源数据循环使用 */
+            for (uint32_t ch = 0; ch < TEST_CHANNEL_NUM; ch++) {
+                in[ch] = source[ch] + source_pos;
+            }
+            in_frames = source_frames - source_pos;
+            n = i2s_multiline_src_process(&src, in, &in_frames, out, n);
+            source_pos = (source_pos + in_frames) % source_frames;
+
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], pack_src, 0, n);
+            i2s_multiline_stream_commit(&i2s_stream, n);
+            written_frames += n;
+        }
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&i2s_stream);
+            if (status_success != stat) {
+                printf("I2S stream start failed!\n");
+                return;
+            }
+        }
+    }
+
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("I2S play done: %lu Hz -> %lu Hz, %lu frames, %lu underruns\n",
+           TEST_SOURCE_RATE, TEST_OUTPUT_RATE, written_frames, stats.underrun_count);
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline SRC example\n");
+
+    /* 采样率转换性能测试 */
+    benchmark_src();
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, TEST_OUTPUT_RATE);
+    init_i2s_multiline_pin();
+
+    /* 执行带采样率转换的I2S多通道播放 */
+    test_i2s_master_multiline_src();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
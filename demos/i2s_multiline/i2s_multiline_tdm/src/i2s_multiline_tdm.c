@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多通道TDM传输的示例程序
+ * 该示例演示了每条数据线2、4、8、16个时隙的TDM发送，4条数据线最多64个通道，
+ * 并测试各时隙数下可持续播放的最高采样率
+ * FIFO阈值、时隙长度和DMA环的周期帧数由TDM配置接口根据数据速率自动计算
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_pack.h"
+#include "i2s_multiline_tdm.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define TEST_I2S_TX_DMA_CHANNEL     0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+#define TEST_LINE_NUM            (4U)
+#define TEST_MAX_CHANNEL         (TEST_LINE_NUM * I2S_MULTILINE_TDM_MAX_SLOT)
+#define TEST_AUDIO_DEPTH         (16U)
+
+/* 每个采样率的测试时长 */
+#define TEST_TRIAL_MS            (1000U)
+
+/* DMA环：4个周期，周期帧数随每帧的数据量自动调整 */
+#define STREAM_PERIOD_NUM        (4U)
+#define STREAM_RING_BYTES        (32U * 1024U)
+
+/* 平面测试数据的帧数，循环播放 */
+#define PLANAR_FRAMES            (64U)
+
+/* 参与测试的时隙数和采样率，采样率从高到低测试 */
+static const uint8_t test_slot_num[] = {2, 4, 8, 16};
+static const uint32_t test_sample_rate[] = {192000, 96000, 48000};
+
+/*
+ * 编译期配置只描述最宽的测试点(4条数据线，16位，每条数据线16个时隙，burst引擎)，在编译时检查芯片能否运行，并提供引脚；
+ * 时隙数和采样率在运行时逐点变化，I2S由i2s_multiline_tdm按每个测试点的布局配置
+ */
+I2S_MULTILINE_CFG_DEFINE(test_cfg, TEST_LINE_NUM, TEST_AUDIO_DEPTH, I2S_MULTILINE_TDM_MAX_SLOT,
+                         I2S_MULTILINE_CFG_ENGINE_BURST, 192000)
+
+/*
+ * 平面测试数据：每个声道一个独立缓冲区，声道编号为 line * channel_per_line + slot
+ * 高4位为声道号的低4位，低位为帧序号
+ */
+int16_t planar_s16[TEST_MAX_CHANNEL][PLANAR_FRAMES];
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) uint32_t stream_buffer[STREAM_RING_BYTES / sizeof(uint32_t)];
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进和错误统计
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+}
+
+/*
+ * 生成平面测试数据
+ */
+void init_planar_data(void)
+{
+    for (uint32_t ch = 0; ch < TEST_MAX_CHANNEL; ch++) {
+        for (uint32_t i = 0; i < PLANAR_FRAMES; i++) {
+            planar_s16[ch][i] = (int16_t)(((ch & 0xFU) << 12) | i);
+        }
+    }
+}
+
+/*
+ * 以指定时隙数和采样率播放TEST_TRIAL_MS，无欠载、FIFO下溢和DMA错误时认为可持续
+ */
+bool run_trial(uint8_t slot_num, uint32_t sample_rate)
+{
+    hpm_stat_t stat;
+    i2s_multiline_tdm_config_t tdm_config = {0};
+    i2s_multiline_tdm_layout_t layout;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    i2s_multiline_pack_config_t pack_config;
+    i2s_multiline_pack_t pack;
+    const void *src[TEST_MAX_CHANNEL];
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t total_frames = sample_rate / 1000U * TEST_TRIAL_MS;
+    uint32_t written_frames = 0;
+    uint32_t src_frame = 0;
+    uint32_t pack_cycles = 0;
+    uint32_t start_cycle;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t n;
+
+    board_config_i2s_clock(I2S_MASTER, sample_rate);
+
+    /* 计算布局：全部时隙使能 */
+    tdm_config.mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+    tdm_config.sample_rate = sample_rate;
+    tdm_config.line_num = TEST_LINE_NUM;
+    tdm_config.slot_num = slot_num;
+    tdm_config.audio_depth = TEST_AUDIO_DEPTH;
+    tdm_config.master_mode = true;
+    tdm_config.tx_enable = true;
+    stat = i2s_multiline_tdm_get_layout(&tdm_config, &layout);
+    if (status_success != stat) {
+        printf("  %6lu Hz: bclk not reachable from mclk %lu Hz\n", sample_rate, tdm_config.mclk_hz);
+        return false;
+    }
+    stat = i2s_multiline_tdm_init(I2S_MASTER, &tdm_config, &layout);
+    if (status_success != stat) {
+        printf("  %6lu Hz: I2S config failed!\n", sample_rate);
+        return false;
+    }
+
+    pack_config.format = i2s_multiline_pack_s16;
+    pack_config.line_num = TEST_LINE_NUM;
+    pack_config.channel_per_line = layout.tx_channel_per_line;
+    pack_config.valid_bits = 0;
+    pack_config.broadcast = false;
+    i2s_multiline_pack_init(&pack, &pack_config);
+    for (uint32_t ch = 0; ch < (uint32_t)TEST_LINE_NUM * layout.tx_channel_per_line; ch++) {
+        src[ch] = planar_s16[ch];
+    }
+
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = TEST_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = layout.tx_channel_per_line;
+    config.audio_depth = TEST_AUDIO_DEPTH;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = i2s_multiline_tdm_period_frames(TEST_LINE_NUM, layout.tx_channel_per_line,
+                                                           sizeof(stream_buffer), STREAM_PERIOD_NUM);
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("  %6lu Hz: I2S stream init failed!\n", sample_rate);
+        return false;
+    }
+
+    /* 先预填充整个环再启动，之后持续打包 */
+    start = 0;
+    while (written_frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n > PLANAR_FRAMES - src_frame) {
+            n = PLANAR_FRAMES - src_frame;
+        }
+        if (n > 0U) {
+            start_cycle = read_csr(CSR_MCYCLE);
+            i2s_multiline_pack(&pack, (uint32_t *)ring_ptr[0], src, src_frame, n);
+            pack_cycles += read_csr(CSR_MCYCLE) - start_cycle;
+            i2s_multiline_stream_commit(&i2s_stream, n);
+            src_frame = (src_frame + n) % PLANAR_FRAMES;
+            written_frames += n;
+        }
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            i2s_multiline_stream_start(&i2s_stream);
+            start = hpm_csr_get_core_cycle();
+            pack_cycles = 0;
+        }
+    }
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        __asm("nop");
+    }
+    elapsed = hpm_csr_get_core_cycle() - start;
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("  %6lu Hz: %2lu-bit slots, bclk %lu Hz, %lu frames/period, fifo threshold %u (%lu ns), "
+           "pack cpu %lu%%, underruns %lu, fifo underflows %lu, dma errors %lu\n",
+           sample_rate, (layout.channel_length == i2s_channel_length_32_bits) ? 32U : 16U, layout.bclk_hz,
+           config.period_frames, layout.tx_fifo_threshold, layout.tx_headroom_ns,
+           (uint32_t)((uint64_t)pack_cycles * 100U / elapsed),
+           stats.underrun_count, stats.fifo_underflow_count, stats.dma_error_count);
+
+    return (stats.underrun_count == 0U) && (stats.fifo_underflow_count == 0U) && (stats.dma_error_count == 0U);
+}
+
+/*
+ * 各时隙数下从高到低测试采样率，打印可持续播放的最高采样率
+ */
+void benchmark_tdm(void)
+{
+    uint32_t max_rate[ARRAY_SIZE(test_slot_num)] = {0};
+
+    /* 使能DMA中断 */
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    for (uint8_t s = 0; s < ARRAY_SIZE(test_slot_num); s++) {
+        printf("TDM%u, %lu channels:\n", test_slot_num[s], TEST_LINE_NUM * test_slot_num[s]);
+        for (uint8_t r = 0; r < ARRAY_SIZE(test_sample_rate); r++) {
+            if (run_trial(test_slot_num[s], test_sample_rate[r])) {
+                max_rate[s] = test_sample_rate[r];
+                break;
+            }
+        }
+    }
+
+    printf("\nslots  channels  max sample rate\n");
+    for (uint8_t s = 0; s < ARRAY_SIZE(test_slot_num); s++) {
+        printf("%5u  %8lu  %lu Hz\n", test_slot_num[s], TEST_LINE_NUM * test_slot_num[s], max_rate[s]);
+    }
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    test_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline TDM example\n");
+
+    init_planar_data();
+    init_i2s_multiline_pin();
+
+    /* 执行各时隙数的最高采样率测试 */
+    benchmark_tdm();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
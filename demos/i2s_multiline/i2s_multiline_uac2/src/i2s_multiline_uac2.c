@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个USB Audio Class 2.0声卡的示例程序
+ * 该示例演示了把主机的8声道等时流通过异步反馈端点同步到I2S本地时钟，
+ * 并以burst DMA输出到4条数据线，周期打印缓冲量、延迟和反馈值
+ */
+
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "usb_audio_bridge.h"
+
+#define STATS_INTERVAL_S         (5U)  /* 统计打印间隔 */
+
+void init_i2s_multiline_pin(void);
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，数据线数由桥接的编译期配置决定 */
+    usb_audio_bridge_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    uint64_t stats_cycles;
+    uint64_t next_stats;
+
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S Master multiline USB Audio Class 2.0 example\n");
+
+    /* 配置I2S引脚，I2S时钟在主机选择采样率后配置 */
+    init_i2s_multiline_pin();
+
+    usb_audio_bridge_init();
+
+    stats_cycles = (uint64_t)clock_get_frequency(clock_cpu0) * STATS_INTERVAL_S;
+    next_stats = hpm_csr_get_core_cycle() + stats_cycles;
+
+    /* 主循环：处理流的打开、关闭，并周期打印统计 */
+    while (1) {
+        usb_audio_bridge_task();
+        if (hpm_csr_get_core_cycle() >= next_stats) {
+            next_stats += stats_cycles;
+            usb_audio_bridge_print_stats();
+        }
+    }
+
+    return 0;
+}
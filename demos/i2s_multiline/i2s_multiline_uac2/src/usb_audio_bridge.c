@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * USB Audio Class 2.0 8声道声卡到4数据线I2S的桥接
+ *
+ * 等时OUT端点为异步模式，收到的交织帧直接重排到burst DMA环中。
+ * 反馈端点的值由i2s_multiline_feedback根据I2S DMA的消耗速率和环中数据量计算，
+ * 主机据此调整每个微帧的帧数，使环中数据量稳定在目标值。
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "usbd_core.h"
+#include "usbd_audio.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_feedback.h"
+#include "i2s_multiline_cfg.h"
+#include "usb_audio_bridge.h"
+
+#ifndef CONFIG_USB_HS
+#error "8 channels of 32-bit subslots need a high-speed USB device"
+#endif
+
+/* DMA配置相关定义 */
+#define BRIDGE_I2S_DMA              HPM_XDMA
+#define BRIDGE_I2S_DMA_IRQ          IRQn_XDMA
+#define BRIDGE_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define BRIDGE_DMA_CHANNEL_MASK     (0x000000FFUL)  /* 允许资源管理器分配的DMA通道 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER                  HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME       clock_i2s0
+
+#define BRIDGE_LINE_NUM             (4U)
+#define BRIDGE_CHANNEL_PER_LINE     (2U)
+#define BRIDGE_CHANNEL_NUM          (BRIDGE_LINE_NUM * BRIDGE_CHANNEL_PER_LINE)
+
+/* 环：4个周期，每个周期1ms */
+#define BRIDGE_PERIOD_NUM           (4U)
+#define BRIDGE_MAX_PERIOD_FRAMES    (AUDIO_MAX_RATE / 1000U)
+/* 目标缓冲量为周期的百分比，需大于一个周期以覆盖半周期检查前的包到达抖动 */
+#define BRIDGE_TARGET_FILL_PERCENT  (175U)
+
+/* USB音频描述符相关定义 */
+#define AUDIO_OUT_EP                0x01
+#define AUDIO_FB_EP                 0x81
+#define AUDIO_CLOCK_ID              0x01
+#define AUDIO_INPUT_TERMINAL_ID     0x02
+#define AUDIO_OUTPUT_TERMINAL_ID    0x03
+
+#define AUDIO_DEFAULT_RATE          (48000U)
+#define AUDIO_MAX_RATE              (96000U)
+#define AUDIO_SUBSLOT_SIZE          (4U)
+#define AUDIO_BIT_RESOLUTION        (24U)
+#define AUDIO_FRAME_BYTES           (BRIDGE_CHANNEL_NUM * AUDIO_SUBSLOT_SIZE)
+/* 每个微帧最多比标称值多1帧 */
+#define AUDIO_OUT_PACKET_MAX        ((AUDIO_MAX_RATE / 8000U + 1U) * AUDIO_FRAME_BYTES)
+#define AUDIO_FB_PACKET             (4U)
+/* 反馈端点间隔2^(4-1)个微帧，即1ms */
+#define AUDIO_FB_INTERVAL           0x04
+
+/* 编译期配置：4条数据线，32位，每条数据线2个时隙，burst引擎；采样率由主机选择，FIFO阈值按最高采样率计算 */
+I2S_MULTILINE_CFG_DEFINE(bridge_cfg, BRIDGE_LINE_NUM, 32, BRIDGE_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         AUDIO_MAX_RATE)
+
+/* 7.1声道：FL FR FC LFE BL BR SL SR，依次映射到数据线0~3的左右声道 */
+#define AUDIO_CHANNEL_CONFIG        0x0000063F
+
+#define AUDIO_AC_SIZE               (9 + 8 + 17 + 12)
+#define AUDIO_AS_SIZE               (9 + 9 + 16 + 6 + 7 + 8 + 7)
+#define USB_AUDIO_CONFIG_SIZE       (9 + 8 + 9 + AUDIO_AC_SIZE + AUDIO_AS_SIZE)
+
+const uint8_t audio_v2_descriptor[] = {
+    USB_DEVICE_DESCRIPTOR_INIT(USB_2_0, 0xEF, 0x02, 0x01, USBD_VID, USBD_PID, 0x0100, 0x01),
+    USB_CONFIG_DESCRIPTOR_INIT(USB_AUDIO_CONFIG_SIZE, 0x02, 0x01, USB_CONFIG_BUS_POWERED, USBD_MAX_POWER),
+    /* 接口关联描述符 */
+    0x08, 0x0B, 0x00, 0x02, 0x01, 0x00, 0x20, 0x00,
+    /* 音频控制接口 */
+    0x09, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x00,
+    /* 类特定音频控制接口头：UAC 2.0，桌面扬声器 */
+    0x09, 0x24, 0x01, WBVAL(0x0200), 0x01, WBVAL(AUDIO_AC_SIZE), 0x00,
+    /* 时钟源：内部可编程时钟，主机可设置频率 */
+    0x08, 0x24, 0x0A, AUDIO_CLOCK_ID, 0x03, 0x07, 0x00, 0x00,
+    /* 输入终端：USB流 */
+    0x11, 0x24, 0x02, AUDIO_INPUT_TERMINAL_ID, WBVAL(0x0101), 0x00, AUDIO_CLOCK_ID,
+    BRIDGE_CHANNEL_NUM, DBVAL(AUDIO_CHANNEL_CONFIG), 0x00, WBVAL(0x0000), 0x00,
+    /* 输出终端：扬声器 */
+    0x0C, 0x24, 0x03, AUDIO_OUTPUT_TERMINAL_ID, WBVAL(0x0301), 0x00, AUDIO_INPUT_TERMINAL_ID, AUDIO_CLOCK_ID,
+    WBVAL(0x0000), 0x00,
+    /* 音频流接口，备用设置0：无带宽 */
+    0x09, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x20, 0x00,
+    /* 音频流接口，备用设置1：数据端点和反馈端点 */
+    0x09, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x20, 0x00,
+    /* 类特定音频流接口：PCM */
+    0x10, 0x24, 0x01, AUDIO_INPUT_TERMINAL_ID, 0x00, 0x01, DBVAL(0x00000001),
+    BRIDGE_CHANNEL_NUM, DBVAL(AUDIO_CHANNEL_CONFIG), 0x00,
+    /* Type I格式：32位子槽，24位有效 */
+    0x06, 0x24, 0x02, 0x01, AUDIO_SUBSLOT_SIZE, AUDIO_BIT_RESOLUTION,
+    /* 等时OUT数据端点：异步 */
+    0x07, 0x05, AUDIO_OUT_EP, 0x05, WBVAL(AUDIO_OUT_PACKET_MAX), 0x01,
+    /* 类特定等时数据端点 */
+    0x08, 0x25, 0x01, 0x00, 0x00, 0x00, WBVAL(0x0000),
+    /* 等时IN反馈端点 */
+    0x07, 0x05, AUDIO_FB_EP, 0x11, WBVAL(AUDIO_FB_PACKET), AUDIO_FB_INTERVAL,
+    /*
+     * string0 descriptor
+     */
+    USB_LANGID_INIT(USBD_LANGID_STRING),
+    /*
+     * string1 descriptor
+     */
+    0x10,                       /* bLength */
+    USB_DESCRIPTOR_TYPE_STRING, /* bDescriptorType */
+    'H', 0x00,                  /* wcChar0 */
+    'P', 0x00,                  /* wcChar1 */
+    'M', 0x00,                  /* wcChar2 */
+    'i', 0x00,                  /* wcChar3 */
+    'c', 0x00,                  /* wcChar4 */
+    'r', 0x00,                  /* wcChar5 */
+    'o', 0x00,                  /* wcChar6 */
+    /*
+     * string2 descriptor
+     */
+    0x1A,                       /* bLength */
+    USB_DESCRIPTOR_TYPE_STRING, /* bDescriptorType */
+    'U', 0x00,                  /* wcChar0 */
+    'A', 0x00,                  /* wcChar1 */
+    'C', 0x00,                  /* wcChar2 */
+    '2', 0x00,                  /* wcChar3 */
+    ' ', 0x00,                  /* wcChar4 */
+    '8', 0x00,                  /* wcChar5 */
+    'C', 0x00,                  /* wcChar6 */
+    'H', 0x00,                  /* wcChar7 */
+    ' ', 0x00,                  /* wcChar8 */
+    'I', 0x00,                  /* wcChar9 */
+    '2', 0x00,                  /* wcChar10 */
+    'S', 0x00,                  /* wcChar11 */
+    /*
+     * string3 descriptor
+     */
+    0x16,                       /* bLength */
+    USB_DESCRIPTOR_TYPE_STRING, /* bDescriptorType */
+    '2', 0x00,                  /* wcChar0 */
+    '0', 0x00,                  /* wcChar1 */
+    '2', 0x00,                  /* wcChar2 */
+    '5', 0x00,                  /* wcChar3 */
+    '0', 0x00,                  /* wcChar4 */
+    '0', 0x00,                  /* wcChar5 */
+    '0', 0x00,                  /* wcChar6 */
+    '0', 0x00,                  /* wcChar7 */
+    '0', 0x00,                  /* wcChar8 */
+    '1', 0x00,                  /* wcChar9 */
+    /*
+     * device qualifier descriptor
+     */
+    0x0a,
+    USB_DESCRIPTOR_TYPE_DEVICE_QUALIFIER,
+    0x00,
+    0x02,
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x01,
+    0x00,
+    0x00
+};
+
+/* 时钟源支持的采样率：2个离散值 */
+static const uint8_t audio_freq_table[] = {
+    AUDIO_SAMPLE_FREQ_NUM(2),
+    AUDIO_SAMPLE_FREQ_4B(48000),
+    AUDIO_SAMPLE_FREQ_4B(48000),
+    AUDIO_SAMPLE_FREQ_4B(0x00),
+    AUDIO_SAMPLE_FREQ_4B(96000),
+    AUDIO_SAMPLE_FREQ_4B(96000),
+    AUDIO_SAMPLE_FREQ_4B(0x00),
+};
+
+static struct audio_entity_info audio_entity_table[] = {
+    {
+        .bEntityId = AUDIO_CLOCK_ID,
+        .bDescriptorSubtype = AUDIO_CONTROL_CLOCK_SOURCE,
+        .ep = AUDIO_OUT_EP,
+    },
+};
+
+/* USB端点缓冲区，USB DMA直接访问 */
+USB_NOCACHE_RAM_SECTION USB_MEM_ALIGNX uint8_t audio_read_buffer[2][AUDIO_OUT_PACKET_MAX];
+USB_NOCACHE_RAM_SECTION USB_MEM_ALIGNX uint8_t audio_fb_buffer[AUDIO_FB_PACKET];
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(BRIDGE_PERIOD_NUM, BRIDGE_MAX_PERIOD_FRAMES,
+                                                           BRIDGE_LINE_NUM, BRIDGE_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+static struct usbd_interface intf0;
+static struct usbd_interface intf1;
+
+static i2s_multiline_feedback_t bridge_fb;
+static uint8_t bridge_dma_channel;                  /* 运行时分配的I2S发送DMA通道 */
+static volatile bool bridge_open_request;
+static volatile bool bridge_close_request;
+static volatile bool bridge_start_request;          /* 已缓冲到目标值，由主循环启动播放 */
+static volatile bool bridge_streaming;              /* USB端点已启动 */
+static volatile uint32_t bridge_sample_rate = AUDIO_DEFAULT_RATE;
+static uint32_t bridge_target_fill;
+static uint8_t bridge_read_index;
+static volatile uint32_t bridge_overrun_frames;     /* 环满时丢弃的帧数 */
+
+static void usbd_audio_out_callback(uint8_t ep, uint32_t nbytes);
+static void usbd_audio_fb_callback(uint8_t ep, uint32_t nbytes);
+
+static struct usbd_endpoint audio_out_ep = {
+    .ep_addr = AUDIO_OUT_EP,
+    .ep_cb = usbd_audio_out_callback,
+};
+
+static struct usbd_endpoint audio_fb_ep = {
+    .ep_addr = AUDIO_FB_EP,
+    .ep_cb = usbd_audio_fb_callback,
+};
+
+/*
+ * DMA中断处理函数
+ * 由资源管理器分发到流式发送接口，处理周期推进和错误统计
+ */
+SDK_DECLARE_EXT_ISR_M(BRIDGE_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_dma_mgr_irq_handler(BRIDGE_I2S_DMA);
+}
+
+/* 半周期和整周期回调：记录I2S的消耗位置 */
+static void bridge_i2s_cb(i2s_multiline_stream_t *stream, uint32_t period, void *user_data)
+{
+    (void)period;
+    (void)user_data;
+    i2s_multiline_feedback_i2s_event(&bridge_fb, stream->read_pos, hpm_csr_get_core_cycle());
+}
+
+/*
+ * USB帧中声道k为数据线k/2的第k%2个通道，重排为burst顺序：
+ * 每帧依次为slot0的line0..3、slot1的line0..3。24位数据在32位子槽中已左对齐
+ */
+static void bridge_interleave(uint32_t *dst, const uint32_t *src, uint32_t frames)
+{
+    for (uint32_t f = 0; f < frames; f++) {
+        for (uint8_t line = 0; line < BRIDGE_LINE_NUM; line++) {
+            for (uint8_t slot = 0; slot < BRIDGE_CHANNEL_PER_LINE; slot++) {
+                dst[slot * BRIDGE_LINE_NUM + line] = src[line * BRIDGE_CHANNEL_PER_LINE + slot];
+            }
+        }
+        dst += BRIDGE_CHANNEL_NUM;
+        src += BRIDGE_CHANNEL_NUM;
+    }
+}
+
+static void bridge_write(const uint8_t *data, uint32_t frames)
+{
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    uint32_t n;
+
+    while (frames > 0U) {
+        n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+        if (n == 0U) {
+            bridge_overrun_frames += frames;
+            break;
+        }
+        if (n > frames) {
+            n = frames;
+        }
+        bridge_interleave((uint32_t *)ring_ptr[0], (const uint32_t *)data, n);
+        i2s_multiline_stream_commit(&i2s_stream, n);
+        data += n * AUDIO_FRAME_BYTES;
+        frames -= n;
+    }
+}
+
+static void bridge_send_feedback(void)
+{
+    uint32_t value = i2s_multiline_feedback_get_value(&bridge_fb);
+
+    /* 高速为Q16.16，小端 */
+    audio_fb_buffer[0] = (uint8_t)value;
+    audio_fb_buffer[1] = (uint8_t)(value >> 8);
+    audio_fb_buffer[2] = (uint8_t)(value >> 16);
+    audio_fb_buffer[3] = (uint8_t)(value >> 24);
+    usbd_ep_start_write(AUDIO_FB_EP, audio_fb_buffer, AUDIO_FB_PACKET);
+}
+
+static void usbd_audio_out_callback(uint8_t ep, uint32_t nbytes)
+{
+    uint64_t now = hpm_csr_get_core_cycle();
+    const uint8_t *data = audio_read_buffer[bridge_read_index];
+
+    (void)ep;
+    if (!bridge_streaming) {
+        return;
+    }
+    /* 先启动下一个包的接收，再处理本包 */
+    bridge_read_index ^= 1U;
+    usbd_ep_start_read(AUDIO_OUT_EP, audio_read_buffer[bridge_read_index], AUDIO_OUT_PACKET_MAX);
+
+    i2s_multiline_feedback_usb_event(&bridge_fb, i2s_stream.data_pos, now);
+    bridge_write(data, nbytes / AUDIO_FRAME_BYTES);
+
+    /* 缓冲到目标值后请求启动播放，启动时等待FIFO预填充，不在USB中断中进行 */
+    if ((!i2s_stream.running) && (i2s_multiline_stream_get_queued_frames(&i2s_stream) >= bridge_target_fill)) {
+        bridge_start_request = true;
+    }
+}
+
+static void usbd_audio_fb_callback(uint8_t ep, uint32_t nbytes)
+{
+    (void)ep;
+    (void)nbytes;
+    if (bridge_streaming) {
+        bridge_send_feedback();
+    }
+}
+
+void usbd_configure_done_callback(void)
+{
+    /* do nothing */
+}
+
+void usbd_audio_open(uint8_t intf)
+{
+    if (intf == 1U) {
+        bridge_open_request = true;
+    }
+}
+
+void usbd_audio_close(uint8_t intf)
+{
+    if (intf == 1U) {
+        bridge_streaming = false;
+        bridge_close_request = true;
+    }
+}
+
+void usbd_audio_set_sampling_freq(uint8_t ep, uint32_t sampling_freq)
+{
+    (void)ep;
+    if ((sampling_freq == 48000U) || (sampling_freq == 96000U)) {
+        bridge_sample_rate = sampling_freq;
+    }
+}
+
+uint32_t usbd_audio_get_sampling_freq(uint8_t ep)
+{
+    (void)ep;
+    return bridge_sample_rate;
+}
+
+void usbd_audio_get_sampling_freq_table(uint8_t ep, uint8_t **sampling_freq_table)
+{
+    (void)ep;
+    *sampling_freq_table = (uint8_t *)audio_freq_table;
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+static void bridge_i2s_config(uint32_t sample_rate)
+{
+    uint32_t i2s_mclk_hz;
+
+    board_config_i2s_clock(I2S_MASTER, sample_rate);
+
+    /* 位深、数据线、时隙掩码和FIFO阈值来自编译期配置，采样率为主机当前选择的值 */
+    i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+    if (status_success != bridge_cfg_config_i2s_at(I2S_MASTER, i2s_mclk_hz, sample_rate, bridge_cfg_fifo_threshold,
+                                                   false, 0)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+/*
+ * 主机选择备用设置1后，按当前采样率配置I2S、流和反馈计算，再启动USB端点
+ */
+static void bridge_open_stream(void)
+{
+    uint32_t sample_rate = bridge_sample_rate;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_feedback_config_t fb_config = {0};
+    hpm_stat_t stat;
+
+    bridge_i2s_config(sample_rate);
+
+    config.i2s = I2S_MASTER;
+    config.dma = BRIDGE_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = BRIDGE_LINE_NUM;
+    config.dma_channel[0] = bridge_dma_channel;
+    config.dma_req[0] = BRIDGE_I2S_DMA_TX_REQ;
+    config.channel_per_line = BRIDGE_CHANNEL_PER_LINE;
+    config.audio_depth = bridge_cfg_audio_depth;
+    config.period_num = BRIDGE_PERIOD_NUM;
+    /* 1ms周期，环为192或384帧，不是2的幂；读写位置在2^32处回绕时由流保持映射连续 */
+    config.period_frames = sample_rate / 1000U;
+    config.buffer[0] = stream_buffer;
+    config.half_period_cb = bridge_i2s_cb;
+    config.period_cb = bridge_i2s_cb;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        printf("I2S stream init failed!\n");
+        return;
+    }
+    bridge_target_fill = config.period_frames * BRIDGE_TARGET_FILL_PERCENT / 100U;
+
+    fb_config.cpu_hz = clock_get_frequency(clock_cpu0);
+    fb_config.sample_rate = sample_rate;
+    fb_config.packet_per_second = 8000U;
+    fb_config.high_speed = true;
+    fb_config.period_frames = config.period_frames;
+    fb_config.target_fill = bridge_target_fill;
+    i2s_multiline_feedback_init(&bridge_fb, &fb_config);
+    bridge_overrun_frames = 0;
+
+    bridge_read_index = 0;
+    bridge_start_request = false;
+    bridge_streaming = true;
+    usbd_ep_start_read(AUDIO_OUT_EP, audio_read_buffer[0], AUDIO_OUT_PACKET_MAX);
+    bridge_send_feedback();
+    printf("UAC2 stream open: %lu Hz, target fill %lu frames\n", sample_rate, bridge_target_fill);
+}
+
+void usb_audio_bridge_init_pins(void)
+{
+    /* 引脚表见i2s_multiline_cfg.h */
+    bridge_cfg_init_pins();
+}
+
+void usb_audio_bridge_init(void)
+{
+    /* DMA通道只分配一次，每次打开流时沿用 */
+    if ((status_success != i2s_multiline_dma_mgr_add_controller(BRIDGE_I2S_DMA, BOARD_APP_DMAMUX,
+                                                                BRIDGE_DMA_CHANNEL_MASK)) ||
+        (status_success != i2s_multiline_dma_mgr_request(BRIDGE_I2S_DMA, BRIDGE_I2S_DMA_TX_REQ, &bridge_dma_channel)) ||
+        (status_success != i2s_multiline_dma_mgr_set_callback(BRIDGE_I2S_DMA, bridge_dma_channel,
+                                                              i2s_multiline_stream_dma_callback, &i2s_stream))) {
+        printf("I2S DMA channel request failed!\n");
+        return;
+    }
+    intc_m_enable_irq_with_priority(BRIDGE_I2S_DMA_IRQ, 1);
+
+    usbd_desc_register(audio_v2_descriptor);
+    usbd_add_interface(usbd_audio_init_intf(&intf0, 0x0200, audio_entity_table, ARRAY_SIZE(audio_entity_table)));
+    usbd_add_interface(usbd_audio_init_intf(&intf1, 0x0200, audio_entity_table, ARRAY_SIZE(audio_entity_table)));
+    usbd_add_endpoint(&audio_out_ep);
+    usbd_add_endpoint(&audio_fb_ep);
+
+    usbd_initialize();
+}
+
+void usb_audio_bridge_task(void)
+{
+    if (bridge_start_request) {
+        bridge_start_request = false;
+        if (bridge_streaming && (!i2s_stream.running) &&
+            (status_success != i2s_multiline_stream_start(&i2s_stream))) {
+            bridge_streaming = false;
+        }
+    }
+    i2s_multiline_stream_task(&i2s_stream);
+    if (bridge_close_request) {
+        bridge_close_request = false;
+        if (i2s_stream.running) {
+            i2s_multiline_stream_stop(&i2s_stream);
+        }
+        printf("UAC2 stream closed\n");
+    }
+    if (bridge_open_request) {
+        bridge_open_request = false;
+        if (i2s_stream.running) {
+            i2s_multiline_stream_stop(&i2s_stream);
+        }
+        bridge_open_stream();
+    }
+}
+
+void usb_audio_bridge_print_stats(void)
+{
+    i2s_multiline_feedback_stats_t fb_stats;
+    i2s_multiline_stream_stats_t stats;
+
+    if (!i2s_stream.running) {
+        return;
+    }
+    i2s_multiline_feedback_get_stats(&bridge_fb, &fb_stats);
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    printf("fb 0x%08lx (%lu.%03lu Hz), fill %lu/%lu/%lu frames, latency %lu/%lu/%lu us, "
+           "underruns %lu, overrun frames %lu\n",
+           fb_stats.feedback, fb_stats.i2s_rate_mhz / 1000U, fb_stats.i2s_rate_mhz % 1000U,
+           fb_stats.fill_min, fb_stats.fill_avg, fb_stats.fill_max,
+           fb_stats.latency_min_us, fb_stats.latency_avg_us, fb_stats.latency_max_us,
+           stats.underrun_count, bridge_overrun_frames);
+}
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef USB_AUDIO_BRIDGE_H
+#define USB_AUDIO_BRIDGE_H
+
+#include "hpm_common.h"
+
+/* 按桥接的数据线数配置I2S0引脚 */
+void usb_audio_bridge_init_pins(void);
+
+/* 注册USB描述符和端点并初始化USB设备 */
+void usb_audio_bridge_init(void);
+
+/* 在主循环中调用，处理主机打开、关闭音频流及采样率切换，启动播放并完成流的错误恢复 */
+void usb_audio_bridge_task(void);
+
+/* 打印缓冲量、延迟和反馈遥测，并重新开始统计 */
+void usb_audio_bridge_print_stats(void);
+
+#endif /* USB_AUDIO_BRIDGE_H */
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022, sakumisu
+ * Copyright (c) 2022-2025, HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef CHERRYUSB_CONFIG_H
+#define CHERRYUSB_CONFIG_H
+
+#include "hpm_soc.h"
+
+#define CHERRYUSB_VERSION 0x001001
+
+/* ================ USB common Configuration ================ */
+
+#define CONFIG_USB_PRINTF(...) printf(__VA_ARGS__)
+
+#define usb_malloc(size) malloc(size)
+#define usb_free(ptr)    free(ptr)
+
+#ifndef CONFIG_USB_DBG_LEVEL
+#define CONFIG_USB_DBG_LEVEL USB_DBG_INFO
+#endif
+
+#ifdef CONFIG_USB_DEVICE_FS
+#undef CONFIG_USB_HS
+#else
+#define CONFIG_USB_HS
+#endif
+
+/* Enable print with color */
+#define CONFIG_USB_PRINTF_COLOR_ENABLE
+
+/* data align size when use dma */
+#ifndef CONFIG_USB_ALIGN_SIZE
+#define CONFIG_USB_ALIGN_SIZE 64
+#endif
+
+/* descriptor common define */
+#define USBD_VID           0x34B7    /* Hpmicro vid */
+#define USBD_PID           0xFFFF
+#define USBD_MAX_POWER     200
+#define USBD_LANGID_STRING 1033
+
+/* attribute data into no cache ram */
+#define USB_NOCACHE_RAM_SECTION __attribute__((section(".noncacheable")))
+
+/* ================= USB Device Stack Configuration ================ */
+
+/* Ep0 max transfer buffer, specially for receiving data from ep0 out */
+#define CONFIG_USBDEV_REQUEST_BUFFER_LEN 512
+
+/* Setup packet log for debug */
+/* #define CONFIG_USBDEV_SETUP_LOG_PRINT */
+
+/* Check if the input descriptor is correct */
+/* #define CONFIG_USBDEV_DESC_CHECK */
+
+/* Enable test mode */
+/* #define CONFIG_USBDEV_TEST_MODE */
+
+/* ================ USB Device Port Configuration ================*/
+
+#ifndef CONFIG_HPM_USBD_BASE
+#define CONFIG_HPM_USBD_BASE    HPM_USB0_BASE
+#endif
+#ifndef CONFIG_HPM_USBD_IRQn
+#define CONFIG_HPM_USBD_IRQn    IRQn_USB0
+#endif
+
+#endif
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个I2S多数据线跨核音频处理的示例程序
+ * 该示例先由核0独自完成DSP处理和I2S/DMA播放，再把DSP处理交给核1：
+ * 核1把处理好的周期填入跨核周期环，核0只负责把周期搬入DMA环。
+ * 两种方式播放相同的16声道音频，比较核0的负载，并估算48kHz下单核和双核各能支撑的声道数
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_mbx_drv.h"
+#include "hpm_sysctl_drv.h"
+#include "i2s_multiline_cfg.h"
+#include "i2s_multiline_stream.h"
+#include "i2s_multiline_xcore.h"
+#include "dsp_graph.h"
+#include "xcore_app.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+#define TEST_I2S_TX_DMA_CHANNEL   0   /* DMA通道号 */
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+I2S_MULTILINE_CFG_DEFINE(xcore_cfg, XCORE_LINE_NUM, 32, XCORE_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         XCORE_SAMPLE_RATE)
+
+_Static_assert(xcore_cfg_frame_bytes * XCORE_PERIOD_FRAMES == XCORE_PERIOD_BYTES, "period size mismatch");
+
+#define STREAM_PERIOD_NUM        (4U)
+/* 每种方式的播放时间 */
+#define PLAY_SECONDS             (5U)
+/* 估算可支撑的声道数时，每个核的负载上限 */
+#define LOAD_LIMIT_PERCENT       (80U)
+/* 等待核1连接的超时时间 */
+#define CORE1_ATTACH_TIMEOUT_MS  (1000U)
+/* 核1从ILM起始地址运行 */
+#define CORE1_ENTRY              (0U)
+
+/* 核1的程序映像，由核1的工程生成在sec_core_img.c中 */
+extern const uint8_t sec_core_img[];
+extern const uint32_t sec_core_img_size;
+
+typedef struct {
+    uint32_t frames;                /* 播放的帧数 */
+    uint64_t total_cycles;          /* 播放期间核0的总周期数 */
+    uint64_t busy_cycles;           /* 其中不在睡眠的周期数，含中断 */
+    uint64_t work_cycles;           /* 其中随声道数增长的部分：单核为DSP处理，双核为周期拷贝 */
+    uint32_t underrun_count;
+} play_result_t;
+
+/* 流实例及交织环形缓冲区，DMA直接访问，放置在非缓存区 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) i2s_multiline_stream_t i2s_stream;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint32_t stream_buffer[I2S_MULTILINE_STREAM_BURST_BUF_SIZE(STREAM_PERIOD_NUM, XCORE_PERIOD_FRAMES,
+                                                           XCORE_LINE_NUM, XCORE_CHANNEL_PER_LINE) / sizeof(uint32_t)];
+
+/* 跨核周期环，核0以非缓存方式访问，核1以可缓存方式访问 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) i2s_multiline_xcore_ring_t xcore_ring;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+uint8_t xcore_buffer[I2S_MULTILINE_XCORE_BUF_SIZE(XCORE_SLOT_NUM, XCORE_PERIOD_BYTES)];
+
+dsp_graph_t graph;
+i2s_multiline_xcore_end_t consumer;
+static volatile bool wake_pending;
+
+/*
+ * DMA中断处理函数
+ * 由流式发送接口处理周期推进，并唤醒主循环
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    i2s_multiline_stream_irq_handler(&i2s_stream);
+    wake_pending = true;
+}
+
+/*
+ * 邮箱中断处理函数
+ * 核1发布周期后发送门铃，唤醒主循环
+ */
+SDK_DECLARE_EXT_ISR_M(XCORE_CORE0_MBX_IRQ, isr_mbx)
+void isr_mbx(void)
+{
+    uint32_t msg;
+
+    while (mbx_retrieve_message(XCORE_CORE0_MBX, &msg) == status_success) {
+    }
+    wake_pending = true;
+}
+
+/*
+ * 睡眠直到下一个中断，返回睡眠的周期数
+ * 清除wake_pending之后到达的中断会跳过睡眠
+ */
+static uint64_t sleep_until_wake(void)
+{
+    uint64_t start = hpm_csr_get_core_cycle();
+    uint64_t end;
+    uint32_t level;
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if (!wake_pending) {
+        __asm volatile("wfi");
+    }
+    /* 在开中断之前计时，中断处理计入负载 */
+    end = hpm_csr_get_core_cycle();
+    restore_global_irq(level);
+    return end - start;
+}
+
+/*
+ * 加载并释放核1
+ */
+static void release_core1(void)
+{
+    uint32_t img_sys_addr = core_local_mem_to_sys_address(HPM_CORE1, CORE1_ENTRY);
+    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(img_sys_addr);
+    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(img_sys_addr + sec_core_img_size);
+
+    if (sysctl_is_cpu1_released(HPM_SYSCTL)) {
+        return;
+    }
+    memcpy((void *)img_sys_addr, sec_core_img, sec_core_img_size);
+    l1c_dc_flush(aligned_start, aligned_end - aligned_start);
+    sysctl_set_cpu1_entry(HPM_SYSCTL, CORE1_ENTRY);
+    sysctl_release_cpu1(HPM_SYSCTL);
+}
+
+/*
+ * 初始化跨核周期环并启动核1，等待核1连接
+ */
+hpm_stat_t start_core1(void)
+{
+    uint32_t ring_sys_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)&xcore_ring);
+    uint32_t buffer_sys_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)xcore_buffer);
+    uint64_t timeout = (uint64_t)clock_get_frequency(clock_cpu0) / 1000U * CORE1_ATTACH_TIMEOUT_MS;
+    uint64_t start;
+    hpm_stat_t stat;
+
+    stat = i2s_multiline_xcore_ring_init(&xcore_ring, buffer_sys_addr, XCORE_SLOT_NUM, XCORE_PERIOD_BYTES);
+    if (stat != status_success) {
+        return stat;
+    }
+    stat = i2s_multiline_xcore_attach_consumer(&consumer, &xcore_ring, xcore_buffer, false);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    mbx_init(XCORE_CORE0_MBX);
+    mbx_enable_intr(XCORE_CORE0_MBX, MBX_CR_RWMVIE_MASK);
+    intc_m_enable_irq_with_priority(XCORE_CORE0_MBX_IRQ, 1);
+
+    release_core1();
+    while (mbx_send_message(XCORE_CORE0_MBX, ring_sys_addr) != status_success) {
+    }
+
+    start = hpm_csr_get_core_cycle();
+    while (!i2s_multiline_xcore_producer_attached(&consumer)) {
+        if ((hpm_csr_get_core_cycle() - start) > timeout) {
+            return status_timeout;
+        }
+    }
+    return status_success;
+}
+
+/*
+ * 播放PLAY_SECONDS秒
+ * dual为false时核0在主循环中处理DSP并直接写入DMA环；
+ * dual为true时从跨核周期环取出核1处理好的周期拷贝到DMA环，释放槽后通知核1
+ */
+hpm_stat_t play(bool dual, play_result_t *result)
+{
+    hpm_stat_t stat;
+    i2s_multiline_stream_config_t config = {0};
+    i2s_multiline_stream_stats_t stats;
+    void *ring_ptr[I2S_MULTILINE_MAX_LINE];
+    const void *line_data[1];
+    const void *slot;
+    uint32_t total_frames = XCORE_SAMPLE_RATE * PLAY_SECONDS;
+    uint64_t idle_cycles = 0;
+    uint64_t start;
+    uint64_t t;
+    uint32_t n;
+
+    config.i2s = I2S_MASTER;
+    config.dma = TEST_I2S_DMA;
+    config.dmamux = BOARD_APP_DMAMUX;
+    config.engine = i2s_multiline_engine_burst_dma;
+    config.line_num = XCORE_LINE_NUM;
+    config.dma_channel[0] = TEST_I2S_TX_DMA_CHANNEL;
+    config.dma_req[0] = TEST_I2S_DMA_TX_REQ;
+    config.channel_per_line = XCORE_CHANNEL_PER_LINE;
+    config.audio_depth = xcore_cfg_audio_depth;
+    config.period_num = STREAM_PERIOD_NUM;
+    config.period_frames = XCORE_PERIOD_FRAMES;
+    config.buffer[0] = stream_buffer;
+    stat = i2s_multiline_stream_init(&i2s_stream, &config);
+    if (status_success != stat) {
+        return stat;
+    }
+
+    memset(result, 0, sizeof(*result));
+    start = hpm_csr_get_core_cycle();
+    while (result->frames < total_frames) {
+        i2s_multiline_stream_task(&i2s_stream);
+        wake_pending = false;
+        if ((!i2s_stream.running) && (i2s_multiline_stream_get_free_frames(&i2s_stream) == 0U)) {
+            stat = i2s_multiline_stream_start(&i2s_stream);
+            if (status_success != stat) {
+                return stat;
+            }
+        }
+        if (i2s_multiline_stream_get_free_frames(&i2s_stream) >= XCORE_PERIOD_FRAMES) {
+            if (!dual) {
+                /* 欠载插入静音后写位置可能不在周期边界，按连续空间处理 */
+                n = i2s_multiline_stream_get_write_ptr(&i2s_stream, ring_ptr);
+                if (n > XCORE_PERIOD_FRAMES) {
+                    n = XCORE_PERIOD_FRAMES;
+                }
+                t = hpm_csr_get_core_cycle();
+                dsp_graph_render(&graph, (uint32_t *)ring_ptr[0], n);
+                result->work_cycles += hpm_csr_get_core_cycle() - t;
+                i2s_multiline_stream_commit(&i2s_stream, n);
+                result->frames += n;
+                continue;
+            }
+            slot = i2s_multiline_xcore_peek(&consumer);
+            if (slot != NULL) {
+                line_data[0] = slot;
+                t = hpm_csr_get_core_cycle();
+                n = i2s_multiline_stream_write(&i2s_stream, line_data, XCORE_PERIOD_FRAMES);
+                result->work_cycles += hpm_csr_get_core_cycle() - t;
+                i2s_multiline_xcore_release(&consumer);
+                /* 核1有未读的门铃时发送失败，无需重发 */
+                (void)mbx_send_message(XCORE_CORE0_MBX, 0);
+                result->frames += n;
+                continue;
+            }
+        }
+        idle_cycles += sleep_until_wake();
+    }
+    result->total_cycles = hpm_csr_get_core_cycle() - start;
+    result->busy_cycles = result->total_cycles - idle_cycles;
+
+    i2s_multiline_stream_drain(&i2s_stream);
+    while (i2s_multiline_stream_get_queued_frames(&i2s_stream) > 0U) {
+        i2s_multiline_stream_task(&i2s_stream);
+        wake_pending = false;
+        (void)sleep_until_wake();
+    }
+    i2s_multiline_stream_stop(&i2s_stream);
+
+    i2s_multiline_stream_get_stats(&i2s_stream, &stats);
+    result->underrun_count = stats.underrun_count;
+    return status_success;
+}
+
+/*
+ * 百分比，保留两位小数
+ */
+static uint32_t percent_x100(uint64_t part, uint64_t total)
+{
+    return (total == 0U) ? 0U : (uint32_t)(part * 10000U / total);
+}
+
+/*
+ * 每个声道每帧的周期数，保留两位小数
+ */
+static uint32_t channel_cycles_x100(uint64_t cycles, uint32_t frames)
+{
+    return (frames == 0U) ? 0U : (uint32_t)(cycles * 100U / ((uint64_t)frames * XCORE_CHANNEL_NUM));
+}
+
+/*
+ * 负载上限内可支撑的声道数：每帧预算减去与声道数无关的开销，再除以每个声道每帧的周期数
+ */
+static uint32_t max_channels(uint32_t cpu_hz, uint64_t fixed_cycles, uint32_t frames, uint32_t per_channel_x100)
+{
+    uint64_t budget_x100 = (uint64_t)cpu_hz * LOAD_LIMIT_PERCENT / XCORE_SAMPLE_RATE;
+    uint64_t fixed_x100 = (frames == 0U) ? 0U : fixed_cycles * 100U / frames;
+
+    if ((per_channel_x100 == 0U) || (fixed_x100 >= budget_x100)) {
+        return 0;
+    }
+    return (uint32_t)((budget_x100 - fixed_x100) / per_channel_x100);
+}
+
+/*
+ * 打印两种方式的结果并估算可支撑的声道数
+ */
+void report(const play_result_t *single, const play_result_t *dual)
+{
+    uint32_t cpu_hz = clock_get_frequency(clock_cpu0);
+    uint32_t core1_last;
+    uint32_t core1_max;
+    uint32_t dsp0_x100 = channel_cycles_x100(single->work_cycles, single->frames);
+    uint32_t copy0_x100 = channel_cycles_x100(dual->work_cycles, dual->frames);
+    uint32_t dsp1_x100;
+    uint32_t core1_load_x100;
+    uint32_t max_single;
+    uint32_t max_core0;
+    uint32_t max_core1;
+    uint32_t load_x100;
+
+    /* 核1按最慢的周期估算，两个核主频相同 */
+    i2s_multiline_xcore_get_work_cycles(&consumer, &core1_last, &core1_max);
+    dsp1_x100 = channel_cycles_x100(core1_max, XCORE_PERIOD_FRAMES);
+    core1_load_x100 = percent_x100((uint64_t)core1_max * XCORE_SAMPLE_RATE, (uint64_t)cpu_hz * XCORE_PERIOD_FRAMES);
+
+    max_single = max_channels(cpu_hz, single->busy_cycles - single->work_cycles, single->frames, dsp0_x100);
+    max_core0 = max_channels(cpu_hz, dual->busy_cycles - dual->work_cycles, dual->frames, copy0_x100);
+    max_core1 = max_channels(cpu_hz, 0, XCORE_PERIOD_FRAMES, dsp1_x100);
+
+    load_x100 = percent_x100(single->busy_cycles, single->total_cycles);
+    printf("single core: %u channels, core0 load %lu.%02lu%%, DSP %lu.%02lu cycles/channel/frame, %lu underruns\n",
+           XCORE_CHANNEL_NUM, load_x100 / 100U, load_x100 % 100U, dsp0_x100 / 100U, dsp0_x100 % 100U,
+           single->underrun_count);
+    load_x100 = percent_x100(dual->busy_cycles, dual->total_cycles);
+    printf("dual core: %u channels, core0 load %lu.%02lu%%, core1 load %lu.%02lu%% (slowest period), %lu underruns\n",
+           XCORE_CHANNEL_NUM, load_x100 / 100U, load_x100 % 100U, core1_load_x100 / 100U, core1_load_x100 % 100U,
+           dual->underrun_count);
+    printf("dual core: core1 DSP %lu.%02lu, core0 copy %lu.%02lu cycles/channel/frame, ring empty %lu times\n",
+           dsp1_x100 / 100U, dsp1_x100 % 100U, copy0_x100 / 100U, copy0_x100 % 100U, consumer.stall_count);
+    printf("max channels @ %u Hz within %u%% load: single core %lu, dual core %lu (core1 DSP %lu, core0 copy %lu)\n",
+           XCORE_SAMPLE_RATE, LOAD_LIMIT_PERCENT, max_single, (max_core0 < max_core1) ? max_core0 : max_core1,
+           max_core1, max_core0);
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    hpm_stat_t stat;
+    play_result_t single;
+    play_result_t dual;
+
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S multiline cross-core audio pipeline example\n");
+
+    /* 配置I2S时钟、引脚和数据格式 */
+    board_config_i2s_clock(I2S_MASTER, XCORE_SAMPLE_RATE);
+    xcore_cfg_init_pins();
+    if (xcore_cfg_config_i2s(I2S_MASTER, clock_get_frequency(I2S_MASTER_CLOCK_NAME), xcore_cfg_fifo_threshold) !=
+        status_success) {
+        printf("I2S config failed!\n");
+        while (1) {
+        }
+    }
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+
+    /* 单核：核0处理DSP并播放 */
+    dsp_graph_init(&graph, XCORE_LINE_NUM, XCORE_CHANNEL_PER_LINE, XCORE_SAMPLE_RATE);
+    stat = play(false, &single);
+    if (stat != status_success) {
+        printf("single core play failed: %d\n", stat);
+        while (1) {
+        }
+    }
+    printf("single core play done\n");
+
+    /* 双核：核1处理DSP，核0播放 */
+    stat = start_core1();
+    if (stat != status_success) {
+        printf("core1 start failed: %d\n", stat);
+        while (1) {
+        }
+    }
+    stat = play(true, &dual);
+    if (stat != status_success) {
+        printf("dual core play failed: %d\n", stat);
+        while (1) {
+        }
+    }
+    printf("dual core play done\n");
+
+    report(&single, &dual);
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 跨核音频处理示例的核1程序
+ * 核1运行DSP处理图，把周期填入跨核周期环，由核0的I2S/DMA播放
+ */
+
+#include "board.h"
+#include "hpm_mbx_drv.h"
+#include "hpm_csr_drv.h"
+#include "i2s_multiline_xcore.h"
+#include "dsp_graph.h"
+#include "xcore_app.h"
+
+dsp_graph_t graph;
+i2s_multiline_xcore_end_t producer;
+static volatile bool doorbell_pending;
+
+/*
+ * 邮箱中断处理函数
+ * 门铃不带内容，只唤醒主循环，是否有空槽由环决定
+ */
+SDK_DECLARE_EXT_ISR_M(XCORE_CORE1_MBX_IRQ, isr_mbx)
+void isr_mbx(void)
+{
+    uint32_t msg;
+
+    while (mbx_retrieve_message(XCORE_CORE1_MBX, &msg) == status_success) {
+    }
+    doorbell_pending = true;
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    uint32_t ring_sys_addr;
+    uint32_t *slot;
+    uint64_t start;
+    uint32_t level;
+
+    board_init_core1();
+    mbx_init(XCORE_CORE1_MBX);
+
+    /* 第一条消息为环的系统地址 */
+    while (mbx_retrieve_message(XCORE_CORE1_MBX, &ring_sys_addr) != status_success) {
+    }
+
+    dsp_graph_init(&graph, XCORE_LINE_NUM, XCORE_CHANNEL_PER_LINE, XCORE_SAMPLE_RATE);
+    /* 环和周期缓冲区位于核0的非缓存区，在核1上为可缓存，由环接口做回写和失效 */
+    if (i2s_multiline_xcore_attach_producer(&producer, (i2s_multiline_xcore_ring_t *)ring_sys_addr, NULL, true) !=
+        status_success) {
+        while (1) {
+            __asm volatile("wfi");
+        }
+    }
+
+    mbx_enable_intr(XCORE_CORE1_MBX, MBX_CR_RWMVIE_MASK);
+    intc_m_enable_irq_with_priority(XCORE_CORE1_MBX_IRQ, 1);
+    /* 通知核0已连接 */
+    (void)mbx_send_message(XCORE_CORE1_MBX, 0);
+
+    while (1) {
+        doorbell_pending = false;
+        slot = (uint32_t *)i2s_multiline_xcore_acquire(&producer);
+        if (slot != NULL) {
+            /* 处理耗时包含槽的回写，随下一个周期发布 */
+            start = hpm_csr_get_core_cycle();
+            dsp_graph_render(&graph, slot, XCORE_PERIOD_FRAMES);
+            i2s_multiline_xcore_publish(&producer);
+            i2s_multiline_xcore_set_work_cycles(&producer, (uint32_t)(hpm_csr_get_core_cycle() - start));
+            /* 核0有未读的门铃时发送失败，无需重发 */
+            (void)mbx_send_message(XCORE_CORE1_MBX, 0);
+            continue;
+        }
+        /* 环满时睡眠，清除标志之后到达的门铃会跳过睡眠再检查一次 */
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        if (!doorbell_pending) {
+            __asm volatile("wfi");
+        }
+        restore_global_irq(level);
+    }
+
+    return 0;
+}
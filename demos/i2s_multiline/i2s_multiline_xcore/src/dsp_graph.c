@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <math.h>
+#include "dsp_graph.h"
+
+#define SINE_TABLE_BITS          (10U)
+#define SINE_TABLE_SIZE          (1UL << SINE_TABLE_BITS)
+#define SINE_AMPLITUDE           (0.25)
+#define BIQUAD_SHIFT             (30U)
+
+/* 各段峰值均衡器的中心频率和增益，Q为1 */
+static const float eq_freq_hz[DSP_GRAPH_STAGE_NUM] = {100.0f, 1000.0f, 4000.0f, 10000.0f};
+static const float eq_gain_db[DSP_GRAPH_STAGE_NUM] = {3.0f, -3.0f, 2.0f, -2.0f};
+
+static int32_t sine_table[SINE_TABLE_SIZE];
+
+static inline int32_t dsp_graph_q30(double v)
+{
+    return (int32_t)lround(v * (double)(1UL << BIQUAD_SHIFT));
+}
+
+static inline int32_t dsp_graph_saturate(int64_t v)
+{
+    if (v > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (v < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)v;
+}
+
+/* RBJ峰值均衡器 */
+static void dsp_graph_peaking(dsp_graph_biquad_t *bq, double freq, double gain_db, double sample_rate)
+{
+    double a = pow(10.0, gain_db / 40.0);
+    double w0 = 2.0 * M_PI * freq / sample_rate;
+    double alpha = sin(w0) / 2.0;
+    double a0 = 1.0 + alpha / a;
+
+    bq->b0 = dsp_graph_q30((1.0 + alpha * a) / a0);
+    bq->b1 = dsp_graph_q30(-2.0 * cos(w0) / a0);
+    bq->b2 = dsp_graph_q30((1.0 - alpha * a) / a0);
+    bq->a1 = bq->b1;
+    bq->a2 = dsp_graph_q30((1.0 - alpha / a) / a0);
+}
+
+hpm_stat_t dsp_graph_init(dsp_graph_t *graph, uint8_t line_num, uint8_t channel_per_line, uint32_t sample_rate)
+{
+    uint32_t ch;
+
+    if ((line_num == 0U) || (channel_per_line == 0U) ||
+        ((uint32_t)line_num * channel_per_line > DSP_GRAPH_MAX_CHANNEL) || (sample_rate == 0U)) {
+        return status_invalid_argument;
+    }
+
+    for (uint32_t i = 0; i < SINE_TABLE_SIZE; i++) {
+        sine_table[i] = (int32_t)(SINE_AMPLITUDE * 2147483647.0 * sin(2.0 * M_PI * i / SINE_TABLE_SIZE));
+    }
+
+    graph->line_num = line_num;
+    graph->channel_per_line = channel_per_line;
+    graph->channel_num = line_num * channel_per_line;
+    for (uint8_t line = 0; line < line_num; line++) {
+        for (uint8_t slot = 0; slot < channel_per_line; slot++) {
+            ch = line * channel_per_line + slot;
+            graph->out_index[ch] = slot * line_num + line;
+            graph->phase[ch] = 0;
+            graph->phase_inc[ch] = (uint32_t)((double)(ch + 1U) * 200.0 * 4294967296.0 / sample_rate);
+            /* 声道间增益略有差别，-0.5dB ~ -2dB */
+            graph->gain[ch] = (int32_t)(2147483647.0 * pow(10.0, -(0.5 + 0.1 * (ch % 16U)) / 20.0));
+            for (uint8_t s = 0; s < DSP_GRAPH_STAGE_NUM; s++) {
+                dsp_graph_peaking(&graph->coef[ch][s], eq_freq_hz[s], eq_gain_db[s], sample_rate);
+                graph->state[ch][s][0] = 0;
+                graph->state[ch][s][1] = 0;
+                graph->state[ch][s][2] = 0;
+                graph->state[ch][s][3] = 0;
+            }
+        }
+    }
+    return status_success;
+}
+
+/* 一个声道处理frames帧，振荡器相位和滤波器状态在循环中保存在局部变量里 */
+static void dsp_graph_channel(dsp_graph_t *graph, uint8_t ch, uint32_t *dst, uint32_t stride, uint32_t frames)
+{
+    const dsp_graph_biquad_t *coef = graph->coef[ch];
+    int32_t (*state)[4] = graph->state[ch];
+    uint32_t phase = graph->phase[ch];
+    uint32_t inc = graph->phase_inc[ch];
+    int32_t gain = graph->gain[ch];
+    int32_t x;
+    int32_t y;
+    int64_t acc;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        x = sine_table[phase >> (32U - SINE_TABLE_BITS)];
+        phase += inc;
+        for (uint32_t s = 0; s < DSP_GRAPH_STAGE_NUM; s++) {
+            acc = (int64_t)coef[s].b0 * x + (int64_t)coef[s].b1 * state[s][0] + (int64_t)coef[s].b2 * state[s][1] -
+                  (int64_t)coef[s].a1 * state[s][2] - (int64_t)coef[s].a2 * state[s][3];
+            y = dsp_graph_saturate(acc >> BIQUAD_SHIFT);
+            state[s][1] = state[s][0];
+            state[s][0] = x;
+            state[s][3] = state[s][2];
+            state[s][2] = y;
+            x = y;
+        }
+        dst[f * stride] = (uint32_t)(int32_t)(((int64_t)x * gain) >> 31);
+    }
+    graph->phase[ch] = phase;
+}
+
+void dsp_graph_render(dsp_graph_t *graph, uint32_t *dst, uint32_t frames)
+{
+    uint8_t n = graph->channel_num;
+
+    for (uint8_t ch = 0; ch < n; ch++) {
+        dsp_graph_channel(graph, ch, dst + graph->out_index[ch], n, frames);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef DSP_GRAPH_H
+#define DSP_GRAPH_H
+
+/*
+ * 示例DSP处理图，核0单核运行和核1双核运行使用同一份代码
+ *
+ * 每个声道：正弦振荡器 -> DSP_GRAPH_STAGE_NUM段峰值均衡器(Q30系数的二阶IIR，64位累加) -> Q31增益，
+ * 结果为左对齐的32位采样，按burst引擎的顺序(slot0的line0..lineN-1、slot1 ...)直接写入周期缓冲区。
+ * 处理量与声道数成正比，每个声道每帧的周期数即可推算一个核能支撑的声道数。
+ */
+
+#include "hpm_common.h"
+
+#define DSP_GRAPH_MAX_CHANNEL   (64U)
+#define DSP_GRAPH_STAGE_NUM     (4U)    /* 每个声道的均衡器段数 */
+
+typedef struct {
+    int32_t b0, b1, b2, a1, a2;         /* Q30，已按a0归一化 */
+} dsp_graph_biquad_t;
+
+typedef struct {
+    uint8_t line_num;
+    uint8_t channel_per_line;
+    uint8_t channel_num;
+    uint8_t out_index[DSP_GRAPH_MAX_CHANNEL];   /* 声道在一帧中的位置 */
+    uint32_t phase[DSP_GRAPH_MAX_CHANNEL];
+    uint32_t phase_inc[DSP_GRAPH_MAX_CHANNEL];
+    int32_t gain[DSP_GRAPH_MAX_CHANNEL];         /* Q31 */
+    dsp_graph_biquad_t coef[DSP_GRAPH_MAX_CHANNEL][DSP_GRAPH_STAGE_NUM];
+    int32_t state[DSP_GRAPH_MAX_CHANNEL][DSP_GRAPH_STAGE_NUM][4];  /* x1, x2, y1, y2 */
+} dsp_graph_t;
+
+/* 声道ch = line * channel_per_line + slot，频率为(ch + 1) * 200Hz */
+hpm_stat_t dsp_graph_init(dsp_graph_t *graph, uint8_t line_num, uint8_t channel_per_line, uint32_t sample_rate);
+
+/* 处理frames帧，dst需能容纳 frames * channel_num 个32位字 */
+void dsp_graph_render(dsp_graph_t *graph, uint32_t *dst, uint32_t frames);
+
+#endif /* DSP_GRAPH_H */
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef XCORE_APP_H
+#define XCORE_APP_H
+
+/* 核0与核1共用的音频格式和周期环配置 */
+
+#define XCORE_SAMPLE_RATE        (48000U)
+#define XCORE_LINE_NUM           (4U)
+#define XCORE_CHANNEL_PER_LINE   (4U)
+#define XCORE_CHANNEL_NUM        (XCORE_LINE_NUM * XCORE_CHANNEL_PER_LINE)
+
+/* 每个周期的帧数和字节数，burst顺序，每个采样32位 */
+#define XCORE_PERIOD_FRAMES      (128U)
+#define XCORE_PERIOD_BYTES       (XCORE_PERIOD_FRAMES * XCORE_CHANNEL_NUM * 4U)
+/* 跨核周期环的槽数 */
+#define XCORE_SLOT_NUM           (4U)
+
+/* 核0使用MBX0A，核1使用MBX0B，第一条消息为环的系统地址，之后只作为门铃 */
+#define XCORE_CORE0_MBX          HPM_MBX0A
+#define XCORE_CORE0_MBX_IRQ      IRQn_MBX0A
+#define XCORE_CORE1_MBX          HPM_MBX0B
+#define XCORE_CORE1_MBX_IRQ      IRQn_MBX0B
+
+#endif /* XCORE_APP_H */
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * 这是一个从SPI NOR Flash流式播放PCM音频到I2S 4数据线的示例程序
+ * SPI NOR的DMA读直接填充SRAM中的周期缓冲区环，I2S发送DMA(DMAv2 burst模式)
+ * 沿循环链表描述符依次搬空这些缓冲区，CPU全程不拷贝音频采样数据
+ */
+
+#include "board.h"
+#include "hpm_i2s_drv.h"
+#include "hpm_dmav2_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_mchtmr_drv.h"
+#include "hpm_serial_nor.h"
+#include "hpm_serial_nor_host_port.h"
+#include "i2s_multiline_dma_mgr.h"
+#include "i2s_multiline_cfg.h"
+
+/* DMA配置相关定义 */
+#define TEST_I2S_DMA              HPM_XDMA
+#define TEST_I2S_DMA_IRQ          IRQn_XDMA
+#define TEST_I2S_DMA_TX_REQ       HPM_DMA_SRC_I2S0_TX
+
+/* I2S与SPI NOR共用的DMA通道由资源管理器分配，可分配的通道 */
+#define APP_DMA_CHANNEL_MASK      (0x000000FFUL)
+
+/* I2S主设备配置 */
+#define I2S_MASTER               HPM_I2S0
+#define I2S_MASTER_CLOCK_NAME    clock_i2s0
+
+/* 音频格式：4条数据线，每线立体声，32位，Flash中按line0..line3循环排列 */
+#define AUDIO_SAMPLE_RATE        (48000U)
+#define AUDIO_LINE_NUM           (4U)
+#define AUDIO_CHANNEL_PER_LINE   (2U)
+
+I2S_MULTILINE_CFG_DEFINE(audio_cfg, AUDIO_LINE_NUM, 32, AUDIO_CHANNEL_PER_LINE, I2S_MULTILINE_CFG_ENGINE_BURST,
+                         AUDIO_SAMPLE_RATE)
+
+/* 周期缓冲区环配置 */
+#define PERIOD_FRAMES            (256U)
+#define PERIOD_BYTES             (PERIOD_FRAMES * audio_cfg_frame_bytes)
+#define PERIOD_NUM               (4U)
+
+/* Flash中音频片段配置 */
+#define AUDIO_FLASH_OFFSET       (0x100000U)
+#define AUDIO_CLIP_PERIODS       (188U)      /* 约1秒 */
+#define AUDIO_CLIP_BYTES         (AUDIO_CLIP_PERIODS * PERIOD_BYTES)
+#ifndef AUDIO_PLAY_LOOPS
+#define AUDIO_PLAY_LOOPS         (10U)
+#endif
+
+/*
+ * 为1时启动时擦除并写入测试音频片段，每次上电都会写一遍Flash。
+ * 只需以1编译运行一次写入片段，之后以默认的0编译，直接播放Flash中已有的片段
+ */
+#ifndef AUDIO_PROGRAM_TEST_CLIP
+#define AUDIO_PROGRAM_TEST_CLIP  0
+#endif
+
+/* 周期缓冲区与DMA链表描述符，放在非缓存区，SPI DMA写入和I2S DMA读出均无需缓存维护 */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) uint8_t period_buf[PERIOD_NUM][PERIOD_BYTES];
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(8) dma_linked_descriptor_t tx_desc[PERIOD_NUM];
+
+hpm_serial_nor_t nor_flash_dev = {0};
+uint8_t i2s_tx_dma_channel;          /* 运行时分配的I2S发送DMA通道 */
+
+/* 流控状态：生产者(SPI NOR读)与消费者(I2S DMA)各自只写一个计数 */
+volatile uint32_t period_filled;     /* 已填充的周期数 */
+volatile uint32_t period_played;     /* DMA已播放完的周期数 */
+volatile uint32_t period_total;      /* 本次播放的总周期数 */
+volatile uint32_t underrun_count;    /* 欠载次数：DMA进入尚未填充的周期 */
+volatile bool     dma_transfer_error;
+volatile bool     audio_play_complete;
+
+/* 时间统计(mchtmr计数)：DMA中断处理时间，CPU等待SPI DMA读完成的时间 */
+volatile uint64_t isr_ticks;
+uint64_t read_wait_ticks;
+
+/*
+ * I2S发送DMA通道的中断回调
+ * 每播放完一个周期触发一次，推进消费计数并检测欠载
+ */
+static void i2s_tx_dma_callback(uint8_t channel, uint32_t stat, void *user_data)
+{
+    (void)user_data;
+
+    /* 错误与传输完成可能出现在同一次状态中，分别检查 */
+    if (stat & DMA_CHANNEL_STATUS_ERROR) {
+        dma_transfer_error = true;
+    }
+    if (stat & DMA_CHANNEL_STATUS_TC) {
+        period_played++;
+        if (period_played >= period_total) {
+            dma_disable_channel(TEST_I2S_DMA, channel);
+            audio_play_complete = true;
+        } else if (period_filled <= period_played) {
+            /* DMA已进入未填充的周期，播放的是旧数据 */
+            underrun_count++;
+        }
+    }
+}
+
+/*
+ * DMA中断处理函数
+ * 由资源管理器读取一次挂起状态并分发到各通道的回调
+ */
+SDK_DECLARE_EXT_ISR_M(TEST_I2S_DMA_IRQ, isr_dma)
+void isr_dma(void)
+{
+    uint64_t start = mchtmr_get_count(HPM_MCHTMR);
+
+    i2s_multiline_dma_mgr_irq_handler(TEST_I2S_DMA);
+
+    isr_ticks += mchtmr_get_count(HPM_MCHTMR) - start;
+}
+
+/*
+ * 重新实现SPI NOR移植层的通道获取函数，从资源管理器分配收发通道
+ */
+hpm_stat_t serial_nor_get_board_dma_channel(void *dma_base, uint8_t *rx_dma_ch, uint8_t *tx_dma_ch)
+{
+    hpm_stat_t stat;
+
+    stat = i2s_multiline_dma_mgr_add_controller((DMAV2_Type *)dma_base, BOARD_APP_DMAMUX, APP_DMA_CHANNEL_MASK);
+    if (stat != status_success) {
+        return stat;
+    }
+    stat = i2s_multiline_dma_mgr_request((DMAV2_Type *)dma_base, BOARD_APP_SPI_RX_DMA, rx_dma_ch);
+    if (stat != status_success) {
+        return stat;
+    }
+    return i2s_multiline_dma_mgr_request((DMAV2_Type *)dma_base, BOARD_APP_SPI_TX_DMA, tx_dma_ch);
+}
+
+/*
+ * I2S发送DMA环配置函数
+ * 每个周期缓冲区对应一个链表描述符，最后一个描述符指回第一个，形成循环
+ */
+hpm_stat_t i2s_tx_dma_ring_config(DMAV2_Type *dma_ptr, uint8_t dma_channel)
+{
+    hpm_stat_t stat;
+    dma_channel_config_t ch_config;
+
+    dma_default_channel_config(dma_ptr, &ch_config);
+    ch_config.dst_addr = (uint32_t)&I2S_MASTER->TXD[0];               /* 目标地址 */
+    ch_config.src_width = DMA_TRANSFER_WIDTH_WORD;                    /* 源数据宽度：32位 */
+    ch_config.dst_width = DMA_TRANSFER_WIDTH_WORD;                    /* 目标数据宽度：32位 */
+    ch_config.src_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;          /* 源地址递增 */
+    ch_config.dst_addr_ctrl = DMA_ADDRESS_CONTROL_INCREMENT;          /* 目标地址在burst内递增 */
+    ch_config.size_in_byte = PERIOD_BYTES;                            /* 每个描述符传输一个周期 */
+    ch_config.dst_mode = DMA_HANDSHAKE_MODE_HANDSHAKE;                /* 硬件握手模式 */
+    ch_config.en_dst_burst_in_fixed_trans = true;                     /* 使能burst传输 */
+    ch_config.src_burst_size = DMA_NUM_TRANSFER_PER_BURST_4T;         /* burst大小：4次传输，对应4条数据线 */
+    ch_config.interrupt_mask = DMA_INTERRUPT_MASK_HALF_TC;            /* 仅使用周期完成中断 */
+
+    for (uint32_t i = 0; i < PERIOD_NUM; i++) {
+        ch_config.src_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)period_buf[i]);
+        ch_config.linked_ptr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)&tx_desc[(i + 1U) % PERIOD_NUM]);
+        stat = dma_config_linked_descriptor(dma_ptr, &tx_desc[i], dma_channel, &ch_config);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    /* 通道从第0个周期开始，之后沿描述符环循环 */
+    ch_config.src_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)period_buf[0]);
+    ch_config.linked_ptr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)&tx_desc[1 % PERIOD_NUM]);
+    stat = dma_setup_channel(dma_ptr, dma_channel, &ch_config, false);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    /* DMAMUX已在分配通道时连接到I2S发送请求 */
+    return status_success;
+}
+
+/*
+ * I2S主模式多通道配置函数
+ * 配置I2S 4通道进行发送
+ */
+void i2s_master_multiline_config(void)
+{
+    uint32_t i2s_mclk_hz = clock_get_frequency(I2S_MASTER_CLOCK_NAME);
+
+    /* 采样率、位深、数据线、时隙掩码和FIFO阈值均来自编译期配置 */
+    if (status_success != audio_cfg_config_i2s(I2S_MASTER, i2s_mclk_hz, audio_cfg_fifo_threshold)) {
+        printf("I2S config failed!\n");
+    }
+}
+
+#if AUDIO_PROGRAM_TEST_CLIP
+/*
+ * 向Flash写入测试音频片段
+ * 每条数据线输出不同频率的锯齿波，数据已按line0..line3的burst顺序排列
+ */
+hpm_stat_t program_test_clip(void)
+{
+    hpm_stat_t stat;
+    uint32_t *words = (uint32_t *)period_buf[0];
+    uint32_t phase[AUDIO_LINE_NUM] = {0};
+    const uint32_t step[AUDIO_LINE_NUM] = {0x01000000U, 0x02000000U, 0x03000000U, 0x04000000U};
+
+    printf("programming %d KB test clip...\n", AUDIO_CLIP_BYTES / 1024);
+    stat = hpm_serial_nor_erase_blocking(&nor_flash_dev, AUDIO_FLASH_OFFSET, AUDIO_CLIP_BYTES);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    for (uint32_t p = 0; p < AUDIO_CLIP_PERIODS; p++) {
+        for (uint32_t f = 0; f < PERIOD_FRAMES * AUDIO_CHANNEL_PER_LINE; f++) {
+            for (uint32_t line = 0; line < AUDIO_LINE_NUM; line++) {
+                words[f * AUDIO_LINE_NUM + line] = phase[line];
+                phase[line] += step[line];
+            }
+        }
+        stat = hpm_serial_nor_program_blocking(&nor_flash_dev, period_buf[0], PERIOD_BYTES,
+                                               AUDIO_FLASH_OFFSET + p * PERIOD_BYTES);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+    return status_success;
+}
+#endif
+
+/*
+ * 填充一个周期
+ * SPI NOR的DMA直接写入周期缓冲区，CPU不接触采样数据
+ */
+hpm_stat_t fill_period(uint32_t period)
+{
+    hpm_stat_t stat;
+    uint32_t flash_addr = AUDIO_FLASH_OFFSET + (period % AUDIO_CLIP_PERIODS) * PERIOD_BYTES;
+    uint64_t start = mchtmr_get_count(HPM_MCHTMR);
+
+    stat = hpm_serial_nor_read(&nor_flash_dev, period_buf[period % PERIOD_NUM], PERIOD_BYTES, flash_addr);
+    read_wait_ticks += mchtmr_get_count(HPM_MCHTMR) - start;
+    return stat;
+}
+
+/*
+ * Flash到I2S流式播放测试函数
+ */
+void test_i2s_nor_flash_stream(void)
+{
+    hpm_stat_t stat;
+    uint64_t play_start, play_ticks;
+    uint32_t timer_freq_in_hz = clock_get_frequency(clock_mchtmr0);
+
+    period_filled = 0;
+    period_played = 0;
+    period_total = AUDIO_CLIP_PERIODS * AUDIO_PLAY_LOOPS;
+    underrun_count = 0;
+    dma_transfer_error = false;
+    audio_play_complete = false;
+    isr_ticks = 0;
+    read_wait_ticks = 0;
+
+    i2s_master_multiline_config();
+
+    /* 启动前预填充全部周期 */
+    for (uint32_t i = 0; i < PERIOD_NUM; i++) {
+        if (fill_period(i) != status_success) {
+            printf("flash read failed\n");
+            return;
+        }
+        period_filled++;
+    }
+    read_wait_ticks = 0;
+
+    stat = i2s_tx_dma_ring_config(TEST_I2S_DMA, i2s_tx_dma_channel);
+    if (stat != status_success) {
+        printf("I2S DMA ring config failed!\n");
+        return;
+    }
+
+    intc_m_enable_irq_with_priority(TEST_I2S_DMA_IRQ, 1);
+    i2s_enable_tx_dma_request(I2S_MASTER);
+    dma_enable_channel(TEST_I2S_DMA, i2s_tx_dma_channel);
+    i2s_start(I2S_MASTER);
+    play_start = mchtmr_get_count(HPM_MCHTMR);
+
+    /* 生产者：环中有空闲周期时从Flash读取下一周期 */
+    while ((!audio_play_complete) && (!dma_transfer_error)) {
+        uint32_t played = period_played;
+
+        if (period_filled <= played) {
+            /* 欠载后跳过DMA正在播放的周期，重新与消费者对齐 */
+            period_filled = played + 1U;
+        }
+        if ((period_filled < played + PERIOD_NUM) && (period_filled < period_total)) {
+            if (fill_period(period_filled) != status_success) {
+                printf("flash read failed\n");
+                break;
+            }
+            period_filled++;
+        } else {
+            /* 环满，等待DMA播放完一个周期 */
+            __asm("nop");
+        }
+    }
+    play_ticks = mchtmr_get_count(HPM_MCHTMR) - play_start;
+
+    /* 此时尚有数据在FIFO中未完全发出，可以等待一段时间 */
+
+    /* 停止I2S传输 */
+    dma_disable_channel(TEST_I2S_DMA, i2s_tx_dma_channel);
+    i2s_stop(I2S_MASTER);
+
+    if (dma_transfer_error) {
+        printf("dma transfer i2s data failed\n");
+    }
+    printf("I2S flash stream done: %d periods, %d underruns\n", period_played, underrun_count);
+    printf("play time: %d ms, read wait: %d.%02d%%, DMA ISR: %d.%02d%%\n",
+           (uint32_t)(play_ticks * 1000U / timer_freq_in_hz),
+           (uint32_t)(read_wait_ticks * 100U / play_ticks), (uint32_t)(read_wait_ticks * 10000U / play_ticks % 100U),
+           (uint32_t)(isr_ticks * 100U / play_ticks), (uint32_t)(isr_ticks * 10000U / play_ticks % 100U));
+}
+
+/*
+ * I2S多通道引脚初始化函数
+ * 配置I2S相关的GPIO引脚功能
+ */
+void init_i2s_multiline_pin(void)
+{
+    /* 配置I2S引脚功能，引脚表见i2s_multiline_cfg.h */
+    audio_cfg_init_pins();
+}
+
+/*
+ * 主函数
+ */
+int main(void)
+{
+    hpm_serial_nor_info_t flash_info;
+
+    /* 初始化板级设备和时钟 */
+    board_init();
+    printf("I2S multiline stream from SPI NOR flash example\n");
+
+    /* 分配I2S发送DMA通道，SPI NOR的通道在获取host配置时分配 */
+    if ((i2s_multiline_dma_mgr_add_controller(TEST_I2S_DMA, BOARD_APP_DMAMUX, APP_DMA_CHANNEL_MASK) != status_success) ||
+        (i2s_multiline_dma_mgr_request(TEST_I2S_DMA, TEST_I2S_DMA_TX_REQ, &i2s_tx_dma_channel) != status_success) ||
+        (i2s_multiline_dma_mgr_set_callback(TEST_I2S_DMA, i2s_tx_dma_channel, i2s_tx_dma_callback, NULL) != status_success)) {
+        printf("I2S DMA channel request failed\n");
+        while (1) {
+        }
+    }
+
+    /* 初始化SPI NOR Flash */
+    if (serial_nor_get_board_host(&nor_flash_dev.host) != status_success) {
+        printf("spi nor dma channel request failed\n");
+        while (1) {
+        }
+    }
+    printf("DMA channels: I2S TX %d, SPI NOR RX %d TX %d\n", i2s_tx_dma_channel,
+           nor_flash_dev.host.host_param.param.dma_control.rx_dma_ch,
+           nor_flash_dev.host.host_param.param.dma_control.tx_dma_ch);
+    board_init_spi_clock(nor_flash_dev.host.host_param.param.host_base);
+    serial_nor_spi_pins_init(nor_flash_dev.host.host_param.param.host_base);
+    if (hpm_serial_nor_init(&nor_flash_dev, &flash_info) != status_success) {
+        printf("spi nor flash init error\n");
+        while (1) {
+        }
+    }
+
+#if AUDIO_PROGRAM_TEST_CLIP
+    if (program_test_clip() != status_success) {
+        printf("program test clip failed\n");
+        while (1) {
+        }
+    }
+#else
+    /* 片段区为擦除状态(全0xFF)时提示先写入片段 */
+    if ((hpm_serial_nor_read(&nor_flash_dev, period_buf[0], sizeof(uint32_t), AUDIO_FLASH_OFFSET) == status_success) &&
+        (*(uint32_t *)period_buf[0] == 0xFFFFFFFFUL)) {
+        printf("no audio clip in flash, build once with AUDIO_PROGRAM_TEST_CLIP=1\n");
+    }
+#endif
+
+    /* 配置I2S时钟和引脚 */
+    board_config_i2s_clock(I2S_MASTER, AUDIO_SAMPLE_RATE);
+    init_i2s_multiline_pin();
+
+    /* 执行Flash到I2S流式播放测试 */
+    test_i2s_nor_flash_stream();
+
+    /* 主循环 */
+    while (1) {
+        __asm("nop");
+    }
+
+    return 0;
+}
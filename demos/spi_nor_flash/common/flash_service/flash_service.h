@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _FLASH_SERVICE_H
+#define _FLASH_SERVICE_H
+
+#include "hpm_common.h"
+#include "hpm_serial_nor.h"
+
+/*
+ * Flash service shared between two cores.
+ *
+ * The server core owns the SPI NOR and executes read, program and erase requests taken
+ * from a single-producer single-consumer ring; the client core only fills requests. The
+ * ring lives in memory visible to both cores and is split into cache lines written by one
+ * side only: the request line(s) and head index by the client, the status and tail index
+ * by the server. Each side publishes its line with a fence (and a cache writeback on the
+ * server) before moving its index, so no lock is needed.
+ *
+ * Program and erase are posted: the data is copied into the slot's bounce buffer and the
+ * call returns at once; a failure is reported by the next call. Reads wait for their slot
+ * to complete, and since the ring is FIFO they always observe earlier posted writes.
+ *
+ * The client memory (ring and bounce buffers) must be noncacheable on the client core; the
+ * server invalidates and writes back the lines it touches, so it works whether or not the
+ * same memory is cacheable on its side. The transport is abstracted by two hooks:
+ * doorbell() wakes the peer (a mailbox write on hardware) and wait() blocks until the peer
+ * rings back, so the ring logic does not depend on the mailbox peripheral.
+ */
+
+#define FLASH_SERVICE_RING_SIZE      (4U)        /* power of two */
+#define FLASH_SERVICE_XFER_SIZE      (4096U)     /* bytes per request and bounce buffer */
+#define FLASH_SERVICE_LINE_SIZE      (64U)       /* cache line size of both cores */
+#define FLASH_SERVICE_MAGIC          (0x464C5356UL)
+
+typedef enum {
+    flash_service_op_read = 1,
+    flash_service_op_program,
+    flash_service_op_erase,
+} flash_service_op_t;
+
+/*
+ * One cache line per request, so the server invalidates exactly the slot it is about to
+ * read and never drops a neighbouring slot the client is still filling
+ */
+typedef struct {
+    uint32_t op;
+    uint32_t addr;                /* flash address */
+    uint32_t len;                 /* read/program: at most FLASH_SERVICE_XFER_SIZE; erase: any length */
+    uint32_t buf;                 /* bounce buffer, system address */
+} ATTR_ALIGN(FLASH_SERVICE_LINE_SIZE) flash_service_req_t;
+
+/* Ring control block, placed in memory shared by both cores */
+typedef struct {
+    /* Written by the client only */
+    struct {
+        volatile uint32_t head;   /* requests submitted */
+        uint32_t pool;            /* bounce buffers, FLASH_SERVICE_RING_SIZE * FLASH_SERVICE_XFER_SIZE bytes */
+    } ATTR_ALIGN(FLASH_SERVICE_LINE_SIZE) client;
+    flash_service_req_t req[FLASH_SERVICE_RING_SIZE] ATTR_ALIGN(FLASH_SERVICE_LINE_SIZE);
+    /* Written by the server only */
+    struct {
+        volatile uint32_t tail;   /* requests completed */
+        volatile uint32_t ready;  /* FLASH_SERVICE_MAGIC once the flash is initialized */
+        volatile int32_t init_status;
+        uint32_t size_in_kbytes;
+        uint32_t sector_size_kbytes;
+        uint32_t block_size_kbytes;
+        uint32_t page_size;
+        volatile int32_t status[FLASH_SERVICE_RING_SIZE];
+    } ATTR_ALIGN(FLASH_SERVICE_LINE_SIZE) server;
+} flash_service_ring_t;
+
+typedef void (*flash_service_doorbell_t)(void *context);
+/* Block until the peer rings the doorbell or the timeout elapses */
+typedef hpm_stat_t (*flash_service_wait_t)(void *context);
+
+typedef struct {
+    flash_service_ring_t *ring;
+    uint8_t *pool;
+    flash_service_doorbell_t doorbell;
+    flash_service_wait_t wait;
+    void *context;
+    uint32_t head;                /* local copy of ring->client.head */
+    uint32_t checked;             /* completions whose status has been collected */
+    hpm_stat_t deferred;          /* first failure of a posted request */
+    uint32_t full_waits;          /* posts that found the ring full */
+} flash_service_client_t;
+
+typedef struct {
+    flash_service_ring_t *ring;
+    hpm_serial_nor_t *nor;
+    flash_service_doorbell_t doorbell;
+    void *context;
+    uint32_t served;
+} flash_service_server_t;
+
+/*
+ * Client side. ring and pool must be reachable by the server's SPI DMA; pool is
+ * FLASH_SERVICE_RING_SIZE * FLASH_SERVICE_XFER_SIZE bytes, cache line aligned, pool_sys_addr
+ * is its address as seen by the server.
+ */
+void flash_service_client_init(flash_service_client_t *client, flash_service_ring_t *ring, uint8_t *pool,
+                               uint32_t pool_sys_addr, flash_service_doorbell_t doorbell,
+                               flash_service_wait_t wait, void *context);
+/* Wait for the server to publish the flash geometry */
+hpm_stat_t flash_service_client_wait_ready(flash_service_client_t *client, hpm_serial_nor_info_t *info);
+hpm_stat_t flash_service_read(flash_service_client_t *client, uint8_t *buf, uint32_t len, uint32_t addr);
+hpm_stat_t flash_service_program(flash_service_client_t *client, const uint8_t *buf, uint32_t len, uint32_t addr);
+hpm_stat_t flash_service_erase(flash_service_client_t *client, uint32_t addr, uint32_t len);
+/* Wait for all posted requests and return the first failure since the last call */
+hpm_stat_t flash_service_flush(flash_service_client_t *client);
+
+/* Server side: publish the flash geometry, then serve requests */
+void flash_service_server_init(flash_service_server_t *server, flash_service_ring_t *ring, hpm_serial_nor_t *nor,
+                               hpm_stat_t init_status, flash_service_doorbell_t doorbell, void *context);
+/* Execute every pending request; returns false if the ring was empty */
+bool flash_service_server_poll(flash_service_server_t *server);
+
+#endif
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "flash_service.h"
+
+/* Collect the status of requests completed since the last call, keeping the first failure */
+static void client_collect(flash_service_client_t *client)
+{
+    uint32_t tail = client->ring->server.tail;
+    int32_t status;
+
+    __sync_synchronize();
+    while (client->checked != tail) {
+        status = client->ring->server.status[client->checked % FLASH_SERVICE_RING_SIZE];
+        if ((status != status_success) && (client->deferred == status_success)) {
+            client->deferred = status;
+        }
+        client->checked++;
+    }
+}
+
+/* Wait until at most `outstanding` requests have not completed */
+static hpm_stat_t client_wait_outstanding(flash_service_client_t *client, uint32_t outstanding)
+{
+    hpm_stat_t stat;
+
+    client_collect(client);
+    while ((client->head - client->checked) > outstanding) {
+        stat = client->wait(client->context);
+        client_collect(client);
+        if ((stat != status_success) && ((client->head - client->checked) > outstanding)) {
+            return stat;
+        }
+    }
+    return status_success;
+}
+
+/* Bounce buffer of the next slot */
+static uint8_t *client_slot_buf(flash_service_client_t *client)
+{
+    return client->pool + (client->head % FLASH_SERVICE_RING_SIZE) * FLASH_SERVICE_XFER_SIZE;
+}
+
+/* Fill the next slot and publish it; the caller has made sure the slot is free */
+static void client_submit(flash_service_client_t *client, uint32_t op, uint32_t addr, uint32_t len)
+{
+    flash_service_req_t *req = &client->ring->req[client->head % FLASH_SERVICE_RING_SIZE];
+
+    req->op = op;
+    req->addr = addr;
+    req->len = len;
+    req->buf = client->ring->client.pool + (client->head % FLASH_SERVICE_RING_SIZE) * FLASH_SERVICE_XFER_SIZE;
+    /* The request must be visible before the index that hands it over */
+    __sync_synchronize();
+    client->head++;
+    client->ring->client.head = client->head;
+    __sync_synchronize();
+    client->doorbell(client->context);
+}
+
+/* Take the first failure of a posted request, if any */
+static hpm_stat_t client_take_deferred(flash_service_client_t *client)
+{
+    hpm_stat_t stat = client->deferred;
+
+    client->deferred = status_success;
+    return stat;
+}
+
+static hpm_stat_t client_post(flash_service_client_t *client, uint32_t op, const uint8_t *buf, uint32_t len,
+                              uint32_t addr)
+{
+    hpm_stat_t stat;
+
+    client_collect(client);
+    if ((client->head - client->checked) >= FLASH_SERVICE_RING_SIZE) {
+        client->full_waits++;
+    }
+    stat = client_wait_outstanding(client, FLASH_SERVICE_RING_SIZE - 1U);
+    if (stat != status_success) {
+        return stat;
+    }
+    if (buf != NULL) {
+        memcpy(client_slot_buf(client), buf, len);
+    }
+    client_submit(client, op, addr, len);
+    return status_success;
+}
+
+void flash_service_client_init(flash_service_client_t *client, flash_service_ring_t *ring, uint8_t *pool,
+                               uint32_t pool_sys_addr, flash_service_doorbell_t doorbell,
+                               flash_service_wait_t wait, void *context)
+{
+    memset(client, 0, sizeof(*client));
+    memset(ring, 0, sizeof(*ring));
+    ring->client.pool = pool_sys_addr;
+    client->ring = ring;
+    client->pool = pool;
+    client->doorbell = doorbell;
+    client->wait = wait;
+    client->context = context;
+    client->deferred = status_success;
+    __sync_synchronize();
+}
+
+hpm_stat_t flash_service_client_wait_ready(flash_service_client_t *client, hpm_serial_nor_info_t *info)
+{
+    flash_service_ring_t *ring = client->ring;
+    hpm_stat_t stat;
+
+    while (ring->server.ready != FLASH_SERVICE_MAGIC) {
+        stat = client->wait(client->context);
+        if ((stat != status_success) && (ring->server.ready != FLASH_SERVICE_MAGIC)) {
+            return stat;
+        }
+    }
+    __sync_synchronize();
+    if (ring->server.init_status != status_success) {
+        return ring->server.init_status;
+    }
+    memset(info, 0, sizeof(*info));
+    info->size_in_kbytes = ring->server.size_in_kbytes;
+    info->sector_size_kbytes = ring->server.sector_size_kbytes;
+    info->block_size_kbytes = ring->server.block_size_kbytes;
+    info->page_size = ring->server.page_size;
+    return status_success;
+}
+
+hpm_stat_t flash_service_read(flash_service_client_t *client, uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    hpm_stat_t stat;
+    uint32_t chunk;
+    uint8_t *slot;
+
+    while (len > 0) {
+        chunk = (len > FLASH_SERVICE_XFER_SIZE) ? FLASH_SERVICE_XFER_SIZE : len;
+        stat = client_post(client, flash_service_op_read, NULL, chunk, addr);
+        if (stat != status_success) {
+            return stat;
+        }
+        /* Earlier posted requests complete first, so this also drains them */
+        slot = client->pool + ((client->head - 1U) % FLASH_SERVICE_RING_SIZE) * FLASH_SERVICE_XFER_SIZE;
+        stat = client_wait_outstanding(client, 0);
+        if (stat != status_success) {
+            return stat;
+        }
+        stat = client_take_deferred(client);
+        if (stat != status_success) {
+            return stat;
+        }
+        memcpy(buf, slot, chunk);
+        buf += chunk;
+        addr += chunk;
+        len -= chunk;
+    }
+    return status_success;
+}
+
+hpm_stat_t flash_service_program(flash_service_client_t *client, const uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    hpm_stat_t stat = client_take_deferred(client);
+    uint32_t chunk;
+
+    while ((stat == status_success) && (len > 0)) {
+        chunk = (len > FLASH_SERVICE_XFER_SIZE) ? FLASH_SERVICE_XFER_SIZE : len;
+        stat = client_post(client, flash_service_op_program, buf, chunk, addr);
+        buf += chunk;
+        addr += chunk;
+        len -= chunk;
+    }
+    return stat;
+}
+
+hpm_stat_t flash_service_erase(flash_service_client_t *client, uint32_t addr, uint32_t len)
+{
+    hpm_stat_t stat = client_take_deferred(client);
+
+    if (stat != status_success) {
+        return stat;
+    }
+    return client_post(client, flash_service_op_erase, NULL, len, addr);
+}
+
+hpm_stat_t flash_service_flush(flash_service_client_t *client)
+{
+    hpm_stat_t stat = client_wait_outstanding(client, 0);
+
+    if (stat != status_success) {
+        return stat;
+    }
+    return client_take_deferred(client);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_l1c_drv.h"
+#include "flash_service.h"
+
+/* Drop stale copies of lines written by the client */
+static inline void server_fetch(void *addr, uint32_t size)
+{
+    l1c_dc_invalidate((uint32_t)addr, size);
+}
+
+/* Push lines written by the server before the client can look at them */
+static inline void server_publish(void *addr, uint32_t size)
+{
+    __sync_synchronize();
+    l1c_dc_writeback((uint32_t)addr, size);
+    __sync_synchronize();
+}
+
+static hpm_stat_t server_execute(flash_service_server_t *server, const flash_service_req_t *req)
+{
+    uint8_t *buf = (uint8_t *)req->buf;
+    hpm_stat_t stat;
+
+    /* Only reads and programs go through the bounce buffer; an erase is posted whole */
+    if ((req->len == 0) ||
+        ((req->op != flash_service_op_erase) && (req->len > FLASH_SERVICE_XFER_SIZE))) {
+        return status_invalid_argument;
+    }
+
+    switch (req->op) {
+    case flash_service_op_read:
+        stat = hpm_serial_nor_read(server->nor, buf, req->len, req->addr);
+        /* The data may have gone through this core's cache if the driver did not use DMA */
+        l1c_dc_flush(req->buf, FLASH_SERVICE_XFER_SIZE);
+        return stat;
+    case flash_service_op_program:
+        l1c_dc_invalidate(req->buf, FLASH_SERVICE_XFER_SIZE);
+        return hpm_serial_nor_program_blocking(server->nor, buf, req->len, req->addr);
+    case flash_service_op_erase:
+        return hpm_serial_nor_erase_blocking(server->nor, req->addr, req->len);
+    default:
+        return status_invalid_argument;
+    }
+}
+
+void flash_service_server_init(flash_service_server_t *server, flash_service_ring_t *ring, hpm_serial_nor_t *nor,
+                               hpm_stat_t init_status, flash_service_doorbell_t doorbell, void *context)
+{
+    hpm_serial_nor_info_t info;
+
+    server->ring = ring;
+    server->nor = nor;
+    server->doorbell = doorbell;
+    server->context = context;
+    server->served = 0;
+
+    if (init_status == status_success) {
+        init_status = hpm_serial_nor_get_info(nor, &info);
+    }
+    if (init_status == status_success) {
+        ring->server.size_in_kbytes = info.size_in_kbytes;
+        ring->server.sector_size_kbytes = info.sector_size_kbytes;
+        ring->server.block_size_kbytes = info.block_size_kbytes;
+        ring->server.page_size = info.page_size;
+    }
+    server_fetch(&ring->client, sizeof(ring->client));
+    ring->server.tail = ring->client.head;
+    ring->server.init_status = init_status;
+    server_publish(&ring->server, sizeof(ring->server));
+    ring->server.ready = FLASH_SERVICE_MAGIC;
+    server_publish(&ring->server, sizeof(ring->server));
+    doorbell(context);
+}
+
+bool flash_service_server_poll(flash_service_server_t *server)
+{
+    flash_service_ring_t *ring = server->ring;
+    uint32_t tail = ring->server.tail;
+    uint32_t head;
+    uint32_t slot;
+    bool busy = false;
+
+    server_fetch(&ring->client, sizeof(ring->client));
+    head = ring->client.head;
+    __sync_synchronize();
+    while (tail != head) {
+        slot = tail % FLASH_SERVICE_RING_SIZE;
+        server_fetch(&ring->req[slot], sizeof(ring->req[slot]));
+        ring->server.status[slot] = server_execute(server, &ring->req[slot]);
+        /* Status first, then the index that tells the client it is valid */
+        server_publish(&ring->server, sizeof(ring->server));
+        ring->server.tail = ++tail;
+        server_publish(&ring->server, sizeof(ring->server));
+        server->doorbell(server->context);
+        server->served++;
+        busy = true;
+
+        server_fetch(&ring->client, sizeof(ring->client));
+        head = ring->client.head;
+        __sync_synchronize();
+    }
+    return busy;
+}
@@ -31,8 +31,24 @@
 
 static void set_spi_clk_frequency(void *ops, uint32_t frequency);
 
+ATTR_WEAK hpm_stat_t serial_nor_get_board_dma_channel(void *dma_base, uint8_t *rx_dma_ch, uint8_t *tx_dma_ch)
+{
+    (void)dma_base;
+    *rx_dma_ch = PORT_SPI_RX_DMA_CH;
+    *tx_dma_ch = PORT_SPI_TX_DMA_CH;
+    return status_success;
+}
+
 ATTR_WEAK hpm_stat_t serial_nor_get_board_host(hpm_serial_nor_host_t *host)
 {
+    uint8_t rx_dma_ch;
+    uint8_t tx_dma_ch;
+    hpm_stat_t stat;
+
+    stat = serial_nor_get_board_dma_channel((void *)PORT_SPI_NOR_DMA, &rx_dma_ch, &tx_dma_ch);
+    if (stat != status_success) {
+        return stat;
+    }
     host->host_param.flags =  PORT_SPI_IO_MODE |
                               SERIAL_NOR_HOST_SUPPORT_DMA |
                               SERIAL_NOR_HOST_SUPPORT_SPI_INTERFACE;
@@ -43,8 +59,8 @@ ATTR_WEAK hpm_stat_t serial_nor_get_board_host(hpm_serial_nor_host_t *host)
     host->host_param.param.host_base = PORT_SPI_BASE;
     host->host_param.param.dma_control.dma_base = PORT_SPI_NOR_DMA;
     host->host_param.param.dma_control.dmamux_base    = PORT_SPI_NOR_DMAMUX;
-    host->host_param.param.dma_control.rx_dma_ch  = PORT_SPI_RX_DMA_CH;
-    host->host_param.param.dma_control.tx_dma_ch  = PORT_SPI_TX_DMA_CH;
+    host->host_param.param.dma_control.rx_dma_ch  = rx_dma_ch;
+    host->host_param.param.dma_control.tx_dma_ch  = tx_dma_ch;
     host->host_param.param.dma_control.rx_dma_req = PORT_SPI_RX_DMA_REQ;
     host->host_param.param.dma_control.tx_dma_req = PORT_SPI_TX_DMA_REQ;
     host->host_param.param.frequency = PORT_SPI_CLK_FREQUENCY;
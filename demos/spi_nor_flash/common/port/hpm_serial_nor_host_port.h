@@ -10,6 +10,11 @@
 
 #include "hpm_serial_nor_host.h"
 
+/*
+ * DMA channels used by the SPI NOR host. The default returns fixed channels;
+ * applications sharing the DMA controller can override it to allocate them at runtime.
+ */
+hpm_stat_t serial_nor_get_board_dma_channel(void *dma_base, uint8_t *rx_dma_ch, uint8_t *tx_dma_ch);
 hpm_stat_t serial_nor_get_board_host(hpm_serial_nor_host_t *host);
 void serial_nor_spi_pins_init(SPI_Type *spi);
 #endif
@@ -77,6 +77,7 @@
 #define INCLUDE_xTaskAbortDelay                 1
 #define INCLUDE_xTaskGetHandle                  1
 #define INCLUDE_xSemaphoreGetMutexHolder        1
+#define INCLUDE_xTaskGetSchedulerState          1
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES                   0
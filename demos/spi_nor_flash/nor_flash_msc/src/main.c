@@ -21,6 +21,11 @@
 #include "hpm_csr_drv.h"
 #include "hpm_serial_nor.h"
 #include "hpm_serial_nor_host_port.h"
+#include "msc_flash_part.h"
+#include "msc_flash_io.h"
+#if MSC_FLASH_OFFLOAD
+#include "msc_flash_offload.h"
+#endif
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -33,6 +38,8 @@
 #define APP_SPI_RX_HDMA_CH         0
 #define APP_SPI_TX_HDMA_CH         1
 #define APP_SPI_CLK_FREQUENCY     (50000000u)
+#define APP_STATS_TASK_PRIORITY   (configMAX_PRIORITIES - 5U)
+#define APP_STATS_PERIOD_MS       (10000U)
 
 
 #ifndef PLACE_BUFF_AT_CACHEABLE
@@ -43,20 +50,37 @@ extern void msc_spi_flash_init(void);
 
 hpm_serial_nor_t nor_flash_dev = {0};
 
+static void stats_task(void *pvParameters)
+{
+    (void)pvParameters;
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(APP_STATS_PERIOD_MS));
+        msc_flash_part_print_stats();
+#if MSC_FLASH_OFFLOAD
+        printf("offload: %lu posts found the ring full\n", msc_flash_offload_get_client()->full_waits);
+#endif
+    }
+}
+
 int main(void)
 {
     hpm_stat_t stat;
     hpm_serial_nor_info_t flash_info;
     board_init();
+#if MSC_FLASH_OFFLOAD
+    /* Core 1 owns the SPI NOR, this core only talks to the flash service */
+    stat = msc_flash_offload_start();
+#else
     serial_nor_get_board_host(&nor_flash_dev.host);
     board_init_spi_clock(nor_flash_dev.host.host_param.param.host_base);
     serial_nor_spi_pins_init(nor_flash_dev.host.host_param.param.host_base);
 
     stat = hpm_serial_nor_init(&nor_flash_dev, &flash_info);
+#endif
     if (stat != status_success) {
         printf("spi nor flash init error\n");
     } else {
-        if (hpm_serial_nor_get_info(&nor_flash_dev, &flash_info) == status_success){
+        if (msc_flash_io_get_info(&nor_flash_dev, &flash_info) == status_success){
             printf("the flash size:%d KB\n", flash_info.size_in_kbytes);
             printf("the flash page_size:%d Byte\n", flash_info.page_size);
             printf("the flash sector_size:%d KB\n", flash_info.sector_size_kbytes);
@@ -66,6 +90,9 @@ int main(void)
         }
         printf("spi nor flash init ok\n");
         msc_spi_flash_init();
+        if (xTaskCreate(stats_task, "stats", configMINIMAL_STACK_SIZE + 256U, NULL, APP_STATS_TASK_PRIORITY, NULL) != pdPASS) {
+            printf("stats task creation failed\n");
+        }
         vTaskStartScheduler();
     }
     while (1) {
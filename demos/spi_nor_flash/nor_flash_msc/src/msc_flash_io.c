@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "msc_flash_io.h"
+
+#if MSC_FLASH_OFFLOAD
+
+static flash_service_client_t *io_client;
+static hpm_serial_nor_info_t io_info;
+
+void msc_flash_io_attach(flash_service_client_t *client)
+{
+    io_client = client;
+}
+
+hpm_stat_t msc_flash_io_get_info(hpm_serial_nor_t *nor, hpm_serial_nor_info_t *info)
+{
+    (void)nor;
+    if (io_info.size_in_kbytes == 0) {
+        hpm_stat_t stat = flash_service_client_wait_ready(io_client, &io_info);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+    *info = io_info;
+    return status_success;
+}
+
+hpm_stat_t msc_flash_io_read(hpm_serial_nor_t *nor, uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    (void)nor;
+    return flash_service_read(io_client, buf, len, addr);
+}
+
+hpm_stat_t msc_flash_io_program(hpm_serial_nor_t *nor, const uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    (void)nor;
+    return flash_service_program(io_client, buf, len, addr);
+}
+
+hpm_stat_t msc_flash_io_erase(hpm_serial_nor_t *nor, uint32_t addr, uint32_t len)
+{
+    (void)nor;
+    return flash_service_erase(io_client, addr, len);
+}
+
+#else
+
+hpm_stat_t msc_flash_io_get_info(hpm_serial_nor_t *nor, hpm_serial_nor_info_t *info)
+{
+    return hpm_serial_nor_get_info(nor, info);
+}
+
+hpm_stat_t msc_flash_io_read(hpm_serial_nor_t *nor, uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    return hpm_serial_nor_read(nor, buf, len, addr);
+}
+
+hpm_stat_t msc_flash_io_program(hpm_serial_nor_t *nor, const uint8_t *buf, uint32_t len, uint32_t addr)
+{
+    return hpm_serial_nor_program_blocking(nor, (uint8_t *)buf, len, addr);
+}
+
+hpm_stat_t msc_flash_io_erase(hpm_serial_nor_t *nor, uint32_t addr, uint32_t len)
+{
+    return hpm_serial_nor_erase_blocking(nor, addr, len);
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _MSC_FLASH_IO_H
+#define _MSC_FLASH_IO_H
+
+#include "hpm_common.h"
+#include "hpm_serial_nor.h"
+
+/*
+ * Flash access used by the partition and log layers.
+ *
+ * By default the calls go straight to serial_nor on this core. With MSC_FLASH_OFFLOAD set
+ * they are forwarded to the flash service on the second core: program and erase are posted
+ * and return once queued, reads wait for completion, and the nor argument is ignored.
+ */
+
+#ifndef MSC_FLASH_OFFLOAD
+#define MSC_FLASH_OFFLOAD 0
+#endif
+
+#if MSC_FLASH_OFFLOAD
+#include "flash_service.h"
+
+void msc_flash_io_attach(flash_service_client_t *client);
+#endif
+
+hpm_stat_t msc_flash_io_get_info(hpm_serial_nor_t *nor, hpm_serial_nor_info_t *info);
+hpm_stat_t msc_flash_io_read(hpm_serial_nor_t *nor, uint8_t *buf, uint32_t len, uint32_t addr);
+hpm_stat_t msc_flash_io_program(hpm_serial_nor_t *nor, const uint8_t *buf, uint32_t len, uint32_t addr);
+hpm_stat_t msc_flash_io_erase(hpm_serial_nor_t *nor, uint32_t addr, uint32_t len);
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "hpm_l1c_drv.h"
+#include "msc_flash_log.h"
+#include "msc_flash_io.h"
+
+#define MSC_LOG_MAGIC           (0x4C4F4731UL) /* "LOG1" */
+#define MSC_LOG_UNMAPPED        (0xFFFFU)
+#define MSC_LOG_ERASED_WORD     (0xFFFFFFFFUL)
+
+#define MSC_LOG_SECTOR_DIRTY    (0U)    /* needs an erase before use */
+#define MSC_LOG_SECTOR_FREE     (1U)    /* erased, header carries only the erase count */
+#define MSC_LOG_SECTOR_OPEN     (2U)    /* current append target */
+#define MSC_LOG_SECTOR_FULL     (3U)
+
+/* Header block at the start of every sector; fields are programmed incrementally over erased (0xFF) flash */
+typedef struct {
+    uint32_t magic;
+    uint32_t erase_count;
+    uint32_t seq;
+    uint32_t reserved;
+    uint32_t lba[MSC_LOG_MAX_BLOCK_PER_SECTOR];
+} msc_log_header_t;
+
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) static msc_log_header_t log_header;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) static uint8_t log_block_buf[MSC_LOG_BLOCK_SIZE];
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE) static uint32_t log_word_buf[4];
+
+static inline uint32_t log_sector_addr(msc_log_t *log, uint16_t sector)
+{
+    return log->base + (uint32_t)sector * log->sector_size;
+}
+
+static inline uint32_t log_slot_addr(msc_log_t *log, uint16_t sector, uint16_t slot)
+{
+    return log_sector_addr(log, sector) + MSC_LOG_BLOCK_SIZE * (slot + 1U);
+}
+
+static hpm_stat_t log_program_word(msc_log_t *log, uint32_t addr, uint32_t value)
+{
+    log_word_buf[0] = value;
+    return msc_flash_io_program(log->nor, (uint8_t *)log_word_buf, sizeof(uint32_t), addr);
+}
+
+static hpm_stat_t log_read_header(msc_log_t *log, uint16_t sector)
+{
+    uint32_t len = offsetof(msc_log_header_t, lba) + log->block_per_sector * sizeof(uint32_t);
+    return msc_flash_io_read(log->nor, (uint8_t *)&log_header, len, log_sector_addr(log, sector));
+}
+
+/* Erase a sector and immediately stamp magic + erase count so wear history survives a reset */
+static hpm_stat_t log_erase_sector(msc_log_t *log, uint16_t sector)
+{
+    hpm_stat_t stat;
+    uint32_t addr = log_sector_addr(log, sector);
+
+    stat = msc_flash_io_erase(log->nor, addr, log->sector_size);
+    if (stat != status_success) {
+        return stat;
+    }
+    log->sector_erase[sector]++;
+    log->erase_count++;
+
+    log_word_buf[0] = MSC_LOG_MAGIC;
+    log_word_buf[1] = log->sector_erase[sector];
+    stat = msc_flash_io_program(log->nor, (uint8_t *)log_word_buf, 2 * sizeof(uint32_t), addr);
+    if (stat != status_success) {
+        return stat;
+    }
+    log->state[sector] = MSC_LOG_SECTOR_FREE;
+    log->valid[sector] = 0;
+    log->sector_seq[sector] = MSC_LOG_ERASED_WORD;
+    log->free_sectors++;
+    return status_success;
+}
+
+/* Pick the least-worn erased sector so the erase load is spread evenly */
+static int32_t log_pick_free_sector(msc_log_t *log)
+{
+    int32_t best = -1;
+
+    for (uint16_t i = 0; i < log->sector_num; i++) {
+        if (log->state[i] != MSC_LOG_SECTOR_FREE) {
+            continue;
+        }
+        if ((best < 0) || (log->sector_erase[i] < log->sector_erase[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static hpm_stat_t log_open_sector(msc_log_t *log)
+{
+    int32_t sector = log_pick_free_sector(log);
+    hpm_stat_t stat;
+
+    if (sector < 0) {
+        return status_fail;
+    }
+    stat = log_program_word(log, log_sector_addr(log, sector) + offsetof(msc_log_header_t, seq), log->next_seq);
+    if (stat != status_success) {
+        return stat;
+    }
+    log->sector_seq[sector] = log->next_seq++;
+    log->state[sector] = MSC_LOG_SECTOR_OPEN;
+    log->free_sectors--;
+    log->write_sector = sector;
+    log->write_slot = 0;
+    return status_success;
+}
+
+static hpm_stat_t log_append(msc_log_t *log, uint32_t block, const uint8_t *buffer);
+
+/* Greedy GC: reclaim the closed sector with the fewest live blocks, preferring less-worn sectors on ties */
+static hpm_stat_t log_collect(msc_log_t *log)
+{
+    int32_t victim = -1;
+    hpm_stat_t stat;
+    uint16_t phys;
+
+    for (uint16_t i = 0; i < log->sector_num; i++) {
+        if (log->state[i] != MSC_LOG_SECTOR_FULL) {
+            continue;
+        }
+        if ((victim < 0) || (log->valid[i] < log->valid[victim]) ||
+            ((log->valid[i] == log->valid[victim]) && (log->sector_erase[i] < log->sector_erase[victim]))) {
+            victim = i;
+        }
+    }
+    if ((victim < 0) || (log->valid[victim] >= log->block_per_sector)) {
+        return status_fail;
+    }
+
+    stat = log_read_header(log, victim);
+    if (stat != status_success) {
+        return stat;
+    }
+    /* log_header is reused by log_append(), keep a private copy of the victim's lba table */
+    uint32_t lba[MSC_LOG_MAX_BLOCK_PER_SECTOR];
+    memcpy(lba, log_header.lba, sizeof(lba));
+
+    for (uint16_t slot = 0; slot < log->block_per_sector; slot++) {
+        phys = victim * log->block_per_sector + slot;
+        if ((lba[slot] >= log->block_num) || (log->map[lba[slot]] != phys)) {
+            continue;
+        }
+        stat = msc_flash_io_read(log->nor, log_block_buf, MSC_LOG_BLOCK_SIZE, log_slot_addr(log, victim, slot));
+        if (stat != status_success) {
+            return stat;
+        }
+        stat = log_append(log, lba[slot], log_block_buf);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    log->gc_count++;
+    return log_erase_sector(log, victim);
+}
+
+static hpm_stat_t log_append(msc_log_t *log, uint32_t block, const uint8_t *buffer)
+{
+    hpm_stat_t stat;
+    uint16_t phys;
+    uint16_t old;
+
+    if (log->write_slot >= log->block_per_sector) {
+        if (log->state[log->write_sector] == MSC_LOG_SECTOR_OPEN) {
+            log->state[log->write_sector] = MSC_LOG_SECTOR_FULL;
+        }
+        stat = log_open_sector(log);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+
+    /* Data first, then the lba tag: a torn write leaves an untagged slot that the next scan ignores */
+    stat = msc_flash_io_program(log->nor, (uint8_t *)buffer, MSC_LOG_BLOCK_SIZE,
+                                log_slot_addr(log, log->write_sector, log->write_slot));
+    if (stat != status_success) {
+        return stat;
+    }
+    stat = log_program_word(log, log_sector_addr(log, log->write_sector) + offsetof(msc_log_header_t, lba) +
+                            log->write_slot * sizeof(uint32_t), block);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    phys = log->write_sector * log->block_per_sector + log->write_slot;
+    old = log->map[block];
+    if (old != MSC_LOG_UNMAPPED) {
+        log->valid[old / log->block_per_sector]--;
+    }
+    log->map[block] = phys;
+    log->valid[log->write_sector]++;
+    log->write_slot++;
+    return status_success;
+}
+
+hpm_stat_t msc_log_init(msc_log_t *log, hpm_serial_nor_t *nor, uint32_t base, uint32_t size, uint32_t sector_size)
+{
+    hpm_stat_t stat;
+    uint16_t order[MSC_LOG_MAX_SECTORS];
+    uint16_t used = 0;
+
+    memset(log, 0, sizeof(*log));
+    log->nor = nor;
+    log->base = base;
+    log->sector_size = sector_size;
+    log->sector_num = size / sector_size;
+    log->block_per_sector = (sector_size / MSC_LOG_BLOCK_SIZE) - 1U;
+    if ((log->sector_num <= MSC_LOG_SPARE_SECTORS) || (log->sector_num > MSC_LOG_MAX_SECTORS) ||
+        (log->block_per_sector == 0) || (log->block_per_sector > MSC_LOG_MAX_BLOCK_PER_SECTOR)) {
+        return status_invalid_argument;
+    }
+    log->block_num = (uint32_t)(log->sector_num - MSC_LOG_SPARE_SECTORS) * log->block_per_sector;
+    if (log->block_num > MSC_LOG_MAX_BLOCKS) {
+        log->block_num = MSC_LOG_MAX_BLOCKS;
+    }
+    memset(log->map, 0xFF, sizeof(log->map));
+
+    /* Classify every sector from its header */
+    for (uint16_t i = 0; i < log->sector_num; i++) {
+        stat = log_read_header(log, i);
+        if (stat != status_success) {
+            return stat;
+        }
+        if (log_header.magic != MSC_LOG_MAGIC) {
+            log->state[i] = MSC_LOG_SECTOR_DIRTY;
+            continue;
+        }
+        log->sector_erase[i] = log_header.erase_count;
+        log->sector_seq[i] = log_header.seq;
+        if (log_header.seq == MSC_LOG_ERASED_WORD) {
+            log->state[i] = MSC_LOG_SECTOR_FREE;
+            log->free_sectors++;
+            continue;
+        }
+        log->state[i] = MSC_LOG_SECTOR_FULL;
+        if (log_header.seq >= log->next_seq) {
+            log->next_seq = log_header.seq + 1U;
+        }
+        /* Insertion sort by sequence number so the replay below sees writes in order */
+        uint16_t pos = used++;
+        while ((pos > 0) && (log->sector_seq[order[pos - 1]] > log_header.seq)) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+
+    /* Replay: later slots override earlier ones */
+    for (uint16_t n = 0; n < used; n++) {
+        uint16_t sector = order[n];
+        stat = log_read_header(log, sector);
+        if (stat != status_success) {
+            return stat;
+        }
+        for (uint16_t slot = 0; slot < log->block_per_sector; slot++) {
+            uint32_t lba = log_header.lba[slot];
+            if (lba == MSC_LOG_ERASED_WORD) {
+                break;
+            }
+            if (lba >= log->block_num) {
+                continue;
+            }
+            if (log->map[lba] != MSC_LOG_UNMAPPED) {
+                log->valid[log->map[lba] / log->block_per_sector]--;
+            }
+            log->map[lba] = sector * log->block_per_sector + slot;
+            log->valid[sector]++;
+        }
+    }
+
+    /* Unformatted or torn sectors are erased up front */
+    for (uint16_t i = 0; i < log->sector_num; i++) {
+        if (log->state[i] == MSC_LOG_SECTOR_DIRTY) {
+            stat = log_erase_sector(log, i);
+            if (stat != status_success) {
+                return stat;
+            }
+        }
+    }
+    /* The scan above counts those erases as runtime wear, keep statistics for this boot only */
+    log->erase_count = 0;
+
+    /*
+     * Never append to the sector that was open before reset: a torn write may have
+     * left programmed data in an untagged slot, so start a fresh sector instead.
+     */
+    return log_open_sector(log);
+}
+
+hpm_stat_t msc_log_read(msc_log_t *log, uint32_t block, uint8_t *buffer)
+{
+    uint16_t phys;
+
+    if (block >= log->block_num) {
+        return status_invalid_argument;
+    }
+    phys = log->map[block];
+    if (phys == MSC_LOG_UNMAPPED) {
+        memset(buffer, 0, MSC_LOG_BLOCK_SIZE);
+        return status_success;
+    }
+    return msc_flash_io_read(log->nor, buffer, MSC_LOG_BLOCK_SIZE,
+                             log_slot_addr(log, phys / log->block_per_sector, phys % log->block_per_sector));
+}
+
+hpm_stat_t msc_log_write(msc_log_t *log, uint32_t block, const uint8_t *buffer)
+{
+    hpm_stat_t stat;
+
+    if (block >= log->block_num) {
+        return status_invalid_argument;
+    }
+    /* Keep one erased sector in reserve for the collector before opening the next sector */
+    if (log->write_slot >= log->block_per_sector) {
+        log->state[log->write_sector] = MSC_LOG_SECTOR_FULL;
+    }
+    while ((log->write_slot >= log->block_per_sector) && (log->free_sectors < MSC_LOG_SPARE_SECTORS)) {
+        stat = log_collect(log);
+        if (stat != status_success) {
+            return stat;
+        }
+    }
+    return log_append(log, block, buffer);
+}
+
+void msc_log_get_wear(msc_log_t *log, uint32_t *min_erase, uint32_t *max_erase)
+{
+    uint32_t min = MSC_LOG_ERASED_WORD;
+    uint32_t max = 0;
+
+    for (uint16_t i = 0; i < log->sector_num; i++) {
+        if (log->sector_erase[i] < min) {
+            min = log->sector_erase[i];
+        }
+        if (log->sector_erase[i] > max) {
+            max = log->sector_erase[i];
+        }
+    }
+    *min_erase = min;
+    *max_erase = max;
+}
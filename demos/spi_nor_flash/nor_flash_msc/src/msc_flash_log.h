@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _MSC_FLASH_LOG_H
+#define _MSC_FLASH_LOG_H
+
+#include "hpm_common.h"
+#include "hpm_serial_nor.h"
+
+/*
+ * Log-structured block store for write-heavy partitions.
+ *
+ * Every flash sector holds one header block followed by data blocks. Writes
+ * are appended to the open sector and never erase in place; stale blocks are
+ * reclaimed by a greedy garbage collector that also picks the least-worn free
+ * sector, so erase traffic is spread over the whole partition and never leaves it.
+ */
+
+#define MSC_LOG_BLOCK_SIZE           (512U)
+#define MSC_LOG_MAX_SECTORS          (512U)
+#define MSC_LOG_MAX_BLOCK_PER_SECTOR (15U)
+#define MSC_LOG_MAX_BLOCKS           (3584U)
+#define MSC_LOG_SPARE_SECTORS        (2U)
+
+typedef struct {
+    hpm_serial_nor_t *nor;
+    uint32_t base;
+    uint32_t sector_size;
+    uint16_t sector_num;
+    uint16_t block_per_sector;
+    uint32_t block_num;
+    uint16_t free_sectors;
+    uint16_t write_sector;
+    uint16_t write_slot;
+    uint32_t next_seq;
+    uint32_t erase_count;
+    uint32_t gc_count;
+    uint16_t map[MSC_LOG_MAX_BLOCKS];                 /* logical block -> physical slot */
+    uint8_t valid[MSC_LOG_MAX_SECTORS];               /* live blocks per sector */
+    uint8_t state[MSC_LOG_MAX_SECTORS];
+    uint32_t sector_seq[MSC_LOG_MAX_SECTORS];
+    uint32_t sector_erase[MSC_LOG_MAX_SECTORS];
+} msc_log_t;
+
+hpm_stat_t msc_log_init(msc_log_t *log, hpm_serial_nor_t *nor, uint32_t base, uint32_t size, uint32_t sector_size);
+hpm_stat_t msc_log_read(msc_log_t *log, uint32_t block, uint8_t *buffer);
+hpm_stat_t msc_log_write(msc_log_t *log, uint32_t block, const uint8_t *buffer);
+void msc_log_get_wear(msc_log_t *log, uint32_t *min_erase, uint32_t *max_erase);
+
+#endif
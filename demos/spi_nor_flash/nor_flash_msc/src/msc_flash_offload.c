@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_mbx_drv.h"
+#include "hpm_mchtmr_drv.h"
+#include "hpm_sysctl_drv.h"
+#include "msc_flash_io.h"
+#include "msc_flash_offload.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+
+#define OFFLOAD_MBX              HPM_MBX0A
+#define OFFLOAD_MBX_IRQ          IRQn_MBX0A
+#define OFFLOAD_CORE1_ENTRY      (0U)        /* core 1 ILM, local address */
+
+/* Core 1 image, generated into sec_core_img.c by the core 1 build */
+extern const uint8_t sec_core_img[];
+extern const uint32_t sec_core_img_size;
+
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(FLASH_SERVICE_LINE_SIZE) static flash_service_ring_t offload_ring;
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+static uint8_t offload_pool[FLASH_SERVICE_RING_SIZE * FLASH_SERVICE_XFER_SIZE];
+
+static flash_service_client_t offload_client;
+static SemaphoreHandle_t offload_doorbell_sem;
+
+SDK_DECLARE_EXT_ISR_M(OFFLOAD_MBX_IRQ, isr_offload_mbx)
+void isr_offload_mbx(void)
+{
+    BaseType_t woken = pdFALSE;
+    uint32_t msg;
+
+    /* Doorbells carry no payload, several completions may share one wake-up */
+    while (mbx_retrieve_message(OFFLOAD_MBX, &msg) == status_success) {
+    }
+    xSemaphoreGiveFromISR(offload_doorbell_sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void offload_doorbell(void *context)
+{
+    (void)context;
+    /* A full TX word means core 1 has an unread doorbell already */
+    (void)mbx_send_message(OFFLOAD_MBX, 0);
+}
+
+static hpm_stat_t offload_wait(void *context)
+{
+    uint64_t timeout;
+    uint64_t start;
+
+    (void)context;
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        return (xSemaphoreTake(offload_doorbell_sem, pdMS_TO_TICKS(MSC_FLASH_OFFLOAD_WAIT_MS)) == pdTRUE) ?
+               status_success : status_timeout;
+    }
+
+    /* Before the scheduler runs (partition setup in main) poll the semaphore */
+    timeout = (uint64_t)clock_get_frequency(clock_mchtmr0) / 1000U * MSC_FLASH_OFFLOAD_WAIT_MS;
+    start = mchtmr_get_count(HPM_MCHTMR);
+    while (xSemaphoreTake(offload_doorbell_sem, 0) != pdTRUE) {
+        if ((mchtmr_get_count(HPM_MCHTMR) - start) > timeout) {
+            return status_timeout;
+        }
+    }
+    return status_success;
+}
+
+static void offload_release_core1(void)
+{
+    uint32_t img_sys_addr = core_local_mem_to_sys_address(HPM_CORE1, OFFLOAD_CORE1_ENTRY);
+    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(img_sys_addr);
+    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(img_sys_addr + sec_core_img_size);
+
+    if (sysctl_is_cpu1_released(HPM_SYSCTL)) {
+        return;
+    }
+    memcpy((void *)img_sys_addr, sec_core_img, sec_core_img_size);
+    l1c_dc_flush(aligned_start, aligned_end - aligned_start);
+    sysctl_set_cpu1_entry(HPM_SYSCTL, OFFLOAD_CORE1_ENTRY);
+    sysctl_release_cpu1(HPM_SYSCTL);
+}
+
+hpm_stat_t msc_flash_offload_start(void)
+{
+    uint32_t ring_sys_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)&offload_ring);
+    uint32_t pool_sys_addr = core_local_mem_to_sys_address(HPM_CORE0, (uint32_t)offload_pool);
+
+    offload_doorbell_sem = xSemaphoreCreateBinary();
+    if (offload_doorbell_sem == NULL) {
+        return status_fail;
+    }
+    flash_service_client_init(&offload_client, &offload_ring, offload_pool, pool_sys_addr,
+                              offload_doorbell, offload_wait, NULL);
+    msc_flash_io_attach(&offload_client);
+
+    mbx_init(OFFLOAD_MBX);
+    mbx_enable_intr(OFFLOAD_MBX, MBX_CR_RWMVIE_MASK);
+    intc_m_enable_irq_with_priority(OFFLOAD_MBX_IRQ, 1);
+
+    offload_release_core1();
+    /* The first message is the ring address, later ones are doorbells */
+    while (mbx_send_message(OFFLOAD_MBX, ring_sys_addr) != status_success) {
+    }
+    printf("flash service offloaded to core 1\n");
+    return status_success;
+}
+
+flash_service_client_t *msc_flash_offload_get_client(void)
+{
+    return &offload_client;
+}
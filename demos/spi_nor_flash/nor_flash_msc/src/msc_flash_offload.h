@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _MSC_FLASH_OFFLOAD_H
+#define _MSC_FLASH_OFFLOAD_H
+
+#include "hpm_common.h"
+#include "flash_service.h"
+
+/*
+ * Core 0 side of the flash offload (MSC_FLASH_OFFLOAD builds on dual-core parts).
+ *
+ * Places the request ring and bounce buffers in noncacheable memory, loads and releases
+ * core 1, hands it the ring address through the mailbox and attaches the client to the
+ * MSC flash layer. Core 1 rings MBX0B -> MBX0A after every completed request; the mailbox
+ * interrupt wakes the task waiting in the client.
+ */
+
+#define MSC_FLASH_OFFLOAD_WAIT_MS    (2000U)
+
+hpm_stat_t msc_flash_offload_start(void);
+flash_service_client_t *msc_flash_offload_get_client(void);
+
+#endif
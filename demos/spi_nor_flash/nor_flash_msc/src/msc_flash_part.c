@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_mchtmr_drv.h"
+#include "msc_flash_part.h"
+#include "msc_flash_log.h"
+#include "msc_flash_io.h"
+
+#define MSC_FLASH_PART_LINE_SIZE    (4096U)
+#define MSC_FLASH_PART_TAG_INVALID  (0xFFFFFFFFUL)
+
+#if (MSC_LOG_BLOCK_SIZE != MSC_FLASH_DISK_BLOCK_SIZE)
+#error "log blocks must match the disk block size"
+#endif
+
+typedef struct {
+    uint32_t tag[MSC_FLASH_PART_CACHE_LINES];
+    uint32_t age[MSC_FLASH_PART_CACHE_LINES];
+    uint32_t clock;
+} msc_part_cache_t;
+
+typedef struct {
+    msc_part_config_t config;
+    uint32_t block_size;          /* flash sector for the direct policy, MSC_LOG_BLOCK_SIZE for the log */
+    uint32_t block_num;
+    uint32_t disk_start;          /* first disk block of the partition */
+    uint32_t disk_blocks;
+    msc_part_cache_t cache;
+    msc_part_stats_t stats;
+} msc_part_t;
+
+static hpm_serial_nor_t *part_nor;
+static uint32_t part_sector_size;
+static uint8_t part_count;
+static msc_part_t parts[MSC_FLASH_PART_MAX];
+static msc_log_t part_log;
+static uint32_t part_timer_freq_in_hz;
+
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+static uint8_t part_cache_buf[MSC_FLASH_PART_MAX][MSC_FLASH_PART_CACHE_LINES][MSC_FLASH_PART_LINE_SIZE];
+/* Sector merge buffer for partial writes to a partition without cache lines */
+ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(HPM_L1C_CACHELINE_SIZE)
+static uint8_t part_merge_buf[MSC_FLASH_PART_LINE_SIZE];
+
+static hpm_stat_t part_backend_read(msc_part_t *part, uint32_t block, uint8_t *buffer, uint32_t count)
+{
+    hpm_stat_t stat = status_success;
+
+    if (part->config.policy == msc_part_policy_log) {
+        for (uint32_t i = 0; (i < count) && (stat == status_success); i++) {
+            stat = msc_log_read(&part_log, block + i, buffer + i * part->block_size);
+        }
+        return stat;
+    }
+    return msc_flash_io_read(part_nor, buffer, count * part->block_size, part->config.offset + block * part->block_size);
+}
+
+static hpm_stat_t part_backend_write(msc_part_t *part, uint32_t block, const uint8_t *buffer)
+{
+    hpm_stat_t stat;
+    uint32_t addr;
+
+    if (part->config.policy == msc_part_policy_log) {
+        uint32_t erase_before = part_log.erase_count;
+        uint32_t gc_before = part_log.gc_count;
+        stat = msc_log_write(&part_log, block, buffer);
+        part->stats.erase_count += part_log.erase_count - erase_before;
+        part->stats.gc_count += part_log.gc_count - gc_before;
+        return stat;
+    }
+
+    addr = part->config.offset + block * part->block_size;
+    stat = msc_flash_io_erase(part_nor, addr, part->block_size);
+    if (stat != status_success) {
+        return stat;
+    }
+    part->stats.erase_count++;
+    return msc_flash_io_program(part_nor, buffer, part->block_size, addr);
+}
+
+static int32_t part_cache_lookup(msc_part_t *part, uint32_t block)
+{
+    for (uint8_t i = 0; i < part->config.cache_lines; i++) {
+        if (part->cache.tag[i] == block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t part_cache_victim(msc_part_t *part)
+{
+    uint8_t victim = 0;
+
+    for (uint8_t i = 0; i < part->config.cache_lines; i++) {
+        if (part->cache.tag[i] == MSC_FLASH_PART_TAG_INVALID) {
+            return i;
+        }
+        if (part->cache.age[i] < part->cache.age[victim]) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+/* Fill the missed block plus the configured read-ahead window, never evicting the block being served */
+static hpm_stat_t part_cache_fill(msc_part_t *part, uint8_t part_index, uint32_t block, int32_t *line)
+{
+    hpm_stat_t stat;
+    uint32_t last = block + part->config.read_ahead_sectors;
+    uint8_t victim;
+
+    if (last >= part->block_num) {
+        last = part->block_num - 1U;
+    }
+
+    for (uint32_t b = block; b <= last; b++) {
+        if ((b != block) && (part_cache_lookup(part, b) >= 0)) {
+            continue;
+        }
+        victim = part_cache_victim(part);
+        if ((b != block) && (part->cache.tag[victim] == block)) {
+            break;
+        }
+        part->cache.tag[victim] = MSC_FLASH_PART_TAG_INVALID;
+        stat = part_backend_read(part, b, part_cache_buf[part_index][victim], 1);
+        if (stat != status_success) {
+            return stat;
+        }
+        part->cache.tag[victim] = b;
+        /* Prefetched lines age out before the demanded one */
+        part->cache.age[victim] = (b == block) ? ++part->cache.clock : (part->cache.clock - 1U);
+        if (b == block) {
+            *line = victim;
+        }
+    }
+    return status_success;
+}
+
+/* Read a byte range of a partition, offset and length in multiples of the disk block */
+static hpm_stat_t part_read(msc_part_t *part, uint8_t part_index, uint32_t offset, uint8_t *buffer, uint32_t length)
+{
+    hpm_stat_t stat = status_success;
+    uint32_t block;
+    uint32_t start;
+    uint32_t n;
+    int32_t line;
+
+    if (part->config.cache_lines == 0) {
+        if (part->config.policy == msc_part_policy_log) {
+            return part_backend_read(part, offset / part->block_size, buffer, length / part->block_size);
+        }
+        return msc_flash_io_read(part_nor, buffer, length, part->config.offset + offset);
+    }
+
+    while ((length > 0) && (stat == status_success)) {
+        block = offset / part->block_size;
+        start = offset % part->block_size;
+        n = (length < part->block_size - start) ? length : (part->block_size - start);
+        line = part_cache_lookup(part, block);
+        if (line >= 0) {
+            part->stats.cache_hits++;
+            part->cache.age[line] = ++part->cache.clock;
+        } else {
+            part->stats.cache_misses++;
+            stat = part_cache_fill(part, part_index, block, &line);
+        }
+        if (stat == status_success) {
+            memcpy(buffer, part_cache_buf[part_index][line] + start, n);
+        }
+        offset += n;
+        buffer += n;
+        length -= n;
+    }
+    return stat;
+}
+
+/*
+ * Write a byte range of a partition. Whole blocks are written straight from the buffer;
+ * a disk block smaller than a direct partition sector is merged into the cached (or
+ * freshly read) sector, which is then erased and programmed as a whole.
+ */
+static hpm_stat_t part_write(msc_part_t *part, uint8_t part_index, uint32_t offset, const uint8_t *buffer, uint32_t length)
+{
+    hpm_stat_t stat = status_success;
+    uint32_t block;
+    uint32_t start;
+    uint32_t n;
+    int32_t line;
+    uint8_t *merge;
+
+    while ((length > 0) && (stat == status_success)) {
+        block = offset / part->block_size;
+        start = offset % part->block_size;
+        n = (length < part->block_size - start) ? length : (part->block_size - start);
+        line = part_cache_lookup(part, block);
+        if (n == part->block_size) {
+            if (line >= 0) {
+                part->cache.tag[line] = MSC_FLASH_PART_TAG_INVALID;
+            }
+            stat = part_backend_write(part, block, buffer);
+        } else {
+            if ((line < 0) && (part->config.cache_lines > 0)) {
+                stat = part_cache_fill(part, part_index, block, &line);
+            }
+            if (line >= 0) {
+                merge = part_cache_buf[part_index][line];
+                part->cache.age[line] = ++part->cache.clock;
+            } else {
+                merge = part_merge_buf;
+                if (stat == status_success) {
+                    stat = part_backend_read(part, block, merge, 1);
+                }
+            }
+            if (stat == status_success) {
+                memcpy(merge + start, buffer, n);
+                stat = part_backend_write(part, block, merge);
+            }
+        }
+        offset += n;
+        buffer += n;
+        length -= n;
+    }
+    return stat;
+}
+
+/* Partition holding a disk block */
+static int32_t part_find(uint32_t sector)
+{
+    for (uint8_t i = 0; i < part_count; i++) {
+        if ((sector >= parts[i].disk_start) && (sector - parts[i].disk_start < parts[i].disk_blocks)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void part_account(msc_part_stats_t *stats, uint64_t ticks, uint32_t length, bool write)
+{
+    if (write) {
+        stats->write_ticks += ticks;
+        if (ticks > stats->write_max_ticks) {
+            stats->write_max_ticks = (uint32_t)ticks;
+        }
+        stats->write_count++;
+        stats->write_bytes += length;
+    } else {
+        stats->read_ticks += ticks;
+        if (ticks > stats->read_max_ticks) {
+            stats->read_max_ticks = (uint32_t)ticks;
+        }
+        stats->read_count++;
+        stats->read_bytes += length;
+    }
+}
+
+/* Split a disk request at partition boundaries */
+static hpm_stat_t part_access(uint32_t sector, uint8_t *buffer, uint32_t length, bool write)
+{
+    hpm_stat_t stat = status_success;
+    msc_part_t *part;
+    int32_t index;
+    uint32_t n;
+    uint64_t start;
+
+    if ((length % MSC_FLASH_DISK_BLOCK_SIZE) != 0) {
+        return status_invalid_argument;
+    }
+    while ((length > 0) && (stat == status_success)) {
+        index = part_find(sector);
+        if (index < 0) {
+            return status_invalid_argument;
+        }
+        part = &parts[index];
+        if (write && part->config.write_protect) {
+            return status_invalid_argument;
+        }
+        n = (part->disk_start + part->disk_blocks - sector) * MSC_FLASH_DISK_BLOCK_SIZE;
+        n = (length < n) ? length : n;
+
+        start = mchtmr_get_count(HPM_MCHTMR);
+        if (write) {
+            stat = part_write(part, (uint8_t)index, (sector - part->disk_start) * MSC_FLASH_DISK_BLOCK_SIZE, buffer, n);
+        } else {
+            stat = part_read(part, (uint8_t)index, (sector - part->disk_start) * MSC_FLASH_DISK_BLOCK_SIZE, buffer, n);
+        }
+        part_account(&part->stats, mchtmr_get_count(HPM_MCHTMR) - start, n, write);
+
+        sector += n / MSC_FLASH_DISK_BLOCK_SIZE;
+        buffer += n;
+        length -= n;
+    }
+    return stat;
+}
+
+hpm_stat_t msc_flash_part_init(hpm_serial_nor_t *nor, const msc_part_config_t *config, uint8_t part_num)
+{
+    hpm_serial_nor_info_t info;
+    hpm_stat_t stat;
+    bool log_used = false;
+    uint32_t disk_start = 0;
+
+    if ((part_num == 0) || (part_num > MSC_FLASH_PART_MAX)) {
+        return status_invalid_argument;
+    }
+    stat = msc_flash_io_get_info(nor, &info);
+    if (stat != status_success) {
+        return stat;
+    }
+
+    part_nor = nor;
+    part_sector_size = info.sector_size_kbytes * 1024U;
+    part_timer_freq_in_hz = clock_get_frequency(clock_mchtmr0);
+    if ((part_sector_size > MSC_FLASH_PART_LINE_SIZE) || ((part_sector_size % MSC_FLASH_DISK_BLOCK_SIZE) != 0)) {
+        return status_invalid_argument;
+    }
+
+    for (uint8_t i = 0; i < part_num; i++) {
+        msc_part_t *part = &parts[i];
+
+        memset(part, 0, sizeof(*part));
+        part->config = config[i];
+        if (((part->config.offset % part_sector_size) != 0) || ((part->config.size % part_sector_size) != 0) ||
+            (part->config.cache_lines > MSC_FLASH_PART_CACHE_LINES) ||
+            ((part->config.offset + part->config.size) > info.size_in_kbytes * 1024U)) {
+            return status_invalid_argument;
+        }
+        memset(part->cache.tag, 0xFF, sizeof(part->cache.tag));
+
+        if (part->config.policy == msc_part_policy_log) {
+            /* Only one log partition: its mapping tables are sized for a single instance */
+            if (log_used) {
+                return status_invalid_argument;
+            }
+            stat = msc_log_init(&part_log, nor, part->config.offset, part->config.size, part_sector_size);
+            if (stat != status_success) {
+                return stat;
+            }
+            log_used = true;
+            part->block_size = MSC_LOG_BLOCK_SIZE;
+            part->block_num = part_log.block_num;
+        } else {
+            part->block_size = part_sector_size;
+            part->block_num = part->config.size / part_sector_size;
+        }
+        part->disk_start = disk_start;
+        part->disk_blocks = part->block_num * (part->block_size / MSC_FLASH_DISK_BLOCK_SIZE);
+        disk_start += part->disk_blocks;
+    }
+    part_count = part_num;
+    return status_success;
+}
+
+uint8_t msc_flash_part_get_num(void)
+{
+    return part_count;
+}
+
+void msc_flash_part_get_cap(uint32_t *block_num, uint16_t *block_size)
+{
+    *block_num = (part_count == 0) ? 0 : (parts[part_count - 1U].disk_start + parts[part_count - 1U].disk_blocks);
+    *block_size = MSC_FLASH_DISK_BLOCK_SIZE;
+}
+
+hpm_stat_t msc_flash_part_read(uint32_t sector, uint8_t *buffer, uint32_t length)
+{
+    return part_access(sector, buffer, length, false);
+}
+
+hpm_stat_t msc_flash_part_write(uint32_t sector, const uint8_t *buffer, uint32_t length)
+{
+    return part_access(sector, (uint8_t *)buffer, length, true);
+}
+
+void msc_flash_part_get_stats(uint8_t part, msc_part_stats_t *stats)
+{
+    if (part < part_count) {
+        *stats = parts[part].stats;
+    }
+}
+
+static uint32_t part_ticks_to_us(uint64_t ticks)
+{
+    return (uint32_t)(ticks * 1000000U / part_timer_freq_in_hz);
+}
+
+static uint32_t part_kbytes_per_second(uint64_t bytes, uint64_t ticks)
+{
+    if (ticks == 0) {
+        return 0;
+    }
+    return (uint32_t)((bytes * part_timer_freq_in_hz) / ticks / 1024U);
+}
+
+void msc_flash_part_print_stats(void)
+{
+    msc_part_stats_t s;
+    uint32_t min_erase, max_erase;
+
+    for (uint8_t i = 0; i < part_count; i++) {
+        msc_flash_part_get_stats(i, &s);
+        printf("part%d[%s]: read %lu KB @ %lu KB/s, write %lu KB @ %lu KB/s, cache hit %lu miss %lu, erase %lu, gc %lu\n",
+               i, parts[i].config.name,
+               (uint32_t)(s.read_bytes / 1024U), part_kbytes_per_second(s.read_bytes, s.read_ticks),
+               (uint32_t)(s.write_bytes / 1024U), part_kbytes_per_second(s.write_bytes, s.write_ticks),
+               s.cache_hits, s.cache_misses, s.erase_count, s.gc_count);
+        printf("part%d[%s]: read latency avg %lu us max %lu us, write latency avg %lu us max %lu us\n",
+               i, parts[i].config.name,
+               (s.read_count == 0) ? 0 : part_ticks_to_us(s.read_ticks / s.read_count), part_ticks_to_us(s.read_max_ticks),
+               (s.write_count == 0) ? 0 : part_ticks_to_us(s.write_ticks / s.write_count), part_ticks_to_us(s.write_max_ticks));
+        if (parts[i].config.policy == msc_part_policy_log) {
+            msc_log_get_wear(&part_log, &min_erase, &max_erase);
+            printf("part%d[%s]: sector erase count min %lu max %lu\n", i, parts[i].config.name, min_erase, max_erase);
+        }
+    }
+}
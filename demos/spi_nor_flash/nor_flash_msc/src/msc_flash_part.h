@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _MSC_FLASH_PART_H
+#define _MSC_FLASH_PART_H
+
+#include "hpm_common.h"
+#include "hpm_serial_nor.h"
+
+/*
+ * Flash partitions behind a single MSC disk.
+ *
+ * The MSC interface of the pinned cherryusb passes no LUN to the sector callbacks, so
+ * the partitions are laid out back to back in the order of the table as one disk of
+ * MSC_FLASH_DISK_BLOCK_SIZE blocks. Each partition keeps its own storage policy and
+ * statistics; a request crossing a partition boundary is split between them.
+ */
+
+#define MSC_FLASH_PART_MAX           (2U)
+#define MSC_FLASH_PART_CACHE_LINES   (4U)
+#define MSC_FLASH_DISK_BLOCK_SIZE    (512U)
+
+typedef enum {
+    msc_part_policy_direct = 0,  /* 1:1 mapping, erase + program on every write, read-modify-write below a sector */
+    msc_part_policy_log,         /* log-structured, wear-levelled, GC confined to the partition */
+} msc_part_policy_t;
+
+typedef struct {
+    const char *name;
+    uint32_t offset;              /* partition start in flash, sector aligned */
+    uint32_t size;                /* partition size in bytes, sector aligned */
+    msc_part_policy_t policy;
+    uint8_t cache_lines;          /* read cache lines (sector sized), 0 disables the cache */
+    uint8_t read_ahead_sectors;   /* sectors prefetched on a cache miss */
+    bool write_protect;
+} msc_part_config_t;
+
+typedef struct {
+    uint32_t read_count;
+    uint32_t write_count;
+    uint64_t read_bytes;
+    uint64_t write_bytes;
+    uint64_t read_ticks;          /* mchtmr ticks spent in read callbacks */
+    uint64_t write_ticks;         /* mchtmr ticks spent in write callbacks */
+    uint32_t read_max_ticks;      /* longest read callback, the worst stall seen by USB */
+    uint32_t write_max_ticks;     /* longest write callback */
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+    uint32_t erase_count;
+    uint32_t gc_count;
+} msc_part_stats_t;
+
+hpm_stat_t msc_flash_part_init(hpm_serial_nor_t *nor, const msc_part_config_t *config, uint8_t part_num);
+uint8_t msc_flash_part_get_num(void);
+void msc_flash_part_get_cap(uint32_t *block_num, uint16_t *block_size);
+hpm_stat_t msc_flash_part_read(uint32_t sector, uint8_t *buffer, uint32_t length);
+hpm_stat_t msc_flash_part_write(uint32_t sector, const uint8_t *buffer, uint32_t length);
+void msc_flash_part_get_stats(uint8_t part, msc_part_stats_t *stats);
+void msc_flash_part_print_stats(void);
+
+#endif
@@ -9,6 +9,8 @@
 #include "usbd_msc.h"
 #include "hpm_serial_nor.h"
 #include "hpm_l1c_drv.h"
+#include "msc_flash_part.h"
+#include "msc_flash_io.h"
 #define MSC_IN_EP  0x81
 #define MSC_OUT_EP 0x02
 
@@ -103,36 +105,49 @@ void usbd_configure_done_callback(void)
     /* do nothing */
 }
 
-#define BLOCK_SIZE      (512)
-#define BLOCK_COUNT     (10)
+#define LOG_PARTITION_SIZE  (1024U * 1024U)
 
-static hpm_serial_nor_info_t spi_flash_info;
 extern hpm_serial_nor_t nor_flash_dev;
 
-typedef struct {
-    uint8_t BlockSpace[BLOCK_SIZE];
-} BLOCK_TYPE;
-
-BLOCK_TYPE mass_block[BLOCK_COUNT];
+/*
+ * One MSC disk, partitions in table order. The log partition comes first so that the
+ * file system metadata at the start of the disk (boot sector, FAT, root directory),
+ * which is rewritten on every file change, lands in the log-structured, wear-levelled
+ * area at the top of the chip. The read-mostly asset partition follows, cached with
+ * read-ahead and erased in place, and its erase traffic never touches the log area.
+ *
+ * Deviation: the partitions share one LUN instead of being separate LUNs, because the
+ * sector callbacks of the pinned cherryusb take no LUN argument (see README.md).
+ */
+static msc_part_config_t msc_part_config[MSC_FLASH_PART_MAX] = {
+    {
+        .name = "log",
+        .policy = msc_part_policy_log,
+        .cache_lines = 0,
+        .read_ahead_sectors = 0,
+    },
+    {
+        .name = "asset",
+        .policy = msc_part_policy_direct,
+        .cache_lines = MSC_FLASH_PART_CACHE_LINES,
+        .read_ahead_sectors = 2,
+    },
+};
 
 void usbd_msc_get_cap(uint8_t lun, uint32_t *block_num, uint16_t *block_size)
 {
-    *block_num = (spi_flash_info.size_in_kbytes) / spi_flash_info.sector_size_kbytes; /* Pretend having so many buffer,not has actually. */
-    *block_size = spi_flash_info.sector_size_kbytes * 1024;
+    (void)lun;
+    msc_flash_part_get_cap(block_num, block_size);
 }
+
 int usbd_msc_sector_read(uint32_t sector, uint8_t *buffer, uint32_t length)
 {
-    hpm_stat_t stat;
-    stat = hpm_serial_nor_read(&nor_flash_dev, buffer, length, sector * spi_flash_info.sector_size_kbytes * 1024);
-    return (stat == status_success) ? 0 : -1;
+    return (msc_flash_part_read(sector, buffer, length) == status_success) ? 0 : -1;
 }
 
 int usbd_msc_sector_write(uint32_t sector, uint8_t *buffer, uint32_t length)
 {
-    hpm_stat_t stat;
-    stat = hpm_serial_nor_erase_blocking(&nor_flash_dev, sector * spi_flash_info.sector_size_kbytes * 1024, length);
-    stat = hpm_serial_nor_program_blocking(&nor_flash_dev, buffer, length, sector * spi_flash_info.sector_size_kbytes * 1024);
-    return (stat == status_success) ? 0 : -1;
+    return (msc_flash_part_write(sector, buffer, length) == status_success) ? 0 : -1;
 }
 
 /* function ------------------------------------------------------------------*/
@@ -146,7 +161,20 @@ struct usbd_interface intf0;
 
 void msc_spi_flash_init(void)
 {
-    hpm_serial_nor_get_info(&nor_flash_dev, &spi_flash_info);
+    hpm_serial_nor_info_t spi_flash_info;
+    uint32_t flash_size;
+
+    msc_flash_io_get_info(&nor_flash_dev, &spi_flash_info);
+    flash_size = spi_flash_info.size_in_kbytes * 1024U;
+    msc_part_config[0].offset = flash_size - LOG_PARTITION_SIZE;
+    msc_part_config[0].size = LOG_PARTITION_SIZE;
+    msc_part_config[1].offset = 0;
+    msc_part_config[1].size = flash_size - LOG_PARTITION_SIZE;
+    if (msc_flash_part_init(&nor_flash_dev, msc_part_config, MSC_FLASH_PART_MAX) != status_success) {
+        printf("msc partition init failed\n");
+        return;
+    }
+
     usbd_desc_register(msc_ram_descriptor);
     usbd_add_interface(usbd_msc_init_intf(&intf0, MSC_OUT_EP, MSC_IN_EP));
 
@@ -75,7 +75,12 @@
 #define CONFIG_USBDEV_MSC_VERSION_STRING "0.01"
 #endif
 
+/* With the flash offloaded, run the MSC callbacks in a thread so they can block on the flash service */
+#if defined(MSC_FLASH_OFFLOAD) && MSC_FLASH_OFFLOAD
+#define CONFIG_USBDEV_MSC_THREAD
+#else
 /* #define CONFIG_USBDEV_MSC_THREAD */
+#endif
 
 #ifndef CONFIG_USBDEV_MSC_PRIO
 #define CONFIG_USBDEV_MSC_PRIO 4
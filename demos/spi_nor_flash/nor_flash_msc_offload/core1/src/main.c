@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "board.h"
+#include "hpm_mbx_drv.h"
+#include "hpm_serial_nor.h"
+#include "hpm_serial_nor_host_port.h"
+#include "flash_service.h"
+
+#define SERVICE_MBX              HPM_MBX0B
+#define SERVICE_MBX_IRQ          IRQn_MBX0B
+
+hpm_serial_nor_t nor_flash_dev = {0};
+static flash_service_server_t service_server;
+static volatile bool service_doorbell_pending;
+
+SDK_DECLARE_EXT_ISR_M(SERVICE_MBX_IRQ, isr_service_mbx)
+void isr_service_mbx(void)
+{
+    uint32_t msg;
+
+    /* Doorbells only wake the service loop, the ring says what to do */
+    while (mbx_retrieve_message(SERVICE_MBX, &msg) == status_success) {
+    }
+    service_doorbell_pending = true;
+}
+
+static void service_doorbell(void *context)
+{
+    (void)context;
+    /* A full TX word means core 0 has an unread doorbell already */
+    (void)mbx_send_message(SERVICE_MBX, 0);
+}
+
+int main(void)
+{
+    hpm_serial_nor_info_t flash_info;
+    hpm_stat_t stat;
+    uint32_t ring_sys_addr;
+    uint32_t level;
+
+    board_init_core1();
+    mbx_init(SERVICE_MBX);
+    /* The first message from core 0 is the ring address */
+    while (mbx_retrieve_message(SERVICE_MBX, &ring_sys_addr) != status_success) {
+    }
+
+    stat = serial_nor_get_board_host(&nor_flash_dev.host);
+    if (stat == status_success) {
+        board_init_spi_clock(nor_flash_dev.host.host_param.param.host_base);
+        serial_nor_spi_pins_init(nor_flash_dev.host.host_param.param.host_base);
+        stat = hpm_serial_nor_init(&nor_flash_dev, &flash_info);
+    }
+    /* Publish the result either way, core 0 reports the failure */
+    flash_service_server_init(&service_server, (flash_service_ring_t *)ring_sys_addr, &nor_flash_dev, stat,
+                              service_doorbell, NULL);
+
+    mbx_enable_intr(SERVICE_MBX, MBX_CR_RWMVIE_MASK);
+    intc_m_enable_irq_with_priority(SERVICE_MBX_IRQ, 1);
+
+    while (1) {
+        service_doorbell_pending = false;
+        if (flash_service_server_poll(&service_server)) {
+            continue;
+        }
+        /* A doorbell that lands after the flag was cleared skips the sleep and triggers another poll */
+        level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+        if (!service_doorbell_pending) {
+            __asm volatile("wfi");
+        }
+        restore_global_irq(level);
+    }
+    return 0;
+}